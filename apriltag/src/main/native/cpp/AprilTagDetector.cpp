@@ -4,6 +4,7 @@
 
 #include "frc/apriltag/AprilTagDetector.h"
 
+#include <atomic>
 #include <cmath>
 #include <utility>
 
@@ -21,23 +22,43 @@
 
 using namespace frc;
 
+namespace {
+// Detections array shared by a detector and the last Results it returned.
+// The detector reuses it once that Results is destroyed.
+struct ResultsStorage {
+  ResultsStorage() : detections{zarray_create(sizeof(apriltag_detection_t*))} {}
+  ~ResultsStorage() { apriltag_detections_destroy(detections); }
+
+  zarray_t* detections;
+  std::atomic<int> refs{1};
+};
+}  // namespace
+
+static void ReleaseResultsStorage(void* impl) {
+  auto storage = static_cast<ResultsStorage*>(impl);
+  if (storage && storage->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete storage;
+  }
+}
+
 AprilTagDetector::Results::Results(void* impl, const private_init&)
     : span{reinterpret_cast<AprilTagDetection**>(
-               static_cast<zarray_t*>(impl)->data),
-           static_cast<size_t>(static_cast<zarray_t*>(impl)->size)},
+               static_cast<ResultsStorage*>(impl)->detections->data),
+           static_cast<size_t>(
+               static_cast<ResultsStorage*>(impl)->detections->size)},
       m_impl{impl} {}
 
 AprilTagDetector::Results& AprilTagDetector::Results::operator=(Results&& rhs) {
   Destroy();
+  span::operator=(rhs);
   m_impl = rhs.m_impl;
+  static_cast<span&>(rhs) = {};
   rhs.m_impl = nullptr;
   return *this;
 }
 
 void AprilTagDetector::Results::Destroy() {
-  if (m_impl) {
-    apriltag_detections_destroy(static_cast<zarray_t*>(m_impl));
-  }
+  ReleaseResultsStorage(m_impl);
 }
 
 AprilTagDetector::AprilTagDetector() : m_impl{apriltag_detector_create()} {
@@ -48,6 +69,8 @@ AprilTagDetector& AprilTagDetector::operator=(AprilTagDetector&& rhs) {
   Destroy();
   m_impl = rhs.m_impl;
   rhs.m_impl = nullptr;
+  m_results = rhs.m_results;
+  rhs.m_results = nullptr;
   m_families = std::move(rhs.m_families);
   rhs.m_families.clear();
   m_qtpCriticalAngle = rhs.m_qtpCriticalAngle;
@@ -143,16 +166,34 @@ void AprilTagDetector::ClearFamilies() {
 
 AprilTagDetector::Results AprilTagDetector::Detect(int width, int height,
                                                    int stride, uint8_t* buf) {
+  return Detect(width, height, stride, buf, nullptr);
+}
+
+AprilTagDetector::Results AprilTagDetector::Detect(int width, int height,
+                                                   int stride, uint8_t* buf,
+                                                   void* workerpool) {
+  auto storage = static_cast<ResultsStorage*>(m_results);
+  if (!storage || storage->refs.load(std::memory_order_acquire) != 1) {
+    // the previous Results is still alive, so leave the storage to it
+    ReleaseResultsStorage(storage);
+    storage = new ResultsStorage;
+    m_results = storage;
+  }
+
+  auto td = static_cast<apriltag_detector_t*>(m_impl);
+  td->shared_wp = static_cast<workerpool_t*>(workerpool);
   image_u8_t img{width, height, stride, buf};
-  return {
-      apriltag_detector_detect(static_cast<apriltag_detector_t*>(m_impl), &img),
-      Results::private_init{}};
+  apriltag_detector_detect_into(td, &img, storage->detections);
+  td->shared_wp = nullptr;
+  storage->refs.fetch_add(1, std::memory_order_relaxed);
+  return {storage, Results::private_init{}};
 }
 
 void AprilTagDetector::Destroy() {
   if (m_impl) {
     apriltag_detector_destroy(static_cast<apriltag_detector_t*>(m_impl));
   }
+  ReleaseResultsStorage(m_results);
   DestroyFamilies();
 }
 
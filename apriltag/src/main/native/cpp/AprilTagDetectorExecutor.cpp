@@ -0,0 +1,143 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc/apriltag/AprilTagDetectorExecutor.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#pragma warning(disable : 4200)
+#elif defined(__clang__)
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#elif defined(__GNUC__)
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+#include "apriltag.h"
+
+using namespace frc;
+
+struct AprilTagDetectorExecutor::TaskGroup {
+  workerpool_t* workerpool;
+  int ntasks;
+  int next = 0;
+  int done = 0;
+};
+
+AprilTagDetectorExecutor::AprilTagDetectorExecutor(int numThreads) {
+  numThreads = std::max(numThreads, 1);
+  auto dispatch = [](void* user, workerpool_t* wp, int ntasks) {
+    static_cast<AprilTagDetectorExecutor*>(user)->RunTasks(wp, ntasks);
+  };
+  for (int i = 0; i < numThreads; ++i) {
+    m_workerpools.emplace_back(
+        workerpool_create_external(numThreads, dispatch, this));
+  }
+  for (auto workerpool : m_workerpools) {
+    m_workers.emplace_back([this, workerpool] { WorkerMain(workerpool); });
+  }
+}
+
+AprilTagDetectorExecutor::~AprilTagDetectorExecutor() {
+  {
+    std::scoped_lock lock{m_mutex};
+    m_shutdown = true;
+  }
+  m_workCv.notify_all();
+  for (auto&& worker : m_workers) {
+    worker.join();
+  }
+  for (auto workerpool : m_workerpools) {
+    workerpool_destroy(static_cast<workerpool_t*>(workerpool));
+  }
+}
+
+std::future<AprilTagDetector::Results> AprilTagDetectorExecutor::Submit(
+    AprilTagDetector& detector, const Frame& frame) {
+  std::promise<AprilTagDetector::Results> promise;
+  auto future = promise.get_future();
+  {
+    std::scoped_lock lock{m_mutex};
+    m_jobs.push_back({&detector, frame, std::move(promise)});
+  }
+  m_workCv.notify_one();
+  return future;
+}
+
+void AprilTagDetectorExecutor::WorkerMain(void* workerpool) {
+  std::unique_lock lock{m_mutex};
+  for (;;) {
+    // Help frames that are already in progress first
+    if (!m_taskGroups.empty()) {
+      RunTask(lock, m_taskGroups.front());
+      continue;
+    }
+
+    // Otherwise start the oldest frame whose detector is free
+    auto job = std::find_if(m_jobs.begin(), m_jobs.end(), [&](auto& job) {
+      return std::find(m_busy.begin(), m_busy.end(), job.detector) ==
+             m_busy.end();
+    });
+    if (job != m_jobs.end()) {
+      Job current = std::move(*job);
+      m_jobs.erase(job);
+      m_busy.emplace_back(current.detector);
+      lock.unlock();
+
+      auto& frame = current.frame;
+      auto results = current.detector->Detect(frame.width, frame.height,
+                                              frame.stride, frame.buf,
+                                              workerpool);
+
+      lock.lock();
+      std::erase(m_busy, current.detector);
+      if (!m_jobs.empty()) {
+        // a later frame for this detector may have been waiting on it
+        m_workCv.notify_all();
+      }
+      lock.unlock();
+      current.promise.set_value(std::move(results));
+      lock.lock();
+      continue;
+    }
+
+    if (m_shutdown && m_jobs.empty()) {
+      return;
+    }
+    m_workCv.wait(lock);
+  }
+}
+
+void AprilTagDetectorExecutor::RunTasks(void* workerpool, int ntasks) {
+  TaskGroup group{static_cast<workerpool_t*>(workerpool), ntasks};
+  std::unique_lock lock{m_mutex};
+  if (ntasks > 1) {
+    m_taskGroups.emplace_back(&group);
+    m_workCv.notify_all();
+  }
+
+  // The frame's own thread works on its tasks too, so the frame makes
+  // progress even when every other thread is busy
+  while (group.next < group.ntasks) {
+    RunTask(lock, &group);
+  }
+  m_tasksDoneCv.wait(lock, [&] { return group.done == group.ntasks; });
+}
+
+void AprilTagDetectorExecutor::RunTask(std::unique_lock<wpi::mutex>& lock,
+                                       TaskGroup* group) {
+  int i = group->next++;
+  if (group->next == group->ntasks) {
+    std::erase(m_taskGroups, group);
+  }
+  lock.unlock();
+  workerpool_run_task(group->workerpool, i);
+  lock.lock();
+  if (++group->done == group->ntasks) {
+    m_tasksDoneCv.notify_all();
+  }
+}
@@ -42,16 +42,20 @@ static Eigen::Matrix3d OrthogonalizeRotationMatrix(
   return Q;
 }
 
+// Converts pose and frees its matrices
 static Transform3d MakePose(const apriltag_pose_t& pose) {
-  if (!pose.R || !pose.t) {
-    return {};
-  }
-  return {Translation3d{units::meter_t{pose.t->data[0]},
+  Transform3d rv;
+  if (pose.R && pose.t) {
+    rv = {Translation3d{units::meter_t{pose.t->data[0]},
                         units::meter_t{pose.t->data[1]},
                         units::meter_t{pose.t->data[2]}},
           Rotation3d{OrthogonalizeRotationMatrix(
               Eigen::Map<Eigen::Matrix<double, 3, 3, Eigen::RowMajor>>{
                   pose.R->data})}};
+  }
+  matd_destroy(pose.R);
+  matd_destroy(pose.t);
+  return rv;
 }
 
 static apriltag_detection_info_t MakeDetectionInfo(
@@ -103,6 +107,17 @@ Transform3d AprilTagPoseEstimator::EstimateHomography(
   return rv;
 }
 
+std::vector<Transform3d> AprilTagPoseEstimator::EstimateHomography(
+    std::span<const AprilTagDetection* const> detections) const {
+  std::vector<Transform3d> rv;
+  rv.reserve(detections.size());
+  for (auto detection : detections) {
+    rv.emplace_back(DoEstimateHomography(
+        reinterpret_cast<const apriltag_detection_t*>(detection), m_config));
+  }
+  return rv;
+}
+
 static AprilTagPoseEstimate DoEstimateOrthogonalIteration(
     const apriltag_detection_t* detection,
     const AprilTagPoseEstimator::Config& config, int nIters) {
@@ -130,6 +145,19 @@ AprilTagPoseEstimate AprilTagPoseEstimator::EstimateOrthogonalIteration(
   return rv;
 }
 
+std::vector<AprilTagPoseEstimate>
+AprilTagPoseEstimator::EstimateOrthogonalIteration(
+    std::span<const AprilTagDetection* const> detections, int nIters) const {
+  std::vector<AprilTagPoseEstimate> rv;
+  rv.reserve(detections.size());
+  for (auto detection : detections) {
+    rv.emplace_back(DoEstimateOrthogonalIteration(
+        reinterpret_cast<const apriltag_detection_t*>(detection), m_config,
+        nIters));
+  }
+  return rv;
+}
+
 static Transform3d DoEstimate(const apriltag_detection_t* detection,
                               const AprilTagPoseEstimator::Config& config) {
   auto info = MakeDetectionInfo(detection, config);
@@ -152,3 +180,14 @@ Transform3d AprilTagPoseEstimator::Estimate(
   matd_destroy(detection.H);
   return rv;
 }
+
+std::vector<Transform3d> AprilTagPoseEstimator::Estimate(
+    std::span<const AprilTagDetection* const> detections) const {
+  std::vector<Transform3d> rv;
+  rv.reserve(detections.size());
+  for (auto detection : detections) {
+    rv.emplace_back(DoEstimate(
+        reinterpret_cast<const apriltag_detection_t*>(detection), m_config));
+  }
+  return rv;
+}
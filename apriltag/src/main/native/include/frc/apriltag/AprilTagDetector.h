@@ -32,7 +32,8 @@ class WPILIB_DLLEXPORT AprilTagDetector {
 
     /**
      * How many threads should be used for computation. Default is
-     * single-threaded operation (1 thread).
+     * single-threaded operation (1 thread). Ignored for frames run through
+     * an AprilTagDetectorExecutor, which uses its own threads.
      */
     int numThreads = 1;
 
@@ -127,6 +128,11 @@ class WPILIB_DLLEXPORT AprilTagDetector {
   /**
    * Array of detection results. Each array element is a pointer to an
    * AprilTagDetection.
+   *
+   * The detector reuses the storage of the last Results it returned once
+   * that Results is destroyed, so destroying it before the next Detect()
+   * call avoids allocating. Results that are still alive remain valid after
+   * later Detect() calls.
    */
   class WPILIB_DLLEXPORT Results
       : public std::span<AprilTagDetection const* const> {
@@ -155,9 +161,11 @@ class WPILIB_DLLEXPORT AprilTagDetector {
   AprilTagDetector& operator=(const AprilTagDetector&) = delete;
   AprilTagDetector(AprilTagDetector&& rhs)
       : m_impl{rhs.m_impl},
+        m_results{rhs.m_results},
         m_families{std::move(rhs.m_families)},
         m_qtpCriticalAngle{rhs.m_qtpCriticalAngle} {
     rhs.m_impl = nullptr;
+    rhs.m_results = nullptr;
   }
   AprilTagDetector& operator=(AprilTagDetector&& rhs);
 
@@ -228,6 +236,12 @@ class WPILIB_DLLEXPORT AprilTagDetector {
    * Detect tags from an 8-bit image.
    * The image must be grayscale.
    *
+   * The scratch buffers (thresholded image, union-find storage, candidate
+   * clusters, quads and detections) are kept by the detector and reused by
+   * later calls. Once they have grown to fit the scene, and if the previous
+   * Results has been destroyed, detecting doesn't allocate with the default
+   * configuration (deglitching, blurring and debug output still do).
+   *
    * @param width width of the image
    * @param height height of the image
    * @param stride number of bytes between image rows (often the same as width)
@@ -250,11 +264,19 @@ class WPILIB_DLLEXPORT AprilTagDetector {
   }
 
  private:
+  friend class AprilTagDetectorExecutor;
+
+  // Runs the detector's tasks on the given apriltag workerpool instead of
+  // its own (nullptr for its own).
+  Results Detect(int width, int height, int stride, uint8_t* buf,
+                 void* workerpool);
+
   void Destroy();
   void DestroyFamilies();
   void DestroyFamily(std::string_view name, void* data);
 
   void* m_impl;
+  void* m_results = nullptr;
   wpi::StringMap<void*> m_families;
   units::radian_t m_qtpCriticalAngle = 10_deg;
 };
@@ -0,0 +1,127 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <wpi/SymbolExports.h>
+#include <wpi/condition_variable.h>
+#include <wpi/mutex.h>
+
+#include "frc/apriltag/AprilTagDetector.h"
+
+namespace frc {
+
+/**
+ * Runs detection for several AprilTagDetector instances (typically one per
+ * camera) on one shared pool of threads.
+ *
+ * Giving each detector its own worker pool through
+ * AprilTagDetector::Config::numThreads oversubscribes the processor when
+ * several cameras are handled at once. Instead, submit each camera's frames
+ * with Submit() as they arrive. A frame starts as soon as a pool thread is
+ * free, and the detector's parallel steps (thresholding, connected
+ * components, clustering, quad fitting and decoding) are split into tasks
+ * that run on all of the pool's threads. Threads finish the tasks of frames
+ * already in progress before starting new frames, so a frame's latency stays
+ * close to what it would be with a dedicated pool.
+ */
+class WPILIB_DLLEXPORT AprilTagDetectorExecutor {
+ public:
+  /** A grayscale image to run through a detector. */
+  struct Frame {
+    /** Width of the image. */
+    int width;
+
+    /** Height of the image. */
+    int height;
+
+    /** Number of bytes between image rows. */
+    int stride;
+
+    /** Grayscale image buffer. */
+    uint8_t* buf;
+  };
+
+  /**
+   * Creates an executor.
+   *
+   * @param numThreads Number of threads used for detection. Values less than
+   *                   1 are treated as 1.
+   */
+  explicit AprilTagDetectorExecutor(int numThreads);
+
+  /**
+   * Destroys the executor. Frames that are still queued are processed first.
+   */
+  ~AprilTagDetectorExecutor();
+
+  AprilTagDetectorExecutor(const AprilTagDetectorExecutor&) = delete;
+  AprilTagDetectorExecutor& operator=(const AprilTagDetectorExecutor&) =
+      delete;
+
+  /**
+   * Gets the number of threads used for detection.
+   *
+   * @return Number of threads
+   */
+  int GetNumThreads() const { return m_workers.size(); }
+
+  /**
+   * Queues a frame for detection without waiting for it.
+   *
+   * Frames for the same detector are processed one at a time, in the order
+   * they were submitted; frames for different detectors run concurrently.
+   * The detector must not be used directly, and it and the image buffer must
+   * remain valid, until the returned future is ready.
+   *
+   * @param detector Detector to use
+   * @param frame Frame to process
+   * @return Future for the detection results
+   */
+  std::future<AprilTagDetector::Results> Submit(AprilTagDetector& detector,
+                                                const Frame& frame);
+
+ private:
+  struct Job {
+    AprilTagDetector* detector;
+    Frame frame;
+    std::promise<AprilTagDetector::Results> promise;
+  };
+
+  // The tasks of one parallel step of a frame
+  struct TaskGroup;
+
+  void WorkerMain(void* workerpool);
+  void RunTasks(void* workerpool, int ntasks);
+  void RunTask(std::unique_lock<wpi::mutex>& lock, TaskGroup* group);
+
+  wpi::mutex m_mutex;
+  wpi::condition_variable m_workCv;
+  wpi::condition_variable m_tasksDoneCv;
+  bool m_shutdown = false;
+
+  // Frames waiting for a thread
+  std::deque<Job> m_jobs;
+
+  // Detectors with a frame in progress
+  std::vector<AprilTagDetector*> m_busy;
+
+  // Task groups with tasks not yet started, oldest first
+  std::vector<TaskGroup*> m_taskGroups;
+
+  // One apriltag workerpool per thread, which hands the tasks of the frame
+  // that thread is processing to the whole pool
+  std::vector<void*> m_workerpools;
+  std::vector<std::thread> m_workers;
+};
+
+}  // namespace frc
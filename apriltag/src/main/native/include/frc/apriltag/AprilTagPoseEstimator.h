@@ -5,6 +5,7 @@
 #pragma once
 
 #include <span>
+#include <vector>
 
 #include <units/length.h>
 #include <wpi/SymbolExports.h>
@@ -76,6 +77,16 @@ class WPILIB_DLLEXPORT AprilTagPoseEstimator {
    */
   Transform3d EstimateHomography(std::span<const double, 9> homography) const;
 
+  /**
+   * Estimates the poses of several tags, such as all of the detections from a
+   * frame, using the homography method described in [1].
+   *
+   * @param detections Tag detections
+   * @return Pose estimates, in the same order as detections
+   */
+  std::vector<Transform3d> EstimateHomography(
+      std::span<const AprilTagDetection* const> detections) const;
+
   /**
    * Estimates the pose of the tag. This returns one or two possible poses for
    * the tag, along with the object-space error of each.
@@ -116,6 +127,17 @@ class WPILIB_DLLEXPORT AprilTagPoseEstimator {
       std::span<const double, 9> homography, std::span<const double, 8> corners,
       int nIters) const;
 
+  /**
+   * Estimates the poses of several tags, such as all of the detections from a
+   * frame. See EstimateOrthogonalIteration(const AprilTagDetection&, int).
+   *
+   * @param detections Tag detections
+   * @param nIters Number of iterations
+   * @return Pose estimates, in the same order as detections
+   */
+  std::vector<AprilTagPoseEstimate> EstimateOrthogonalIteration(
+      std::span<const AprilTagDetection* const> detections, int nIters) const;
+
   /**
    * Estimates tag pose. This method is an easier to use interface to
    * EstimatePoseOrthogonalIteration(), running 50 iterations and returning the
@@ -138,6 +160,16 @@ class WPILIB_DLLEXPORT AprilTagPoseEstimator {
   Transform3d Estimate(std::span<const double, 9> homography,
                        std::span<const double, 8> corners) const;
 
+  /**
+   * Estimates the poses of several tags, such as all of the detections from a
+   * frame. See Estimate(const AprilTagDetection&).
+   *
+   * @param detections Tag detections
+   * @return Pose estimates, in the same order as detections
+   */
+  std::vector<Transform3d> Estimate(
+      std::span<const AprilTagDetection* const> detections) const;
+
  private:
   Config m_config;
 };
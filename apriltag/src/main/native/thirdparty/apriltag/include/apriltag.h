@@ -186,8 +186,32 @@ struct apriltag_detector
     // Used to manage multi-threading.
     workerpool_t *wp;
 
+    // When non-NULL, tasks run on this workerpool instead of wp and
+    // nthreads is ignored. This lets several detectors share one set
+    // of threads (see workerpool_create_external()). Not destroyed by
+    // apriltag_detector_destroy().
+    workerpool_t *shared_wp;
+
     // Used for thread safety.
     pthread_mutex_t mutex;
+
+    // Image-sized scratch buffers used by the quad detector. These are
+    // kept between calls to apriltag_detector_detect() and only
+    // reallocated when a frame needs more space than the previous ones.
+    struct apriltag_quad_thresh_buffers *qtb;
+
+    // Per-frame storage, also kept between calls and cleared rather
+    // than freed, so that detecting in a frame like the previous one
+    // doesn't allocate.
+    image_u8_t *quad_im;       // decimated image
+    zarray_t *quads;           // struct quad
+    zarray_t *quad_matrices;   // matd_t*, 3x3; the quads' H and Hinv
+    struct quad_decode_task *decode_tasks;
+    int decode_tasks_capacity;
+
+    // apriltag_detection_t* that are not in any detections array, for
+    // reuse by apriltag_detector_detect_into().
+    zarray_t *detection_pool;
 };
 
 // Represents the detection of a tag. These are returned to the user
@@ -261,6 +285,12 @@ void apriltag_detector_destroy(apriltag_detector_t *td);
 // _detection_destroy and zarray_destroy yourself.
 zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig);
 
+// Detect tags from an image, like apriltag_detector_detect(), but store
+// the detections in an existing array of apriltag_detection_t*. The
+// detections already in the array are taken over by the detector and
+// reused, so keeping one array across frames avoids allocating.
+void apriltag_detector_detect_into(apriltag_detector_t *td, image_u8_t *im_orig, zarray_t *detections);
+
 // Call this method on each of the tags returned by apriltag_detector_detect
 void apriltag_detection_destroy(apriltag_detection_t *det);
 
@@ -271,6 +301,18 @@ void apriltag_detections_destroy(zarray_t *detections);
 // Caller is responsible for calling image_u8_destroy on the image
 image_u8_t *apriltag_to_image(apriltag_family_t *fam, uint32_t idx);
 
+// The tile min/max, adaptive threshold and union-find stages of the
+// quad detector have SIMD implementations (SSE2/AVX2 on x86, NEON on
+// ARM) which are picked at runtime based on what the CPU supports.
+// They produce bit-identical results to the scalar code. Passing 0
+// forces the scalar fallback for all detectors in the process; this
+// is mostly useful for testing and benchmarking.
+void apriltag_set_simd_enabled(int enabled);
+
+// Returns the name of the instruction set currently used by the
+// quad detector ("avx2", "sse2", "neon" or "scalar").
+const char *apriltag_get_simd_name(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -73,6 +73,10 @@ void image_u8_gaussian_blur(image_u8_t *im, double sigma, int k);
 // 1.5, 2, 3, 4, ... supported
 image_u8_t *image_u8_decimate(image_u8_t *im, float factor);
 
+// Like image_u8_decimate(), but stores the result in *decim, which is
+// reused if it already has the right size and replaced otherwise.
+void image_u8_decimate_reuse(image_u8_t *im, float factor, image_u8_t **decim);
+
 void image_u8_destroy(image_u8_t *im);
 
 // Write a pnm. Returns 0 on success
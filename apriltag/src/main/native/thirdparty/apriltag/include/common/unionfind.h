@@ -37,6 +37,9 @@ struct unionfind
 {
     uint32_t maxid;
 
+    // Number of elements parent and size have room for
+    uint32_t capacity;
+
     // Parent node for each. Initialized to 0xffffffff
     uint32_t *parent;
 
@@ -48,6 +51,7 @@ static inline unionfind_t *unionfind_create(uint32_t maxid)
 {
     unionfind_t *uf = (unionfind_t*) calloc(1, sizeof(unionfind_t));
     uf->maxid = maxid;
+    uf->capacity = maxid+1;
     uf->parent = (uint32_t *) malloc((maxid+1) * sizeof(uint32_t) * 2);
     memset(uf->parent, 0xff, (maxid+1) * sizeof(uint32_t));
     uf->size = uf->parent + (maxid+1);
@@ -55,6 +59,21 @@ static inline unionfind_t *unionfind_create(uint32_t maxid)
     return uf;
 }
 
+// Reinitializes uf with maxid+1 disjoint elements, reusing its storage
+// if it is already large enough.
+static inline void unionfind_reset(unionfind_t *uf, uint32_t maxid)
+{
+    if (uf->capacity < maxid+1) {
+        free(uf->parent);
+        uf->parent = (uint32_t *) malloc((maxid+1) * sizeof(uint32_t) * 2);
+        uf->capacity = maxid+1;
+    }
+    uf->maxid = maxid;
+    memset(uf->parent, 0xff, (maxid+1) * sizeof(uint32_t));
+    uf->size = uf->parent + (maxid+1);
+    memset(uf->size, 0, (maxid+1) * sizeof(uint32_t));
+}
+
 static inline void unionfind_destroy(unionfind_t *uf)
 {
     free(uf->parent);
@@ -36,6 +36,21 @@ typedef struct workerpool workerpool_t;
 workerpool_t *workerpool_create(int nthreads);
 void workerpool_destroy(workerpool_t *wp);
 
+// Hands the ntasks added tasks of wp to an external thread pool. It
+// must call workerpool_run_task(wp, i) exactly once for each i in
+// [0, ntasks), from any threads, and return once all of them are done.
+typedef void (*workerpool_dispatch_t)(void *user, workerpool_t *wp, int ntasks);
+
+// Creates a workerpool without threads of its own; workerpool_run
+// passes the tasks to dispatch instead. nthreads is the number of
+// threads the external pool is expected to use, and only affects how
+// finely callers split their work. Tasks must be added from one
+// thread at a time.
+workerpool_t *workerpool_create_external(int nthreads, workerpool_dispatch_t dispatch, void *user);
+
+// runs the i'th added task; for use by workerpool_dispatch_t.
+void workerpool_run_task(workerpool_t *wp, int i);
+
 void workerpool_add_task(workerpool_t *wp, void (*f)(void *p), void *p);
 
 // runs all added tasks, waits for them to complete.
@@ -66,7 +66,9 @@ static inline long int random(void)
 
 #define APRILTAG_U64_ONE ((uint64_t) 1)
 
+// The returned quads are td->quads.
 extern zarray_t *apriltag_quad_thresh(apriltag_detector_t *td, image_u8_t *im);
+extern void apriltag_quad_thresh_buffers_destroy(struct apriltag_quad_thresh_buffers *qtb);
 
 // Regresses a model of the form:
 // intensity(x,y) = C0*x + C1*y + CC2
@@ -145,27 +147,6 @@ static uint64_t rotate90(uint64_t w, int numBits)
     return w;
 }
 
-static void quad_destroy(struct quad *quad)
-{
-    if (!quad)
-        return;
-
-    matd_destroy(quad->H);
-    matd_destroy(quad->Hinv);
-    free(quad);
-}
-
-static struct quad *quad_copy(struct quad *quad)
-{
-    struct quad *q = calloc(1, sizeof(struct quad));
-    memcpy(q, quad, sizeof(struct quad));
-    if (quad->H)
-        q->H = matd_copy(quad->H);
-    if (quad->Hinv)
-        q->Hinv = matd_copy(quad->Hinv);
-    return q;
-}
-
 static void quick_decode_add(struct quick_decode *qd, uint64_t code, int id, int hamming)
 {
     uint32_t bucket = code % qd->nentries;
@@ -366,6 +347,8 @@ apriltag_detector_t *apriltag_detector_create(void)
     td->qtp.min_white_black_diff = 5;
 
     td->tag_families = zarray_create(sizeof(apriltag_family_t*));
+    td->quad_matrices = zarray_create(sizeof(matd_t*));
+    td->detection_pool = zarray_create(sizeof(apriltag_detection_t*));
 
     pthread_mutex_init(&td->mutex, NULL);
 
@@ -387,6 +370,20 @@ void apriltag_detector_destroy(apriltag_detector_t *td)
 {
     timeprofile_destroy(td->tp);
     workerpool_destroy(td->wp);
+    apriltag_quad_thresh_buffers_destroy(td->qtb);
+
+    if (td->quad_im)
+        image_u8_destroy(td->quad_im);
+    if (td->quads)
+        zarray_destroy(td->quads);
+    for (int i = 0; i < zarray_size(td->quad_matrices); i++) {
+        matd_t *m;
+        zarray_get(td->quad_matrices, i, &m);
+        matd_destroy(m);
+    }
+    zarray_destroy(td->quad_matrices);
+    free(td->decode_tasks);
+    apriltag_detections_destroy(td->detection_pool);
 
     apriltag_detector_clear_families(td);
 
@@ -416,7 +413,9 @@ struct evaluate_quad_ret
     struct quick_decode_entry e;
 };
 
-static matd_t* homography_compute2(double c[4][4]) {
+// Stores the homography in H, which must be 3x3. Returns non-zero if it
+// can't be computed.
+static int homography_compute2(double c[4][4], matd_t *H) {
     double A[] =  {
             c[0][0], c[0][1], 1,       0,       0, 0, -c[0][0]*c[0][2], -c[0][1]*c[0][2], c[0][2],
                   0,       0, 0, c[0][0], c[0][1], 1, -c[0][0]*c[0][3], -c[0][1]*c[0][3], c[0][3],
@@ -444,12 +443,12 @@ static matd_t* homography_compute2(double c[4][4]) {
         }
 
         if (max_val_idx < 0) {
-            return NULL;
+            return -1;
         }
 
         if (max_val < epsilon) {
             debug_print("WRN: Matrix is singular.\n");
-            return NULL;
+            return -1;
         }
 
         // Swap to get best row.
@@ -479,10 +478,96 @@ static matd_t* homography_compute2(double c[4][4]) {
         }
         A[col*9 + 8] = (A[col*9 + 8] - sum)/A[col*9 + col];
     }
-    return matd_create_data(3, 3, (double[]) { A[8], A[17], A[26], A[35], A[44], A[53], A[62], A[71], 1 });
+    double h[9] = { A[8], A[17], A[26], A[35], A[44], A[53], A[62], A[71], 1 };
+    memcpy(H->data, h, sizeof(h));
+    return 0;
 }
 
-// returns non-zero if an error occurs (i.e., H has no inverse)
+// Stores the inverse of the 3x3 matrix a in inv, computed the same way
+// as matd_inverse() but without allocating. Returns non-zero if a is
+// singular.
+static int matd_inverse_3x3(const matd_t *a, matd_t *inv)
+{
+    double lu[9];
+    unsigned int piv[3] = { 0, 1, 2 };
+    int singular = 0;
+
+    memcpy(lu, a->data, sizeof(lu));
+
+    // matd_plu()
+    for (int j = 0; j < 3; j++) {
+        for (int i = 0; i < 3; i++) {
+            int kmax = i < j ? i : j;
+
+            double acc = 0;
+            for (int k = 0; k < kmax; k++)
+                acc += lu[i*3 + k] * lu[k*3 + j];
+
+            lu[i*3 + j] -= acc;
+        }
+
+        int p = j;
+        for (int i = j+1; i < 3; i++) {
+            if (fabs(lu[i*3 + j]) > fabs(lu[p*3 + j]))
+                p = i;
+        }
+
+        if (p != j) {
+            for (int k = 0; k < 3; k++) {
+                double tmp = lu[p*3 + k];
+                lu[p*3 + k] = lu[j*3 + k];
+                lu[j*3 + k] = tmp;
+            }
+            unsigned int k = piv[p];
+            piv[p] = piv[j];
+            piv[j] = k;
+        }
+
+        double LUjj = lu[j*3 + j];
+        if (fabs(LUjj) < MATD_EPS)
+            singular = 1;
+
+        if (LUjj != 0) {
+            LUjj = 1.0 / LUjj;
+            for (int i = j+1; i < 3; i++)
+                lu[i*3 + j] *= LUjj;
+        }
+    }
+
+    if (singular)
+        return -1;
+
+    // matd_plu_solve() with the identity
+    double *x = inv->data;
+    for (int i = 0; i < 3; i++)
+        for (int t = 0; t < 3; t++)
+            x[i*3 + t] = piv[i] == (unsigned int) t;
+
+    for (int k = 0; k < 3; k++) {
+        for (int i = k+1; i < 3; i++) {
+            double LUik = -lu[i*3 + k];
+            for (int t = 0; t < 3; t++)
+                x[i*3 + t] += x[k*3 + t] * LUik;
+        }
+    }
+
+    for (int k = 2; k >= 0; k--) {
+        double LUkk = 1.0 / lu[k*3 + k];
+        for (int t = 0; t < 3; t++)
+            x[k*3 + t] *= LUkk;
+
+        for (int i = 0; i < k; i++) {
+            double LUik = -lu[i*3 + k];
+            for (int t = 0; t < 3; t++)
+                x[i*3 + t] += x[k*3 + t] * LUik;
+        }
+    }
+
+    return 0;
+}
+
+// returns non-zero if an error occurs (i.e., H has no inverse). quad->H
+// and quad->Hinv must already be allocated as 3x3 matrices.
 static int quad_update_homographies(struct quad *quad)
 {
     //zarray_t *correspondences = zarray_create(sizeof(float[4]));
@@ -496,21 +581,12 @@ static int quad_update_homographies(struct quad *quad)
         corr_arr[i][3] = quad->p[i][1];
     }
 
-    if (quad->H)
-        matd_destroy(quad->H);
-    if (quad->Hinv)
-        matd_destroy(quad->Hinv);
-
     // XXX Tunable
-    quad->H = homography_compute2(corr_arr);
-    if (quad->H != NULL) {
-        quad->Hinv = matd_inverse(quad->H);
-        if (quad->Hinv != NULL) {
+    if (homography_compute2(corr_arr, quad->H) == 0) {
+        if (matd_inverse_3x3(quad->H, quad->Hinv) == 0) {
 	    // Success!
             return 0;
         }
-        matd_destroy(quad->H);
-        quad->H = NULL;
     }
     return -1;
 }
@@ -531,8 +607,8 @@ static double value_for_pixel(image_u8_t *im, double px, double py) {
             im->buf[y2*im->stride + x2]*x*y;
 }
 
-static void sharpen(apriltag_detector_t* td, double* values, int size) {
-    double *sharpened = malloc(sizeof(double)*size*size);
+// sharpened is scratch space for size*size values.
+static void sharpen(apriltag_detector_t* td, double* values, double* sharpened, int size) {
     double kernel[9] = {
         0, -1, 0,
         -1, 4, -1,
@@ -559,10 +635,11 @@ static void sharpen(apriltag_detector_t* td, double* values, int size) {
             values[y*size + x] = values[y*size + x] + td->decode_sharpening*sharpened[y*size + x];
         }
     }
-
-    free(sharpened);
 }
 
+// Bit values of families up to this total width are decoded on the stack.
+#define QUAD_DECODE_STACK_WIDTH 16
+
 // returns the decision margin. Return < 0 if the detection should be rejected.
 static float quad_decode(apriltag_detector_t* td, apriltag_family_t *family, image_u8_t *im, struct quad *quad, struct quick_decode_entry *entry, image_u8_t *im_samples)
 {
@@ -681,7 +758,12 @@ static float quad_decode(apriltag_detector_t* td, apriltag_family_t *family, ima
     float black_score = 0, white_score = 0;
     float black_score_count = 1, white_score_count = 1;
 
-    double *values = calloc(family->total_width*family->total_width, sizeof(double));
+    int nvalues = family->total_width*family->total_width;
+    double values_stack[2*QUAD_DECODE_STACK_WIDTH*QUAD_DECODE_STACK_WIDTH];
+    double *values = values_stack;
+    if (family->total_width > QUAD_DECODE_STACK_WIDTH)
+        values = malloc(2*nvalues*sizeof(double));
+    memset(values, 0, nvalues*sizeof(double));
 
     int min_coord = (family->width_at_border - family->total_width)/2;
     for (uint32_t i = 0; i < family->nbits; i++) {
@@ -714,7 +796,7 @@ static float quad_decode(apriltag_detector_t* td, apriltag_family_t *family, ima
         }
     }
 
-    sharpen(td, values, family->total_width);
+    sharpen(td, values, values + nvalues, family->total_width);
 
     uint64_t rcode = 0;
     for (uint32_t i = 0; i < family->nbits; i++) {
@@ -734,7 +816,8 @@ static float quad_decode(apriltag_detector_t* td, apriltag_family_t *family, ima
     }
 
     quick_decode_codeword(family, rcode, entry);
-    free(values);
+    if (values != values_stack)
+        free(values);
     return fmin(white_score / white_score_count, black_score / black_score_count);
 }
 
@@ -887,6 +970,21 @@ static void refine_edges(apriltag_detector_t *td, image_u8_t *im_orig, struct qu
     }
 }
 
+// Returns a detection with a 3x3 H, from td's pool if possible. The
+// caller must hold td->mutex.
+static apriltag_detection_t *get_detection(apriltag_detector_t *td)
+{
+    apriltag_detection_t *det;
+    if (zarray_size(td->detection_pool) > 0) {
+        zarray_get(td->detection_pool, zarray_size(td->detection_pool) - 1, &det);
+        zarray_remove_index(td->detection_pool, zarray_size(td->detection_pool) - 1, 0);
+    } else {
+        det = calloc(1, sizeof(apriltag_detection_t));
+        det->H = matd_create(3, 3);
+    }
+    return det;
+}
+
 static void quad_decode_task(void *_u)
 {
     struct quad_decode_task *task = (struct quad_decode_task*) _u;
@@ -916,16 +1014,18 @@ static void quad_decode_task(void *_u)
                 continue;
             }
 
-            // since the geometry of tag families can vary, start any
-            // optimization process over with the original quad.
-            struct quad *quad = quad_copy(quad_original);
+            // quad_decode() doesn't modify the quad, so every family
+            // can use the original.
+            struct quad *quad = quad_original;
 
             struct quick_decode_entry entry;
 
             float decision_margin = quad_decode(td, family, im, quad, &entry, task->im_samples);
 
             if (decision_margin >= 0 && entry.hamming < 255) {
-                apriltag_detection_t *det = calloc(1, sizeof(apriltag_detection_t));
+                pthread_mutex_lock(&td->mutex);
+                apriltag_detection_t *det = get_detection(td);
+                pthread_mutex_unlock(&td->mutex);
 
                 det->family = family;
                 det->id = entry.id;
@@ -936,16 +1036,21 @@ static void quad_decode_task(void *_u)
                 double c = cos(theta), s = sin(theta);
 
                 // Fix the rotation of our homography to properly orient the tag
-                matd_t *R = matd_create(3,3);
-                MATD_EL(R, 0, 0) = c;
-                MATD_EL(R, 0, 1) = -s;
-                MATD_EL(R, 1, 0) = s;
-                MATD_EL(R, 1, 1) = c;
-                MATD_EL(R, 2, 2) = 1;
-
-                det->H = matd_op("M*M", quad->H, R);
-
-                matd_destroy(R);
+                double R[9] = {
+                    c, -s, 0,
+                    s,  c, 0,
+                    0,  0, 1
+                };
+
+                // det->H = quad->H * R, as matd_multiply() would compute it
+                for (int i = 0; i < 3; i++) {
+                    for (int j = 0; j < 3; j++) {
+                        double acc = 0;
+                        for (int k = 0; k < 3; k++)
+                            acc += MATD_EL(quad->H, i, k) * R[k*3 + j];
+                        MATD_EL(det->H, i, j) = acc;
+                    }
+                }
 
                 homography_project(det->H, 0, 0, &det->c[0], &det->c[1]);
 
@@ -969,8 +1074,6 @@ static void quad_decode_task(void *_u)
                 zarray_add(task->detections, &det);
                 pthread_mutex_unlock(&td->mutex);
             }
-
-            quad_destroy(quad);
         }
     }
 }
@@ -1000,21 +1103,58 @@ static int prefer_smaller(int pref, double q0, double q1)
 
 zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
 {
+    zarray_t *detections = zarray_create(sizeof(apriltag_detection_t*));
+    apriltag_detector_detect_into(td, im_orig, detections);
+    return detections;
+}
+
+// Returns a 3x3 matrix from td's pool; index selects which one.
+static matd_t *get_quad_matrix(apriltag_detector_t *td, int index)
+{
+    matd_t *m;
+    if (index < zarray_size(td->quad_matrices)) {
+        zarray_get(td->quad_matrices, index, &m);
+    } else {
+        m = matd_create(3, 3);
+        zarray_add(td->quad_matrices, &m);
+    }
+    return m;
+}
+
+static void detect(apriltag_detector_t *td, image_u8_t *im_orig, zarray_t *detections);
+
+void apriltag_detector_detect_into(apriltag_detector_t *td, image_u8_t *im_orig, zarray_t *detections)
+{
+    // take over the previous detections for reuse
+    zarray_add_range(td->detection_pool, detections, 0, zarray_size(detections));
+    zarray_clear(detections);
+
     if (zarray_size(td->tag_families) == 0) {
-        zarray_t *s = zarray_create(sizeof(apriltag_detection_t*));
         debug_print("No tag families enabled\n");
-        return s;
+        return;
     }
 
-    if (td->wp == NULL || td->nthreads != workerpool_get_nthreads(td->wp)) {
+    if (td->shared_wp == NULL &&
+        (td->wp == NULL || td->nthreads != workerpool_get_nthreads(td->wp))) {
         workerpool_destroy(td->wp);
         td->wp = workerpool_create(td->nthreads);
         if (td->wp == NULL) {
-            // creating workerpool failed - return empty zarray
-            return zarray_create(sizeof(apriltag_detection_t*));
+            // creating workerpool failed - return no detections
+            return;
         }
     }
 
+    // the rest of detection only uses td->wp, so lend it the shared
+    // workerpool for the duration of this frame
+    workerpool_t *own_wp = td->wp;
+    if (td->shared_wp != NULL)
+        td->wp = td->shared_wp;
+    detect(td, im_orig, detections);
+    td->wp = own_wp;
+}
+
+static void detect(apriltag_detector_t *td, image_u8_t *im_orig, zarray_t *detections)
+{
     timeprofile_clear(td->tp);
     timeprofile_stamp(td->tp, "init");
 
@@ -1023,7 +1163,8 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
     // and blurring parameters.
     image_u8_t *quad_im = im_orig;
     if (td->quad_decimate > 1) {
-        quad_im = image_u8_decimate(im_orig, td->quad_decimate);
+        image_u8_decimate_reuse(im_orig, td->quad_decimate, &td->quad_im);
+        quad_im = td->quad_im;
 
         timeprofile_stamp(td->tp, "decimate");
     }
@@ -1080,6 +1221,14 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
 
     zarray_t *quads = apriltag_quad_thresh(td, quad_im);
 
+    // give each quad pooled homography matrices
+    for (int i = 0; i < zarray_size(quads); i++) {
+        struct quad *q;
+        zarray_get_volatile(quads, i, &q);
+        q->H = get_quad_matrix(td, 2*i);
+        q->Hinv = get_quad_matrix(td, 2*i + 1);
+    }
+
     // adjust centers of pixels so that they correspond to the
     // original full-resolution image.
     if (td->quad_decimate > 1) {
@@ -1099,11 +1248,6 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
         }
     }
 
-    if (quad_im != im_orig)
-        image_u8_destroy(quad_im);
-
-    zarray_t *detections = zarray_create(sizeof(apriltag_detection_t*));
-
     td->nquads = zarray_size(quads);
 
     timeprofile_stamp(td->tp, "quads");
@@ -1137,9 +1281,15 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
     if (1) {
         image_u8_t *im_samples = td->debug ? image_u8_copy(im_orig) : NULL;
 
-        int chunksize = 1 + zarray_size(quads) / (APRILTAG_TASKS_PER_THREAD_TARGET * td->nthreads);
+        int chunksize = 1 + zarray_size(quads) / (APRILTAG_TASKS_PER_THREAD_TARGET * workerpool_get_nthreads(td->wp));
 
-        struct quad_decode_task *tasks = malloc(sizeof(struct quad_decode_task)*(zarray_size(quads) / chunksize + 1));
+        int maxtasks = zarray_size(quads) / chunksize + 1;
+        if (td->decode_tasks_capacity < maxtasks) {
+            free(td->decode_tasks);
+            td->decode_tasks = malloc(sizeof(struct quad_decode_task)*maxtasks);
+            td->decode_tasks_capacity = maxtasks;
+        }
+        struct quad_decode_task *tasks = td->decode_tasks;
 
         int ntasks = 0;
         for (int i = 0; i < zarray_size(quads); i+= chunksize) {
@@ -1158,8 +1308,6 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
 
         workerpool_run(td->wp);
 
-        free(tasks);
-
         if (im_samples != NULL) {
             image_u8_write_pnm(im_samples, "debug_samples.pnm");
             image_u8_destroy(im_samples);
@@ -1197,8 +1345,11 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
     // Step 3. Reconcile detections--- don't report the same tag more
     // than once. (Allow non-overlapping duplicate detections.)
     if (1) {
-        zarray_t *poly0 = g2d_polygon_create_zeros(4);
-        zarray_t *poly1 = g2d_polygon_create_zeros(4);
+        float poly0_data[4][2], poly1_data[4][2];
+        zarray_t poly0_array = { sizeof(float[2]), 4, 4, (char*) poly0_data };
+        zarray_t poly1_array = { sizeof(float[2]), 4, 4, (char*) poly1_data };
+        zarray_t *poly0 = &poly0_array;
+        zarray_t *poly1 = &poly1_array;
 
         for (int i0 = 0; i0 < zarray_size(detections); i0++) {
 
@@ -1241,13 +1392,13 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
 
                     if (pref < 0) {
                         // keep det0, destroy det1
-                        apriltag_detection_destroy(det1);
+                        zarray_add(td->detection_pool, &det1);
                         zarray_remove_index(detections, i1, 1);
                         i1--; // retry the same index
                         goto retry1;
                     } else {
                         // keep det1, destroy det0
-                        apriltag_detection_destroy(det0);
+                        zarray_add(td->detection_pool, &det0);
                         zarray_remove_index(detections, i0, 1);
                         i0--; // retry the same index.
                         goto retry0;
@@ -1259,9 +1410,6 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
 
           retry0: ;
         }
-
-        zarray_destroy(poly0);
-        zarray_destroy(poly1);
     }
 
     timeprofile_stamp(td->tp, "reconcile");
@@ -1390,19 +1538,8 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
 
     timeprofile_stamp(td->tp, "debug output");
 
-    for (int i = 0; i < zarray_size(quads); i++) {
-        struct quad *quad;
-        zarray_get_volatile(quads, i, &quad);
-        matd_destroy(quad->H);
-        matd_destroy(quad->Hinv);
-    }
-
-    zarray_destroy(quads);
-
     zarray_sort(detections, detection_compare_function);
     timeprofile_stamp(td->tp, "cleanup");
-
-    return detections;
 }
 
 
@@ -43,6 +43,24 @@ either expressed or implied, of the Regents of The University of Michigan.
 #include "common/zmaxheap.h"
 #include "common/math_util.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define APRILTAG_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// AVX2 kernels are compiled with a function-level target attribute and
+// only called after checking the CPU at runtime, so they don't require
+// building the whole library with -mavx2.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define APRILTAG_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define APRILTAG_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
 #ifdef _WIN32
 static inline long int random(void)
 {
@@ -79,6 +97,19 @@ struct unionfind_task
     image_u8_t *im;
 };
 
+// Scratch arrays for fitting a quad to a cluster of up to capacity
+// points. One is kept per quad task between frames.
+struct fit_quad_buffers
+{
+    int capacity;
+
+    struct pt *pts;          // ptsort() temporary
+    struct line_fit_pt *lfps;
+    double *errs, *y, *maxima_errs;
+    float *f;
+    int *maxima;
+};
+
 struct quad_task
 {
     zarray_t *clusters;
@@ -91,8 +122,29 @@ struct quad_task
     int tag_width;
     bool normal_border;
     bool reversed_border;
+
+    struct fit_quad_buffers *fqb;
 };
 
+// State of one do_gradient_clusters() task. One is kept per task between
+// frames: the cluster map is cleared, and the entries and point arrays
+// are handed out again in order, so that a frame like the previous one
+// doesn't allocate.
+struct cluster_task_buffers
+{
+    struct uint64_zarray_entry **clustermap;
+    int clustermap_capacity;
+
+    // struct uint64_zarray_entry* chunks of CLUSTER_ENTRY_CHUNK_SIZE
+    zarray_t *entry_chunks;
+
+    // zarray_t* of struct pt; the first npoint_arrays are in use
+    zarray_t *point_arrays;
+    int npoint_arrays;
+
+    // struct cluster_hash, sorted by hash and then id
+    zarray_t *clusters;
+};
 
 struct cluster_task
 {
@@ -103,7 +155,7 @@ struct cluster_task
     int nclustermap;
     unionfind_t* uf;
     image_u8_t* im;
-    zarray_t* clusters;
+    struct cluster_task_buffers *ctb;
 };
 
 struct minmax_task {
@@ -134,6 +186,36 @@ struct threshold_task {
     uint8_t *im_min;
 };
 
+struct apriltag_quad_thresh_buffers
+{
+    image_u8_t *threshim;
+    size_t threshim_capacity;
+
+    // tile min/max values, before and after blurring
+    uint8_t *tiles;
+    size_t tiles_capacity;
+
+    unionfind_t uf;
+
+    // task descriptors of the current workerpool phase
+    void *tasks;
+    size_t tasks_capacity;
+
+    struct cluster_task_buffers *ctbs;
+    int nctbs;
+
+    // zarray_t* of struct cluster_hash, for the results of merge_clusters()
+    zarray_t *merged_clusters;
+    zarray_t **clusters_list;
+    int clusters_list_capacity;
+
+    // zarray_t* of the final clusters' points
+    zarray_t *clusters;
+
+    struct fit_quad_buffers *fqbs;
+    int nfqbs;
+};
+
 struct remove_vertex
 {
     int i;           // which vertex to remove?
@@ -319,7 +401,7 @@ int err_compare_descending(const void *_a, const void *_b)
   rather than pairs of clusters.) Critically, this helps keep nearby
   edges from becoming connected.
 */
-int quad_segment_maxima(apriltag_detector_t *td, zarray_t *cluster, struct line_fit_pt *lfps, int indices[4])
+int quad_segment_maxima(apriltag_detector_t *td, zarray_t *cluster, struct line_fit_pt *lfps, int indices[4], struct fit_quad_buffers *fqb)
 {
     int sz = zarray_size(cluster);
 
@@ -340,7 +422,7 @@ int quad_segment_maxima(apriltag_detector_t *td, zarray_t *cluster, struct line_
     if (ksz < 2)
         return 0;
 
-    double *errs = malloc(sizeof(double)*sz);
+    double *errs = fqb->errs;
 
     for (int i = 0; i < sz; i++) {
         fit_line(lfps, sz, (i + sz - ksz) % sz, (i + ksz) % sz, NULL, &errs[i], NULL);
@@ -348,7 +430,7 @@ int quad_segment_maxima(apriltag_detector_t *td, zarray_t *cluster, struct line_
 
     // apply a low-pass filter to errs
     if (1) {
-        double *y = malloc(sizeof(double)*sz);
+        double *y = fqb->y;
 
         // how much filter to apply?
 
@@ -370,7 +452,8 @@ int quad_segment_maxima(apriltag_detector_t *td, zarray_t *cluster, struct line_
 
         // For default values of cutoff = 0.05, sigma = 3,
         // we have fsz = 17.
-        float *f = malloc(sizeof(float)*fsz);
+        assert(fsz <= sz);
+        float *f = fqb->f;
 
         for (int i = 0; i < fsz; i++) {
             int j = i - fsz / 2;
@@ -387,12 +470,10 @@ int quad_segment_maxima(apriltag_detector_t *td, zarray_t *cluster, struct line_
         }
 
         memcpy(errs, y, sizeof(double)*sz);
-        free(y);
-        free(f);
     }
 
-    int *maxima = malloc(sizeof(int)*sz);
-    double *maxima_errs = malloc(sizeof(double)*sz);
+    int *maxima = fqb->maxima;
+    double *maxima_errs = fqb->maxima_errs;
     int nmaxima = 0;
 
     for (int i = 0; i < sz; i++) {
@@ -402,12 +483,9 @@ int quad_segment_maxima(apriltag_detector_t *td, zarray_t *cluster, struct line_
             nmaxima++;
         }
     }
-    free(errs);
 
     // if we didn't get at least 4 maxima, we can't fit a quad.
     if (nmaxima < 4){
-        free(maxima);
-        free(maxima_errs);
         return 0;
     }
 
@@ -415,13 +493,26 @@ int quad_segment_maxima(apriltag_detector_t *td, zarray_t *cluster, struct line_
     int max_nmaxima = td->qtp.max_nmaxima;
 
     if (nmaxima > max_nmaxima) {
-        double *maxima_errs_copy = malloc(sizeof(double)*nmaxima);
-        memcpy(maxima_errs_copy, maxima_errs, sizeof(double)*nmaxima);
-
-        // throw out all but the best handful of maxima. Sorts descending.
-        qsort(maxima_errs_copy, nmaxima, sizeof(double), err_compare_descending);
+        // throw out all but the best handful of maxima. errs isn't
+        // needed anymore, so it holds the max_nmaxima + 1 largest
+        // errors, sorted descending.
+        double *best_errs = errs;
+        int nbest = 0;
+        for (int in = 0; in < nmaxima; in++) {
+            double err = maxima_errs[in];
+            int pos = nbest;
+            while (pos > 0 && best_errs[pos - 1] < err) {
+                if (pos <= max_nmaxima)
+                    best_errs[pos] = best_errs[pos - 1];
+                pos--;
+            }
+            if (pos <= max_nmaxima)
+                best_errs[pos] = err;
+            if (nbest <= max_nmaxima)
+                nbest++;
+        }
 
-        double maxima_thresh = maxima_errs_copy[max_nmaxima];
+        double maxima_thresh = best_errs[max_nmaxima];
         int out = 0;
         for (int in = 0; in < nmaxima; in++) {
             if (maxima_errs[in] <= maxima_thresh)
@@ -429,9 +520,7 @@ int quad_segment_maxima(apriltag_detector_t *td, zarray_t *cluster, struct line_
             maxima[out++] = maxima[in];
         }
         nmaxima = out;
-        free(maxima_errs_copy);
     }
-    free(maxima_errs);
 
     int best_indices[4];
     double best_error = HUGE_VALF;
@@ -489,8 +578,6 @@ int quad_segment_maxima(apriltag_detector_t *td, zarray_t *cluster, struct line_
         }
     }
 
-    free(maxima);
-
     if (best_error == HUGE_VALF)
         return 0;
 
@@ -617,8 +704,9 @@ int quad_segment_agg(zarray_t *cluster, struct line_fit_pt *lfps, int indices[4]
  * Compute statistics that allow line fit queries to be
  * efficiently computed for any contiguous range of indices.
  */
-struct line_fit_pt* compute_lfps(int sz, zarray_t* cluster, image_u8_t* im) {
-    struct line_fit_pt *lfps = calloc(sz, sizeof(struct line_fit_pt));
+struct line_fit_pt* compute_lfps(int sz, zarray_t* cluster, image_u8_t* im, struct fit_quad_buffers *fqb) {
+    struct line_fit_pt *lfps = fqb->lfps;
+    memset(lfps, 0, sizeof(struct line_fit_pt)*sz);
 
     for (int i = 0; i < sz; i++) {
         struct pt *p;
@@ -659,7 +747,8 @@ struct line_fit_pt* compute_lfps(int sz, zarray_t* cluster, image_u8_t* im) {
     return lfps;
 }
 
-static inline void ptsort(struct pt *pts, int sz)
+// tmp must have room for sz points; its contents are clobbered.
+static void ptsort_tmp(struct pt *pts, struct pt *tmp, int sz)
 {
 #define MAYBE_SWAP(arr,apos,bpos)                                   \
     if (pt_compare_angle(&(arr[apos]), &(arr[bpos])) > 0) {                        \
@@ -712,9 +801,8 @@ static inline void ptsort(struct pt *pts, int sz)
 
 #undef MAYBE_SWAP
 
-    // a merge sort with temp storage.
-
-    struct pt *tmp = malloc(sizeof(struct pt) * sz);
+    // a merge sort with temp storage. The halves are sorted in tmp, using
+    // the matching halves of pts (already copied) as their temp storage.
 
     memcpy(tmp, pts, sizeof(struct pt) * sz);
 
@@ -724,8 +812,8 @@ static inline void ptsort(struct pt *pts, int sz)
     struct pt *as = &tmp[0];
     struct pt *bs = &tmp[asz];
 
-    ptsort(as, asz);
-    ptsort(bs, bsz);
+    ptsort_tmp(as, &pts[0], asz);
+    ptsort_tmp(bs, &pts[asz], bsz);
 
     #define MERGE(apos,bpos)                        \
     if (pt_compare_angle(&(as[apos]), &(bs[bpos])) < 0)        \
@@ -748,11 +836,43 @@ static inline void ptsort(struct pt *pts, int sz)
     if (bpos < bsz)
         memcpy(&pts[outpos], &bs[bpos], (bsz-bpos)*sizeof(struct pt));
 
-    free(tmp);
-
 #undef MERGE
 }
 
+static void fit_quad_buffers_destroy(struct fit_quad_buffers *fqb)
+{
+    free(fqb->pts);
+    free(fqb->lfps);
+    free(fqb->errs);
+    free(fqb->y);
+    free(fqb->maxima_errs);
+    free(fqb->f);
+    free(fqb->maxima);
+    memset(fqb, 0, sizeof(struct fit_quad_buffers));
+}
+
+// Makes sure that fqb can hold sz points.
+static void fit_quad_buffers_reserve(struct fit_quad_buffers *fqb, int sz)
+{
+    int capacity = fqb->capacity;
+    if (capacity >= sz)
+        return;
+
+    fit_quad_buffers_destroy(fqb);
+
+    // grow geometrically, like zarray
+    if (sz < 2*capacity)
+        sz = 2*capacity;
+    fqb->capacity = sz;
+    fqb->pts = malloc(sizeof(struct pt)*sz);
+    fqb->lfps = malloc(sizeof(struct line_fit_pt)*sz);
+    fqb->errs = malloc(sizeof(double)*sz);
+    fqb->y = malloc(sizeof(double)*sz);
+    fqb->maxima_errs = malloc(sizeof(double)*sz);
+    fqb->f = malloc(sizeof(float)*sz);
+    fqb->maxima = malloc(sizeof(int)*sz);
+}
+
 // return 1 if the quad looks okay, 0 if it should be discarded
 int fit_quad(
         apriltag_detector_t *td,
@@ -761,13 +881,16 @@ int fit_quad(
         struct quad *quad,
         int tag_width,
         bool normal_border,
-        bool reversed_border) {
+        bool reversed_border,
+        struct fit_quad_buffers *fqb) {
     int res = 0;
 
     int sz = zarray_size(cluster);
     if (sz < 24) // Synchronize with later check.
         return 0;
 
+    fit_quad_buffers_reserve(fqb, sz);
+
     /////////////////////////////////////////////////////////////
     // Step 1. Sort points so they wrap around the center of the
     // quad. We will constrain our quad fit to simply partition this
@@ -849,14 +972,14 @@ int fit_quad(
     // we now sort the points according to theta. This is a prepatory
     // step for segmenting them into four lines.
     if (1) {
-        ptsort((struct pt*) cluster->data, zarray_size(cluster));
+        ptsort_tmp((struct pt*) cluster->data, fqb->pts, zarray_size(cluster));
     }
 
-    struct line_fit_pt *lfps = compute_lfps(sz, cluster, im);
+    struct line_fit_pt *lfps = compute_lfps(sz, cluster, im, fqb);
 
     int indices[4];
     if (1) {
-        if (!quad_segment_maxima(td, cluster, lfps, indices))
+        if (!quad_segment_maxima(td, cluster, lfps, indices, fqb))
             goto finish;
     } else {
         if (!quad_segment_agg(cluster, lfps, indices))
@@ -973,11 +1096,482 @@ int fit_quad(
 
   finish:
 
-    free(lfps);
-
     return res;
 }
 
+static struct apriltag_quad_thresh_buffers *get_buffers(apriltag_detector_t *td)
+{
+    if (td->qtb == NULL)
+        td->qtb = calloc(1, sizeof(struct apriltag_quad_thresh_buffers));
+    return td->qtb;
+}
+
+// Destroys a zarray of zarray_t*, and the arrays in it.
+static void destroy_zarrays(zarray_t *arrays)
+{
+    if (arrays == NULL)
+        return;
+
+    for (int i = 0; i < zarray_size(arrays); i++) {
+        zarray_t *array;
+        zarray_get(arrays, i, &array);
+        zarray_destroy(array);
+    }
+    zarray_destroy(arrays);
+}
+
+// Returns the index-th zarray_t* of arrays, cleared, creating it if
+// needed.
+static zarray_t *get_zarray(zarray_t *arrays, int index, size_t el_sz)
+{
+    zarray_t *array;
+    if (index < zarray_size(arrays)) {
+        zarray_get(arrays, index, &array);
+        zarray_clear(array);
+    } else {
+        array = zarray_create(el_sz);
+        zarray_add(arrays, &array);
+    }
+    return array;
+}
+
+void apriltag_quad_thresh_buffers_destroy(struct apriltag_quad_thresh_buffers *qtb)
+{
+    if (qtb == NULL)
+        return;
+
+    if (qtb->threshim)
+        image_u8_destroy(qtb->threshim);
+    free(qtb->tiles);
+    free(qtb->uf.parent);
+    free(qtb->tasks);
+
+    for (int i = 0; i < qtb->nctbs; i++) {
+        struct cluster_task_buffers *ctb = &qtb->ctbs[i];
+        free(ctb->clustermap);
+        for (int j = 0; j < zarray_size(ctb->entry_chunks); j++) {
+            struct uint64_zarray_entry *chunk;
+            zarray_get(ctb->entry_chunks, j, &chunk);
+            free(chunk);
+        }
+        zarray_destroy(ctb->entry_chunks);
+        destroy_zarrays(ctb->point_arrays);
+        zarray_destroy(ctb->clusters);
+    }
+    free(qtb->ctbs);
+
+    destroy_zarrays(qtb->merged_clusters);
+    free(qtb->clusters_list);
+    if (qtb->clusters)
+        zarray_destroy(qtb->clusters);
+
+    for (int i = 0; i < qtb->nfqbs; i++)
+        fit_quad_buffers_destroy(&qtb->fqbs[i]);
+    free(qtb->fqbs);
+
+    free(qtb);
+}
+
+// Returns pooled storage for size bytes of task descriptors. Each
+// workerpool phase reuses the same storage, so the descriptors are only
+// valid until the next call.
+static void *get_tasks(struct apriltag_quad_thresh_buffers *qtb, size_t size)
+{
+    if (qtb->tasks_capacity < size) {
+        free(qtb->tasks);
+        qtb->tasks = malloc(size);
+        qtb->tasks_capacity = size;
+    }
+    return qtb->tasks;
+}
+
+// Returns the pooled threshold image, resized to w x h with stride s.
+// Its contents are left over from the previous frame.
+static image_u8_t *get_threshim(struct apriltag_quad_thresh_buffers *qtb, int w, int h, int s)
+{
+    size_t size = (size_t) h * s;
+
+    if (qtb->threshim == NULL || qtb->threshim_capacity < size) {
+        if (qtb->threshim)
+            image_u8_destroy(qtb->threshim);
+        qtb->threshim = image_u8_create_stride(w, h, s);
+        qtb->threshim_capacity = size;
+        return qtb->threshim;
+    }
+
+    // const initializer
+    image_u8_t tmp = { .width = w, .height = h, .stride = s, .buf = qtb->threshim->buf };
+    memcpy(qtb->threshim, &tmp, sizeof(image_u8_t));
+    return qtb->threshim;
+}
+
+// Returns pooled storage for the four tw*th tile min/max arrays.
+static uint8_t *get_tiles(struct apriltag_quad_thresh_buffers *qtb, size_t ntiles)
+{
+    size_t size = 4 * ntiles;
+
+    if (qtb->tiles_capacity < size) {
+        free(qtb->tiles);
+        qtb->tiles = malloc(size);
+        qtb->tiles_capacity = size;
+    }
+    return qtb->tiles;
+}
+
+enum simd_level {
+    SIMD_SCALAR = 0,
+    SIMD_SSE2,
+    SIMD_AVX2,
+    SIMD_NEON,
+};
+
+static int simd_enabled = 1;
+
+void apriltag_set_simd_enabled(int enabled)
+{
+    simd_enabled = enabled;
+}
+
+static enum simd_level get_simd_level(void)
+{
+    if (!simd_enabled)
+        return SIMD_SCALAR;
+#if defined(APRILTAG_HAVE_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+        return SIMD_AVX2;
+#endif
+#if defined(APRILTAG_HAVE_SSE2)
+    return SIMD_SSE2;
+#elif defined(APRILTAG_HAVE_NEON)
+    return SIMD_NEON;
+#else
+    return SIMD_SCALAR;
+#endif
+}
+
+const char *apriltag_get_simd_name(void)
+{
+    switch (get_simd_level()) {
+        case SIMD_SSE2: return "sse2";
+        case SIMD_AVX2: return "avx2";
+        case SIMD_NEON: return "neon";
+        default: return "scalar";
+    }
+}
+
+static inline void store_u32(uint8_t *dst, uint32_t v)
+{
+    memcpy(dst, &v, sizeof(v));
+}
+
+static inline uint32_t load_u32(const uint8_t *src)
+{
+    uint32_t v;
+    memcpy(&v, src, sizeof(v));
+    return v;
+}
+
+// Each of the minmax kernels below computes the min/max of 4x4 tiles
+// for one row of tiles, starting at tile 0. They return the number of
+// tiles processed; the caller handles the remainder with scalar code.
+//
+// Vertical min/max over the four rows is done bytewise. The horizontal
+// reduction within a tile shifts each 32-bit lane (one tile) right by
+// one and two bytes, so byte 0 of every lane ends up holding the
+// result for its tile.
+
+#if defined(APRILTAG_HAVE_SSE2)
+static int minmax_tiles_sse2(const uint8_t *row, int s, int tw, uint8_t *im_max, uint8_t *im_min)
+{
+    const __m128i lo_byte = _mm_set1_epi32(0xff);
+    int tx = 0;
+
+    for (; tx + 4 <= tw; tx += 4) {
+        const uint8_t *p = row + tx*4;
+        __m128i r0 = _mm_loadu_si128((const __m128i*) (p));
+        __m128i r1 = _mm_loadu_si128((const __m128i*) (p + s));
+        __m128i r2 = _mm_loadu_si128((const __m128i*) (p + 2*s));
+        __m128i r3 = _mm_loadu_si128((const __m128i*) (p + 3*s));
+
+        __m128i max = _mm_max_epu8(_mm_max_epu8(r0, r1), _mm_max_epu8(r2, r3));
+        __m128i min = _mm_min_epu8(_mm_min_epu8(r0, r1), _mm_min_epu8(r2, r3));
+
+        max = _mm_max_epu8(max, _mm_srli_epi32(max, 8));
+        max = _mm_max_epu8(max, _mm_srli_epi32(max, 16));
+        min = _mm_min_epu8(min, _mm_srli_epi32(min, 8));
+        min = _mm_min_epu8(min, _mm_srli_epi32(min, 16));
+
+        max = _mm_and_si128(max, lo_byte);
+        min = _mm_and_si128(min, lo_byte);
+        max = _mm_packs_epi32(max, max);
+        min = _mm_packs_epi32(min, min);
+        max = _mm_packus_epi16(max, max);
+        min = _mm_packus_epi16(min, min);
+
+        store_u32(&im_max[tx], (uint32_t) _mm_cvtsi128_si32(max));
+        store_u32(&im_min[tx], (uint32_t) _mm_cvtsi128_si32(min));
+    }
+
+    return tx;
+}
+#endif
+
+#if defined(APRILTAG_HAVE_AVX2)
+__attribute__((target("avx2")))
+static int minmax_tiles_avx2(const uint8_t *row, int s, int tw, uint8_t *im_max, uint8_t *im_min)
+{
+    const __m256i lo_byte = _mm256_set1_epi32(0xff);
+    int tx = 0;
+
+    for (; tx + 8 <= tw; tx += 8) {
+        const uint8_t *p = row + tx*4;
+        __m256i r0 = _mm256_loadu_si256((const __m256i*) (p));
+        __m256i r1 = _mm256_loadu_si256((const __m256i*) (p + s));
+        __m256i r2 = _mm256_loadu_si256((const __m256i*) (p + 2*s));
+        __m256i r3 = _mm256_loadu_si256((const __m256i*) (p + 3*s));
+
+        __m256i max = _mm256_max_epu8(_mm256_max_epu8(r0, r1), _mm256_max_epu8(r2, r3));
+        __m256i min = _mm256_min_epu8(_mm256_min_epu8(r0, r1), _mm256_min_epu8(r2, r3));
+
+        max = _mm256_max_epu8(max, _mm256_srli_epi32(max, 8));
+        max = _mm256_max_epu8(max, _mm256_srli_epi32(max, 16));
+        min = _mm256_min_epu8(min, _mm256_srli_epi32(min, 8));
+        min = _mm256_min_epu8(min, _mm256_srli_epi32(min, 16));
+
+        // packs work within 128-bit lanes, so tiles 0-3 end up in the
+        // low lane and tiles 4-7 in the high lane.
+        max = _mm256_and_si256(max, lo_byte);
+        min = _mm256_and_si256(min, lo_byte);
+        max = _mm256_packs_epi32(max, max);
+        min = _mm256_packs_epi32(min, min);
+        max = _mm256_packus_epi16(max, max);
+        min = _mm256_packus_epi16(min, min);
+
+        store_u32(&im_max[tx], (uint32_t) _mm_cvtsi128_si32(_mm256_castsi256_si128(max)));
+        store_u32(&im_max[tx + 4], (uint32_t) _mm_cvtsi128_si32(_mm256_extracti128_si256(max, 1)));
+        store_u32(&im_min[tx], (uint32_t) _mm_cvtsi128_si32(_mm256_castsi256_si128(min)));
+        store_u32(&im_min[tx + 4], (uint32_t) _mm_cvtsi128_si32(_mm256_extracti128_si256(min, 1)));
+    }
+
+    return tx;
+}
+#endif
+
+#if defined(APRILTAG_HAVE_NEON)
+static int minmax_tiles_neon(const uint8_t *row, int s, int tw, uint8_t *im_max, uint8_t *im_min)
+{
+    int tx = 0;
+
+    for (; tx + 4 <= tw; tx += 4) {
+        const uint8_t *p = row + tx*4;
+        uint8x16_t r0 = vld1q_u8(p);
+        uint8x16_t r1 = vld1q_u8(p + s);
+        uint8x16_t r2 = vld1q_u8(p + 2*s);
+        uint8x16_t r3 = vld1q_u8(p + 3*s);
+
+        uint8x16_t max = vmaxq_u8(vmaxq_u8(r0, r1), vmaxq_u8(r2, r3));
+        uint8x16_t min = vminq_u8(vminq_u8(r0, r1), vminq_u8(r2, r3));
+
+        max = vmaxq_u8(max, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(max), 8)));
+        max = vmaxq_u8(max, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(max), 16)));
+        min = vminq_u8(min, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(min), 8)));
+        min = vminq_u8(min, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(min), 16)));
+
+        // narrowing keeps the low byte of every 32-bit lane
+        uint16x4_t max16 = vmovn_u32(vreinterpretq_u32_u8(max));
+        uint16x4_t min16 = vmovn_u32(vreinterpretq_u32_u8(min));
+        uint8x8_t max8 = vmovn_u16(vcombine_u16(max16, max16));
+        uint8x8_t min8 = vmovn_u16(vcombine_u16(min16, min16));
+
+        store_u32(&im_max[tx], vget_lane_u32(vreinterpret_u32_u8(max8), 0));
+        store_u32(&im_min[tx], vget_lane_u32(vreinterpret_u32_u8(min8), 0));
+    }
+
+    return tx;
+}
+#endif
+
+// The threshold kernels binarize one row of 4x4 tiles given the
+// blurred per-tile min/max, again starting at tile 0 and returning the
+// number of tiles processed. Per-tile values are broadcast to the four
+// pixels of the tile so a whole vector of pixels is compared at once:
+//
+//   out = (max - min < min_white_black_diff) ? 127 :
+//         (v > min + (max - min) / 2) ? 255 : 0
+
+#if defined(APRILTAG_HAVE_SSE2)
+static int threshold_tiles_sse2(const uint8_t *row, uint8_t *out, int s, int tw,
+                                const uint8_t *im_max, const uint8_t *im_min,
+                                int min_white_black_diff)
+{
+    const __m128i gray = _mm_set1_epi8(127);
+    const __m128i half_mask = _mm_set1_epi8(0x7f);
+    const __m128i ones = _mm_set1_epi8(-1);
+    const __m128i diff_thresh = _mm_set1_epi8((char) (uint8_t) iclamp(min_white_black_diff, 0, 255));
+    int tx = 0;
+
+    for (; tx + 4 <= tw; tx += 4) {
+        // expand 4 tile values to 16 bytes, each repeated 4 times
+        __m128i max = _mm_cvtsi32_si128((int) load_u32(&im_max[tx]));
+        __m128i min = _mm_cvtsi32_si128((int) load_u32(&im_min[tx]));
+        max = _mm_unpacklo_epi8(max, max);
+        max = _mm_unpacklo_epi16(max, max);
+        min = _mm_unpacklo_epi8(min, min);
+        min = _mm_unpacklo_epi16(min, min);
+
+        // blurred max >= min always holds, so this doesn't saturate
+        __m128i diff = _mm_subs_epu8(max, min);
+        __m128i thresh = _mm_add_epi8(min, _mm_and_si128(_mm_srli_epi16(diff, 1), half_mask));
+
+        __m128i low_contrast;
+        if (min_white_black_diff > 255) {
+            low_contrast = ones;
+        } else {
+            // diff < d  <=>  max(diff, d) != diff
+            low_contrast = _mm_xor_si128(_mm_cmpeq_epi8(_mm_max_epu8(diff, diff_thresh), diff), ones);
+        }
+
+        for (int dy = 0; dy < 4; dy++) {
+            __m128i v = _mm_loadu_si128((const __m128i*) (row + dy*s + tx*4));
+            // v > thresh  <=>  min(v, thresh) != v
+            __m128i white = _mm_xor_si128(_mm_cmpeq_epi8(_mm_min_epu8(v, thresh), v), ones);
+            __m128i res = _mm_or_si128(_mm_and_si128(low_contrast, gray),
+                                       _mm_andnot_si128(low_contrast, white));
+            _mm_storeu_si128((__m128i*) (out + dy*s + tx*4), res);
+        }
+    }
+
+    return tx;
+}
+#endif
+
+#if defined(APRILTAG_HAVE_AVX2)
+__attribute__((target("avx2")))
+static int threshold_tiles_avx2(const uint8_t *row, uint8_t *out, int s, int tw,
+                                const uint8_t *im_max, const uint8_t *im_min,
+                                int min_white_black_diff)
+{
+    const __m256i gray = _mm256_set1_epi8(127);
+    const __m256i half_mask = _mm256_set1_epi8(0x7f);
+    const __m256i ones = _mm256_set1_epi8(-1);
+    const __m256i splat = _mm256_set1_epi32(0x01010101);
+    const __m256i diff_thresh = _mm256_set1_epi8((char) (uint8_t) iclamp(min_white_black_diff, 0, 255));
+    int tx = 0;
+
+    for (; tx + 8 <= tw; tx += 8) {
+        // zero-extend 8 tile values to 32-bit lanes, then multiply to
+        // repeat each byte 4 times
+        __m256i max = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) &im_max[tx]));
+        __m256i min = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) &im_min[tx]));
+        max = _mm256_mullo_epi32(max, splat);
+        min = _mm256_mullo_epi32(min, splat);
+
+        __m256i diff = _mm256_subs_epu8(max, min);
+        __m256i thresh = _mm256_add_epi8(min, _mm256_and_si256(_mm256_srli_epi16(diff, 1), half_mask));
+
+        __m256i low_contrast;
+        if (min_white_black_diff > 255) {
+            low_contrast = ones;
+        } else {
+            low_contrast = _mm256_xor_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(diff, diff_thresh), diff), ones);
+        }
+
+        for (int dy = 0; dy < 4; dy++) {
+            __m256i v = _mm256_loadu_si256((const __m256i*) (row + dy*s + tx*4));
+            __m256i white = _mm256_xor_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(v, thresh), v), ones);
+            __m256i res = _mm256_blendv_epi8(white, gray, low_contrast);
+            _mm256_storeu_si256((__m256i*) (out + dy*s + tx*4), res);
+        }
+    }
+
+    return tx;
+}
+#endif
+
+#if defined(APRILTAG_HAVE_NEON)
+static int threshold_tiles_neon(const uint8_t *row, uint8_t *out, int s, int tw,
+                                const uint8_t *im_max, const uint8_t *im_min,
+                                int min_white_black_diff)
+{
+    const uint8x16_t gray = vdupq_n_u8(127);
+    const uint8x16_t diff_thresh = vdupq_n_u8((uint8_t) iclamp(min_white_black_diff, 0, 255));
+    int tx = 0;
+
+    for (; tx + 4 <= tw; tx += 4) {
+        // expand 4 tile values to 16 bytes, each repeated 4 times
+        uint8x8_t max8 = vreinterpret_u8_u32(vdup_n_u32(load_u32(&im_max[tx])));
+        uint8x8_t min8 = vreinterpret_u8_u32(vdup_n_u32(load_u32(&im_min[tx])));
+        max8 = vzip_u8(max8, max8).val[0];
+        min8 = vzip_u8(min8, min8).val[0];
+        uint8x8x2_t max_zip = vzip_u8(max8, max8);
+        uint8x8x2_t min_zip = vzip_u8(min8, min8);
+        uint8x16_t max = vcombine_u8(max_zip.val[0], max_zip.val[1]);
+        uint8x16_t min = vcombine_u8(min_zip.val[0], min_zip.val[1]);
+
+        uint8x16_t diff = vsubq_u8(max, min);
+        uint8x16_t thresh = vaddq_u8(min, vshrq_n_u8(diff, 1));
+
+        uint8x16_t low_contrast;
+        if (min_white_black_diff > 255) {
+            low_contrast = vdupq_n_u8(0xff);
+        } else {
+            low_contrast = vcltq_u8(diff, diff_thresh);
+        }
+
+        for (int dy = 0; dy < 4; dy++) {
+            uint8x16_t v = vld1q_u8(row + dy*s + tx*4);
+            uint8x16_t white = vcgtq_u8(v, thresh);
+            vst1q_u8(out + dy*s + tx*4, vbslq_u8(low_contrast, gray, white));
+        }
+    }
+
+    return tx;
+}
+#endif
+
+// Returns the first x in [x, end) whose pixel isn't 127 (or end if
+// there is none). Low contrast regions are marked with 127 by the
+// threshold step and are skipped by the union-find pass, so jumping
+// over them a vector at a time doesn't change which pixels get
+// connected or in which order.
+static inline int skip_unknown_pixels(const uint8_t *row, int x, int end, enum simd_level level)
+{
+#if defined(APRILTAG_HAVE_SSE2)
+    if (level != SIMD_SCALAR) {
+        const __m128i gray = _mm_set1_epi8(127);
+        for (; x + 16 <= end; x += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i*) (row + x));
+            int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v, gray));
+            if (mask != 0xffff) {
+#if defined(_MSC_VER) && !defined(__clang__)
+                unsigned long idx;
+                _BitScanForward(&idx, (unsigned long) ~mask);
+                return x + (int) idx;
+#else
+                return x + __builtin_ctz((unsigned) ~mask);
+#endif
+            }
+        }
+    }
+#elif defined(APRILTAG_HAVE_NEON)
+    if (level != SIMD_SCALAR) {
+        const uint8x16_t gray = vdupq_n_u8(127);
+        for (; x + 16 <= end; x += 16) {
+            uint8x16_t eq = vceqq_u8(vld1q_u8(row + x), gray);
+            uint8x8_t all = vand_u8(vget_low_u8(eq), vget_high_u8(eq));
+            if (vget_lane_u64(vreinterpret_u64_u8(all), 0) != UINT64_MAX)
+                break;
+        }
+    }
+#else
+    (void) level;
+#endif
+
+    while (x < end && row[x] == 127)
+        x++;
+    return x;
+}
+
 #define DO_UNIONFIND2(dx, dy) if (im->buf[(y + dy)*s + x + dx] == v) unionfind_connect(uf, y*w + x, (y + dy)*w + x + dx);
 
 static void do_unionfind_first_line(unionfind_t *uf, image_u8_t *im, int w, int s)
@@ -999,6 +1593,7 @@ static void do_unionfind_line2(unionfind_t *uf, image_u8_t *im, int w, int s, in
 {
     assert(y > 0);
 
+    enum simd_level level = get_simd_level();
     uint8_t v_m1_m1;
     uint8_t v_0_m1 = im->buf[(y - 1)*s];
     uint8_t v_1_m1 = im->buf[(y - 1)*s + 1];
@@ -1012,8 +1607,19 @@ static void do_unionfind_line2(unionfind_t *uf, image_u8_t *im, int w, int s, in
         v_m1_0 = v;
         v = im->buf[y*s + x];
 
-        if (v == 127)
+        if (v == 127) {
+            // Jump to the end of the run of unknown pixels and reload
+            // the neighborhood so the shifts at the top of the loop see
+            // the same values they would have after stepping through it.
+            int next = skip_unknown_pixels(&im->buf[y*s], x + 1, w - 1, level);
+            if (next > x + 1) {
+                x = next - 1;
+                v_0_m1 = im->buf[(y - 1)*s + x];
+                v_1_m1 = im->buf[(y - 1)*s + x + 1];
+                v = im->buf[y*s + x];
+            }
             continue;
+        }
 
         // (dx,dy) pairs for 8 connectivity:
         // (-1, -1)    (0, -1)    (1, -1)
@@ -1075,7 +1681,7 @@ static void do_quad_task(void *p)
         struct quad quad;
         memset(&quad, 0, sizeof(struct quad));
 
-        if (fit_quad(td, task->im, *cluster, &quad, task->tag_width, task->normal_border, task->reversed_border)) {
+        if (fit_quad(td, task->im, *cluster, &quad, task->tag_width, task->normal_border, task->reversed_border, task->fqb)) {
             pthread_mutex_lock(&td->mutex);
             zarray_add(quads, &quad);
             pthread_mutex_unlock(&td->mutex);
@@ -1091,8 +1697,30 @@ void do_minmax_task(void *p)
     int ty = task->ty;
     int tw = task->im->width / tilesz;
     image_u8_t *im = task->im;
+    const uint8_t *row = &im->buf[ty*tilesz*s];
+    int tx0 = 0;
+
+    switch (get_simd_level()) {
+#if defined(APRILTAG_HAVE_AVX2)
+        case SIMD_AVX2:
+            tx0 = minmax_tiles_avx2(row, s, tw, &task->im_max[ty*tw], &task->im_min[ty*tw]);
+            break;
+#endif
+#if defined(APRILTAG_HAVE_SSE2)
+        case SIMD_SSE2:
+            tx0 = minmax_tiles_sse2(row, s, tw, &task->im_max[ty*tw], &task->im_min[ty*tw]);
+            break;
+#endif
+#if defined(APRILTAG_HAVE_NEON)
+        case SIMD_NEON:
+            tx0 = minmax_tiles_neon(row, s, tw, &task->im_max[ty*tw], &task->im_min[ty*tw]);
+            break;
+#endif
+        default:
+            break;
+    }
 
-    for (int tx = 0; tx < tw; tx++) {
+    for (int tx = tx0; tx < tw; tx++) {
         uint8_t max = 0, min = 255;
 
         for (int dy = 0; dy < tilesz; dy++) {
@@ -1158,8 +1786,31 @@ void do_threshold_task(void *p)
     image_u8_t *im = task->im;
     image_u8_t *threshim = task->threshim;
     int min_white_black_diff = task->td->qtp.min_white_black_diff;
+    const uint8_t *row = &im->buf[ty*tilesz*s];
+    uint8_t *out = &threshim->buf[ty*tilesz*s];
+    int tx0 = 0;
+
+    switch (get_simd_level()) {
+#if defined(APRILTAG_HAVE_AVX2)
+        case SIMD_AVX2:
+            tx0 = threshold_tiles_avx2(row, out, s, tw, &im_max[ty*tw], &im_min[ty*tw], min_white_black_diff);
+            break;
+#endif
+#if defined(APRILTAG_HAVE_SSE2)
+        case SIMD_SSE2:
+            tx0 = threshold_tiles_sse2(row, out, s, tw, &im_max[ty*tw], &im_min[ty*tw], min_white_black_diff);
+            break;
+#endif
+#if defined(APRILTAG_HAVE_NEON)
+        case SIMD_NEON:
+            tx0 = threshold_tiles_neon(row, out, s, tw, &im_max[ty*tw], &im_min[ty*tw], min_white_black_diff);
+            break;
+#endif
+        default:
+            break;
+    }
 
-    for (int tx = 0; tx < tw; tx++) {
+    for (int tx = tx0; tx < tw; tx++) {
         int min = im_min[ty*tw + tx];
         int max = im_max[ty*tw + tx];
 
@@ -1205,7 +1856,11 @@ image_u8_t *threshold(apriltag_detector_t *td, image_u8_t *im)
     assert(w < 32768);
     assert(h < 32768);
 
-    image_u8_t *threshim = image_u8_create_alignment(w, h, s);
+    struct apriltag_quad_thresh_buffers *qtb = get_buffers(td);
+
+    // Every pixel is written below, so the pooled image doesn't need
+    // to be cleared.
+    image_u8_t *threshim = get_threshim(qtb, w, h, s);
     assert(threshim->stride == s);
 
     // The idea is to find the maximum and minimum values in a
@@ -1238,10 +1893,11 @@ image_u8_t *threshold(apriltag_detector_t *td, image_u8_t *im)
     int tw = w / tilesz;
     int th = h / tilesz;
 
-    uint8_t *im_max = calloc(tw*th, sizeof(uint8_t));
-    uint8_t *im_min = calloc(tw*th, sizeof(uint8_t));
+    uint8_t *tiles = get_tiles(qtb, tw*th);
+    uint8_t *im_max = tiles;
+    uint8_t *im_min = tiles + tw*th;
 
-    struct minmax_task *minmax_tasks = malloc(sizeof(struct minmax_task)*th);
+    struct minmax_task *minmax_tasks = get_tasks(qtb, sizeof(struct minmax_task)*th);
     // first, collect min/max statistics for each tile
     for (int ty = 0; ty < th; ty++) {
         minmax_tasks[ty].im = im;
@@ -1252,16 +1908,15 @@ image_u8_t *threshold(apriltag_detector_t *td, image_u8_t *im)
         workerpool_add_task(td->wp, do_minmax_task, &minmax_tasks[ty]);
     }
     workerpool_run(td->wp);
-    free(minmax_tasks);
 
     // second, apply 3x3 max/min convolution to "blur" these values
     // over larger areas. This reduces artifacts due to abrupt changes
     // in the threshold value.
     if (1) {
-        uint8_t *im_max_tmp = calloc(tw*th, sizeof(uint8_t));
-        uint8_t *im_min_tmp = calloc(tw*th, sizeof(uint8_t));
+        uint8_t *im_max_tmp = tiles + 2*tw*th;
+        uint8_t *im_min_tmp = tiles + 3*tw*th;
 
-        struct blur_task *blur_tasks = malloc(sizeof(struct blur_task)*th);
+        struct blur_task *blur_tasks = get_tasks(qtb, sizeof(struct blur_task)*th);
         for (int ty = 0; ty < th; ty++) {
             blur_tasks[ty].im = im;
             blur_tasks[ty].im_max = im_max;
@@ -1273,14 +1928,11 @@ image_u8_t *threshold(apriltag_detector_t *td, image_u8_t *im)
             workerpool_add_task(td->wp, do_blur_task, &blur_tasks[ty]);
         }
         workerpool_run(td->wp);
-        free(blur_tasks);
-        free(im_max);
-        free(im_min);
         im_max = im_max_tmp;
         im_min = im_min_tmp;
     }
 
-    struct threshold_task *threshold_tasks = malloc(sizeof(struct threshold_task)*th);
+    struct threshold_task *threshold_tasks = get_tasks(qtb, sizeof(struct threshold_task)*th);
     for (int ty = 0; ty < th; ty++) {
         threshold_tasks[ty].im = im;
         threshold_tasks[ty].threshim = threshim;
@@ -1292,7 +1944,6 @@ image_u8_t *threshold(apriltag_detector_t *td, image_u8_t *im)
         workerpool_add_task(td->wp, do_threshold_task, &threshold_tasks[ty]);
     }
     workerpool_run(td->wp);
-    free(threshold_tasks);
 
     // we skipped over the non-full-sized tiles above. Fix those now.
     if (1) {
@@ -1331,9 +1982,6 @@ image_u8_t *threshold(apriltag_detector_t *td, image_u8_t *im)
         }
     }
 
-    free(im_min);
-    free(im_max);
-
     // this is a dilate/erode deglitching scheme that does not improve
     // anything as far as I can tell.
     if (td->qtp.deglitch) {
@@ -1495,9 +2143,11 @@ image_u8_t *threshold_bayer(apriltag_detector_t *td, image_u8_t *im)
 }
 
 unionfind_t* connected_components(apriltag_detector_t *td, image_u8_t* threshim, int w, int h, int ts) {
-    unionfind_t *uf = unionfind_create(w * h);
+    struct apriltag_quad_thresh_buffers *qtb = get_buffers(td);
+    unionfind_t *uf = &qtb->uf;
+    unionfind_reset(uf, w * h);
 
-    if (td->nthreads <= 1) {
+    if (workerpool_get_nthreads(td->wp) <= 1) {
         do_unionfind_first_line(uf, threshim, w, ts);
         for (int y = 1; y < h; y++) {
             do_unionfind_line2(uf, threshim, w, ts, y);
@@ -1506,8 +2156,8 @@ unionfind_t* connected_components(apriltag_detector_t *td, image_u8_t* threshim,
         do_unionfind_first_line(uf, threshim, w, ts);
 
         int sz = h;
-        int chunksize = 1 + sz / (APRILTAG_TASKS_PER_THREAD_TARGET * td->nthreads);
-        struct unionfind_task *tasks = malloc(sizeof(struct unionfind_task)*(sz / chunksize + 1));
+        int chunksize = 1 + sz / (APRILTAG_TASKS_PER_THREAD_TARGET * workerpool_get_nthreads(td->wp));
+        struct unionfind_task *tasks = get_tasks(qtb, sizeof(struct unionfind_task)*(sz / chunksize + 1));
 
         int ntasks = 0;
 
@@ -1535,20 +2185,32 @@ unionfind_t* connected_components(apriltag_detector_t *td, image_u8_t* threshim,
         for (int i = 1; i < ntasks; i++) {
             do_unionfind_line2(uf, threshim, w, ts, tasks[i].y0 - 1);
         }
-
-        free(tasks);
     }
     return uf;
 }
 
-zarray_t* do_gradient_clusters(image_u8_t* threshim, int ts, int y0, int y1, int w, int nclustermap, unionfind_t* uf, zarray_t* clusters) {
-    struct uint64_zarray_entry **clustermap = calloc(nclustermap, sizeof(struct uint64_zarray_entry*));
+#define CLUSTER_ENTRY_CHUNK_SIZE 2048
 
-    int mem_chunk_size = 2048;
-    struct uint64_zarray_entry** mem_pools = malloc(sizeof(struct uint64_zarray_entry *)*(1 + 2 * nclustermap / mem_chunk_size)); // SmodeTech: avoid memory corruption when nclustermap < mem_chunk_size
-    int mem_pool_idx = 0;
-    int mem_pool_loc = 0;
-    mem_pools[mem_pool_idx] = calloc(mem_chunk_size, sizeof(struct uint64_zarray_entry));
+zarray_t* do_gradient_clusters(image_u8_t* threshim, int ts, int y0, int y1, int w, int nclustermap, unionfind_t* uf, struct cluster_task_buffers* ctb) {
+    if (ctb->clustermap_capacity < nclustermap) {
+        free(ctb->clustermap);
+        ctb->clustermap = malloc(nclustermap * sizeof(struct uint64_zarray_entry*));
+        ctb->clustermap_capacity = nclustermap;
+    }
+    struct uint64_zarray_entry **clustermap = ctb->clustermap;
+    memset(clustermap, 0, nclustermap * sizeof(struct uint64_zarray_entry*));
+
+    if (ctb->entry_chunks == NULL) {
+        ctb->entry_chunks = zarray_create(sizeof(struct uint64_zarray_entry*));
+        ctb->point_arrays = zarray_create(sizeof(zarray_t*));
+        ctb->clusters = zarray_create(sizeof(struct cluster_hash));
+    }
+    ctb->npoint_arrays = 0;
+
+    int mem_chunk_size = CLUSTER_ENTRY_CHUNK_SIZE;
+    int mem_pool_idx = -1;
+    int mem_pool_loc = mem_chunk_size;
+    struct uint64_zarray_entry *mem_pool = NULL;
 
     for (int y = y0; y < y1; y++) {
         bool connected_last = false;
@@ -1612,13 +2274,18 @@ zarray_t* do_gradient_clusters(image_u8_t* threshim, int ts, int y0, int y1, int
                             if (mem_pool_loc == mem_chunk_size) {           \
                                 mem_pool_loc = 0;                           \
                                 mem_pool_idx++;                             \
-                                mem_pools[mem_pool_idx] = calloc(mem_chunk_size, sizeof(struct uint64_zarray_entry)); \
+                                if (mem_pool_idx == zarray_size(ctb->entry_chunks)) { \
+                                    mem_pool = malloc(mem_chunk_size * sizeof(struct uint64_zarray_entry)); \
+                                    zarray_add(ctb->entry_chunks, &mem_pool); \
+                                } else {                                    \
+                                    zarray_get(ctb->entry_chunks, mem_pool_idx, &mem_pool); \
+                                }                                           \
                             }                                               \
-                            entry = mem_pools[mem_pool_idx] + mem_pool_loc; \
+                            entry = mem_pool + mem_pool_loc;                \
                             mem_pool_loc++;                                 \
                                                                             \
                             entry->id = clusterid;                          \
-                            entry->cluster = zarray_create(sizeof(struct pt)); \
+                            entry->cluster = get_zarray(ctb->point_arrays, ctb->npoint_arrays++, sizeof(struct pt)); \
                             entry->next = clustermap[clustermap_bucket];    \
                             clustermap[clustermap_bucket] = entry;          \
                         }                                                   \
@@ -1649,13 +2316,15 @@ zarray_t* do_gradient_clusters(image_u8_t* threshim, int ts, int y0, int y1, int
     }
 #undef DO_CONN
 
+    zarray_t *clusters = ctb->clusters;
+    zarray_clear(clusters);
     for (int i = 0; i < nclustermap; i++) {
         int start = zarray_size(clusters);
         for (struct uint64_zarray_entry *entry = clustermap[i]; entry; entry = entry->next) {
-            struct cluster_hash* cluster_hash = malloc(sizeof(struct cluster_hash));
-            cluster_hash->hash = u64hash_2(entry->id) % nclustermap;
-            cluster_hash->id = entry->id;
-            cluster_hash->data = entry->cluster;
+            struct cluster_hash cluster_hash;
+            cluster_hash.hash = u64hash_2(entry->id) % nclustermap;
+            cluster_hash.id = entry->id;
+            cluster_hash.data = entry->cluster;
             zarray_add(clusters, &cluster_hash);
         }
         int end = zarray_size(clusters);
@@ -1664,23 +2333,18 @@ zarray_t* do_gradient_clusters(image_u8_t* threshim, int ts, int y0, int y1, int
         int n = end - start;
         for (int j = 0; j < n - 1; j++) {
             for (int k = 0; k < n - j - 1; k++) {
-                struct cluster_hash** hash1;
-                struct cluster_hash** hash2;
+                struct cluster_hash* hash1;
+                struct cluster_hash* hash2;
                 zarray_get_volatile(clusters, start + k, &hash1);
                 zarray_get_volatile(clusters, start + k + 1, &hash2);
-                if ((*hash1)->id > (*hash2)->id) {
-                    struct cluster_hash tmp = **hash2;
-                    **hash2 = **hash1;
-                    **hash1 = tmp;
+                if (hash1->id > hash2->id) {
+                    struct cluster_hash tmp = *hash2;
+                    *hash2 = *hash1;
+                    *hash1 = tmp;
                 }
             }
         }
     }
-    for (int i = 0; i <= mem_pool_idx; i++) {
-        free(mem_pools[i]);
-    }
-    free(mem_pools);
-    free(clustermap);
 
     return clusters;
 }
@@ -1689,11 +2353,12 @@ static void do_cluster_task(void *p)
 {
     struct cluster_task *task = (struct cluster_task*) p;
 
-    do_gradient_clusters(task->im, task->s, task->y0, task->y1, task->w, task->nclustermap, task->uf, task->clusters);
+    do_gradient_clusters(task->im, task->s, task->y0, task->y1, task->w, task->nclustermap, task->uf, task->ctb);
 }
 
-zarray_t* merge_clusters(zarray_t* c1, zarray_t* c2) {
-    zarray_t* ret = zarray_create(sizeof(struct cluster_hash*));
+// Merges c1 and c2 into ret, which must be empty. The points of clusters
+// found in both are appended to c1's cluster.
+zarray_t* merge_clusters(zarray_t* c1, zarray_t* c2, zarray_t* ret) {
     zarray_ensure_capacity(ret, zarray_size(c1) + zarray_size(c2));
 
     int i1 = 0;
@@ -1702,19 +2367,17 @@ zarray_t* merge_clusters(zarray_t* c1, zarray_t* c2) {
     int l2 = zarray_size(c2);
 
     while (i1 < l1 && i2 < l2) {
-        struct cluster_hash** h1;
-        struct cluster_hash** h2;
+        struct cluster_hash* h1;
+        struct cluster_hash* h2;
         zarray_get_volatile(c1, i1, &h1);
         zarray_get_volatile(c2, i2, &h2);
 
-        if ((*h1)->hash == (*h2)->hash && (*h1)->id == (*h2)->id) {
-            zarray_add_range((*h1)->data, (*h2)->data, 0, zarray_size((*h2)->data));
+        if (h1->hash == h2->hash && h1->id == h2->id) {
+            zarray_add_range(h1->data, h2->data, 0, zarray_size(h2->data));
             zarray_add(ret, h1);
             i1++;
             i2++;
-            zarray_destroy((*h2)->data);
-            free(*h2);
-        } else if ((*h2)->hash < (*h1)->hash || ((*h2)->hash == (*h1)->hash && (*h2)->id < (*h1)->id)) {
+        } else if (h2->hash < h1->hash || (h2->hash == h1->hash && h2->id < h1->id)) {
             zarray_add(ret, h2);
             i2++;
         } else {
@@ -1726,19 +2389,25 @@ zarray_t* merge_clusters(zarray_t* c1, zarray_t* c2) {
     zarray_add_range(ret, c1, i1, l1);
     zarray_add_range(ret, c2, i2, l2);
 
-    zarray_destroy(c1);
-    zarray_destroy(c2);
-
     return ret;
 }
 
+// The returned clusters, and the points in them, belong to td and are
+// reused by the next call.
 zarray_t* gradient_clusters(apriltag_detector_t *td, image_u8_t* threshim, int w, int h, int ts, unionfind_t* uf) {
-    zarray_t* clusters;
+    struct apriltag_quad_thresh_buffers *qtb = get_buffers(td);
     int nclustermap = 0.2*w*h;
 
     int sz = h - 1;
-    int chunksize = 1 + sz / (APRILTAG_TASKS_PER_THREAD_TARGET * td->nthreads);
-    struct cluster_task *tasks = malloc(sizeof(struct cluster_task)*(sz / chunksize + 1));
+    int chunksize = 1 + sz / (APRILTAG_TASKS_PER_THREAD_TARGET * workerpool_get_nthreads(td->wp));
+    int maxtasks = sz / chunksize + 1;
+    struct cluster_task *tasks = get_tasks(qtb, sizeof(struct cluster_task)*maxtasks);
+
+    if (qtb->nctbs < maxtasks) {
+        qtb->ctbs = realloc(qtb->ctbs, sizeof(struct cluster_task_buffers)*maxtasks);
+        memset(&qtb->ctbs[qtb->nctbs], 0, sizeof(struct cluster_task_buffers)*(maxtasks - qtb->nctbs));
+        qtb->nctbs = maxtasks;
+    }
 
     int ntasks = 0;
 
@@ -1752,7 +2421,7 @@ zarray_t* gradient_clusters(apriltag_detector_t *td, image_u8_t* threshim, int w
         tasks[ntasks].uf = uf;
         tasks[ntasks].im = threshim;
         tasks[ntasks].nclustermap = nclustermap/(sz / chunksize + 1);
-        tasks[ntasks].clusters = zarray_create(sizeof(struct cluster_hash*));
+        tasks[ntasks].ctb = &qtb->ctbs[ntasks];
 
         workerpool_add_task(td->wp, do_cluster_task, &tasks[ntasks]);
         ntasks++;
@@ -1760,16 +2429,26 @@ zarray_t* gradient_clusters(apriltag_detector_t *td, image_u8_t* threshim, int w
 
     workerpool_run(td->wp);
 
-    zarray_t** clusters_list = malloc(sizeof(zarray_t *)*ntasks);
+    if (qtb->clusters_list_capacity < ntasks) {
+        free(qtb->clusters_list);
+        qtb->clusters_list = malloc(sizeof(zarray_t *)*ntasks);
+        qtb->clusters_list_capacity = ntasks;
+    }
+    zarray_t** clusters_list = qtb->clusters_list;
     for (int i = 0; i < ntasks; i++) {
-        clusters_list[i] = tasks[i].clusters;
+        clusters_list[i] = tasks[i].ctb->clusters;
     }
 
+    if (qtb->merged_clusters == NULL)
+        qtb->merged_clusters = zarray_create(sizeof(zarray_t*));
+    int nmerged = 0;
+
     int length = ntasks;
     while (length > 1) {
         int write = 0;
         for (int i = 0; i < length - 1; i += 2) {
-            clusters_list[write] = merge_clusters(clusters_list[i], clusters_list[i + 1]);
+            zarray_t *merged = get_zarray(qtb->merged_clusters, nmerged++, sizeof(struct cluster_hash));
+            clusters_list[write] = merge_clusters(clusters_list[i], clusters_list[i + 1], merged);
             write++;
         }
 
@@ -1780,22 +2459,27 @@ zarray_t* gradient_clusters(apriltag_detector_t *td, image_u8_t* threshim, int w
         length = (length >> 1) + length % 2;
     }
 
-    clusters = zarray_create(sizeof(zarray_t*));
+    if (qtb->clusters == NULL)
+        qtb->clusters = zarray_create(sizeof(zarray_t*));
+    zarray_t* clusters = qtb->clusters;
+    zarray_clear(clusters);
     zarray_ensure_capacity(clusters, zarray_size(clusters_list[0]));
     for (int i = 0; i < zarray_size(clusters_list[0]); i++) {
-        struct cluster_hash** hash;
+        struct cluster_hash* hash;
         zarray_get_volatile(clusters_list[0], i, &hash);
-        zarray_add(clusters, &(*hash)->data);
-        free(*hash);
+        zarray_add(clusters, &hash->data);
     }
-    zarray_destroy(clusters_list[0]);
-    free(clusters_list);
-    free(tasks);
     return clusters;
 }
 
+// The returned quads are td->quads, which is reused by the next call.
 zarray_t* fit_quads(apriltag_detector_t *td, int w, int h, zarray_t* clusters, image_u8_t* im) {
-    zarray_t *quads = zarray_create(sizeof(struct quad));
+    struct apriltag_quad_thresh_buffers *qtb = get_buffers(td);
+
+    if (td->quads == NULL)
+        td->quads = zarray_create(sizeof(struct quad));
+    zarray_t *quads = td->quads;
+    zarray_clear(quads);
 
     bool normal_border = false;
     bool reversed_border = false;
@@ -1816,8 +2500,15 @@ zarray_t* fit_quads(apriltag_detector_t *td, int w, int h, zarray_t* clusters, i
     }
 
     int sz = zarray_size(clusters);
-    int chunksize = 1 + sz / (APRILTAG_TASKS_PER_THREAD_TARGET * td->nthreads);
-    struct quad_task *tasks = malloc(sizeof(struct quad_task)*(sz / chunksize + 1));
+    int chunksize = 1 + sz / (APRILTAG_TASKS_PER_THREAD_TARGET * workerpool_get_nthreads(td->wp));
+    int maxtasks = sz / chunksize + 1;
+    struct quad_task *tasks = get_tasks(qtb, sizeof(struct quad_task)*maxtasks);
+
+    if (qtb->nfqbs < maxtasks) {
+        qtb->fqbs = realloc(qtb->fqbs, sizeof(struct fit_quad_buffers)*maxtasks);
+        memset(&qtb->fqbs[qtb->nfqbs], 0, sizeof(struct fit_quad_buffers)*(maxtasks - qtb->nfqbs));
+        qtb->nfqbs = maxtasks;
+    }
 
     int ntasks = 0;
     for (int i = 0; i < sz; i += chunksize) {
@@ -1832,6 +2523,7 @@ zarray_t* fit_quads(apriltag_detector_t *td, int w, int h, zarray_t* clusters, i
         tasks[ntasks].tag_width = min_tag_width;
         tasks[ntasks].normal_border = normal_border;
         tasks[ntasks].reversed_border = reversed_border;
+        tasks[ntasks].fqb = &qtb->fqbs[ntasks];
 
         workerpool_add_task(td->wp, do_quad_task, &tasks[ntasks]);
         ntasks++;
@@ -1839,8 +2531,6 @@ zarray_t* fit_quads(apriltag_detector_t *td, int w, int h, zarray_t* clusters, i
 
     workerpool_run(td->wp);
 
-    free(tasks);
-
     return quads;
 }
 
@@ -1938,7 +2628,6 @@ zarray_t *apriltag_quad_thresh(apriltag_detector_t *td, image_u8_t *im)
     }
 
 
-    image_u8_destroy(threshim);
     timeprofile_stamp(td->tp, "make clusters");
 
     ////////////////////////////////////////////////////////
@@ -1986,14 +2675,5 @@ zarray_t *apriltag_quad_thresh(apriltag_detector_t *td, image_u8_t *im)
 
     timeprofile_stamp(td->tp, "fit quads to clusters");
 
-    unionfind_destroy(uf);
-
-    for (int i = 0; i < zarray_size(clusters); i++) {
-        zarray_t *cluster;
-        zarray_get(clusters, i, &cluster);
-        zarray_destroy(cluster);
-    }
-    zarray_destroy(clusters);
-
     return quads;
 }
@@ -437,13 +437,31 @@ image_u8_t *image_u8_rotate(const image_u8_t *in, double rad, uint8_t pad)
 }
 
 image_u8_t *image_u8_decimate(image_u8_t *im, float ffactor)
+{
+    image_u8_t *decim = NULL;
+    image_u8_decimate_reuse(im, ffactor, &decim);
+    return decim;
+}
+
+// Returns *decim, replacing it first unless it is swidth x sheight.
+static image_u8_t *reuse_image(image_u8_t **decim, int swidth, int sheight)
+{
+    if (*decim == NULL || (*decim)->width != swidth || (*decim)->height != sheight) {
+        if (*decim)
+            image_u8_destroy(*decim);
+        *decim = image_u8_create(swidth, sheight);
+    }
+    return *decim;
+}
+
+void image_u8_decimate_reuse(image_u8_t *im, float ffactor, image_u8_t **out)
 {
     int width = im->width, height = im->height;
 
     if (ffactor == 1.5) {
         int swidth = width / 3 * 2, sheight = height / 3 * 2;
 
-        image_u8_t *decim = image_u8_create(swidth, sheight);
+        image_u8_t *decim = reuse_image(out, swidth, sheight);
 
         int y = 0, sy = 0;
         while (sy < sheight) {
@@ -483,14 +501,14 @@ image_u8_t *image_u8_decimate(image_u8_t *im, float ffactor)
             sy += 2;
         }
 
-        return decim;
+        return;
     }
 
     int factor = (int) ffactor;
 
     int swidth = 1 + (width - 1)/factor;
     int sheight = 1 + (height - 1)/factor;
-    image_u8_t *decim = image_u8_create(swidth, sheight);
+    image_u8_t *decim = reuse_image(out, swidth, sheight);
     int sy = 0;
     for (int y = 0; y < height; y += factor) {
         int sx = 0;
@@ -500,7 +518,6 @@ image_u8_t *image_u8_decimate(image_u8_t *im, float ffactor)
         }
         sy++;
     }
-    return decim;
 }
 
 void image_u8_fill_line_max(image_u8_t *im, const image_u8_lut_t *lut, const float *xy0, const float *xy1)
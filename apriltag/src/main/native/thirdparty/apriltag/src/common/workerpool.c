@@ -56,6 +56,10 @@ struct workerpool {
     pthread_cond_t endcond;     // used to signal completion of all work
 
     int end_count; // how many threads are done?
+
+    // set for workerpools created by workerpool_create_external()
+    workerpool_dispatch_t dispatch;
+    void *dispatch_user;
 };
 
 struct task
@@ -129,13 +133,27 @@ workerpool_t *workerpool_create(int nthreads)
     return wp;
 }
 
+workerpool_t *workerpool_create_external(int nthreads, workerpool_dispatch_t dispatch, void *user)
+{
+    assert(nthreads > 0);
+    assert(dispatch != NULL);
+
+    workerpool_t *wp = calloc(1, sizeof(workerpool_t));
+    wp->nthreads = nthreads;
+    wp->tasks = zarray_create(sizeof(struct task));
+    wp->dispatch = dispatch;
+    wp->dispatch_user = user;
+
+    return wp;
+}
+
 void workerpool_destroy(workerpool_t *wp)
 {
     if (wp == NULL)
         return;
 
     // force all worker threads to exit.
-    if (wp->nthreads > 1) {
+    if (wp->nthreads > 1 && wp->dispatch == NULL) {
         for (int i = 0; i < wp->nthreads; i++)
             workerpool_add_task(wp, NULL, NULL);
 
@@ -168,7 +186,7 @@ void workerpool_add_task(workerpool_t *wp, void (*f)(void *p), void *p)
     t.f = f;
     t.p = p;
 
-    if (wp->nthreads > 1) {
+    if (wp->nthreads > 1 && wp->dispatch == NULL) {
         pthread_mutex_lock(&wp->mutex);
         zarray_add(wp->tasks, &t);
         pthread_mutex_unlock(&wp->mutex);
@@ -191,7 +209,12 @@ void workerpool_run_single(workerpool_t *wp)
 // runs all added tasks, waits for them to complete.
 void workerpool_run(workerpool_t *wp)
 {
-    if (wp->nthreads > 1) {
+    if (wp->dispatch != NULL) {
+        int ntasks = zarray_size(wp->tasks);
+        if (ntasks > 0)
+            wp->dispatch(wp->dispatch_user, wp, ntasks);
+        zarray_clear(wp->tasks);
+    } else if (wp->nthreads > 1) {
         pthread_mutex_lock(&wp->mutex);
         wp->end_count = 0;
         wp->start_predicate = true;
@@ -213,6 +236,13 @@ void workerpool_run(workerpool_t *wp)
     }
 }
 
+void workerpool_run_task(workerpool_t *wp, int i)
+{
+    struct task *task;
+    zarray_get_volatile(wp->tasks, i, &task);
+    task->f(task->p);
+}
+
 int workerpool_get_nprocs(void)
 {
 #ifdef _WIN32
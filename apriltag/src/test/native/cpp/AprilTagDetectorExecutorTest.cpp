@@ -0,0 +1,82 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <array>
+#include <future>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "TestFrame.h"
+#include "frc/apriltag/AprilTagDetectorExecutor.h"
+
+using namespace frc;
+
+TEST(AprilTagDetectorExecutorTest, NumThreads) {
+  EXPECT_EQ(AprilTagDetectorExecutor{3}.GetNumThreads(), 3);
+  EXPECT_EQ(AprilTagDetectorExecutor{0}.GetNumThreads(), 1);
+}
+
+TEST(AprilTagDetectorExecutorTest, MatchesSerialDetection) {
+  constexpr std::array<std::array<int, 2>, 3> kSizes{
+      {{642, 483}, {320, 240}, {480, 360}}};
+
+  std::array<AprilTagDetector, kSizes.size()> detectors;
+  std::vector<std::vector<uint8_t>> images;
+  std::vector<AprilTagDetectorExecutor::Frame> frames;
+  for (size_t i = 0; i < kSizes.size(); ++i) {
+    detectors[i].AddFamily("tag36h11");
+    auto [width, height] = kSizes[i];
+    images.emplace_back(RenderTestFrame(width, height));
+  }
+  for (size_t i = 0; i < kSizes.size(); ++i) {
+    auto [width, height] = kSizes[i];
+    frames.push_back({width, height, width, images[i].data()});
+  }
+
+  AprilTagDetectorExecutor executor{3};
+  // Queue several frames per detector so that each detector has frames
+  // waiting on the previous one while the others run
+  std::vector<std::future<AprilTagDetector::Results>> futures;
+  for (int round = 0; round < 4; ++round) {
+    for (size_t i = 0; i < frames.size(); ++i) {
+      futures.emplace_back(executor.Submit(detectors[i], frames[i]));
+    }
+  }
+
+  for (size_t k = 0; k < futures.size(); ++k) {
+    auto results = futures[k].get();
+    auto& frame = frames[k % frames.size()];
+
+    AprilTagDetector serial;
+    serial.AddFamily("tag36h11");
+    auto expected = serial.Detect(frame.width, frame.height, frame.buf);
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t j = 0; j < expected.size(); ++j) {
+      EXPECT_EQ(results[j]->GetId(), expected[j]->GetId());
+      EXPECT_EQ(results[j]->GetCenter().x, expected[j]->GetCenter().x);
+      EXPECT_EQ(results[j]->GetCenter().y, expected[j]->GetCenter().y);
+    }
+  }
+}
+
+TEST(AprilTagDetectorExecutorTest, DestructorFinishesQueuedFrames) {
+  auto image = RenderTestFrame(320, 240);
+  AprilTagDetector detector;
+  detector.AddFamily("tag36h11");
+
+  std::vector<std::future<AprilTagDetector::Results>> futures;
+  {
+    AprilTagDetectorExecutor executor{2};
+    for (int i = 0; i < 3; ++i) {
+      futures.emplace_back(
+          executor.Submit(detector, {320, 240, 320, image.data()}));
+    }
+  }
+
+  for (auto&& future : futures) {
+    EXPECT_FALSE(future.get().empty());
+  }
+}
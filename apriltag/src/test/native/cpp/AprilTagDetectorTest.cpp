@@ -4,8 +4,19 @@
 
 #include <gtest/gtest.h>
 
+#include "TestFrame.h"
 #include "frc/apriltag/AprilTagDetector.h"
 
+#ifdef _WIN32
+#pragma warning(disable : 4200)
+#elif defined(__clang__)
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#elif defined(__GNUC__)
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+#include "apriltag.h"
+
 using namespace frc;
 
 TEST(AprilTagDetectorTest, ConfigDefaults) {
@@ -61,3 +72,85 @@ TEST(AprilTagDetectorTest, RemoveFamily) {
   detector.AddFamily("tag16h5");
   detector.RemoveFamily("tag16h5");
 }
+
+TEST(AprilTagDetectorTest, SimdMatchesScalar) {
+  constexpr int kWidth = 642;
+  constexpr int kHeight = 483;
+  auto frame = RenderTestFrame(kWidth, kHeight);
+
+  AprilTagDetector detector;
+  detector.AddFamily("tag36h11");
+  detector.SetConfig({.quadDecimate = 1.0f});
+
+  apriltag_set_simd_enabled(0);
+  auto scalar = detector.Detect(kWidth, kHeight, frame.data());
+  apriltag_set_simd_enabled(1);
+  auto simd = detector.Detect(kWidth, kHeight, frame.data());
+
+  ASSERT_EQ(scalar.size(), 4u);
+  ASSERT_EQ(scalar.size(), simd.size());
+  for (size_t i = 0; i < scalar.size(); ++i) {
+    EXPECT_EQ(scalar[i]->GetId(), simd[i]->GetId());
+    EXPECT_EQ(scalar[i]->GetHamming(), simd[i]->GetHamming());
+    EXPECT_EQ(scalar[i]->GetDecisionMargin(), simd[i]->GetDecisionMargin());
+    for (int j = 0; j < 4; ++j) {
+      EXPECT_EQ(scalar[i]->GetCorner(j).x, simd[i]->GetCorner(j).x);
+      EXPECT_EQ(scalar[i]->GetCorner(j).y, simd[i]->GetCorner(j).y);
+    }
+  }
+}
+
+TEST(AprilTagDetectorTest, ReuseAcrossFrameSizes) {
+  auto large = RenderTestFrame(642, 483);
+  auto small = RenderTestFrame(320, 240);
+
+  AprilTagDetector detector;
+  detector.AddFamily("tag36h11");
+  detector.SetConfig({.quadDecimate = 1.0f});
+  AprilTagDetector fresh;
+  fresh.AddFamily("tag36h11");
+  fresh.SetConfig({.quadDecimate = 1.0f});
+
+  auto first = detector.Detect(642, 483, large.data());
+  auto shrunk = detector.Detect(320, 240, small.data());
+  auto grown = detector.Detect(642, 483, large.data());
+  auto expected = fresh.Detect(320, 240, small.data());
+
+  ASSERT_EQ(first.size(), 4u);
+  ASSERT_EQ(grown.size(), first.size());
+  for (size_t i = 0; i < first.size(); ++i) {
+    EXPECT_EQ(first[i]->GetId(), grown[i]->GetId());
+    EXPECT_EQ(first[i]->GetCenter().x, grown[i]->GetCenter().x);
+    EXPECT_EQ(first[i]->GetCenter().y, grown[i]->GetCenter().y);
+  }
+
+  ASSERT_EQ(shrunk.size(), 2u);
+  ASSERT_EQ(shrunk.size(), expected.size());
+  for (size_t i = 0; i < shrunk.size(); ++i) {
+    EXPECT_EQ(shrunk[i]->GetId(), expected[i]->GetId());
+    EXPECT_EQ(shrunk[i]->GetCenter().x, expected[i]->GetCenter().x);
+    EXPECT_EQ(shrunk[i]->GetCenter().y, expected[i]->GetCenter().y);
+  }
+}
+
+TEST(AprilTagDetectorTest, ResultsOutliveDetector) {
+  auto frame = RenderTestFrame(642, 483);
+
+  AprilTagDetector::Results kept;
+  {
+    AprilTagDetector detector;
+    detector.AddFamily("tag36h11");
+    detector.SetConfig({.quadDecimate = 1.0f});
+
+    // the second call reuses the storage released by the first results
+    detector.Detect(642, 483, frame.data());
+    kept = detector.Detect(642, 483, frame.data());
+  }
+
+  // families belong to the detector, but the detections themselves remain
+  ASSERT_EQ(kept.size(), 4u);
+  for (auto&& det : kept) {
+    EXPECT_GE(det->GetId(), 0);
+    EXPECT_GT(det->GetDecisionMargin(), 0.0f);
+  }
+}
@@ -0,0 +1,35 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <gtest/gtest.h>
+
+#include "TestFrame.h"
+#include "frc/apriltag/AprilTagDetector.h"
+#include "frc/apriltag/AprilTagPoseEstimator.h"
+
+using namespace frc;
+
+TEST(AprilTagPoseEstimatorTest, BatchMatchesSingle) {
+  auto image = RenderTestFrame(642, 483);
+  AprilTagDetector detector;
+  detector.AddFamily("tag36h11");
+  auto detections = detector.Detect(642, 483, image.data());
+  ASSERT_FALSE(detections.empty());
+
+  AprilTagPoseEstimator estimator{{0.1651_m, 600, 600, 321, 241}};
+  auto homography = estimator.EstimateHomography(detections);
+  auto poses = estimator.Estimate(detections);
+  auto iterations = estimator.EstimateOrthogonalIteration(detections, 50);
+  ASSERT_EQ(homography.size(), detections.size());
+  ASSERT_EQ(poses.size(), detections.size());
+  ASSERT_EQ(iterations.size(), detections.size());
+
+  for (size_t i = 0; i < detections.size(); ++i) {
+    EXPECT_EQ(homography[i], estimator.EstimateHomography(*detections[i]));
+    EXPECT_EQ(poses[i], estimator.Estimate(*detections[i]));
+    auto single = estimator.EstimateOrthogonalIteration(*detections[i], 50);
+    EXPECT_EQ(iterations[i].pose1, single.pose1);
+    EXPECT_EQ(iterations[i].error1, single.error1);
+  }
+}
@@ -0,0 +1,52 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <wpi/RawFrame.h>
+
+#include "frc/apriltag/AprilTag.h"
+
+namespace frc {
+
+/**
+ * Renders 36h11 tags 0-3 at increasing scales onto a noisy gradient. Tags that
+ * don't fit in the frame are left out.
+ */
+inline std::vector<uint8_t> RenderTestFrame(int width, int height) {
+  std::vector<uint8_t> frame(width * height);
+  uint32_t seed = 1;
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      seed = seed * 1664525 + 1013904223;
+      frame[y * width + x] =
+          static_cast<uint8_t>(60 + (x + y) * 100 / (width + height) +
+                               static_cast<int>(seed >> 29));
+    }
+  }
+
+  wpi::RawFrame tag;
+  for (int id = 0; id < 4; ++id) {
+    AprilTag::Generate36h11AprilTagImage(&tag, id);
+    int scale = 6 + 4 * id;
+    int x0 = 13 + id * 140;
+    int y0 = 21 + id * 37;
+    if (x0 + tag.width * scale > width || y0 + tag.height * scale > height) {
+      continue;
+    }
+    for (int y = 0; y < tag.height * scale; ++y) {
+      for (int x = 0; x < tag.width * scale; ++x) {
+        frame[(y0 + y) * width + x0 + x] =
+            tag.data[(y / scale) * tag.stride + x / scale];
+      }
+    }
+  }
+  return frame;
+}
+
+}  // namespace frc
@@ -0,0 +1,53 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <benchmark/benchmark.h>
+#include <frc/apriltag/AprilTagDetector.h>
+
+#include "Allocations.h"
+#include "AprilTagFrame.h"
+
+// Same frame as BM_AprilTagDetect in benchmarkCpp.  Arg 0 selects the quad
+// decimation.  The first detections, which size the detector's reused
+// buffers, are not counted.  Each Results is destroyed before the next
+// Detect() call so its storage is reused, so steady state should not
+// allocate at all; the benchmark fails if it does and C allocations are
+// counted.
+//
+// Counters:
+//   allocs_per_frame  allocations (including those made by the AprilTag C
+//                     library where counted) per Detect() call
+void BM_AprilTagDetectAllocs(benchmark::State& state) {
+  auto frame = apriltagbench::RenderFrame();
+
+  frc::AprilTagDetector detector;
+  detector.AddFamily("tag36h11");
+  detector.SetConfig({.quadDecimate = static_cast<float>(state.range(0))});
+  for (int i = 0; i < 2; ++i) {
+    detector.Detect(apriltagbench::kWidth, apriltagbench::kHeight,
+                    frame.data());
+  }
+
+  uint64_t startAllocs = GetAllocations();
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    auto results = detector.Detect(apriltagbench::kWidth,
+                                   apriltagbench::kHeight, frame.data());
+    benchmark::DoNotOptimize(results.size());
+  }
+
+  uint64_t allocs = GetAllocations() - startAllocs;
+  state.counters["allocs_per_frame"] =
+      static_cast<double>(allocs) / state.iterations();
+  if (allocs != 0 && CountsCAllocations()) {
+    state.SkipWithError("Detect() allocated after warm-up");
+  }
+}
+BENCHMARK(BM_AprilTagDetectAllocs)
+    ->Arg(1)
+    ->Arg(2)
+    ->Unit(benchmark::kMillisecond);
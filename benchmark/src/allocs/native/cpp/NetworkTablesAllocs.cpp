@@ -0,0 +1,85 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <networktables/GenericEntry.h>
+#include <networktables/NetworkTableInstance.h>
+
+#include "Allocations.h"
+#include "NTLoopback.h"
+
+// Same setup as BM_NTLoopback in benchmarkCpp, with the server flushing after
+// every publish.  Arg 0 is the number of clients and arg 1 the number of
+// topics published by the server each iteration.
+//
+// Counters:
+//   allocs_per_update  allocations in the whole process (server, clients and
+//                      benchmark thread) per published value
+template <typename Payload>
+void BM_NTLoopbackAllocs(benchmark::State& state) {
+  const int numClients = state.range(0);
+  const int numTopics = state.range(1);
+
+  ntbench::LoopbackNetwork network{numClients, false};
+  if (!network.WaitForConnections()) {
+    state.SkipWithError("clients did not connect");
+    return;
+  }
+
+  std::vector<nt::GenericPublisher> publishers;
+  for (int i = 0; i < numTopics; ++i) {
+    publishers.emplace_back(
+        network.server.GetTopic(fmt::format("/bench/topic{}", i))
+            .GenericPublish(Payload::kTypeString,
+                            {.periodic = 0.005, .sendAll = true}));
+  }
+
+  int64_t time = 0;
+  auto publish = [&] {
+    ++time;
+    for (auto&& publisher : publishers) {
+      publisher.Set(Payload::Make(time));
+    }
+    network.server.Flush();
+  };
+
+  // wait for the subscriptions to reach the server
+  const size_t perRound = static_cast<size_t>(numClients) * numTopics;
+  publish();
+  if (!network.Receive(perRound, [](const nt::Value&) {})) {
+    state.SkipWithError("values were not received");
+    return;
+  }
+
+  uint64_t startAllocs = GetAllocations();
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    publish();
+    if (!network.Receive(perRound, [](const nt::Value&) {})) {
+      state.SkipWithError("values were not received");
+      return;
+    }
+  }
+
+  double updates = static_cast<double>(state.iterations()) * numTopics;
+  state.counters["allocs_per_update"] = (GetAllocations() - startAllocs) / updates;
+  state.SetItemsProcessed(state.iterations() * numTopics);
+}
+BENCHMARK_TEMPLATE(BM_NTLoopbackAllocs, ntbench::DoublePayload)
+    ->Args({1, 1})
+    ->Args({1, 100})
+    ->Args({4, 100})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NTLoopbackAllocs, ntbench::DoubleArrayPayload)
+    ->Args({1, 100})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NTLoopbackAllocs, ntbench::RawPayload)
+    ->Args({1, 100})
+    ->UseRealTime();
@@ -0,0 +1,29 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+// Allocation counting for benchmarkAllocsCpp.  This is its own executable
+// because counting replaces the process's allocation functions, which would
+// otherwise slow down every other benchmark.
+
+/**
+ * Gets the number of heap allocations made by the whole process so far.
+ * With glibc, this counts malloc(), calloc() and realloc() calls, which
+ * includes C++ operator new and C libraries such as AprilTag.  Elsewhere,
+ * only operator new calls are counted, and calls from DLLs are missed on
+ * Windows.
+ *
+ * @return Number of allocations
+ */
+uint64_t GetAllocations();
+
+/**
+ * Returns true if GetAllocations() includes allocations made by C code.
+ *
+ * @return True if C allocations are counted
+ */
+bool CountsCAllocations();
@@ -0,0 +1,82 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <array>
+#include <cstdint>
+#include <future>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <frc/apriltag/AprilTagDetector.h>
+#include <frc/apriltag/AprilTagDetectorExecutor.h>
+
+#ifdef _WIN32
+#pragma warning(disable : 4200)
+#elif defined(__clang__)
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#elif defined(__GNUC__)
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+#include <apriltag.h>
+
+#include "AprilTagFrame.h"
+
+using apriltagbench::kHeight;
+using apriltagbench::kWidth;
+using apriltagbench::RenderFrame;
+
+// Arg 0 selects the quad decimation, arg 1 enables the SIMD kernels.
+void BM_AprilTagDetect(benchmark::State& state) {
+  auto frame = RenderFrame();
+
+  frc::AprilTagDetector detector;
+  detector.AddFamily("tag36h11");
+  detector.SetConfig({.quadDecimate = static_cast<float>(state.range(0))});
+
+  apriltag_set_simd_enabled(static_cast<int>(state.range(1)));
+  state.SetLabel(apriltag_get_simd_name());
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    auto results = detector.Detect(kWidth, kHeight, frame.data());
+    benchmark::DoNotOptimize(results.size());
+  }
+
+  apriltag_set_simd_enabled(1);
+}
+BENCHMARK(BM_AprilTagDetect)
+    ->ArgsProduct({{1, 2}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+// Four cameras sharing one executor; arg 0 is the executor's thread count.
+void BM_AprilTagDetectExecutor(benchmark::State& state) {
+  auto frame = RenderFrame();
+
+  std::array<frc::AprilTagDetector, 4> detectors;
+  for (auto&& detector : detectors) {
+    detector.AddFamily("tag36h11");
+  }
+
+  frc::AprilTagDetectorExecutor executor{static_cast<int>(state.range(0))};
+  std::vector<std::future<frc::AprilTagDetector::Results>> futures;
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    for (auto&& detector : detectors) {
+      futures.emplace_back(
+          executor.Submit(detector, {kWidth, kHeight, kWidth, frame.data()}));
+    }
+    for (auto&& future : futures) {
+      benchmark::DoNotOptimize(future.get().size());
+    }
+    futures.clear();
+  }
+}
+BENCHMARK(BM_AprilTagDetectExecutor)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,26 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <numbers>
+
+#include <benchmark/benchmark.h>
+#include <frc/controller/ArmFeedforward.h>
+
+#include <units/angle.h>
+#include <units/angular_acceleration.h>
+#include <units/angular_velocity.h>
+#include <units/voltage.h>
+
+void BM_ArmFeedforwardCalculate(benchmark::State& state) {
+  frc::ArmFeedforward armFF{0.5_V, 1_V, 1.5_V / 1_rad_per_s,
+                            2_V / 1_rad_per_s_sq, 5_ms};
+
+  auto angle = std::numbers::pi / 3 * 1_rad;
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        armFF.Calculate(angle, 1_rad_per_s, 1.05_rad_per_s));
+  }
+}
+BENCHMARK(BM_ArmFeedforwardCalculate);
@@ -0,0 +1,109 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <hal/DIO.h>
+#include <hal/Encoder.h>
+#include <hal/HALBase.h>
+#include <hal/PWM.h>
+#include <hal/SensorSnapshot.h>
+
+// Arg 0 is the number of devices read or written per iteration, e.g. one
+// robot loop
+void BM_HALGetDIO(benchmark::State& state) {
+  HAL_Initialize(500, 0);
+  int32_t status = 0;
+  HAL_DigitalHandle handles[8];
+  for (int i = 0; i < 8; ++i) {
+    handles[i] = HAL_InitializeDIOPort(HAL_GetPort(i), true, nullptr, &status);
+  }
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      benchmark::DoNotOptimize(HAL_GetDIO(handles[i % 8], &status));
+    }
+  }
+
+  for (auto handle : handles) {
+    HAL_FreeDIOPort(handle);
+  }
+}
+BENCHMARK(BM_HALGetDIO)->Arg(1)->Arg(40);
+
+void BM_HALSetPWMPulseTime(benchmark::State& state) {
+  HAL_Initialize(500, 0);
+  int32_t status = 0;
+  HAL_DigitalHandle handles[8];
+  for (int i = 0; i < 8; ++i) {
+    handles[i] = HAL_InitializePWMPort(HAL_GetPort(i), nullptr, &status);
+  }
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      HAL_SetPWMPulseTimeMicroseconds(handles[i % 8], 1500, &status);
+    }
+  }
+
+  for (auto handle : handles) {
+    HAL_FreePWMPort(handle);
+  }
+}
+BENCHMARK(BM_HALSetPWMPulseTime)->Arg(1)->Arg(40);
+
+void BM_HALGetEncoder(benchmark::State& state) {
+  HAL_Initialize(500, 0);
+  int32_t status = 0;
+  HAL_DigitalHandle a =
+      HAL_InitializeDIOPort(HAL_GetPort(10), true, nullptr, &status);
+  HAL_DigitalHandle b =
+      HAL_InitializeDIOPort(HAL_GetPort(11), true, nullptr, &status);
+  HAL_EncoderHandle encoder = HAL_InitializeEncoder(
+      a, HAL_Trigger_kInWindow, b, HAL_Trigger_kInWindow, false,
+      HAL_Encoder_k4X, &status);
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      benchmark::DoNotOptimize(HAL_GetEncoder(encoder, &status));
+    }
+  }
+
+  HAL_FreeEncoder(encoder);
+  HAL_FreeDIOPort(a);
+  HAL_FreeDIOPort(b);
+}
+BENCHMARK(BM_HALGetEncoder)->Arg(1)->Arg(40);
+
+void BM_HALReadSensorSnapshot(benchmark::State& state) {
+  HAL_Initialize(500, 0);
+  int32_t status = 0;
+  HAL_DigitalHandle handles[8];
+  for (int i = 0; i < 8; ++i) {
+    handles[i] = HAL_InitializeDIOPort(HAL_GetPort(i), true, nullptr, &status);
+  }
+  HAL_SensorSnapshotHandle snapshot = HAL_InitializeSensorSnapshot(&status);
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    HAL_AddSensorSnapshotSensor(snapshot, HAL_SensorSnapshot_kDIO,
+                                handles[i % 8], &status);
+  }
+  std::vector<double> values(state.range(0));
+  uint64_t timestamp = 0;
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    HAL_ReadSensorSnapshot(snapshot, values.data(), values.size(), &timestamp,
+                           &status);
+    benchmark::DoNotOptimize(values.data());
+  }
+
+  HAL_FreeSensorSnapshot(snapshot);
+  for (auto handle : handles) {
+    HAL_FreeDIOPort(handle);
+  }
+}
+BENCHMARK(BM_HALReadSensorSnapshot)->Arg(1)->Arg(40);
@@ -0,0 +1,50 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <benchmark/benchmark.h>
+#include <frc/controller/LTVDifferentialDriveController.h>
+#include <frc/controller/LTVUnicycleController.h>
+#include <frc/system/plant/LinearSystemId.h>
+
+#include <units/angular_velocity.h>
+#include <units/length.h>
+#include <units/time.h>
+#include <units/velocity.h>
+
+void BM_LTVUnicycleControllerConstruct(benchmark::State& state) {
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    frc::LTVUnicycleController controller{20_ms};
+    benchmark::DoNotOptimize(controller);
+  }
+}
+BENCHMARK(BM_LTVUnicycleControllerConstruct)->Unit(benchmark::kMillisecond);
+
+void BM_LTVDifferentialDriveControllerConstruct(benchmark::State& state) {
+  auto plant = frc::LinearSystemId::IdentifyDrivetrainSystem(
+      3.02_V / 1_mps, 0.642_V / 1_mps_sq, 1.382_V / 1_mps,
+      0.08495_V / 1_mps_sq);
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    frc::LTVDifferentialDriveController controller{
+        plant, 0.9_m, {0.0625, 0.125, 2.5, 0.95, 0.95}, {12.0, 12.0}, 20_ms};
+    benchmark::DoNotOptimize(controller);
+  }
+}
+BENCHMARK(BM_LTVDifferentialDriveControllerConstruct)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_LTVUnicycleControllerCalculate(benchmark::State& state) {
+  frc::LTVUnicycleController controller{20_ms};
+  frc::Pose2d pose{1_m, 2_m, 0.1_rad};
+  frc::Pose2d poseRef{1.1_m, 2.05_m, 0.12_rad};
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        controller.Calculate(pose, poseRef, 2.345_mps, 0.5_rad_per_s));
+  }
+}
+BENCHMARK(BM_LTVUnicycleControllerCalculate);
@@ -0,0 +1,29 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <frc/filter/MedianFilter.h>
+
+// Arg 0 is the window size.
+void BM_MedianFilterCalculate(benchmark::State& state) {
+  frc::MedianFilter<double> filter{static_cast<size_t>(state.range(0))};
+
+  std::mt19937 gen{1};
+  std::normal_distribution<double> dist;
+  std::vector<double> inputs(4096);
+  for (auto&& input : inputs) {
+    input = dist(gen);
+  }
+
+  size_t i = 0;
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(filter.Calculate(inputs[i]));
+    i = (i + 1) % inputs.size();
+  }
+}
+BENCHMARK(BM_MedianFilterCalculate)->RangeMultiplier(4)->Range(4, 1024);
@@ -0,0 +1,200 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <networktables/DoubleTopic.h>
+#include <networktables/GenericEntry.h>
+#include <networktables/NetworkTableInstance.h>
+#include <wpi/timestamp.h>
+
+#include "NTLoopback.h"
+
+namespace {
+nt::NetworkTableInstance inst;
+std::vector<nt::DoubleEntry> entries;
+}  // namespace
+
+// One topic per benchmark thread, like vision threads and the robot loop
+// each updating their own values
+static void SetupThreadTopics(const benchmark::State& state) {
+  inst = nt::NetworkTableInstance::Create();
+  for (int i = 0; i < state.threads(); ++i) {
+    entries.emplace_back(
+        inst.GetDoubleTopic(fmt::format("/bench/thread{}", i)).GetEntry(0));
+    entries.back().Set(0);
+  }
+}
+
+static void TeardownThreadTopics(const benchmark::State&) {
+  entries.clear();
+  nt::NetworkTableInstance::Destroy(inst);
+}
+
+void BM_NTSetGetThreaded(benchmark::State& state) {
+  auto& entry = entries[state.thread_index()];
+  double value = 0;
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    entry.Set(value);
+    benchmark::DoNotOptimize(entry.Get());
+    value += 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NTSetGetThreaded)
+    ->Setup(SetupThreadTopics)
+    ->Teardown(TeardownThreadTopics)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+void BM_NTSetReadQueueThreaded(benchmark::State& state) {
+  auto& entry = entries[state.thread_index()];
+  double value = 0;
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    entry.Set(value);
+    auto queue = entry.ReadQueue();
+    benchmark::DoNotOptimize(queue);
+    value += 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NTSetReadQueueThreaded)
+    ->Setup(SetupThreadTopics)
+    ->Teardown(TeardownThreadTopics)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+//
+// Server and clients in this process, connected over loopback
+//
+
+// Arg 0 is the number of clients, arg 1 the number of topics published by
+// the server each iteration, and arg 2 the publish period in milliseconds.
+// With a period of 0 the server flushes after every publish; otherwise values
+// go out with NT's periodic sends, like a robot program that doesn't flush.
+//
+// Counters:
+//   p50_us, p99_us, max_us  publish-to-receive latency over every value
+//                           received by every client
+//   cpu_us_per_update       CPU time of the whole process (server, clients
+//                           and benchmark thread) per published value
+//   wire_bytes_per_update   TCP bytes in both directions per published value
+//                           (only when bytes are counted)
+//
+// Allocations per update are measured by benchmarkAllocsCpp, which replaces
+// the global operator new.
+template <typename Payload, bool CountBytes>
+void BM_NTLoopback(benchmark::State& state) {
+  const int numClients = state.range(0);
+  const int numTopics = state.range(1);
+  const auto period = std::chrono::milliseconds{state.range(2)};
+
+  ntbench::LoopbackNetwork network{numClients, CountBytes};
+  if (!network.WaitForConnections()) {
+    state.SkipWithError("clients did not connect");
+    return;
+  }
+
+  std::vector<nt::GenericPublisher> publishers;
+  for (int i = 0; i < numTopics; ++i) {
+    publishers.emplace_back(
+        network.server.GetTopic(fmt::format("/bench/topic{}", i))
+            .GenericPublish(Payload::kTypeString,
+                            {.periodic = 0.005, .sendAll = true}));
+  }
+
+  auto publish = [&] {
+    auto now = static_cast<int64_t>(wpi::Now());
+    for (auto&& publisher : publishers) {
+      publisher.Set(Payload::Make(now));
+    }
+    if (period.count() == 0) {
+      network.server.Flush();
+    }
+  };
+
+  // wait for the subscriptions to reach the server
+  const size_t perRound = static_cast<size_t>(numClients) * numTopics;
+  publish();
+  if (!network.Receive(perRound, [](const nt::Value&) {})) {
+    state.SkipWithError("values were not received");
+    return;
+  }
+
+  std::vector<int64_t> latencies;
+  latencies.reserve(1 << 20);
+  auto nextPublish = std::chrono::steady_clock::now();
+  uint64_t startBytes = network.proxy ? network.proxy->GetBytes() : 0;
+  std::clock_t startCpu = std::clock();
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    if (period.count() != 0) {
+      nextPublish += period;
+      std::this_thread::sleep_until(nextPublish);
+    }
+    publish();
+    if (!network.Receive(perRound, [&](const nt::Value& value) {
+          if (latencies.size() < latencies.capacity()) {
+            latencies.emplace_back(static_cast<int64_t>(wpi::Now()) -
+                                   Payload::GetTime(value));
+          }
+        })) {
+      state.SkipWithError("values were not received");
+      return;
+    }
+  }
+
+  double updates = static_cast<double>(state.iterations()) * numTopics;
+  double cpuUs = (std::clock() - startCpu) * 1e6 / CLOCKS_PER_SEC;
+  state.counters["cpu_us_per_update"] = cpuUs / updates;
+  if (network.proxy) {
+    state.counters["wire_bytes_per_update"] =
+        (network.proxy->GetBytes() - startBytes) / updates;
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  if (!latencies.empty()) {
+    auto percentile = [&](double p) {
+      return latencies[static_cast<size_t>(p * (latencies.size() - 1))];
+    };
+    state.counters["p50_us"] = percentile(0.5);
+    state.counters["p99_us"] = percentile(0.99);
+    state.counters["max_us"] = latencies.back();
+  }
+  state.SetItemsProcessed(state.iterations() * numTopics);
+}
+BENCHMARK_TEMPLATE(BM_NTLoopback, ntbench::DoublePayload, false)
+    ->Args({1, 1, 0})
+    ->Args({1, 100, 0})
+    ->Args({4, 100, 0})
+    ->Args({4, 100, 20})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NTLoopback, ntbench::DoubleArrayPayload, false)
+    ->Args({1, 100, 0})
+    ->Args({4, 100, 0})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NTLoopback, ntbench::RawPayload, false)
+    ->Args({1, 100, 0})
+    ->Args({4, 100, 0})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NTLoopback, ntbench::DoublePayload, true)
+    ->Args({1, 100, 0})
+    ->Args({1, 100, 20})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NTLoopback, ntbench::RawPayload, true)
+    ->Args({1, 100, 0})
+    ->UseRealTime();
@@ -0,0 +1,43 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <wpi/Profile.h>
+
+// Cost of a zone while profiling is disabled
+void BM_ProfileScopeDisabled(benchmark::State& state) {
+  wpi::profile::SetEnabled(false);
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    WPI_PROFILE_SCOPE("Disabled");
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(BM_ProfileScopeDisabled);
+
+// Cost of recording a zone, including collecting it
+void BM_ProfileScopeEnabled(benchmark::State& state) {
+  std::vector<wpi::profile::Event> events;
+  wpi::profile::SetEnabled(true);
+  int count = 0;
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    WPI_PROFILE_SCOPE("Enabled");
+    benchmark::ClobberMemory();
+    // collect well before the ring buffer wraps
+    if (++count == 1000) {
+      count = 0;
+      events.clear();
+      wpi::profile::Collect(&events);
+    }
+  }
+  wpi::profile::SetEnabled(false);
+  events.clear();
+  wpi::profile::Collect(&events);
+}
+
+BENCHMARK(BM_ProfileScopeEnabled);
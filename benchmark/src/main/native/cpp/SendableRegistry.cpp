@@ -0,0 +1,96 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <frc/smartdashboard/SendableBuilderImpl.h>
+#include <wpi/sendable/Sendable.h>
+#include <wpi/sendable/SendableRegistry.h>
+
+namespace {
+class EmptySendable : public wpi::Sendable {
+ public:
+  void InitSendable(wpi::SendableBuilder& builder) override {}
+};
+
+// Registers count LiveWindow components, like the sensors and actuators of a
+// large robot program, and removes them when destroyed
+class Components {
+ public:
+  explicit Components(int64_t count) : m_sendables(count) {
+    wpi::SendableRegistry::SetLiveWindowBuilderFactory(
+        [] { return std::make_unique<frc::SendableBuilderImpl>(); });
+    for (int64_t i = 0; i < count; ++i) {
+      wpi::SendableRegistry::AddLW(&m_sendables[i], "Device", i);
+    }
+  }
+
+  ~Components() {
+    for (auto&& sendable : m_sendables) {
+      wpi::SendableRegistry::Remove(&sendable);
+    }
+  }
+
+ private:
+  std::vector<EmptySendable> m_sendables;
+};
+}  // namespace
+
+// Arg 0 is the number of registered components
+void BM_SendableRegistryForeachLiveWindow(benchmark::State& state) {
+  Components components{state.range(0)};
+  int dataHandle = wpi::SendableRegistry::GetDataHandle();
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    wpi::SendableRegistry::ForeachLiveWindow(
+        dataHandle, [](auto& cbdata) { cbdata.builder.Update(); });
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SendableRegistryForeachLiveWindow)->Arg(100)->Arg(1000)->Arg(5000);
+
+// Same, while another thread repeatedly renames a component, e.g. a
+// subsystem being constructed on another thread.  Every iteration sees the
+// change and takes a new snapshot.
+void BM_SendableRegistryForeachWithWriter(benchmark::State& state) {
+  Components components{state.range(0)};
+  int dataHandle = wpi::SendableRegistry::GetDataHandle();
+
+  EmptySendable renamed;
+  wpi::SendableRegistry::AddLW(&renamed, "Renamed");
+  std::atomic<bool> done{false};
+  std::atomic<int64_t> writes{0};
+  std::thread writer{[&] {
+    int64_t i = 0;
+    while (!done.load(std::memory_order_relaxed)) {
+      wpi::SendableRegistry::SetName(&renamed, "Renamed", i++);
+      writes.fetch_add(1, std::memory_order_relaxed);
+    }
+  }};
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    wpi::SendableRegistry::ForeachLiveWindow(
+        dataHandle, [](auto& cbdata) { cbdata.builder.Update(); });
+  }
+
+  done = true;
+  writer.join();
+  wpi::SendableRegistry::Remove(&renamed);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["writes"] = benchmark::Counter(
+      static_cast<double>(writes.load()), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_SendableRegistryForeachWithWriter)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(5000)
+    ->UseRealTime();
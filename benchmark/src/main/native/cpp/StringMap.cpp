@@ -0,0 +1,85 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <wpi/StringHashMap.h>
+#include <wpi/StringMap.h>
+
+// Topic names shaped like a robot's NetworkTables, e.g.
+// "/SmartDashboard/Subsystem12/value34"
+static std::vector<std::string> MakeTopicNames(int64_t count) {
+  std::vector<std::string> names;
+  names.reserve(count);
+  for (int64_t i = 0; i < count; ++i) {
+    names.emplace_back(
+        fmt::format("/SmartDashboard/Subsystem{}/value{}", i % 50, i));
+  }
+  return names;
+}
+
+template <typename Map>
+void BM_StringMapFind(benchmark::State& state) {
+  auto names = MakeTopicNames(state.range(0));
+  Map map;
+  for (size_t i = 0; i < names.size(); ++i) {
+    map[names[i]] = i;
+  }
+
+  size_t i = 0;
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    auto it = map.find(names[i]);
+    benchmark::DoNotOptimize(it);
+    i = (i + 7919) % names.size();
+  }
+}
+BENCHMARK_TEMPLATE(BM_StringMapFind, wpi::StringMap<size_t>)
+    ->Arg(100)
+    ->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StringMapFind, wpi::StringHashMap<size_t>)
+    ->Arg(100)
+    ->Arg(10000);
+
+void BM_StringHashMapFindPrecomputed(benchmark::State& state) {
+  auto names = MakeTopicNames(state.range(0));
+  wpi::StringHashMap<size_t> map;
+  std::vector<uint64_t> hashes;
+  for (size_t i = 0; i < names.size(); ++i) {
+    map[names[i]] = i;
+    hashes.emplace_back(wpi::StringHashMap<size_t>::Hash(names[i]));
+  }
+
+  size_t i = 0;
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    auto it = map.find(names[i], hashes[i]);
+    benchmark::DoNotOptimize(it);
+    i = (i + 7919) % names.size();
+  }
+}
+BENCHMARK(BM_StringHashMapFindPrecomputed)->Arg(100)->Arg(10000);
+
+template <typename Map>
+void BM_StringMapInsert(benchmark::State& state) {
+  auto names = MakeTopicNames(state.range(0));
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    Map map;
+    for (size_t i = 0; i < names.size(); ++i) {
+      map[names[i]] = i;
+    }
+    benchmark::DoNotOptimize(map);
+  }
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK_TEMPLATE(BM_StringMapInsert, wpi::StringMap<size_t>)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StringMapInsert, wpi::StringHashMap<size_t>)
+    ->Arg(10000);
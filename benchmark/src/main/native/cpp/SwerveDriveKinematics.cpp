@@ -0,0 +1,133 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <frc/kinematics/SwerveDriveKinematics.h>
+#include <frc/kinematics/SwerveDriveOdometry.h>
+
+#include <units/angle.h>
+#include <units/angular_velocity.h>
+#include <units/length.h>
+#include <units/velocity.h>
+
+static frc::SwerveDriveKinematics<4> MakeKinematics() {
+  return frc::SwerveDriveKinematics<4>{
+      frc::Translation2d{0.3_m, 0.3_m}, frc::Translation2d{0.3_m, -0.3_m},
+      frc::Translation2d{-0.3_m, 0.3_m}, frc::Translation2d{-0.3_m, -0.3_m}};
+}
+
+// Arg 0 is the number of chassis speeds, e.g. one per simulated robot
+static std::vector<frc::ChassisSpeeds> MakeSpeeds(int64_t count) {
+  std::vector<frc::ChassisSpeeds> speeds;
+  for (int64_t i = 0; i < count; ++i) {
+    speeds.push_back({units::meters_per_second_t{0.01 * i},
+                      units::meters_per_second_t{1.0 - 0.01 * i},
+                      units::radians_per_second_t{0.5}});
+  }
+  return speeds;
+}
+
+void BM_SwerveInverseKinematics(benchmark::State& state) {
+  auto kinematics = MakeKinematics();
+  auto speeds = MakeSpeeds(state.range(0));
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    for (const auto& speed : speeds) {
+      benchmark::DoNotOptimize(kinematics.ToSwerveModuleStates(speed));
+    }
+  }
+}
+BENCHMARK(BM_SwerveInverseKinematics)->Arg(1000);
+
+void BM_SwerveInverseKinematicsBatch(benchmark::State& state) {
+  auto kinematics = MakeKinematics();
+  auto speeds = MakeSpeeds(state.range(0));
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kinematics.ToSwerveModuleStates(speeds));
+  }
+}
+BENCHMARK(BM_SwerveInverseKinematicsBatch)->Arg(1000);
+
+void BM_SwerveForwardKinematics(benchmark::State& state) {
+  auto kinematics = MakeKinematics();
+  auto batch = kinematics.ToSwerveModuleStates(MakeSpeeds(state.range(0)));
+  std::vector<wpi::array<frc::SwerveModuleState, 4>> moduleStates;
+  for (size_t i = 0; i < batch.size(); ++i) {
+    moduleStates.push_back(batch[i]);
+  }
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    for (const auto& states : moduleStates) {
+      benchmark::DoNotOptimize(kinematics.ToChassisSpeeds(states));
+    }
+  }
+}
+BENCHMARK(BM_SwerveForwardKinematics)->Arg(1000);
+
+void BM_SwerveForwardKinematicsBatch(benchmark::State& state) {
+  auto kinematics = MakeKinematics();
+  auto batch = kinematics.ToSwerveModuleStates(MakeSpeeds(state.range(0)));
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kinematics.ToChassisSpeeds(batch));
+  }
+}
+BENCHMARK(BM_SwerveForwardKinematicsBatch)->Arg(1000);
+
+// Arg 0 is the number of buffered odometry measurements
+static void MakeMeasurements(
+    int64_t count, std::vector<frc::Rotation2d>* gyroAngles,
+    std::vector<wpi::array<frc::SwerveModulePosition, 4>>* positions) {
+  for (int64_t i = 1; i <= count; ++i) {
+    units::meter_t distance{0.01 * i};
+    frc::Rotation2d angle{units::degree_t{0.1 * i}};
+    gyroAngles->push_back(angle);
+    positions->push_back({frc::SwerveModulePosition{distance, angle},
+                          frc::SwerveModulePosition{distance, angle},
+                          frc::SwerveModulePosition{distance, angle},
+                          frc::SwerveModulePosition{distance, angle}});
+  }
+}
+
+void BM_SwerveOdometry(benchmark::State& state) {
+  std::vector<frc::Rotation2d> gyroAngles;
+  std::vector<wpi::array<frc::SwerveModulePosition, 4>> positions;
+  MakeMeasurements(state.range(0), &gyroAngles, &positions);
+  frc::SwerveModulePosition zero;
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    frc::SwerveDriveOdometry<4> odometry{
+        MakeKinematics(), frc::Rotation2d{}, {zero, zero, zero, zero}};
+    for (size_t i = 0; i < positions.size(); ++i) {
+      odometry.Update(gyroAngles[i], positions[i]);
+    }
+    frc::Pose2d pose = odometry.GetPose();
+    benchmark::DoNotOptimize(pose);
+  }
+}
+BENCHMARK(BM_SwerveOdometry)->Arg(1000);
+
+void BM_SwerveOdometryBatch(benchmark::State& state) {
+  std::vector<frc::Rotation2d> gyroAngles;
+  std::vector<wpi::array<frc::SwerveModulePosition, 4>> positions;
+  MakeMeasurements(state.range(0), &gyroAngles, &positions);
+  frc::SwerveModulePosition zero;
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    frc::SwerveDriveOdometry<4> odometry{
+        MakeKinematics(), frc::Rotation2d{}, {zero, zero, zero, zero}};
+    frc::Pose2d pose = odometry.Update(gyroAngles, positions);
+    benchmark::DoNotOptimize(pose);
+  }
+}
+BENCHMARK(BM_SwerveOdometryBatch)->Arg(1000);
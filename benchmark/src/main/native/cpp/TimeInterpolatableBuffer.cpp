@@ -0,0 +1,31 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <benchmark/benchmark.h>
+#include <frc/geometry/Pose2d.h>
+#include <frc/interpolation/TimeInterpolatableBuffer.h>
+
+#include <units/time.h>
+#include <units/velocity.h>
+
+// Matches the pose estimator's odometry history: a 1.5 s window filled by
+// updates every 4 ms (250 Hz), sampled once per update at a vision latency.
+void BM_TimeInterpolatableBufferAddSample(benchmark::State& state) {
+  frc::TimeInterpolatableBuffer<frc::Pose2d> buffer{1.5_s};
+  units::second_t time = 0_s;
+
+  // Fill the window so every iteration evicts a sample
+  for (int i = 0; i < 400; ++i) {
+    buffer.AddSample(time, frc::Pose2d{time * 1_mps, 0_m, 0_rad});
+    time += 4_ms;
+  }
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    buffer.AddSample(time, frc::Pose2d{time * 1_mps, 0_m, 0_rad});
+    benchmark::DoNotOptimize(buffer.Sample(time - 63_ms));
+    time += 4_ms;
+  }
+}
+BENCHMARK(BM_TimeInterpolatableBufferAddSample);
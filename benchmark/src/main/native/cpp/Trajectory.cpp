@@ -0,0 +1,64 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <frc/trajectory/Trajectory.h>
+#include <frc/trajectory/TrajectoryGenerator.h>
+
+#include <units/acceleration.h>
+#include <units/angle.h>
+#include <units/length.h>
+#include <units/time.h>
+#include <units/velocity.h>
+
+static frc::Trajectory MakeTrajectory() {
+  std::vector<frc::Pose2d> waypoints;
+  for (int i = 0; i <= 16; ++i) {
+    waypoints.emplace_back(units::meter_t{1.0 * i},
+                           units::meter_t{i % 2 == 0 ? 1.0 : 3.0},
+                           units::degree_t{i % 2 == 0 ? 45.0 : -45.0});
+  }
+  return frc::TrajectoryGenerator::GenerateTrajectory(
+      waypoints, frc::TrajectoryConfig{3_mps, 3_mps_sq});
+}
+
+// Each iteration follows the whole trajectory at a 20 ms loop period
+void BM_TrajectorySample(benchmark::State& state) {
+  auto trajectory = MakeTrajectory();
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    for (auto t = 0_s; t < trajectory.TotalTime(); t += 20_ms) {
+      benchmark::DoNotOptimize(trajectory.Sample(t));
+    }
+  }
+}
+BENCHMARK(BM_TrajectorySample)->Unit(benchmark::kMicrosecond);
+
+void BM_TrajectorySampler(benchmark::State& state) {
+  auto trajectory = MakeTrajectory();
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    frc::Trajectory::Sampler sampler{trajectory};
+    for (auto t = 0_s; t < trajectory.TotalTime(); t += 20_ms) {
+      benchmark::DoNotOptimize(sampler.Sample(t));
+    }
+  }
+}
+BENCHMARK(BM_TrajectorySampler)->Unit(benchmark::kMicrosecond);
+
+void BM_TrajectorySampleResampled(benchmark::State& state) {
+  auto trajectory = MakeTrajectory().Resample(20_ms);
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    for (auto t = 0_s; t < trajectory.TotalTime(); t += 20_ms) {
+      benchmark::DoNotOptimize(trajectory.Sample(t));
+    }
+  }
+}
+BENCHMARK(BM_TrajectorySampleResampled)->Unit(benchmark::kMicrosecond);
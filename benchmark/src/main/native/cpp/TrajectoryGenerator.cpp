@@ -0,0 +1,73 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <frc/trajectory/TrajectoryGenerator.h>
+#include <frc/trajectory/TrajectoryGeneratorService.h>
+
+#include <units/acceleration.h>
+#include <units/angle.h>
+#include <units/length.h>
+#include <units/velocity.h>
+
+// A path with eight splines, similar to a multi-piece autonomous routine
+static std::vector<frc::Pose2d> MakeWaypoints() {
+  std::vector<frc::Pose2d> waypoints;
+  for (int i = 0; i <= 8; ++i) {
+    waypoints.emplace_back(units::meter_t{2.0 * i},
+                           units::meter_t{i % 2 == 0 ? 0.0 : 1.5},
+                           units::degree_t{i % 2 == 0 ? 30.0 : -30.0});
+  }
+  return waypoints;
+}
+
+void BM_TrajectoryGenerator(benchmark::State& state) {
+  auto waypoints = MakeWaypoints();
+  frc::TrajectoryConfig config{3_mps, 3_mps_sq};
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    auto trajectory =
+        frc::TrajectoryGenerator::GenerateTrajectory(waypoints, config);
+    benchmark::DoNotOptimize(trajectory);
+  }
+}
+BENCHMARK(BM_TrajectoryGenerator)->Unit(benchmark::kMicrosecond);
+
+// Arg 0 is the service's thread count
+void BM_TrajectoryGeneratorService(benchmark::State& state) {
+  auto waypoints = MakeWaypoints();
+  frc::TrajectoryGeneratorService service{static_cast<int>(state.range(0))};
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    service.ClearCache();
+    auto trajectory =
+        service.Generate(waypoints, frc::TrajectoryConfig{3_mps, 3_mps_sq});
+    benchmark::DoNotOptimize(trajectory);
+  }
+}
+BENCHMARK(BM_TrajectoryGeneratorService)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+void BM_TrajectoryGeneratorServiceCached(benchmark::State& state) {
+  auto waypoints = MakeWaypoints();
+  frc::TrajectoryGeneratorService service{1};
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    auto trajectory =
+        service.Generate(waypoints, frc::TrajectoryConfig{3_mps, 3_mps_sq});
+    benchmark::DoNotOptimize(trajectory);
+  }
+}
+BENCHMARK(BM_TrajectoryGeneratorServiceCached)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
@@ -0,0 +1,78 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <frc/kinematics/DifferentialDriveKinematics.h>
+#include <frc/spline/SplineHelper.h>
+#include <frc/trajectory/TrajectoryGenerator.h>
+#include <frc/trajectory/TrajectoryParameterizer.h>
+#include <frc/trajectory/constraint/CentripetalAccelerationConstraint.h>
+#include <frc/trajectory/constraint/DifferentialDriveKinematicsConstraint.h>
+#include <frc/trajectory/constraint/EllipticalRegionConstraint.h>
+#include <frc/trajectory/constraint/MaxVelocityConstraint.h>
+#include <frc/trajectory/constraint/RectangularRegionConstraint.h>
+
+#include <units/acceleration.h>
+#include <units/angle.h>
+#include <units/length.h>
+#include <units/velocity.h>
+
+// Spline points of a long weaving path across the field
+static std::vector<frc::TrajectoryParameterizer::PoseWithCurvature>
+MakePoints() {
+  std::vector<frc::Pose2d> waypoints;
+  for (int i = 0; i <= 16; ++i) {
+    waypoints.emplace_back(units::meter_t{1.0 * i},
+                           units::meter_t{i % 2 == 0 ? 1.0 : 3.0},
+                           units::degree_t{i % 2 == 0 ? 45.0 : -45.0});
+  }
+  return frc::TrajectoryGenerator::SplinePointsFromSplines(
+      frc::SplineHelper::QuinticSplinesFromWaypoints(waypoints));
+}
+
+using RectangularSlowZone =
+    frc::RectangularRegionConstraint<frc::MaxVelocityConstraint>;
+using EllipticalSlowZone =
+    frc::EllipticalRegionConstraint<frc::MaxVelocityConstraint>;
+
+// Arg 0 is the number of slow-zone region constraints along the path
+void BM_TimeParameterizeTrajectory(benchmark::State& state) {
+  auto points = MakePoints();
+
+  std::vector<std::unique_ptr<frc::TrajectoryConstraint>> constraints;
+  constraints.emplace_back(
+      std::make_unique<frc::CentripetalAccelerationConstraint>(2_mps_sq));
+  constraints.emplace_back(
+      std::make_unique<frc::DifferentialDriveKinematicsConstraint>(
+          frc::DifferentialDriveKinematics{0.7_m}, 3_mps));
+  for (int i = 0; i < state.range(0); ++i) {
+    units::meter_t x{16.0 * i / state.range(0)};
+    if (i % 2 == 0) {
+      constraints.emplace_back(std::make_unique<RectangularSlowZone>(
+          frc::Rectangle2d{{x, 0_m}, {x + 0.5_m, 4_m}},
+          frc::MaxVelocityConstraint{1_mps}));
+    } else {
+      constraints.emplace_back(std::make_unique<EllipticalSlowZone>(
+          frc::Ellipse2d{frc::Pose2d{x, 2_m, 0_deg}, 0.5_m, 2_m},
+          frc::MaxVelocityConstraint{1_mps}));
+    }
+  }
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    auto trajectory =
+        frc::TrajectoryParameterizer::TimeParameterizeTrajectory(
+            points, constraints, 0_mps, 0_mps, 4_mps, 3_mps_sq, false);
+    benchmark::DoNotOptimize(trajectory);
+  }
+}
+BENCHMARK(BM_TimeParameterizeTrajectory)
+    ->Arg(0)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64)
+    ->Unit(benchmark::kMicrosecond);
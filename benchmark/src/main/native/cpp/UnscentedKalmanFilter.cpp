@@ -0,0 +1,94 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+#include <frc/EigenCore.h>
+#include <frc/estimator/UnscentedKalmanFilter.h>
+
+#include <units/time.h>
+
+// Swerve-like model with pose, chassis velocity and gyro bias states
+static frc::Vectord<8> Dynamics(const frc::Vectord<8>& x,
+                                const frc::Vectord<3>& u) {
+  double cos = std::cos(x(2));
+  double sin = std::sin(x(2));
+  return frc::Vectord<8>{cos * x(3) - sin * x(4),
+                         sin * x(3) + cos * x(4),
+                         x(5),
+                         5.0 * (u(0) - x(3)),
+                         5.0 * (u(1) - x(4)),
+                         5.0 * (u(2) - x(5)),
+                         0.0,
+                         0.0};
+}
+
+static frc::Matrixd<8, 17> BatchDynamics(const frc::Matrixd<8, 17>& sigmas,
+                                         const frc::Vectord<3>& u) {
+  auto theta = sigmas.row(2).array();
+  auto vx = sigmas.row(3).array();
+  auto vy = sigmas.row(4).array();
+
+  frc::Matrixd<8, 17> xdot;
+  xdot.row(0) = theta.cos() * vx - theta.sin() * vy;
+  xdot.row(1) = theta.sin() * vx + theta.cos() * vy;
+  xdot.row(2) = sigmas.row(5);
+  xdot.row(3) = 5.0 * (u(0) - vx);
+  xdot.row(4) = 5.0 * (u(1) - vy);
+  xdot.row(5) = 5.0 * (u(2) - sigmas.row(5).array());
+  xdot.bottomRows<2>().setZero();
+  return xdot;
+}
+
+static frc::Vectord<4> Measurement(
+    const frc::Vectord<8>& x, [[maybe_unused]] const frc::Vectord<3>& u) {
+  return frc::Vectord<4>{x(3), x(4), x(5) + x(6), x(2) + x(7)};
+}
+
+static frc::UnscentedKalmanFilter<8, 3, 4> MakeFilter() {
+  frc::UnscentedKalmanFilter<8, 3, 4> filter{
+      Dynamics,
+      Measurement,
+      {0.1, 0.1, 0.1, 0.5, 0.5, 0.5, 0.01, 0.01},
+      {0.05, 0.05, 0.02, 0.01},
+      5_ms};
+  filter.SetP(frc::Matrixd<8, 8>::Identity() * 0.01);
+  return filter;
+}
+
+static void RunFilter(benchmark::State& state,
+                      frc::UnscentedKalmanFilter<8, 3, 4>& filter) {
+  frc::Vectord<3> u{1.0, 0.5, 0.2};
+  frc::Vectord<4> y{1.0, 0.5, 0.2, 0.0};
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    filter.Predict(u, 5_ms);
+    filter.Correct(u, y);
+    frc::Vectord<8> xHat = filter.Xhat();
+    benchmark::DoNotOptimize(xHat);
+  }
+}
+
+void BM_UnscentedKalmanFilter(benchmark::State& state) {
+  auto filter = MakeFilter();
+  RunFilter(state, filter);
+}
+BENCHMARK(BM_UnscentedKalmanFilter);
+
+void BM_UnscentedKalmanFilterBatchDynamics(benchmark::State& state) {
+  auto filter = MakeFilter();
+  filter.SetBatchDynamics(BatchDynamics);
+  RunFilter(state, filter);
+}
+BENCHMARK(BM_UnscentedKalmanFilterBatchDynamics);
+
+void BM_UnscentedKalmanFilterCachedNoise(benchmark::State& state) {
+  auto filter = MakeFilter();
+  filter.SetBatchDynamics(BatchDynamics);
+  filter.SetCacheProcessNoise(true);
+  RunFilter(state, filter);
+}
+BENCHMARK(BM_UnscentedKalmanFilterCachedNoise);
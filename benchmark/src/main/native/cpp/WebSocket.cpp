@@ -0,0 +1,147 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <wpinet/WebSocket.h>
+#include <wpinet/WebSocketServer.h>
+#include <wpinet/uv/Loop.h>
+#include <wpinet/uv/Tcp.h>
+#include <wpinet/uv/util.h>
+
+namespace uv = wpi::uv;
+
+namespace {
+
+constexpr int kMessagesPerIteration = 16;
+
+// Struct array payload, similar to what NT4 clients publish for poses: each
+// element is a double x, y, and heading that drift slightly between updates.
+class PosePayload {
+ public:
+  explicit PosePayload(size_t size) : m_data(size) {
+    m_poses.resize(m_data.size() / sizeof(double));
+    for (size_t i = 0; i < m_poses.size(); ++i) {
+      m_poses[i] = static_cast<double>(i % 3) * 0.5 + static_cast<double>(i);
+    }
+  }
+
+  std::span<const uint8_t> Next() {
+    for (size_t i = 0; i < m_poses.size(); ++i) {
+      m_poses[i] += 0.001 * static_cast<double>((i + m_count) % 7);
+    }
+    ++m_count;
+    if (!m_poses.empty()) {
+      std::memcpy(m_data.data(), m_poses.data(),
+                  m_poses.size() * sizeof(double));
+    }
+    return m_data;
+  }
+
+ private:
+  std::vector<double> m_poses;
+  std::vector<uint8_t> m_data;
+  size_t m_count = 0;
+};
+
+}  // namespace
+
+// A client and server in one event loop, connected over loopback TCP.  The
+// client sends binary messages to the server.  Arguments are the message size
+// and whether permessage-deflate is offered and accepted.
+void BM_WebSocketThroughput(benchmark::State& state) {
+  size_t size = state.range(0);
+  bool deflate = state.range(1) != 0;
+
+  auto loop = uv::Loop::Create();
+  auto listener = uv::Tcp::Create(loop);
+  listener->Bind("127.0.0.1", 0);
+  std::string ip;
+  unsigned int port = 0;
+  uv::AddrToName(listener->GetSock(), &ip, &port);
+
+  uint64_t received = 0;
+  uint64_t wireBytes = 0;
+  listener->Listen([&] {
+    auto conn = listener->Accept();
+    if (!conn) {
+      return;
+    }
+    conn->SetNoDelay(true);
+    conn->data.connect(
+        [&](uv::Buffer&, size_t len) { wireBytes += len; });
+    wpi::WebSocketServer::ServerOptions options;
+    options.deflate.enable = deflate;
+    auto server = wpi::WebSocketServer::Create(*conn, {}, options);
+    server->connected.connect([&](std::string_view, wpi::WebSocket& ws) {
+      ws.binary.connect([&](std::span<const uint8_t>, bool) { ++received; });
+    });
+  });
+
+  auto client = uv::Tcp::Create(loop);
+  std::shared_ptr<wpi::WebSocket> ws;
+  bool open = false;
+  client->Connect("127.0.0.1", port, [&] {
+    client->SetNoDelay(true);
+    wpi::WebSocket::ClientOptions options;
+    options.deflate.enable = deflate;
+    ws = wpi::WebSocket::CreateClient(*client, "/", "127.0.0.1", {}, options);
+    ws->open.connect([&](std::string_view) { open = true; });
+  });
+  while (!open) {
+    loop->Run(uv::Loop::kOnce);
+  }
+  if (ws->IsDeflateEnabled() != deflate) {
+    state.SkipWithError("permessage-deflate negotiation failed");
+  }
+
+  PosePayload payload{size};
+  uint64_t pending = 0;
+  uint64_t expected = 0;
+  wireBytes = 0;
+
+  // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+  for (auto _ : state) {
+    for (int i = 0; i < kMessagesPerIteration; ++i) {
+      ++pending;
+      ws->SendBinary({uv::Buffer::Dup(payload.Next())},
+                     [&](auto bufs, uv::Error) {
+                       for (auto&& buf : bufs) {
+                         buf.Deallocate();
+                       }
+                       --pending;
+                     });
+    }
+    expected += kMessagesPerIteration;
+    while (received < expected || pending != 0) {
+      loop->Run(uv::Loop::kOnce);
+    }
+  }
+
+  uint64_t messages = state.iterations() * kMessagesPerIteration;
+  state.SetItemsProcessed(messages);
+  state.SetBytesProcessed(messages * size);
+  if (messages != 0) {
+    // client to server, including WebSocket framing
+    state.counters["wire_bytes_per_msg"] =
+        static_cast<double>(wireBytes) / static_cast<double>(messages);
+  }
+
+  ws->Close();
+  client->Close();
+  listener->Close();
+  loop->Run();
+}
+BENCHMARK(BM_WebSocketThroughput)
+    ->ArgNames({"size", "deflate"})
+    ->ArgsProduct({{64, 1024, 16384}, {0, 1}})
+    ->UseRealTime();
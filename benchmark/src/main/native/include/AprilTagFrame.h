@@ -0,0 +1,50 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <frc/apriltag/AprilTag.h>
+#include <wpi/RawFrame.h>
+
+// Test image shared by the AprilTag benchmarks
+namespace apriltagbench {
+
+inline constexpr int kWidth = 1280;
+inline constexpr int kHeight = 720;
+
+// Approximates a field camera frame: a noisy lighting gradient with a grid of
+// 36h11 tags at several distances.
+inline std::vector<uint8_t> RenderFrame() {
+  std::vector<uint8_t> frame(kWidth * kHeight);
+  uint32_t seed = 1;
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      seed = seed * 1664525 + 1013904223;
+      frame[y * kWidth + x] =
+          static_cast<uint8_t>(40 + (x + 2 * y) * 150 / (kWidth + 2 * kHeight) +
+                               static_cast<int>(seed >> 28));
+    }
+  }
+
+  wpi::RawFrame tag;
+  for (int id = 0; id < 12; ++id) {
+    frc::AprilTag::Generate36h11AprilTagImage(&tag, id);
+    int scale = 4 + 2 * (id % 4);
+    int x0 = 40 + (id % 4) * 300;
+    int y0 = 40 + (id / 4) * 220;
+    for (int y = 0; y < tag.height * scale; ++y) {
+      for (int x = 0; x < tag.width * scale; ++x) {
+        frame[(y0 + y) * kWidth + x0 + x] =
+            tag.data[(y / scale) * tag.stride + x / scale];
+      }
+    }
+  }
+  return frame;
+}
+
+}  // namespace apriltagbench
@@ -0,0 +1,262 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <networktables/MultiSubscriber.h>
+#include <networktables/NetworkTableInstance.h>
+#include <networktables/NetworkTableListener.h>
+#include <networktables/NetworkTableValue.h>
+#include <wpi/Logger.h>
+#include <wpi/Synchronization.h>
+#include <wpinet/TCPAcceptor.h>
+#include <wpinet/TCPConnector.h>
+
+// Server and clients in one process, connected over loopback, shared by the
+// NetworkTables benchmarks
+namespace ntbench {
+
+
+// Gets a free port for the server.  NT servers can't listen on port 0, so
+// this binds a socket to port 0 and returns the port picked by the OS after
+// closing it again.
+inline unsigned int GetFreePort() {
+  wpi::Logger logger;
+  wpi::TCPAcceptor acceptor{0, "127.0.0.1", logger};
+  if (acceptor.start() != 0) {
+    return 0;
+  }
+  return acceptor.getPort();
+}
+
+// Forwards connections to the server and counts the bytes passing through in
+// both directions
+class CountingProxy {
+ public:
+  explicit CountingProxy(unsigned int serverPort)
+      : m_serverPort{serverPort}, m_acceptor{0, "127.0.0.1", m_logger} {
+    m_acceptor.start();
+    m_acceptThread = std::thread{[this] { AcceptLoop(); }};
+  }
+
+  ~CountingProxy() {
+    m_acceptor.shutdown();
+    m_acceptThread.join();
+    m_stop = true;
+    for (auto&& thread : m_forwardThreads) {
+      thread.join();
+    }
+  }
+
+  unsigned int GetPort() const { return m_acceptor.getPort(); }
+
+  uint64_t GetBytes() const { return m_bytes; }
+
+ private:
+  struct Connection {
+    std::unique_ptr<wpi::NetworkStream> client;
+    std::unique_ptr<wpi::NetworkStream> server;
+  };
+
+  void AcceptLoop() {
+    while (auto client = m_acceptor.accept()) {
+      auto server =
+          wpi::TCPConnector::connect("127.0.0.1", m_serverPort, m_logger, 1);
+      if (!server) {
+        continue;
+      }
+      client->setNoDelay();
+      server->setNoDelay();
+      auto& conn = *m_connections.emplace_back(
+          std::make_unique<Connection>(std::move(client), std::move(server)));
+      m_forwardThreads.emplace_back(
+          [this, &conn] { Forward(*conn.client, *conn.server); });
+      m_forwardThreads.emplace_back(
+          [this, &conn] { Forward(*conn.server, *conn.client); });
+    }
+  }
+
+  void Forward(wpi::NetworkStream& from, wpi::NetworkStream& to) {
+    char buf[4096];
+    while (!m_stop) {
+      wpi::NetworkStream::Error err;
+      // time out once a second to check for shutdown
+      size_t len = from.receive(buf, sizeof(buf), &err, 1);
+      if (len == 0) {
+        if (err == wpi::NetworkStream::kConnectionTimedOut) {
+          continue;
+        }
+        return;
+      }
+      m_bytes += len;
+      for (size_t sent = 0; sent < len;) {
+        size_t count = to.send(buf + sent, len - sent, &err);
+        if (count == 0) {
+          return;
+        }
+        sent += count;
+      }
+    }
+  }
+
+  unsigned int m_serverPort;
+  wpi::Logger m_logger;
+  wpi::TCPAcceptor m_acceptor;
+  std::thread m_acceptThread;
+  std::vector<std::unique_ptr<Connection>> m_connections;
+  std::vector<std::thread> m_forwardThreads;
+  std::atomic_bool m_stop{false};
+  std::atomic<uint64_t> m_bytes{0};
+};
+
+// A client subscribed to every topic under /bench/, with a poller receiving
+// its value updates
+struct LoopbackClient {
+  static constexpr std::string_view kPrefixes[] = {"/bench/"};
+
+  LoopbackClient(int index, unsigned int port)
+      : inst{nt::NetworkTableInstance::Create()},
+        subscriber{inst, kPrefixes, {.periodic = 0.005, .sendAll = true}},
+        poller{inst} {
+    poller.AddListener(subscriber, nt::EventFlags::kValueRemote);
+    inst.StartClient4(fmt::format("bench{}", index));
+    inst.SetServer("127.0.0.1", port);
+  }
+
+  ~LoopbackClient() {
+    poller = nt::NetworkTableListenerPoller{};
+    subscriber = nt::MultiSubscriber{};
+    nt::NetworkTableInstance::Destroy(inst);
+  }
+
+  nt::NetworkTableInstance inst;
+  nt::MultiSubscriber subscriber;
+  nt::NetworkTableListenerPoller poller;
+};
+
+class LoopbackNetwork {
+ public:
+  LoopbackNetwork(int numClients, bool countBytes)
+      : server{nt::NetworkTableInstance::Create()} {
+    unsigned int port = GetFreePort();
+    m_persistFile = std::filesystem::temp_directory_path() /
+                    fmt::format("ntbenchmark-{}.json", port);
+    server.StartServer(m_persistFile.string(), "127.0.0.1", 0, port);
+    if (countBytes) {
+      proxy = std::make_unique<CountingProxy>(port);
+      port = proxy->GetPort();
+    }
+    for (int i = 0; i < numClients; ++i) {
+      clients.emplace_back(std::make_unique<LoopbackClient>(i, port));
+      pollerHandles.emplace_back(clients.back()->poller.GetHandle());
+    }
+  }
+
+  ~LoopbackNetwork() {
+    clients.clear();
+    proxy.reset();
+    nt::NetworkTableInstance::Destroy(server);
+    std::error_code ec;
+    std::filesystem::remove(m_persistFile, ec);
+  }
+
+  bool WaitForConnections() {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    for (auto&& client : clients) {
+      while (!client->inst.IsConnected()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+          return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+      }
+    }
+    return true;
+  }
+
+  // Waits until every client has received count values, calling func with
+  // each one.  Returns false on timeout.
+  template <typename F>
+  bool Receive(size_t count, F&& func) {
+    std::vector<WPI_Handle> signaled(pollerHandles.size());
+    while (count > 0) {
+      bool timedOut;
+      auto handles = wpi::WaitForObjects(pollerHandles, signaled, 1.0, &timedOut);
+      if (timedOut) {
+        return false;
+      }
+      for (auto handle : handles) {
+        for (auto&& event :
+             nt::ReadListenerQueue(static_cast<NT_ListenerPoller>(handle))) {
+          if (auto data = event.GetValueEventData()) {
+            func(data->value);
+            --count;
+          }
+        }
+      }
+    }
+    return true;
+  }
+
+  nt::NetworkTableInstance server;
+  std::unique_ptr<CountingProxy> proxy;
+  std::vector<std::unique_ptr<LoopbackClient>> clients;
+  std::vector<WPI_Handle> pollerHandles;
+
+ private:
+  std::filesystem::path m_persistFile;
+};
+
+// Payloads carry their send time so receivers can compute latency
+struct DoublePayload {
+  static constexpr std::string_view kTypeString = "double";
+  static nt::Value Make(int64_t time) {
+    return nt::Value::MakeDouble(static_cast<double>(time));
+  }
+  static int64_t GetTime(const nt::Value& value) {
+    return static_cast<int64_t>(value.GetDouble());
+  }
+};
+
+struct DoubleArrayPayload {
+  static constexpr std::string_view kTypeString = "double[]";
+  static nt::Value Make(int64_t time) {
+    std::vector<double> arr(32, 1.0);
+    arr[0] = static_cast<double>(time);
+    return nt::Value::MakeDoubleArray(std::move(arr));
+  }
+  static int64_t GetTime(const nt::Value& value) {
+    return static_cast<int64_t>(value.GetDoubleArray()[0]);
+  }
+};
+
+// e.g. a struct-serialized array of poses
+struct RawPayload {
+  static constexpr std::string_view kTypeString = "raw";
+  static nt::Value Make(int64_t time) {
+    std::vector<uint8_t> raw(256);
+    std::memcpy(raw.data(), &time, sizeof(time));
+    return nt::Value::MakeRaw(std::move(raw));
+  }
+  static int64_t GetTime(const nt::Value& value) {
+    int64_t time;
+    std::memcpy(&time, value.GetRaw().data(), sizeof(time));
+    return time;
+  }
+};
+
+}  // namespace ntbench
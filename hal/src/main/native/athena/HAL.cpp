@@ -94,6 +94,7 @@ void InitializeHAL() {
   InitializePower();
   InitializePWM();
   InitializeRelay();
+  InitializeSensorSnapshot();
   InitializeSerialPort();
   InitializeSPI();
   InitializeThreads();
@@ -49,6 +49,7 @@ extern void InitializePorts();
 extern void InitializePower();
 extern void InitializePWM();
 extern void InitializeRelay();
+extern void InitializeSensorSnapshot();
 extern void InitializeSerialPort();
 extern void InitializeSPI();
 extern void InitializeThreads();
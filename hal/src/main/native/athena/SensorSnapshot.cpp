@@ -0,0 +1,242 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "hal/SensorSnapshot.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <wpi/mutex.h>
+
+#include "AnalogInternal.h"
+#include "DigitalInternal.h"
+#include "HALInitializer.h"
+#include "HALInternal.h"
+#include "hal/AnalogInput.h"
+#include "hal/DIO.h"
+#include "hal/DutyCycle.h"
+#include "hal/Encoder.h"
+#include "hal/Errors.h"
+#include "hal/HALBase.h"
+#include "hal/handles/HandlesInternal.h"
+#include "hal/handles/UnlimitedHandleResource.h"
+
+using namespace hal;
+
+namespace {
+// Which field of tDIO::tDI a digital input is in
+enum class DIOGroup { kHeaders, kMXP, kSPI };
+
+struct SensorEntry {
+  HAL_SensorSnapshotType type;
+  HAL_Handle handle;
+  // Digital and analog inputs are resolved to their FPGA channel (and analog
+  // calibration) when added, so reading them doesn't go through the handle
+  DIOGroup dioGroup = DIOGroup::kHeaders;
+  int32_t channel = 0;
+  double lsbWeight = 0;
+  double offset = 0;
+};
+
+struct SensorSnapshot {
+  wpi::mutex mutex;
+  std::vector<SensorEntry> entries;
+  bool hasDIO = false;
+};
+}  // namespace
+
+static UnlimitedHandleResource<HAL_SensorSnapshotHandle, SensorSnapshot,
+                               HAL_HandleEnum::SensorSnapshot>*
+    sensorSnapshotHandles;
+
+namespace hal::init {
+void InitializeSensorSnapshot() {
+  static UnlimitedHandleResource<HAL_SensorSnapshotHandle, SensorSnapshot,
+                                 HAL_HandleEnum::SensorSnapshot>
+      ssH;
+  sensorSnapshotHandles = &ssH;
+}
+}  // namespace hal::init
+
+static HAL_HandleEnum GetSensorHandleType(HAL_SensorSnapshotType type) {
+  switch (type) {
+    case HAL_SensorSnapshot_kDIO:
+      return HAL_HandleEnum::DIO;
+    case HAL_SensorSnapshot_kAnalogVoltage:
+      return HAL_HandleEnum::AnalogInput;
+    case HAL_SensorSnapshot_kEncoder:
+      return HAL_HandleEnum::Encoder;
+    case HAL_SensorSnapshot_kDutyCycle:
+      return HAL_HandleEnum::DutyCycle;
+    default:
+      return HAL_HandleEnum::Undefined;
+  }
+}
+
+extern "C" {
+
+HAL_SensorSnapshotHandle HAL_InitializeSensorSnapshot(int32_t* status) {
+  hal::init::CheckInit();
+  auto handle =
+      sensorSnapshotHandles->Allocate(std::make_shared<SensorSnapshot>());
+  if (handle == HAL_kInvalidHandle) {
+    *status = NO_AVAILABLE_RESOURCES;
+  }
+  return handle;
+}
+
+void HAL_FreeSensorSnapshot(HAL_SensorSnapshotHandle handle) {
+  sensorSnapshotHandles->Free(handle);
+}
+
+int32_t HAL_AddSensorSnapshotSensor(HAL_SensorSnapshotHandle handle,
+                                    HAL_SensorSnapshotType type,
+                                    HAL_Handle sensorHandle, int32_t* status) {
+  auto snapshot = sensorSnapshotHandles->Get(handle);
+  if (snapshot == nullptr) {
+    *status = HAL_HANDLE_ERROR;
+    return -1;
+  }
+
+  auto handleType = GetSensorHandleType(type);
+  if (handleType == HAL_HandleEnum::Undefined) {
+    *status = PARAMETER_OUT_OF_RANGE;
+    hal::SetLastError(status, "invalid sensor snapshot type");
+    return -1;
+  }
+  if (getHandleType(sensorHandle) != handleType) {
+    *status = HAL_HANDLE_ERROR;
+    return -1;
+  }
+
+  SensorEntry entry{type, sensorHandle};
+  if (type == HAL_SensorSnapshot_kDIO) {
+    auto port = digitalChannelHandles->Get(sensorHandle, HAL_HandleEnum::DIO);
+    if (port == nullptr) {
+      *status = HAL_HANDLE_ERROR;
+      return -1;
+    }
+    if (port->channel >= kNumDigitalHeaders + kNumDigitalMXPChannels) {
+      entry.dioGroup = DIOGroup::kSPI;
+      entry.channel = remapSPIChannel(port->channel);
+    } else if (port->channel < kNumDigitalHeaders) {
+      entry.dioGroup = DIOGroup::kHeaders;
+      entry.channel = port->channel;
+    } else {
+      entry.dioGroup = DIOGroup::kMXP;
+      entry.channel = remapMXPChannel(port->channel);
+    }
+  } else if (type == HAL_SensorSnapshot_kAnalogVoltage) {
+    auto port = analogInputHandles->Get(sensorHandle);
+    if (port == nullptr) {
+      *status = HAL_HANDLE_ERROR;
+      return -1;
+    }
+    entry.channel = port->channel;
+    entry.lsbWeight = HAL_GetAnalogLSBWeight(sensorHandle, status) * 1.0e-9;
+    entry.offset = HAL_GetAnalogOffset(sensorHandle, status) * 1.0e-9;
+    if (*status != 0) {
+      return -1;
+    }
+  }
+
+  std::scoped_lock lock(snapshot->mutex);
+  if (type == HAL_SensorSnapshot_kDIO) {
+    snapshot->hasDIO = true;
+  }
+  snapshot->entries.push_back(entry);
+  return snapshot->entries.size() - 1;
+}
+
+int32_t HAL_GetSensorSnapshotSize(HAL_SensorSnapshotHandle handle,
+                                  int32_t* status) {
+  auto snapshot = sensorSnapshotHandles->Get(handle);
+  if (snapshot == nullptr) {
+    *status = HAL_HANDLE_ERROR;
+    return 0;
+  }
+
+  std::scoped_lock lock(snapshot->mutex);
+  return snapshot->entries.size();
+}
+
+void HAL_ReadSensorSnapshot(HAL_SensorSnapshotHandle handle, double* values,
+                            int32_t size, uint64_t* timestamp,
+                            int32_t* status) {
+  auto snapshot = sensorSnapshotHandles->Get(handle);
+  if (snapshot == nullptr) {
+    *status = HAL_HANDLE_ERROR;
+    return;
+  }
+
+  std::scoped_lock lock(snapshot->mutex);
+  if (size < static_cast<int32_t>(snapshot->entries.size())) {
+    *status = PARAMETER_OUT_OF_RANGE;
+    hal::SetLastError(status, "values array smaller than snapshot");
+    return;
+  }
+
+  // All digital inputs come from a single register read. Analog inputs are
+  // read through the register window by channel, and encoders and duty
+  // cycles through their HAL functions, back to back against one timestamp.
+  // Errors don't stop the read; the first one is reported.
+  *timestamp = HAL_GetFPGATime(status);
+  tDIO::tDI dio{};
+  if (snapshot->hasDIO) {
+    int32_t dioStatus = 0;
+    dio = digitalSystem->readDI(&dioStatus);
+    if (*status == 0) {
+      *status = dioStatus;
+    }
+  }
+  for (auto&& entry : snapshot->entries) {
+    int32_t sensorStatus = 0;
+    switch (entry.type) {
+      case HAL_SensorSnapshot_kDIO: {
+        uint32_t bits;
+        switch (entry.dioGroup) {
+          case DIOGroup::kHeaders:
+            bits = dio.Headers;
+            break;
+          case DIOGroup::kMXP:
+            bits = dio.MXP;
+            break;
+          default:
+            bits = dio.SPIPort;
+            break;
+        }
+        *values = ((bits >> entry.channel) & 1) != 0 ? 1.0 : 0.0;
+        break;
+      }
+      case HAL_SensorSnapshot_kAnalogVoltage: {
+        tAI::tReadSelect readSelect;
+        readSelect.Channel = entry.channel;
+        readSelect.Averaged = false;
+        int32_t value;
+        {
+          std::scoped_lock analogLock(analogRegisterWindowMutex);
+          analogInputSystem->writeReadSelect(readSelect, &sensorStatus);
+          analogInputSystem->strobeLatchOutput(&sensorStatus);
+          value = static_cast<int16_t>(
+              analogInputSystem->readOutput(&sensorStatus));
+        }
+        *values = entry.lsbWeight * value - entry.offset;
+        break;
+      }
+      case HAL_SensorSnapshot_kEncoder:
+        *values = HAL_GetEncoder(entry.handle, &sensorStatus);
+        break;
+      case HAL_SensorSnapshot_kDutyCycle:
+        *values = HAL_GetDutyCycleOutput(entry.handle, &sensorStatus);
+        break;
+    }
+    if (*status == 0) {
+      *status = sensorStatus;
+    }
+    ++values;
+  }
+}
+
+}  // extern "C"
@@ -0,0 +1,165 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "hal/handles/HandleEpoch.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <wpi/mutex.h>
+
+using namespace hal;
+
+namespace {
+constexpr uint64_t kUnpinned = std::numeric_limits<uint64_t>::max();
+
+// Per-thread epoch record. Records are never freed; a thread's record is
+// released for reuse by another thread when it exits.
+struct alignas(64) ThreadRecord {
+  std::atomic<uint64_t> epoch{kUnpinned};
+  std::atomic<bool> inUse{true};
+  ThreadRecord* next = nullptr;
+};
+
+struct LocalRecord {
+  ThreadRecord* record = nullptr;
+  int depth = 0;
+
+  ~LocalRecord() {
+    if (record) {
+      record->epoch.store(kUnpinned, std::memory_order_release);
+      record->inUse.store(false, std::memory_order_release);
+    }
+  }
+};
+
+struct Retired {
+  uint64_t epoch;
+  std::shared_ptr<void> structure;
+};
+
+struct RetiredList {
+  wpi::mutex mutex;
+  std::vector<Retired> structures;
+};
+}  // namespace
+
+static std::atomic<uint64_t> globalEpoch{0};
+static std::atomic<ThreadRecord*> threadRecords{nullptr};
+// One past the newest epoch with a retired structure, or 0 if there are none
+static std::atomic<uint64_t> retiredEnd{0};
+static thread_local LocalRecord localRecord;
+
+static RetiredList& GetRetiredList() {
+  // Leaked so that structures retired during static destruction still have
+  // somewhere to go
+  static RetiredList* list = new RetiredList;
+  return *list;
+}
+
+static ThreadRecord* AcquireRecord() {
+  for (auto record = threadRecords.load(std::memory_order_acquire); record;
+       record = record->next) {
+    bool inUse = false;
+    if (!record->inUse.load(std::memory_order_relaxed) &&
+        record->inUse.compare_exchange_strong(inUse, true,
+                                              std::memory_order_acquire)) {
+      return record;
+    }
+  }
+
+  auto record = new ThreadRecord;
+  record->next = threadRecords.load(std::memory_order_relaxed);
+  while (!threadRecords.compare_exchange_weak(record->next, record,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+  }
+  return record;
+}
+
+// Returns the oldest epoch any thread is pinned to
+static uint64_t OldestPinnedEpoch() {
+  // Pairs with the fences in HandleEpoch::Pin() and HandleEpoch::Unpin()
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  uint64_t oldest = kUnpinned;
+  for (auto record = threadRecords.load(std::memory_order_acquire); record;
+       record = record->next) {
+    oldest = std::min(oldest, record->epoch.load(std::memory_order_acquire));
+  }
+  return oldest;
+}
+
+static void Reclaim() {
+  std::vector<std::shared_ptr<void>> reclaimed;
+  {
+    auto& list = GetRetiredList();
+    std::scoped_lock lock(list.mutex);
+    uint64_t oldest = OldestPinnedEpoch();
+    uint64_t newestRetired = 0;
+    std::erase_if(list.structures, [&](Retired& retired) {
+      if (retired.epoch >= oldest) {
+        newestRetired = std::max(newestRetired, retired.epoch + 1);
+        return false;
+      }
+      reclaimed.emplace_back(std::move(retired.structure));
+      return true;
+    });
+    retiredEnd.store(newestRetired, std::memory_order_relaxed);
+  }
+  // The structures are destroyed here, outside the lock, in case their
+  // destructors free other handles
+}
+
+void HandleEpoch::Pin() {
+  auto& local = localRecord;
+  if (local.depth++ != 0) {
+    return;
+  }
+  if (!local.record) {
+    local.record = AcquireRecord();
+  }
+  local.record->epoch.store(globalEpoch.load(std::memory_order_acquire),
+                            std::memory_order_relaxed);
+  // Orders publishing the pinned epoch before the lookup loads the structure
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void HandleEpoch::Unpin() {
+  auto& local = localRecord;
+  if (--local.depth != 0) {
+    return;
+  }
+  uint64_t epoch = local.record->epoch.load(std::memory_order_relaxed);
+  local.record->epoch.store(kUnpinned, std::memory_order_release);
+
+  // Only threads pinned before a structure was retired can hold it up. The
+  // fence pairs with the one in OldestPinnedEpoch(), so either a concurrent
+  // Retire() sees this thread as unpinned or this thread sees the retirement.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (epoch < retiredEnd.load(std::memory_order_relaxed)) {
+    Reclaim();
+  }
+}
+
+void HandleEpoch::Retire(std::shared_ptr<void> structure) {
+  if (!structure) {
+    return;
+  }
+  uint64_t epoch = globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+  {
+    auto& list = GetRetiredList();
+    std::scoped_lock lock(list.mutex);
+    list.structures.emplace_back(Retired{epoch, std::move(structure)});
+    retiredEnd.store(
+        std::max(retiredEnd.load(std::memory_order_relaxed), epoch + 1),
+        std::memory_order_relaxed);
+  }
+  Reclaim();
+}
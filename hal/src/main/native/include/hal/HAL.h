@@ -33,6 +33,7 @@
 #include "hal/Power.h"
 #include "hal/Relay.h"
 #include "hal/SPI.h"
+#include "hal/SensorSnapshot.h"
 #include "hal/SerialPort.h"
 #include "hal/SimDevice.h"
 #include "hal/Threads.h"
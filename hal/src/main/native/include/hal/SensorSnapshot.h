@@ -0,0 +1,103 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "hal/Types.h"
+
+/**
+ * @defgroup hal_sensorsnapshot Sensor Snapshot Functions
+ * @ingroup hal_capi
+ *
+ * A sensor snapshot reads a fixed group of sensors in a single call, with one
+ * timestamp for all of them. Where possible, sensors are resolved to their
+ * underlying channel when they're added rather than on every read. In
+ * simulation this applies to every sensor type. On the roboRIO it applies to
+ * digital inputs (which are all read from a single FPGA register read) and
+ * analog inputs; encoders and duty cycles are read through their usual HAL
+ * functions, so each one still costs a handle lookup.
+ *
+ * Freeing a sensor that's part of a snapshot doesn't remove it from the
+ * snapshot; the value read for it afterwards is unspecified.
+ * @{
+ */
+
+/**
+ * The kind of value a snapshot entry reads.
+ */
+HAL_ENUM(HAL_SensorSnapshotType) {
+  /** Digital input value, as 0 or 1 (HAL_GetDIO). */
+  HAL_SensorSnapshot_kDIO = 0,
+  /** Analog input voltage (HAL_GetAnalogVoltage). */
+  HAL_SensorSnapshot_kAnalogVoltage = 1,
+  /** Encoder count, scaled by the decoding type (HAL_GetEncoder). */
+  HAL_SensorSnapshot_kEncoder = 2,
+  /** Duty cycle output ratio (HAL_GetDutyCycleOutput). */
+  HAL_SensorSnapshot_kDutyCycle = 3,
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initializes an empty sensor snapshot.
+ *
+ * @param[out] status Error status variable. 0 on success.
+ * @return the created sensor snapshot handle
+ */
+HAL_SensorSnapshotHandle HAL_InitializeSensorSnapshot(int32_t* status);
+
+/**
+ * Frees a sensor snapshot. The sensors in it are not freed.
+ *
+ * @param handle the sensor snapshot handle
+ */
+void HAL_FreeSensorSnapshot(HAL_SensorSnapshotHandle handle);
+
+/**
+ * Adds a sensor to a snapshot.
+ *
+ * @param[in] handle       the sensor snapshot handle
+ * @param[in] type         the kind of value to read
+ * @param[in] sensorHandle the handle of the sensor to read; its type must
+ *                         match type
+ * @param[out] status      Error status variable. 0 on success.
+ * @return the index of the sensor's value in the snapshot, or -1 on error
+ */
+int32_t HAL_AddSensorSnapshotSensor(HAL_SensorSnapshotHandle handle,
+                                    HAL_SensorSnapshotType type,
+                                    HAL_Handle sensorHandle, int32_t* status);
+
+/**
+ * Gets the number of sensors in a snapshot.
+ *
+ * @param[in] handle  the sensor snapshot handle
+ * @param[out] status Error status variable. 0 on success.
+ * @return the number of sensors
+ */
+int32_t HAL_GetSensorSnapshotSize(HAL_SensorSnapshotHandle handle,
+                                  int32_t* status);
+
+/**
+ * Reads every sensor in a snapshot.
+ *
+ * Values are written in the order the sensors were added. Digital inputs
+ * read as 0.0 or 1.0.
+ *
+ * @param[in] handle     the sensor snapshot handle
+ * @param[out] values    array to fill with the sensor values
+ * @param[in] size       the size of values; must be at least the number of
+ *                       sensors in the snapshot
+ * @param[out] timestamp the FPGA time in microseconds the values were read at
+ * @param[out] status    Error status variable. 0 on success.
+ */
+void HAL_ReadSensorSnapshot(HAL_SensorSnapshotHandle handle, double* values,
+                            int32_t size, uint64_t* timestamp, int32_t* status);
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+/** @} */
@@ -7,12 +7,15 @@
 #include <stdint.h>
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <utility>
 
 #include <wpi/mutex.h>
 
 #include "hal/Errors.h"
 #include "hal/Types.h"
+#include "hal/handles/HandleEpoch.h"
 #include "hal/handles/HandlesInternal.h"
 
 namespace hal {
@@ -43,12 +46,13 @@ class DigitalHandleResource : public HandleBase {
   int16_t GetIndex(THandle handle, HAL_HandleEnum enumValue) {
     return getHandleTypedIndex(handle, enumValue, m_version);
   }
-  std::shared_ptr<TStruct> Get(THandle handle, HAL_HandleEnum enumValue);
+  HandlePtr<TStruct> Get(THandle handle, HAL_HandleEnum enumValue);
   void Free(THandle handle, HAL_HandleEnum enumValue);
   void ResetHandles() override;
 
  private:
   std::array<std::shared_ptr<TStruct>, size> m_structures;
+  std::array<std::atomic<TStruct*>, size> m_pointers{};
   std::array<wpi::mutex, size> m_handleMutexes;
 };
 
@@ -70,6 +74,8 @@ DigitalHandleResource<THandle, TStruct, size>::Allocate(
     return m_structures[index];
   }
   m_structures[index] = std::make_shared<TStruct>();
+  m_pointers[index].store(m_structures[index].get(),
+                          std::memory_order_release);
   *handle =
       static_cast<THandle>(hal::createHandle(index, enumValue, m_version));
   *status = HAL_SUCCESS;
@@ -77,17 +83,17 @@ DigitalHandleResource<THandle, TStruct, size>::Allocate(
 }
 
 template <typename THandle, typename TStruct, int16_t size>
-std::shared_ptr<TStruct> DigitalHandleResource<THandle, TStruct, size>::Get(
+HandlePtr<TStruct> DigitalHandleResource<THandle, TStruct, size>::Get(
     THandle handle, HAL_HandleEnum enumValue) {
   // get handle index, and fail early if index out of range or wrong handle
   int16_t index = GetIndex(handle, enumValue);
   if (index < 0 || index >= size) {
     return nullptr;
   }
-  std::scoped_lock lock(m_handleMutexes[index]);
-  // return structure. Null will propagate correctly, so no need to manually
-  // check.
-  return m_structures[index];
+  // pin before loading so a concurrent Free() can't destroy the structure.
+  // Null will propagate correctly, so no need to manually check.
+  HandleEpoch::Guard guard;
+  return {guard, m_pointers[index].load(std::memory_order_acquire)};
 }
 
 template <typename THandle, typename TStruct, int16_t size>
@@ -100,14 +106,16 @@ void DigitalHandleResource<THandle, TStruct, size>::Free(
   }
   // lock and deallocated handle
   std::scoped_lock lock(m_handleMutexes[index]);
-  m_structures[index].reset();
+  m_pointers[index].store(nullptr, std::memory_order_release);
+  HandleEpoch::Retire(std::move(m_structures[index]));
 }
 
 template <typename THandle, typename TStruct, int16_t size>
 void DigitalHandleResource<THandle, TStruct, size>::ResetHandles() {
   for (int i = 0; i < size; i++) {
     std::scoped_lock lock(m_handleMutexes[i]);
-    m_structures[i].reset();
+    m_pointers[i].store(nullptr, std::memory_order_release);
+    HandleEpoch::Retire(std::move(m_structures[i]));
   }
   HandleBase::ResetHandles();
 }
@@ -0,0 +1,132 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace hal {
+
+/**
+ * Epoch-based reclamation for the structures held by handle resources.
+ *
+ * Looking up a handle pins the calling thread to the current epoch instead of
+ * locking a mutex and copying a shared_ptr. Pinning only writes to a record
+ * owned by the calling thread, so lookups are wait-free and don't contend with
+ * each other. Freeing a handle retires its structure, which is destroyed once
+ * no thread is still pinned to an epoch at or before the one it was retired
+ * in. A thread that blocks while pinned, such as one waiting on a notifier
+ * alarm, delays destroying structures retired meanwhile until it returns.
+ */
+class HandleEpoch {
+ public:
+  /**
+   * Pins the calling thread to the current epoch for the lifetime of the
+   * guard.
+   */
+  class Guard {
+   public:
+    Guard() { Pin(); }
+    ~Guard() {
+      if (m_pinned) {
+        Unpin();
+      }
+    }
+    Guard(const Guard&) = delete;
+    Guard& operator=(const Guard&) = delete;
+
+    /**
+     * Hands the pin over to the caller, who must call Unpin() later.
+     */
+    void Release() { m_pinned = false; }
+
+   private:
+    bool m_pinned = true;
+  };
+
+  /**
+   * Pins the calling thread to the current epoch. Pins nest; each call must be
+   * matched by a call to Unpin() on the same thread.
+   */
+  static void Pin();
+
+  /**
+   * Releases one pin of the calling thread.
+   */
+  static void Unpin();
+
+  /**
+   * Retires a structure that has been removed from its handle resource. It's
+   * destroyed as soon as every thread that might still be using it unpins,
+   * which is immediately if no lookups are in progress.
+   *
+   * This must be called after the structure is no longer reachable through
+   * the resource.
+   *
+   * @param structure The removed structure.
+   */
+  static void Retire(std::shared_ptr<void> structure);
+};
+
+/**
+ * Pointer to a structure looked up from a handle resource. It keeps the
+ * structure alive by keeping the calling thread pinned, so it must not leave
+ * the thread that looked it up, and should only live for the duration of a HAL
+ * call.
+ *
+ * @tparam T The struct type pointed to
+ */
+template <typename T>
+class HandlePtr {
+ public:
+  HandlePtr() = default;
+  HandlePtr(std::nullptr_t) {}  // NOLINT
+
+  /**
+   * Constructs a pointer from a structure looked up while guard was held.
+   *
+   * @param guard The guard pinning the calling thread.
+   * @param ptr The structure.
+   */
+  HandlePtr(HandleEpoch::Guard& guard, T* ptr) : m_ptr{ptr} {
+    if (ptr) {
+      guard.Release();
+    }
+  }
+
+  HandlePtr(const HandlePtr& rhs) : m_ptr{rhs.m_ptr} {
+    if (m_ptr) {
+      HandleEpoch::Pin();
+    }
+  }
+
+  HandlePtr(HandlePtr&& rhs) : m_ptr{std::exchange(rhs.m_ptr, nullptr)} {}
+
+  HandlePtr& operator=(HandlePtr rhs) {
+    std::swap(m_ptr, rhs.m_ptr);
+    return *this;
+  }
+
+  ~HandlePtr() {
+    if (m_ptr) {
+      HandleEpoch::Unpin();
+    }
+  }
+
+  T* get() const { return m_ptr; }
+  T& operator*() const { return *m_ptr; }
+  T* operator->() const { return m_ptr; }
+  explicit operator bool() const { return m_ptr != nullptr; }
+
+  friend bool operator==(const HandlePtr& lhs, std::nullptr_t) {
+    return lhs.m_ptr == nullptr;
+  }
+
+ private:
+  T* m_ptr = nullptr;
+};
+
+}  // namespace hal
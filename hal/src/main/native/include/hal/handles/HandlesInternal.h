@@ -35,7 +35,7 @@ class HandleBase {
   static void ResetGlobalHandles();
 
  protected:
-  int16_t m_version;
+  int16_t m_version = 0;
 };
 
 constexpr int16_t InvalidHandleIndex = -1;
@@ -72,6 +72,7 @@ enum class HAL_HandleEnum {
   CTREPDP = 25,
   REVPDH = 26,
   REVPH = 27,
+  SensorSnapshot = 28,
 };
 
 /**
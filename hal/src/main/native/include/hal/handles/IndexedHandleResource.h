@@ -7,12 +7,15 @@
 #include <stdint.h>
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <utility>
 
 #include <wpi/mutex.h>
 
 #include "hal/Errors.h"
 #include "hal/Types.h"
+#include "hal/handles/HandleEpoch.h"
 #include "hal/handles/HandlesInternal.h"
 
 namespace hal {
@@ -21,7 +24,9 @@ namespace hal {
  * The IndexedHandleResource class is a way to track handles. This version
  * allows a limited number of handles that are allocated by index.
  * Because they are allocated by index, each individual index holds its own
- * mutex, which reduces contention heavily.]
+ * mutex, which reduces contention heavily.] Get() doesn't take the mutex; it
+ * reads the structure pointer directly and relies on HandleEpoch to keep the
+ * structure alive until the caller is done with it.
  *
  * @tparam THandle The Handle Type (Must be typedefed from HAL_Handle)
  * @tparam TStruct The struct type held by this resource
@@ -44,12 +49,13 @@ class IndexedHandleResource : public HandleBase {
   int16_t GetIndex(THandle handle) {
     return getHandleTypedIndex(handle, enumValue, m_version);
   }
-  std::shared_ptr<TStruct> Get(THandle handle);
+  HandlePtr<TStruct> Get(THandle handle);
   void Free(THandle handle);
   void ResetHandles() override;
 
  private:
   std::array<std::shared_ptr<TStruct>, size> m_structures;
+  std::array<std::atomic<TStruct*>, size> m_pointers{};
   std::array<wpi::mutex, size> m_handleMutexes;
 };
 
@@ -72,6 +78,7 @@ IndexedHandleResource<THandle, TStruct, size, enumValue>::Allocate(
     return m_structures[index];
   }
   m_structures[index] = std::make_shared<TStruct>();
+  m_pointers[index].store(m_structures[index].get(), std::memory_order_release);
   *handle =
       static_cast<THandle>(hal::createHandle(index, enumValue, m_version));
   *status = HAL_SUCCESS;
@@ -80,17 +87,17 @@ IndexedHandleResource<THandle, TStruct, size, enumValue>::Allocate(
 
 template <typename THandle, typename TStruct, int16_t size,
           HAL_HandleEnum enumValue>
-std::shared_ptr<TStruct>
+HandlePtr<TStruct>
 IndexedHandleResource<THandle, TStruct, size, enumValue>::Get(THandle handle) {
   // get handle index, and fail early if index out of range or wrong handle
   int16_t index = GetIndex(handle);
   if (index < 0 || index >= size) {
     return nullptr;
   }
-  std::scoped_lock lock(m_handleMutexes[index]);
-  // return structure. Null will propagate correctly, so no need to manually
-  // check.
-  return m_structures[index];
+  // pin before loading so a concurrent Free() can't destroy the structure.
+  // Null will propagate correctly, so no need to manually check.
+  HandleEpoch::Guard guard;
+  return {guard, m_pointers[index].load(std::memory_order_acquire)};
 }
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -104,7 +111,8 @@ void IndexedHandleResource<THandle, TStruct, size, enumValue>::Free(
   }
   // lock and deallocated handle
   std::scoped_lock lock(m_handleMutexes[index]);
-  m_structures[index].reset();
+  m_pointers[index].store(nullptr, std::memory_order_release);
+  HandleEpoch::Retire(std::move(m_structures[index]));
 }
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -112,7 +120,8 @@ template <typename THandle, typename TStruct, int16_t size,
 void IndexedHandleResource<THandle, TStruct, size, enumValue>::ResetHandles() {
   for (int i = 0; i < size; i++) {
     std::scoped_lock lock(m_handleMutexes[i]);
-    m_structures[i].reset();
+    m_pointers[i].store(nullptr, std::memory_order_release);
+    HandleEpoch::Retire(std::move(m_structures[i]));
   }
   HandleBase::ResetHandles();
 }
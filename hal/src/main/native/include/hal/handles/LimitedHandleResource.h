@@ -7,12 +7,15 @@
 #include <stdint.h>
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <utility>
 
 #include <wpi/mutex.h>
 
 #include "HandlesInternal.h"
 #include "hal/Types.h"
+#include "hal/handles/HandleEpoch.h"
 
 namespace hal {
 
@@ -40,12 +43,13 @@ class LimitedHandleResource : public HandleBase {
   int16_t GetIndex(THandle handle) {
     return getHandleTypedIndex(handle, enumValue, m_version);
   }
-  std::shared_ptr<TStruct> Get(THandle handle);
+  HandlePtr<TStruct> Get(THandle handle);
   void Free(THandle handle);
   void ResetHandles() override;
 
  private:
   std::array<std::shared_ptr<TStruct>, size> m_structures;
+  std::array<std::atomic<TStruct*>, size> m_pointers{};
   std::array<wpi::mutex, size> m_handleMutexes;
   wpi::mutex m_allocateMutex;
 };
@@ -61,6 +65,7 @@ THandle LimitedHandleResource<THandle, TStruct, size, enumValue>::Allocate() {
       // and allocate it.
       std::scoped_lock lock(m_handleMutexes[i]);
       m_structures[i] = std::make_shared<TStruct>();
+      m_pointers[i].store(m_structures[i].get(), std::memory_order_release);
       return static_cast<THandle>(createHandle(i, enumValue, m_version));
     }
   }
@@ -69,17 +74,17 @@ THandle LimitedHandleResource<THandle, TStruct, size, enumValue>::Allocate() {
 
 template <typename THandle, typename TStruct, int16_t size,
           HAL_HandleEnum enumValue>
-std::shared_ptr<TStruct>
+HandlePtr<TStruct>
 LimitedHandleResource<THandle, TStruct, size, enumValue>::Get(THandle handle) {
   // get handle index, and fail early if index out of range or wrong handle
   int16_t index = GetIndex(handle);
   if (index < 0 || index >= size) {
     return nullptr;
   }
-  std::scoped_lock lock(m_handleMutexes[index]);
-  // return structure. Null will propagate correctly, so no need to manually
-  // check.
-  return m_structures[index];
+  // pin before loading so a concurrent Free() can't destroy the structure.
+  // Null will propagate correctly, so no need to manually check.
+  HandleEpoch::Guard guard;
+  return {guard, m_pointers[index].load(std::memory_order_acquire)};
 }
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -94,7 +99,8 @@ void LimitedHandleResource<THandle, TStruct, size, enumValue>::Free(
   // lock and deallocated handle
   std::scoped_lock allocateLock(m_allocateMutex);
   std::scoped_lock handleLock(m_handleMutexes[index]);
-  m_structures[index].reset();
+  m_pointers[index].store(nullptr, std::memory_order_release);
+  HandleEpoch::Retire(std::move(m_structures[index]));
 }
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -104,7 +110,8 @@ void LimitedHandleResource<THandle, TStruct, size, enumValue>::ResetHandles() {
     std::scoped_lock allocateLock(m_allocateMutex);
     for (int i = 0; i < size; i++) {
       std::scoped_lock handleLock(m_handleMutexes[i]);
-      m_structures[i].reset();
+      m_pointers[i].store(nullptr, std::memory_order_release);
+      HandleEpoch::Retire(std::move(m_structures[i]));
     }
   }
   HandleBase::ResetHandles();
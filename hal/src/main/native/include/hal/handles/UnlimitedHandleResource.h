@@ -6,6 +6,8 @@
 
 #include <stdint.h>
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -13,6 +15,7 @@
 #include <wpi/mutex.h>
 
 #include "hal/Types.h"
+#include "hal/handles/HandleEpoch.h"
 #include "hal/handles/HandlesInternal.h"
 
 namespace hal {
@@ -25,6 +28,9 @@ namespace hal {
  * However, automatic array management has not been implemented, but might be in
  * the future.
  * Because we have to loop through the allocator, we must use a global mutex.
+ * Get() doesn't take the mutex; it reads the structure pointer from a table of
+ * fixed-size chunks that are never moved, and relies on HandleEpoch to keep the
+ * structure alive until the caller is done with it.
 
  * @tparam THandle The Handle Type (Must be typedefed from HAL_Handle)
  * @tparam TStruct The struct type held by this resource
@@ -44,7 +50,7 @@ class UnlimitedHandleResource : public HandleBase {
   int16_t GetIndex(THandle handle) {
     return getHandleTypedIndex(handle, enumValue, m_version);
   }
-  std::shared_ptr<TStruct> Get(THandle handle);
+  HandlePtr<TStruct> Get(THandle handle);
   /* Returns structure previously at that handle (or nullptr if none) */
   std::shared_ptr<TStruct> Free(THandle handle);
   void ResetHandles() override;
@@ -56,10 +62,30 @@ class UnlimitedHandleResource : public HandleBase {
   void ForEach(Functor func);
 
  private:
+  static constexpr size_t kChunkSize = 256;
+  using Chunk = std::array<std::atomic<TStruct*>, kChunkSize>;
+
+  void Publish(size_t index, TStruct* structure);
+
   std::vector<std::shared_ptr<TStruct>> m_structures;
+  // Lock-free view of m_structures for Get(), allocated a chunk at a time
+  std::array<std::atomic<Chunk*>, (INT16_MAX + kChunkSize) / kChunkSize>
+      m_chunks{};
+  std::vector<std::unique_ptr<Chunk>> m_ownedChunks;
   wpi::mutex m_handleMutex;
 };
 
+template <typename THandle, typename TStruct, HAL_HandleEnum enumValue>
+void UnlimitedHandleResource<THandle, TStruct, enumValue>::Publish(
+    size_t index, TStruct* structure) {
+  auto chunk = m_chunks[index / kChunkSize].load(std::memory_order_relaxed);
+  if (!chunk) {
+    chunk = m_ownedChunks.emplace_back(std::make_unique<Chunk>()).get();
+    m_chunks[index / kChunkSize].store(chunk, std::memory_order_release);
+  }
+  (*chunk)[index % kChunkSize].store(structure, std::memory_order_release);
+}
+
 template <typename THandle, typename TStruct, HAL_HandleEnum enumValue>
 THandle UnlimitedHandleResource<THandle, TStruct, enumValue>::Allocate(
     std::shared_ptr<TStruct> structure) {
@@ -68,6 +94,7 @@ THandle UnlimitedHandleResource<THandle, TStruct, enumValue>::Allocate(
   for (i = 0; i < m_structures.size(); i++) {
     if (m_structures[i] == nullptr) {
       m_structures[i] = structure;
+      Publish(i, structure.get());
       return static_cast<THandle>(createHandle(i, enumValue, m_version));
     }
   }
@@ -76,19 +103,25 @@ THandle UnlimitedHandleResource<THandle, TStruct, enumValue>::Allocate(
   }
 
   m_structures.push_back(structure);
+  Publish(i, structure.get());
   return static_cast<THandle>(
       createHandle(static_cast<int16_t>(i), enumValue, m_version));
 }
 
 template <typename THandle, typename TStruct, HAL_HandleEnum enumValue>
-std::shared_ptr<TStruct>
-UnlimitedHandleResource<THandle, TStruct, enumValue>::Get(THandle handle) {
+HandlePtr<TStruct> UnlimitedHandleResource<THandle, TStruct, enumValue>::Get(
+    THandle handle) {
   int16_t index = GetIndex(handle);
-  std::scoped_lock lock(m_handleMutex);
-  if (index < 0 || index >= static_cast<int16_t>(m_structures.size())) {
+  if (index < 0) {
+    return nullptr;
+  }
+  auto chunk = m_chunks[index / kChunkSize].load(std::memory_order_acquire);
+  if (!chunk) {
     return nullptr;
   }
-  return m_structures[index];
+  // pin before loading so a concurrent Free() can't destroy the structure
+  HandleEpoch::Guard guard;
+  return {guard, (*chunk)[index % kChunkSize].load(std::memory_order_acquire)};
 }
 
 template <typename THandle, typename TStruct, HAL_HandleEnum enumValue>
@@ -99,7 +132,10 @@ UnlimitedHandleResource<THandle, TStruct, enumValue>::Free(THandle handle) {
   if (index < 0 || index >= static_cast<int16_t>(m_structures.size())) {
     return nullptr;
   }
-  return std::move(m_structures[index]);
+  Publish(index, nullptr);
+  auto structure = std::move(m_structures[index]);
+  HandleEpoch::Retire(structure);
+  return structure;
 }
 
 template <typename THandle, typename TStruct, HAL_HandleEnum enumValue>
@@ -107,7 +143,8 @@ void UnlimitedHandleResource<THandle, TStruct, enumValue>::ResetHandles() {
   {
     std::scoped_lock lock(m_handleMutex);
     for (size_t i = 0; i < m_structures.size(); i++) {
-      m_structures[i].reset();
+      Publish(i, nullptr);
+      HandleEpoch::Retire(std::move(m_structures[i]));
     }
   }
   HandleBase::ResetHandles();
@@ -118,6 +118,7 @@ void InitializeHAL() {
   InitializeREVPH();
   InitializePWM();
   InitializeRelay();
+  InitializeSensorSnapshot();
   InitializeSerialPort();
   InitializeSimDevice();
   InitializeSPI();
@@ -69,6 +69,7 @@ extern void InitializeCTREPCM();
 extern void InitializeREVPH();
 extern void InitializePWM();
 extern void InitializeRelay();
+extern void InitializeSensorSnapshot();
 extern void InitializeSerialPort();
 extern void InitializeSimDevice();
 extern void InitializeSPI();
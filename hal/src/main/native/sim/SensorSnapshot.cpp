@@ -0,0 +1,168 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "hal/SensorSnapshot.h"
+
+#include <memory>
+#include <vector>
+
+#include <wpi/mutex.h>
+
+#include "AnalogInternal.h"
+#include "DigitalInternal.h"
+#include "HALInitializer.h"
+#include "HALInternal.h"
+#include "hal/DutyCycle.h"
+#include "hal/Encoder.h"
+#include "hal/Errors.h"
+#include "hal/HALBase.h"
+#include "hal/handles/HandlesInternal.h"
+#include "hal/handles/UnlimitedHandleResource.h"
+#include "mockdata/AnalogInDataInternal.h"
+#include "mockdata/DIODataInternal.h"
+#include "mockdata/DutyCycleDataInternal.h"
+#include "mockdata/EncoderDataInternal.h"
+
+using namespace hal;
+
+namespace {
+struct SensorEntry {
+  HAL_SensorSnapshotType type;
+  // Sim data index, resolved from the sensor handle when it was added
+  int32_t index;
+};
+
+struct SensorSnapshot {
+  wpi::mutex mutex;
+  std::vector<SensorEntry> entries;
+};
+}  // namespace
+
+static UnlimitedHandleResource<HAL_SensorSnapshotHandle, SensorSnapshot,
+                               HAL_HandleEnum::SensorSnapshot>*
+    sensorSnapshotHandles;
+
+namespace hal::init {
+void InitializeSensorSnapshot() {
+  static UnlimitedHandleResource<HAL_SensorSnapshotHandle, SensorSnapshot,
+                                 HAL_HandleEnum::SensorSnapshot>
+      ssH;
+  sensorSnapshotHandles = &ssH;
+}
+}  // namespace hal::init
+
+static int32_t GetSimIndex(HAL_SensorSnapshotType type, HAL_Handle sensorHandle,
+                           int32_t* status) {
+  switch (type) {
+    case HAL_SensorSnapshot_kDIO: {
+      auto port = digitalChannelHandles->Get(sensorHandle, HAL_HandleEnum::DIO);
+      if (port == nullptr) {
+        *status = HAL_HANDLE_ERROR;
+        return -1;
+      }
+      return port->channel;
+    }
+    case HAL_SensorSnapshot_kAnalogVoltage: {
+      auto port = analogInputHandles->Get(sensorHandle);
+      if (port == nullptr) {
+        *status = HAL_HANDLE_ERROR;
+        return -1;
+      }
+      return port->channel;
+    }
+    case HAL_SensorSnapshot_kEncoder:
+      return HAL_GetEncoderFPGAIndex(sensorHandle, status);
+    case HAL_SensorSnapshot_kDutyCycle:
+      return HAL_GetDutyCycleFPGAIndex(sensorHandle, status);
+    default:
+      *status = PARAMETER_OUT_OF_RANGE;
+      hal::SetLastError(status, "invalid sensor snapshot type");
+      return -1;
+  }
+}
+
+extern "C" {
+
+HAL_SensorSnapshotHandle HAL_InitializeSensorSnapshot(int32_t* status) {
+  hal::init::CheckInit();
+  auto handle =
+      sensorSnapshotHandles->Allocate(std::make_shared<SensorSnapshot>());
+  if (handle == HAL_kInvalidHandle) {
+    *status = NO_AVAILABLE_RESOURCES;
+  }
+  return handle;
+}
+
+void HAL_FreeSensorSnapshot(HAL_SensorSnapshotHandle handle) {
+  sensorSnapshotHandles->Free(handle);
+}
+
+int32_t HAL_AddSensorSnapshotSensor(HAL_SensorSnapshotHandle handle,
+                                    HAL_SensorSnapshotType type,
+                                    HAL_Handle sensorHandle, int32_t* status) {
+  auto snapshot = sensorSnapshotHandles->Get(handle);
+  if (snapshot == nullptr) {
+    *status = HAL_HANDLE_ERROR;
+    return -1;
+  }
+
+  int32_t index = GetSimIndex(type, sensorHandle, status);
+  if (*status != 0) {
+    return -1;
+  }
+
+  std::scoped_lock lock(snapshot->mutex);
+  snapshot->entries.push_back({type, index});
+  return snapshot->entries.size() - 1;
+}
+
+int32_t HAL_GetSensorSnapshotSize(HAL_SensorSnapshotHandle handle,
+                                  int32_t* status) {
+  auto snapshot = sensorSnapshotHandles->Get(handle);
+  if (snapshot == nullptr) {
+    *status = HAL_HANDLE_ERROR;
+    return 0;
+  }
+
+  std::scoped_lock lock(snapshot->mutex);
+  return snapshot->entries.size();
+}
+
+void HAL_ReadSensorSnapshot(HAL_SensorSnapshotHandle handle, double* values,
+                            int32_t size, uint64_t* timestamp,
+                            int32_t* status) {
+  auto snapshot = sensorSnapshotHandles->Get(handle);
+  if (snapshot == nullptr) {
+    *status = HAL_HANDLE_ERROR;
+    return;
+  }
+
+  std::scoped_lock lock(snapshot->mutex);
+  if (size < static_cast<int32_t>(snapshot->entries.size())) {
+    *status = PARAMETER_OUT_OF_RANGE;
+    hal::SetLastError(status, "values array smaller than snapshot");
+    return;
+  }
+
+  *timestamp = HAL_GetFPGATime(status);
+  for (auto&& entry : snapshot->entries) {
+    switch (entry.type) {
+      case HAL_SensorSnapshot_kDIO:
+        *values = SimDIOData[entry.index].value > 0 ? 1.0 : 0.0;
+        break;
+      case HAL_SensorSnapshot_kAnalogVoltage:
+        *values = SimAnalogInData[entry.index].voltage;
+        break;
+      case HAL_SensorSnapshot_kEncoder:
+        *values = SimEncoderData[entry.index].count;
+        break;
+      case HAL_SensorSnapshot_kDutyCycle:
+        *values = SimDutyCycleData[entry.index].output;
+        break;
+    }
+    ++values;
+  }
+}
+
+}  // extern "C"
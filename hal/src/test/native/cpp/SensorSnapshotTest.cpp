@@ -0,0 +1,92 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <gtest/gtest.h>
+
+#include "hal/AnalogInput.h"
+#include "hal/DIO.h"
+#include "hal/Encoder.h"
+#include "hal/HAL.h"
+#include "hal/SensorSnapshot.h"
+#include "hal/simulation/AnalogInData.h"
+#include "hal/simulation/DIOData.h"
+#include "hal/simulation/EncoderData.h"
+
+namespace hal {
+
+TEST(SensorSnapshotTest, ReadMatchesIndividualReads) {
+  int32_t status = 0;
+  auto dio = HAL_InitializeDIOPort(HAL_GetPort(6), true, nullptr, &status);
+  ASSERT_EQ(0, status);
+  auto analog = HAL_InitializeAnalogInputPort(HAL_GetPort(2), nullptr, &status);
+  ASSERT_EQ(0, status);
+  auto encoderA = HAL_InitializeDIOPort(HAL_GetPort(7), true, nullptr, &status);
+  auto encoderB = HAL_InitializeDIOPort(HAL_GetPort(8), true, nullptr, &status);
+  auto encoder = HAL_InitializeEncoder(
+      encoderA, HAL_Trigger_kInWindow, encoderB, HAL_Trigger_kInWindow, false,
+      HAL_Encoder_k4X, &status);
+  ASSERT_EQ(0, status);
+
+  auto snapshot = HAL_InitializeSensorSnapshot(&status);
+  ASSERT_EQ(0, status);
+  EXPECT_EQ(0, HAL_AddSensorSnapshotSensor(snapshot, HAL_SensorSnapshot_kDIO,
+                                           dio, &status));
+  EXPECT_EQ(1, HAL_AddSensorSnapshotSensor(
+                   snapshot, HAL_SensorSnapshot_kAnalogVoltage, analog,
+                   &status));
+  EXPECT_EQ(2, HAL_AddSensorSnapshotSensor(
+                   snapshot, HAL_SensorSnapshot_kEncoder, encoder, &status));
+  ASSERT_EQ(0, status);
+  EXPECT_EQ(3, HAL_GetSensorSnapshotSize(snapshot, &status));
+
+  HALSIM_SetDIOValue(6, false);
+  HALSIM_SetAnalogInVoltage(2, 3.3);
+  HALSIM_SetEncoderCount(HAL_GetEncoderFPGAIndex(encoder, &status), 1234);
+
+  double values[3];
+  uint64_t timestamp = 0;
+  HAL_ReadSensorSnapshot(snapshot, values, 3, &timestamp, &status);
+  ASSERT_EQ(0, status);
+  EXPECT_EQ(HAL_GetDIO(dio, &status) ? 1.0 : 0.0, values[0]);
+  EXPECT_EQ(HAL_GetAnalogVoltage(analog, &status), values[1]);
+  EXPECT_EQ(HAL_GetEncoder(encoder, &status), values[2]);
+  EXPECT_EQ(0.0, values[0]);
+  EXPECT_DOUBLE_EQ(3.3, values[1]);
+  EXPECT_EQ(1234.0, values[2]);
+
+  HALSIM_SetDIOValue(6, true);
+  HAL_ReadSensorSnapshot(snapshot, values, 3, &timestamp, &status);
+  EXPECT_EQ(1.0, values[0]);
+
+  HAL_ReadSensorSnapshot(snapshot, values, 2, &timestamp, &status);
+  EXPECT_EQ(HAL_USE_LAST_ERROR, status);
+  HAL_GetLastError(&status);
+  EXPECT_EQ(PARAMETER_OUT_OF_RANGE, status);
+
+  HAL_FreeSensorSnapshot(snapshot);
+  HAL_FreeEncoder(encoder);
+  HAL_FreeDIOPort(encoderA);
+  HAL_FreeDIOPort(encoderB);
+  HAL_FreeAnalogInputPort(analog);
+  HAL_FreeDIOPort(dio);
+}
+
+TEST(SensorSnapshotTest, AddRejectsMismatchedHandle) {
+  int32_t status = 0;
+  auto analog = HAL_InitializeAnalogInputPort(HAL_GetPort(3), nullptr, &status);
+  ASSERT_EQ(0, status);
+  auto snapshot = HAL_InitializeSensorSnapshot(&status);
+  ASSERT_EQ(0, status);
+
+  EXPECT_EQ(-1, HAL_AddSensorSnapshotSensor(snapshot, HAL_SensorSnapshot_kDIO,
+                                            analog, &status));
+  EXPECT_EQ(HAL_HANDLE_ERROR, status);
+  status = 0;
+  EXPECT_EQ(0, HAL_GetSensorSnapshotSize(snapshot, &status));
+
+  HAL_FreeSensorSnapshot(snapshot);
+  HAL_FreeAnalogInputPort(analog);
+}
+
+}  // namespace hal
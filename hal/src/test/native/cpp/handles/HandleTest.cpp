@@ -3,15 +3,28 @@
 // the WPILib BSD license file in the root directory of this project.
 
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "hal/handles/IndexedClassedHandleResource.h"
+#include "hal/handles/IndexedHandleResource.h"
+#include "hal/handles/UnlimitedHandleResource.h"
 
 #define HAL_TestHandle HAL_Handle
 
 namespace {
 class MyTestClass {};
+
+struct DestructorFlag {
+  ~DestructorFlag() {
+    if (destroyed) {
+      *destroyed = true;
+    }
+  }
+
+  bool* destroyed = nullptr;
+};
 }  // namespace
 
 namespace hal {
@@ -24,4 +37,66 @@ TEST(HandleTest, ClassedHandle) {
   EXPECT_EQ(0, status);
 }
 
+TEST(HandleTest, IndexedGetAfterFree) {
+  hal::IndexedHandleResource<HAL_TestHandle, DestructorFlag, 8,
+                             HAL_HandleEnum::Vendor>
+      testResource;
+  int32_t status = 0;
+  HAL_TestHandle handle;
+  auto allocated = testResource.Allocate(3, &handle, &status);
+  ASSERT_EQ(0, status);
+
+  auto structure = testResource.Get(handle);
+  EXPECT_EQ(allocated.get(), structure.get());
+
+  testResource.Free(handle);
+  EXPECT_EQ(nullptr, testResource.Get(handle));
+}
+
+TEST(HandleTest, FreeDefersDestructionUntilUnpinned) {
+  hal::IndexedHandleResource<HAL_TestHandle, DestructorFlag, 8,
+                             HAL_HandleEnum::Vendor>
+      testResource;
+  int32_t status = 0;
+  HAL_TestHandle handle;
+  bool destroyed = false;
+  testResource.Allocate(0, &handle, &status)->destroyed = &destroyed;
+
+  {
+    auto structure = testResource.Get(handle);
+    auto copy = structure;
+    testResource.Free(handle);
+
+    // The lookups above still pin this thread, so the structure must stay
+    // alive until they go out of scope
+    EXPECT_FALSE(destroyed);
+    EXPECT_EQ(&destroyed, copy->destroyed);
+  }
+  EXPECT_TRUE(destroyed);
+}
+
+TEST(HandleTest, UnlimitedGetAcrossChunks) {
+  hal::UnlimitedHandleResource<HAL_TestHandle, DestructorFlag,
+                               HAL_HandleEnum::Vendor>
+      testResource;
+  std::vector<HAL_TestHandle> handles;
+  for (int i = 0; i < 600; ++i) {
+    handles.emplace_back(
+        testResource.Allocate(std::make_shared<DestructorFlag>()));
+  }
+
+  EXPECT_NE(nullptr, testResource.Get(handles[599]));
+
+  bool destroyed = false;
+  testResource.Get(handles[300])->destroyed = &destroyed;
+  testResource.Free(handles[300]);
+  EXPECT_TRUE(destroyed);
+  EXPECT_EQ(nullptr, testResource.Get(handles[300]));
+  EXPECT_NE(nullptr, testResource.Get(handles[301]));
+
+  auto reused = testResource.Allocate(std::make_shared<DestructorFlag>());
+  EXPECT_EQ(handles[300], reused);
+  EXPECT_NE(nullptr, testResource.Get(reused));
+}
+
 }  // namespace hal
@@ -1493,6 +1493,15 @@ public final class NetworkTablesJNI {
    */
   public static native void stopDSClient(int inst);
 
+  /**
+   * Enables or disables the shared memory transport for clients and servers on the same host.
+   *
+   * @param inst NT instance handle.
+   * @param enabled true to enable
+   * @see NetworkTableInstance#setSharedMemoryTransport(boolean)
+   */
+  public static native void setSharedMemoryTransport(int inst, boolean enabled);
+
   /**
    * Flushes all updated values immediately to the local client/server. This does not flush to the
    * network.
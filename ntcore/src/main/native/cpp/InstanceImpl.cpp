@@ -108,8 +108,8 @@ void InstanceImpl::StartServer(std::string_view persistFilename,
     return;
   }
   m_networkServer = std::make_shared<NetworkServer>(
-      persistFilename, listenAddress, port3, port4, localStorage,
-      connectionList, logger, [this] {
+      persistFilename, listenAddress, port3, port4, sharedMemory,
+      localStorage, connectionList, logger, [this] {
         std::scoped_lock lock{m_mutex};
         networkMode &= ~NT_NET_MODE_STARTING;
       });
@@ -153,7 +153,7 @@ void InstanceImpl::StartClient4(std::string_view identity) {
     return;
   }
   m_networkClient = std::make_shared<NetworkClient>(
-      m_inst, identity, localStorage, connectionList, logger,
+      m_inst, identity, sharedMemory, localStorage, connectionList, logger,
       [this](int64_t serverTimeOffset, int64_t rtt2, bool valid) {
         std::scoped_lock lock{m_mutex};
         listenerStorage.NotifyTimeSync({}, NT_EVENT_TIMESYNC, serverTimeOffset,
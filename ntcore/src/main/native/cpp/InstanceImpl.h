@@ -68,6 +68,8 @@ class InstanceImpl {
   ConnectionList connectionList;
   LocalStorage localStorage;
   std::atomic<int> networkMode{NT_NET_MODE_NONE};
+  // offer the shared memory transport in servers and clients started later
+  std::atomic<bool> sharedMemory{false};
 
  private:
   static int AllocImpl();
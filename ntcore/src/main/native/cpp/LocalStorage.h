@@ -6,7 +6,10 @@
 
 #include <stdint.h>
 
+#include <array>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <span>
 #include <string>
 #include <string_view>
@@ -61,8 +64,9 @@ class LocalStorage final : public net::ILocalStorage {
   }
 
   void ServerSetValue(int topicId, const Value& value) final {
-    std::scoped_lock lock{m_mutex};
+    std::shared_lock lock{m_mutex};
     if (auto topic = m_impl.GetTopicById(topicId)) {
+      std::scoped_lock valueLock{GetValueMutex(topic)};
       m_impl.ServerSetValue(topic, value);
     }
   }
@@ -311,6 +315,14 @@ class LocalStorage final : public net::ILocalStorage {
   }
 
   bool SetEntryValue(NT_Handle pubentryHandle, const Value& value) {
+    {
+      std::shared_lock lock{m_mutex};
+      if (auto publisher = m_impl.GetPublisher(pubentryHandle)) {
+        std::scoped_lock valueLock{GetValueMutex(publisher->topic)};
+        return m_impl.PublishLocalValue(publisher, value);
+      }
+    }
+    // entries publish on first set, which needs the exclusive lock
     std::scoped_lock lock{m_mutex};
     return m_impl.SetEntryValue(pubentryHandle, value);
   }
@@ -323,13 +335,15 @@ class LocalStorage final : public net::ILocalStorage {
   template <ValidType T>
   Timestamped<typename TypeInfo<T>::Value> GetAtomic(
       NT_Handle subentry, typename TypeInfo<T>::View defaultValue) {
-    std::scoped_lock lock{m_mutex};
-    Value* value = m_impl.GetSubEntryValue(subentry);
-    if (value && (IsNumericConvertibleTo<T>(*value) || IsType<T>(*value))) {
-      return GetTimestamped<T, true>(*value);
-    } else {
-      return {0, 0, CopyValue<T>(defaultValue)};
+    std::shared_lock lock{m_mutex};
+    if (auto subscriber = m_impl.GetSubEntry(subentry)) {
+      std::scoped_lock valueLock{GetValueMutex(subscriber->topic)};
+      const Value& value = subscriber->topic->lastValue;
+      if (IsNumericConvertibleTo<T>(value) || IsType<T>(value)) {
+        return GetTimestamped<T, true>(value);
+      }
     }
+    return {0, 0, CopyValue<T>(defaultValue)};
   }
 
   template <SmallArrayType T>
@@ -337,32 +351,36 @@ class LocalStorage final : public net::ILocalStorage {
       NT_Handle subentry,
       wpi::SmallVectorImpl<typename TypeInfo<T>::SmallElem>& buf,
       typename TypeInfo<T>::View defaultValue) {
-    std::scoped_lock lock{m_mutex};
-    Value* value = m_impl.GetSubEntryValue(subentry);
-    if (value && (IsNumericConvertibleTo<T>(*value) || IsType<T>(*value))) {
-      return GetTimestamped<T, true>(*value, buf);
-    } else {
-      return {0, 0, CopyValue<T>(defaultValue, buf)};
+    std::shared_lock lock{m_mutex};
+    if (auto subscriber = m_impl.GetSubEntry(subentry)) {
+      std::scoped_lock valueLock{GetValueMutex(subscriber->topic)};
+      const Value& value = subscriber->topic->lastValue;
+      if (IsNumericConvertibleTo<T>(value) || IsType<T>(value)) {
+        return GetTimestamped<T, true>(value, buf);
+      }
     }
+    return {0, 0, CopyValue<T>(defaultValue, buf)};
   }
 
   std::vector<Value> ReadQueueValue(NT_Handle subentry, unsigned int types) {
-    std::scoped_lock lock{m_mutex};
+    std::shared_lock lock{m_mutex};
     auto subscriber = m_impl.GetSubEntry(subentry);
     if (!subscriber) {
       return {};
     }
+    std::scoped_lock valueLock{GetValueMutex(subscriber->topic)};
     return subscriber->pollStorage.ReadValue(types);
   }
 
   template <ValidType T>
   std::vector<Timestamped<typename TypeInfo<T>::Value>> ReadQueue(
       NT_Handle subentry) {
-    std::scoped_lock lock{m_mutex};
+    std::shared_lock lock{m_mutex};
     auto subscriber = m_impl.GetSubEntry(subentry);
     if (!subscriber) {
       return {};
     }
+    std::scoped_lock valueLock{GetValueMutex(subscriber->topic)};
     return subscriber->pollStorage.Read<T>();
   }
 
@@ -417,8 +435,9 @@ class LocalStorage final : public net::ILocalStorage {
   }
 
   int64_t GetEntryLastChange(NT_Entry subentryHandle) {
-    std::scoped_lock lock{m_mutex};
+    std::shared_lock lock{m_mutex};
     if (auto subscriber = m_impl.GetSubEntry(subentryHandle)) {
+      std::scoped_lock valueLock{GetValueMutex(subscriber->topic)};
       return subscriber->topic->lastValue.time();
     } else {
       return 0;
@@ -486,7 +505,19 @@ class LocalStorage final : public net::ILocalStorage {
   }
 
  private:
-  wpi::mutex m_mutex;
+  static constexpr size_t kNumValueMutexes = 64;
+
+  wpi::mutex& GetValueMutex(const local::LocalTopic* topic) {
+    return m_valueMutexes[Handle{topic->handle}.GetIndex() % kNumValueMutexes];
+  }
+
+  // Reading or setting the value of an existing publisher or subscriber holds
+  // m_mutex shared plus the value mutex of the topic, so values of different
+  // topics are accessed in parallel.  Everything else (creating or releasing
+  // topics, publishers, subscribers, listeners and loggers, property changes,
+  // network announcements) holds m_mutex exclusively.
+  std::shared_mutex m_mutex;
+  std::array<wpi::mutex, kNumValueMutexes> m_valueMutexes;
   local::StorageImpl m_impl;
 };
 
@@ -23,6 +23,7 @@
 #include "IConnectionList.h"
 #include "Log.h"
 #include "net/NetworkInterface.h"
+#include "net/WireEncoder.h"
 
 using namespace nt;
 namespace uv = wpi::uv;
@@ -298,12 +299,14 @@ void NetworkClient3::DoDisconnect(std::string_view reason) {
 }
 
 NetworkClient::NetworkClient(
-    int inst, std::string_view id, net::ILocalStorage& localStorage,
-    IConnectionList& connList, wpi::Logger& logger,
+    int inst, std::string_view id, bool sharedMemory,
+    net::ILocalStorage& localStorage, IConnectionList& connList,
+    wpi::Logger& logger,
     std::function<void(int64_t serverTimeOffset, int64_t rtt2, bool valid)>
         timeSyncUpdated)
     : NetworkClientBase{inst, id, localStorage, connList, logger},
-      m_timeSyncUpdated{std::move(timeSyncUpdated)} {
+      m_timeSyncUpdated{std::move(timeSyncUpdated)},
+      m_shmFailed{!sharedMemory} {
   m_loopRunner.ExecAsync([this](uv::Loop& loop) {
     m_parallelConnect = wpi::ParallelTcpConnector::Create(
         loop, kReconnectRate, m_logger,
@@ -354,6 +357,7 @@ NetworkClient::~NetworkClient() {
   // must explicitly destroy these on loop
   m_loopRunner.ExecSync([&](auto&) {
     m_clientImpl.reset();
+    m_shmWire.reset();
     m_wire.reset();
   });
   // shut down loop here to avoid race
@@ -375,19 +379,25 @@ void NetworkClient::HandleLocal() {
 void NetworkClient::TcpConnected(uv::Tcp& tcp) {
   tcp.SetLogger(&m_logger);
   tcp.SetNoDelay(true);
+  std::string ip;
+  unsigned int port = 0;
+  uv::AddrToName(tcp.GetPeer(), &ip, &port);
   // Start the WS client
-  if (m_logger.min_level() >= wpi::WPI_LOG_DEBUG4) {
-    std::string ip;
-    unsigned int port = 0;
-    uv::AddrToName(tcp.GetPeer(), &ip, &port);
-    DEBUG4("Starting WebSocket client on {} port {}", ip, port);
-  }
+  DEBUG4("Starting WebSocket client on {} port {}", ip, port);
   wpi::WebSocket::ClientOptions options;
   options.handshakeTimeout = kWebsocketHandshakeTimeout;
   wpi::SmallString<128> idBuf;
+  // offer shared memory first (if enabled) if the server is on the same host;
+  // the server picks the first protocol in our list that it supports
+  static constexpr std::string_view kProtocols[] = {
+      net::SharedMemoryConnection::kProtocol, net::kDeltaProtocol,
+      "v4.1.networktables.first.wpi.edu", "networktables.first.wpi.edu"};
+  std::span<const std::string_view> protocols = kProtocols;
+  if (m_shmFailed || !net::SharedMemoryConnection::CanConnect(ip)) {
+    protocols = protocols.subspan(1);
+  }
   auto ws = wpi::WebSocket::CreateClient(
-      tcp, fmt::format("/nt/{}", wpi::EscapeURI(m_id, idBuf)), "",
-      {"v4.1.networktables.first.wpi.edu", "networktables.first.wpi.edu"},
+      tcp, fmt::format("/nt/{}", wpi::EscapeURI(m_id, idBuf)), "", protocols,
       options);
   ws->SetMaxMessageSize(kMaxMessageSize);
   ws->open.connect([this, &tcp, ws = ws.get()](std::string_view protocol) {
@@ -405,18 +415,68 @@ void NetworkClient::WsConnected(wpi::WebSocket& ws, uv::Tcp& tcp,
     m_parallelConnect->Succeeded(tcp);
   }
 
+  ws.closed.connect([this, &ws](uint16_t, std::string_view reason) {
+    if (!ws.GetStream().IsLoopClosing()) {
+      // we could be in the middle of sending data, so defer disconnect
+      // capture a shared_ptr copy of ws to make sure it doesn't get destroyed
+      // until after DoDisconnect returns
+      uv::Timer::SingleShot(
+          m_loop, uv::Timer::Time{0},
+          [this, reason = std::string{reason}, keepws = ws.shared_from_this()] {
+            DoDisconnect(reason);
+          });
+    }
+  });
+
+  if (protocol == net::SharedMemoryConnection::kProtocol) {
+    // the server sends the shared memory segment name as the first message
+    ws.text.connect_extended(
+        [this, &ws, &tcp](auto& conn, std::string_view data, bool) {
+          conn.disconnect();
+          auto segment = net::SharedMemorySegment::Open(data);
+          if (!segment) {
+            // don't try again on reconnect
+            WARN("could not open shared memory segment '{}', using WebSocket",
+                 data);
+            m_shmFailed = true;
+            ws.Fail(1011, "could not open shared memory segment");
+            return;
+          }
+          // the shared memory protocol includes delta frames
+          WireConnected(ws, tcp, 0x0401, std::move(segment), true);
+        });
+    return;
+  }
+
+  bool delta = protocol == net::kDeltaProtocol;
+  WireConnected(ws, tcp,
+                delta || protocol == "v4.1.networktables.first.wpi.edu"
+                    ? 0x0401
+                    : 0x0400,
+                nullptr, delta);
+}
+
+void NetworkClient::WireConnected(
+    wpi::WebSocket& ws, uv::Tcp& tcp, unsigned int version,
+    std::unique_ptr<net::SharedMemorySegment> segment, bool deltaFrames) {
   ConnectionInfo connInfo;
   uv::AddrToName(tcp.GetPeer(), &connInfo.remote_ip, &connInfo.remote_port);
-  connInfo.protocol_version =
-      protocol == "v4.1.networktables.first.wpi.edu" ? 0x0401 : 0x0400;
+  connInfo.protocol_version = version;
 
-  INFO("CONNECTED NT4 to {} port {}", connInfo.remote_ip, connInfo.remote_port);
+  INFO("CONNECTED NT4 to {} port {}{}", connInfo.remote_ip,
+       connInfo.remote_port, segment ? " (shared memory)" : "");
   m_connHandle = m_connList.AddConnection(connInfo);
 
   m_wire = std::make_shared<net::WebSocketConnection>(
       ws, connInfo.protocol_version, m_logger);
+  net::WireConnection* wire = m_wire.get();
+  if (segment) {
+    m_shmWire = std::make_shared<net::SharedMemoryConnection>(
+        ws, std::move(segment), false, connInfo.protocol_version, m_logger);
+    wire = m_shmWire.get();
+  }
   m_clientImpl = std::make_unique<net::ClientImpl>(
-      m_loop.Now().count(), *m_wire, m_logger, m_timeSyncUpdated,
+      m_loop.Now().count(), *wire, m_logger, m_timeSyncUpdated,
       [this](uint32_t repeatMs) {
         DEBUG4("Setting periodic timer to {}", repeatMs);
         if (m_sendOutgoingTimer &&
@@ -425,49 +485,52 @@ void NetworkClient::WsConnected(wpi::WebSocket& ws, uv::Tcp& tcp,
           m_sendOutgoingTimer->Start(uv::Timer::Time{repeatMs},
                                      uv::Timer::Time{repeatMs});
         }
-      });
+      },
+      deltaFrames);
   m_clientImpl->SetLocal(&m_localStorage);
   m_localStorage.StartNetwork(&m_localQueue);
   HandleLocal();
   m_clientImpl->SendInitial();
-  ws.closed.connect([this, &ws](uint16_t, std::string_view reason) {
-    if (!ws.GetStream().IsLoopClosing()) {
-      // we could be in the middle of sending data, so defer disconnect
-      // capture a shared_ptr copy of ws to make sure it doesn't get destroyed
-      // until after DoDisconnect returns
-      uv::Timer::SingleShot(
-          m_loop, uv::Timer::Time{0},
-          [this, reason = std::string{reason}, keepws = ws.shared_from_this()] {
-            DoDisconnect(reason);
-          });
-    }
-  });
-  ws.text.connect([this](std::string_view data, bool) {
+  auto processText = [this](std::string_view data) {
     if (m_clientImpl) {
       m_clientImpl->ProcessIncomingText(data);
     }
-  });
-  ws.binary.connect([this](std::span<const uint8_t> data, bool) {
+  };
+  auto processBinary = [this](std::span<const uint8_t> data) {
     if (m_clientImpl) {
       m_clientImpl->ProcessIncomingBinary(m_loop.Now().count(), data);
     }
-  });
+  };
+  // the WebSocket can carry messages even when shared memory is in use
+  ws.text.connect([=](std::string_view data, bool) { processText(data); });
+  ws.binary.connect(
+      [=](std::span<const uint8_t> data, bool) { processBinary(data); });
+  if (m_shmWire) {
+    m_shmWire->text.connect(processText);
+    m_shmWire->binary.connect(processBinary);
+  }
 }
 
 void NetworkClient::ForceDisconnect(std::string_view reason) {
-  if (m_wire) {
+  if (m_shmWire) {
+    m_shmWire->Disconnect(reason);
+  } else if (m_wire) {
     m_wire->Disconnect(reason);
   }
 }
 
 void NetworkClient::DoDisconnect(std::string_view reason) {
   std::string realReason;
-  if (m_wire) {
+  if (m_shmWire) {
+    realReason = m_shmWire->GetDisconnectReason();
+  }
+  if (m_wire && realReason.empty()) {
     realReason = m_wire->GetDisconnectReason();
   }
   INFO("DISCONNECTED NT4 connection: {}",
        realReason.empty() ? reason : realReason);
   m_clientImpl.reset();
+  m_shmWire.reset();
   m_wire.reset();
   NetworkClientBase::DoDisconnect(reason);
   m_timeSyncUpdated(0, 0, false);
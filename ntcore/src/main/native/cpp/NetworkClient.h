@@ -24,6 +24,7 @@
 #include "net/ClientImpl.h"
 #include "net/ClientMessageQueue.h"
 #include "net/Message.h"
+#include "net/SharedMemoryConnection.h"
 #include "net/WebSocketConnection.h"
 #include "net3/ClientImpl3.h"
 #include "net3/UvStreamConnection3.h"
@@ -123,8 +124,9 @@ class NetworkClient3 final : public NetworkClientBase {
 class NetworkClient final : public NetworkClientBase {
  public:
   NetworkClient(
-      int inst, std::string_view id, net::ILocalStorage& localStorage,
-      IConnectionList& connList, wpi::Logger& logger,
+      int inst, std::string_view id, bool sharedMemory,
+      net::ILocalStorage& localStorage, IConnectionList& connList,
+      wpi::Logger& logger,
       std::function<void(int64_t serverTimeOffset, int64_t rtt2, bool valid)>
           timeSyncUpdated);
   ~NetworkClient() final;
@@ -139,13 +141,20 @@ class NetworkClient final : public NetworkClientBase {
   void TcpConnected(wpi::uv::Tcp& tcp) final;
   void WsConnected(wpi::WebSocket& ws, wpi::uv::Tcp& tcp,
                    std::string_view protocol);
+  void WireConnected(wpi::WebSocket& ws, wpi::uv::Tcp& tcp,
+                     unsigned int version,
+                     std::unique_ptr<net::SharedMemorySegment> segment,
+                     bool deltaFrames);
   void ForceDisconnect(std::string_view reason) override;
   void DoDisconnect(std::string_view reason) override;
 
   std::function<void(int64_t serverTimeOffset, int64_t rtt2, bool valid)>
       m_timeSyncUpdated;
   std::shared_ptr<net::WebSocketConnection> m_wire;
+  std::shared_ptr<net::SharedMemoryConnection> m_shmWire;
   std::unique_ptr<net::ClientImpl> m_clientImpl;
+  // don't offer shared memory if disabled, or after it failed
+  bool m_shmFailed;
 };
 
 }  // namespace nt
@@ -31,6 +31,7 @@
 #include "IConnectionList.h"
 #include "InstanceImpl.h"
 #include "Log.h"
+#include "net/SharedMemoryConnection.h"
 #include "net/WebSocketConnection.h"
 #include "net/WireDecoder.h"
 #include "net/WireEncoder.h"
@@ -91,17 +92,19 @@ class NetworkServer::ServerConnection4 final
                     wpi::Logger& logger)
       : ServerConnection{server, addr, port, logger},
         HttpWebSocketServerConnection(
-            stream,
-            {"v4.1.networktables.first.wpi.edu", "networktables.first.wpi.edu",
-             "rtt.networktables.first.wpi.edu"}) {
+            stream, GetProtocols(addr, server.m_sharedMemory)) {
     m_info.protocol_version = 0x0400;
   }
 
  private:
+  static std::span<const std::string_view> GetProtocols(std::string_view addr,
+                                                         bool sharedMemory);
+
   void ProcessRequest() final;
   void ProcessWsUpgrade() final;
 
   std::shared_ptr<net::WebSocketConnection> m_wire;
+  std::shared_ptr<net::SharedMemoryConnection> m_shmWire;
 };
 
 void NetworkServer::ServerConnection::SetupOutgoingTimer() {
@@ -183,6 +186,21 @@ NetworkServer::ServerConnection3::ServerConnection3(
   SetupOutgoingTimer();
 }
 
+std::span<const std::string_view>
+NetworkServer::ServerConnection4::GetProtocols(std::string_view addr,
+                                               bool sharedMemory) {
+  // only offer shared memory (if enabled) to clients on the same host
+  static constexpr std::string_view kProtocols[] = {
+      net::SharedMemoryConnection::kProtocol, net::kDeltaProtocol,
+      "v4.1.networktables.first.wpi.edu", "networktables.first.wpi.edu",
+      "rtt.networktables.first.wpi.edu"};
+  std::span<const std::string_view> protocols = kProtocols;
+  if (!sharedMemory || !net::SharedMemoryConnection::CanConnect(addr)) {
+    protocols = protocols.subspan(1);
+  }
+  return protocols;
+}
+
 void NetworkServer::ServerConnection4::ProcessRequest() {
   DEBUG1("HTTP request: '{}'", m_request.GetUrl());
   wpi::UrlParser url{m_request.GetUrl(),
@@ -247,8 +265,12 @@ void NetworkServer::ServerConnection4::ProcessWsUpgrade() {
 
   m_websocket->open.connect([this, name = std::string{name}](
                                 std::string_view protocol) {
+    bool shm = protocol == net::SharedMemoryConnection::kProtocol;
+    bool delta = protocol == net::kDeltaProtocol;
     m_info.protocol_version =
-        protocol == "v4.1.networktables.first.wpi.edu" ? 0x0401 : 0x0400;
+        shm || delta || protocol == "v4.1.networktables.first.wpi.edu"
+            ? 0x0401
+            : 0x0400;
     m_wire = std::make_shared<net::WebSocketConnection>(
         *m_websocket, m_info.protocol_version, m_logger);
 
@@ -281,30 +303,72 @@ void NetworkServer::ServerConnection4::ProcessWsUpgrade() {
       return;
     }
 
+    net::WireConnection* wire = m_wire.get();
+    if (shm) {
+      auto segment = net::SharedMemorySegment::Create(
+          net::SharedMemoryConnection::kRingCapacity);
+      if (!segment) {
+        INFO("could not create shared memory segment (from {}), closing",
+             m_connInfo);
+        m_websocket->Fail(1011, "could not create shared memory segment");
+        return;
+      }
+      // tell the client where to attach
+      m_websocket->SendText({wpi::uv::Buffer::Dup(segment->GetName())},
+                            [](auto bufs, auto) {
+                              for (auto&& buf : bufs) {
+                                buf.Deallocate();
+                              }
+                            });
+      m_shmWire = std::make_shared<net::SharedMemoryConnection>(
+          *m_websocket, std::move(segment), true, m_info.protocol_version,
+          m_logger);
+      wire = m_shmWire.get();
+    }
+
     // TODO: set local flag appropriately
     std::string dedupName;
     std::tie(dedupName, m_clientId) = m_server.m_serverImpl.AddClient(
-        name, m_connInfo, false, *m_wire,
-        [this](uint32_t repeatMs) { UpdateOutgoingTimer(repeatMs); });
-    INFO("CONNECTED NT4 client '{}' (from {})", dedupName, m_connInfo);
+        name, m_connInfo, false, *wire,
+        [this](uint32_t repeatMs) { UpdateOutgoingTimer(repeatMs); },
+        delta || shm);
+    INFO("CONNECTED NT4 client '{}' (from {}){}", dedupName, m_connInfo,
+         shm ? " (shared memory)" : "");
     m_info.remote_id = dedupName;
     m_server.AddConnection(this, m_info);
     m_websocket->closed.connect([this](uint16_t, std::string_view reason) {
-      auto realReason = m_wire->GetDisconnectReason();
+      std::string_view realReason;
+      if (m_shmWire) {
+        // the client has been removed, so don't process anything further
+        m_shmWire->StopRead();
+        realReason = m_shmWire->GetDisconnectReason();
+      }
+      if (realReason.empty()) {
+        realReason = m_wire->GetDisconnectReason();
+      }
       INFO("DISCONNECTED NT4 client '{}' (from {}): {}", m_info.remote_id,
            m_connInfo, realReason.empty() ? reason : realReason);
       ConnectionClosed();
     });
-    m_websocket->text.connect([this](std::string_view data, bool) {
+    auto processText = [this](std::string_view data) {
       if (m_server.m_serverImpl.ProcessIncomingText(m_clientId, data)) {
         m_server.m_idle->Start();
       }
-    });
-    m_websocket->binary.connect([this](std::span<const uint8_t> data, bool) {
+    };
+    auto processBinary = [this](std::span<const uint8_t> data) {
       if (m_server.m_serverImpl.ProcessIncomingBinary(m_clientId, data)) {
         m_server.m_idle->Start();
       }
-    });
+    };
+    // the WebSocket can carry messages even when shared memory is in use
+    m_websocket->text.connect(
+        [=](std::string_view data, bool) { processText(data); });
+    m_websocket->binary.connect(
+        [=](std::span<const uint8_t> data, bool) { processBinary(data); });
+    if (m_shmWire) {
+      m_shmWire->text.connect(processText);
+      m_shmWire->binary.connect(processBinary);
+    }
 
     SetupOutgoingTimer();
   });
@@ -312,7 +376,7 @@ void NetworkServer::ServerConnection4::ProcessWsUpgrade() {
 
 NetworkServer::NetworkServer(std::string_view persistentFilename,
                              std::string_view listenAddress, unsigned int port3,
-                             unsigned int port4,
+                             unsigned int port4, bool sharedMemory,
                              net::ILocalStorage& localStorage,
                              IConnectionList& connList, wpi::Logger& logger,
                              std::function<void()> initDone)
@@ -324,6 +388,7 @@ NetworkServer::NetworkServer(std::string_view persistentFilename,
       m_listenAddress{wpi::trim(listenAddress)},
       m_port3{port3},
       m_port4{port4},
+      m_sharedMemory{sharedMemory},
       m_serverImpl{logger},
       m_localQueue{logger},
       m_loop(*m_loopRunner.GetLoop()) {
@@ -37,7 +37,8 @@ class NetworkServer {
  public:
   NetworkServer(std::string_view persistentFilename,
                 std::string_view listenAddress, unsigned int port3,
-                unsigned int port4, net::ILocalStorage& localStorage,
+                unsigned int port4, bool sharedMemory,
+                net::ILocalStorage& localStorage,
                 IConnectionList& connList, wpi::Logger& logger,
                 std::function<void()> initDone);
   ~NetworkServer();
@@ -66,6 +67,7 @@ class NetworkServer {
   std::string m_listenAddress;
   unsigned int m_port3;
   unsigned int m_port4;
+  bool m_sharedMemory;
 
   // used only from loop
   std::shared_ptr<wpi::uv::Timer> m_readLocalTimer;
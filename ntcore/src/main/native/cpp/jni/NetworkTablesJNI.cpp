@@ -1358,6 +1358,18 @@ Java_edu_wpi_first_networktables_NetworkTablesJNI_stopDSClient
   nt::StopDSClient(inst);
 }
 
+/*
+ * Class:     edu_wpi_first_networktables_NetworkTablesJNI
+ * Method:    setSharedMemoryTransport
+ * Signature: (IZ)V
+ */
+JNIEXPORT void JNICALL
+Java_edu_wpi_first_networktables_NetworkTablesJNI_setSharedMemoryTransport
+  (JNIEnv*, jclass, jint inst, jboolean enabled)
+{
+  nt::SetSharedMemoryTransport(inst, enabled);
+}
+
 /*
  * Class:     edu_wpi_first_networktables_NetworkTablesJNI
  * Method:    flushLocal
@@ -18,19 +18,26 @@ class DataLog;
 
 namespace nt::local {
 
+class LocalDataLoggerThread;
 struct LocalTopic;
 
 struct LocalDataLogger {
   static constexpr auto kType = Handle::kDataLogger;
 
-  LocalDataLogger(NT_DataLogger handle, wpi::log::DataLog& log,
-                  std::string_view prefix, std::string_view logPrefix)
-      : handle{handle}, log{log}, prefix{prefix}, logPrefix{logPrefix} {}
+  LocalDataLogger(NT_DataLogger handle, LocalDataLoggerThread& thread,
+                  wpi::log::DataLog& log, std::string_view prefix,
+                  std::string_view logPrefix)
+      : handle{handle},
+        thread{thread},
+        log{log},
+        prefix{prefix},
+        logPrefix{logPrefix} {}
 
   int Start(std::string_view name, std::string_view typeStr,
             std::string_view metadata, int64_t time);
 
   NT_DataLogger handle;
+  LocalDataLoggerThread& thread;
   wpi::log::DataLog& log;
   std::string prefix;
   std::string logPrefix;
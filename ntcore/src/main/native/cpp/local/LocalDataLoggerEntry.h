@@ -11,32 +11,35 @@
 
 #include <wpi/DataLog.h>
 
+#include "local/LocalDataLoggerThread.h"
 #include "ntcore_c.h"
 
 namespace wpi::log {
 class DataLog;
 }  // namespace wpi::log
 
-namespace nt {
-class Value;
-}  // namespace nt
-
 namespace nt::local {
 
 struct LocalTopic;
 
 struct LocalDataLoggerEntry {
-  LocalDataLoggerEntry(wpi::log::DataLog& log, int entry, NT_DataLogger logger)
-      : log{&log}, entry{entry}, logger{logger} {}
+  LocalDataLoggerEntry(LocalDataLoggerThread& thread, wpi::log::DataLog& log,
+                       int entry, NT_DataLogger logger)
+      : thread{&thread}, log{&log}, entry{entry}, logger{logger} {}
 
   static std::string MakeMetadata(std::string_view properties);
 
-  void Append(const Value& v);
-  void Finish(int64_t timestamp) { log->Finish(entry, timestamp); }
+  void Append(const Value& v) { thread->Append(log, entry, v); }
+  void Finish(int64_t timestamp) {
+    // previously appended values must be written first
+    thread->Flush();
+    log->Finish(entry, timestamp);
+  }
   void SetMetadata(std::string_view metadata, int64_t timestamp) {
     log->SetMetadata(entry, metadata, timestamp);
   }
 
+  LocalDataLoggerThread* thread;
   wpi::log::DataLog* log;
   int entry;
   NT_DataLogger logger;
@@ -0,0 +1,258 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "LocalDataLoggerThread.h"
+
+#include <bit>
+#include <cstring>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+
+#include <wpi/Endian.h>
+#include <wpi/SmallVector.h>
+
+using namespace nt::local;
+
+// how often queued values are written, in seconds
+static constexpr double kWritePeriod = 0.01;
+
+// maximum number of records appended per data log lock acquisition
+static constexpr size_t kMaxBatchSize = 256;
+
+LocalDataLoggerThread::Queue::Queue()
+    : m_cells{std::make_unique<std::array<Cell, kSize>>()} {
+  for (uint64_t i = 0; i < kSize; ++i) {
+    (*m_cells)[i].seq.store(i, std::memory_order_relaxed);
+  }
+}
+
+int64_t LocalDataLoggerThread::Queue::Push(Record&& record) {
+  uint64_t pos = m_pushPos.load(std::memory_order_relaxed);
+  for (;;) {
+    Cell& cell = (*m_cells)[pos % kSize];
+    uint64_t seq = cell.seq.load(std::memory_order_acquire);
+    if (seq == pos) {
+      if (m_pushPos.compare_exchange_weak(pos, pos + 1,
+                                          std::memory_order_relaxed)) {
+        cell.record = std::move(record);
+        cell.seq.store(pos + 1, std::memory_order_release);
+        return pos;
+      }
+    } else if (seq < pos) {
+      // the consumer has not yet emptied this cell
+      return -1;
+    } else {
+      pos = m_pushPos.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool LocalDataLoggerThread::Queue::Pop(Record* record) {
+  Cell& cell = (*m_cells)[m_popPos % kSize];
+  if (cell.seq.load(std::memory_order_acquire) != m_popPos + 1) {
+    // empty, or a producer has claimed the cell but not yet filled it
+    return false;
+  }
+  *record = std::move(cell.record);
+  cell.record = {};
+  cell.seq.store(m_popPos + kSize, std::memory_order_release);
+  ++m_popPos;
+  return true;
+}
+
+void LocalDataLoggerThread::Start() {
+  if (!m_thread) {
+    m_owner.Start();
+    m_thread = m_owner.GetThreadSharedPtr();
+  }
+}
+
+void LocalDataLoggerThread::Append(wpi::log::DataLog* log, int entry,
+                                   const Value& value) {
+  Record record{log, entry, value};
+  for (;;) {
+    int64_t pos = m_thread->m_queue.Push(std::move(record));
+    if (pos >= 0) {
+      // wake the thread early when the queue is filling up
+      if (static_cast<uint64_t>(pos) % (Queue::kSize / 2) == 0 && pos != 0) {
+        m_thread->m_wakeup.Set();
+      }
+      return;
+    }
+    // full; Push() does not consume the record on failure
+    m_thread->m_wakeup.Set();
+    std::this_thread::yield();
+  }
+}
+
+void LocalDataLoggerThread::Flush() {
+  if (!m_thread) {
+    return;
+  }
+  auto& thr = *m_thread;
+  uint64_t target = thr.m_queue.GetPushCount();
+  if (thr.m_written.load(std::memory_order_acquire) >= target) {
+    return;
+  }
+  thr.m_wakeup.Set();
+  std::unique_lock lock{thr.m_mutex};
+  thr.m_flushed.wait(lock, [&] {
+    return thr.m_written.load(std::memory_order_acquire) >= target ||
+           !thr.m_active;
+  });
+}
+
+void LocalDataLoggerThread::Thread::Main() {
+  while (m_active) {
+    WPI_Handle signaledBuf[2];
+    bool timedOut;
+    wpi::WaitForObjects({m_wakeup.GetHandle(), m_stopEvent.GetHandle()},
+                        signaledBuf, kWritePeriod, &timedOut);
+    Drain();
+  }
+  // write anything queued before the thread was stopped
+  Drain();
+}
+
+void LocalDataLoggerThread::Thread::Drain() {
+  uint64_t count = 0;
+  Record record;
+  while (m_queue.Pop(&record)) {
+    ++count;
+    if (!m_pending.empty() && (m_pending.back().log != record.log ||
+                               m_pending.size() >= kMaxBatchSize)) {
+      WriteBatch();
+    }
+    m_pending.emplace_back(std::move(record));
+  }
+  WriteBatch();
+  if (count != 0) {
+    m_written.fetch_add(count, std::memory_order_release);
+    {
+      std::scoped_lock lock{m_mutex};
+    }
+    m_flushed.notify_all();
+  }
+}
+
+// Encodes a value the same way as the corresponding DataLog::AppendX()
+// function.  Raw and string payloads (and numeric arrays, on little-endian
+// platforms) are referenced in place; everything else is written to the end
+// of buf, and an empty span with a null pointer is returned.
+static std::span<const uint8_t> Encode(const nt::Value& v,
+                                       std::vector<uint8_t>& buf) {
+  auto bytes = [](auto arr) -> std::span<const uint8_t> {
+    return {reinterpret_cast<const uint8_t*>(arr.data()), arr.size_bytes()};
+  };
+  auto append = [&](size_t size) {
+    buf.resize(buf.size() + size);
+    return buf.data() + buf.size() - size;
+  };
+  auto appendArray = [&](auto arr) {
+    for (auto val : arr) {
+      if constexpr (sizeof(val) == 8) {
+        wpi::support::endian::write64le(append(8),
+                                        std::bit_cast<uint64_t>(val));
+      } else {
+        wpi::support::endian::write32le(append(4),
+                                        std::bit_cast<uint32_t>(val));
+      }
+    }
+  };
+  constexpr bool native = std::endian::native == std::endian::little;
+
+  switch (v.type()) {
+    case NT_BOOLEAN:
+      *append(1) = v.GetBoolean() ? 1 : 0;
+      break;
+    case NT_INTEGER:
+      wpi::support::endian::write64le(append(8), v.GetInteger());
+      break;
+    case NT_FLOAT:
+      wpi::support::endian::write32le(append(4),
+                                      std::bit_cast<uint32_t>(v.GetFloat()));
+      break;
+    case NT_DOUBLE:
+      wpi::support::endian::write64le(append(8),
+                                      std::bit_cast<uint64_t>(v.GetDouble()));
+      break;
+    case NT_STRING:
+      return bytes(std::span{v.GetString()});
+    case NT_RAW:
+      return v.GetRaw();
+    case NT_BOOLEAN_ARRAY: {
+      auto arr = v.GetBooleanArray();
+      uint8_t* out = append(arr.size());
+      for (auto val : arr) {
+        *out++ = val & 1;
+      }
+      break;
+    }
+    case NT_INTEGER_ARRAY:
+      if constexpr (native) {
+        return bytes(v.GetIntegerArray());
+      } else {
+        appendArray(v.GetIntegerArray());
+      }
+      break;
+    case NT_FLOAT_ARRAY:
+      if constexpr (native) {
+        return bytes(v.GetFloatArray());
+      } else {
+        appendArray(v.GetFloatArray());
+      }
+      break;
+    case NT_DOUBLE_ARRAY:
+      if constexpr (native) {
+        return bytes(v.GetDoubleArray());
+      } else {
+        appendArray(v.GetDoubleArray());
+      }
+      break;
+    case NT_STRING_ARRAY: {
+      // 4-byte array length, each string prefixed by 4-byte length
+      auto arr = v.GetStringArray();
+      wpi::support::endian::write32le(append(4), arr.size());
+      for (auto&& str : arr) {
+        wpi::support::endian::write32le(append(4), str.size());
+        if (!str.empty()) {
+          std::memcpy(append(str.size()), str.data(), str.size());
+        }
+      }
+      break;
+    }
+    default:
+      break;
+  }
+  return {};
+}
+
+void LocalDataLoggerThread::Thread::WriteBatch() {
+  if (m_pending.empty()) {
+    return;
+  }
+  m_scratch.clear();
+  m_batch.clear();
+  // offsets into m_scratch are resolved after all records are encoded, as
+  // encoding may reallocate it
+  wpi::SmallVector<std::pair<size_t, size_t>, 64> scratchRecords;
+  for (auto&& record : m_pending) {
+    size_t offset = m_scratch.size();
+    auto data = Encode(record.value, m_scratch);
+    if (data.data() == nullptr) {
+      scratchRecords.emplace_back(m_batch.size(), offset);
+    }
+    m_batch.push_back({record.entry, data, record.value.time()});
+  }
+  for (size_t i = 0; i < scratchRecords.size(); ++i) {
+    auto [index, offset] = scratchRecords[i];
+    size_t end = i + 1 < scratchRecords.size() ? scratchRecords[i + 1].second
+                                               : m_scratch.size();
+    m_batch[index].data = {m_scratch.data() + offset, end - offset};
+  }
+  m_pending.front().log->AppendRawBatch(m_batch);
+  m_pending.clear();
+}
@@ -0,0 +1,100 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <wpi/DataLog.h>
+#include <wpi/SafeThread.h>
+#include <wpi/Synchronization.h>
+#include <wpi/condition_variable.h>
+
+#include "networktables/NetworkTableValue.h"
+
+namespace nt::local {
+
+// Writes topic values to data logs from a separate thread.  Values are queued
+// without locking and written in batches, so each data log lock is acquired
+// once per batch rather than once per value.  Queued values share their
+// payload with the value that was set, so raw and struct data is not copied
+// until it is written to the log buffer.
+class LocalDataLoggerThread {
+ public:
+  // Starts the thread; no effect if already started.
+  void Start();
+
+  // Queues a value to be appended to a data log entry.  May be called from
+  // multiple threads concurrently.
+  void Append(wpi::log::DataLog* log, int entry, const Value& value);
+
+  // Waits until all previously queued values have been written.  Must be
+  // called before finishing an entry, and before a data log can be destroyed.
+  void Flush();
+
+ private:
+  struct Record {
+    wpi::log::DataLog* log = nullptr;
+    int entry = 0;
+    Value value;
+  };
+
+  // Bounded multi-producer, single-consumer queue.  Each cell has a sequence
+  // number that tells producers when it is free and the consumer when it has
+  // been filled.
+  class Queue {
+   public:
+    static constexpr size_t kSize = 4096;
+
+    Queue();
+
+    // Returns the position the record was stored at, or -1 if full.
+    int64_t Push(Record&& record);
+
+    bool Pop(Record* record);
+
+    uint64_t GetPushCount() const {
+      return m_pushPos.load(std::memory_order_acquire);
+    }
+
+   private:
+    struct Cell {
+      std::atomic<uint64_t> seq;
+      Record record;
+    };
+    std::unique_ptr<std::array<Cell, kSize>> m_cells;
+    alignas(64) std::atomic<uint64_t> m_pushPos{0};
+    alignas(64) uint64_t m_popPos{0};
+  };
+
+  class Thread final : public wpi::SafeThreadEvent {
+   public:
+    void Main() final;
+
+    void Drain();
+    void WriteBatch();
+
+    Queue m_queue;
+    wpi::Event m_wakeup;
+    // number of records written, for Flush()
+    std::atomic<uint64_t> m_written{0};
+    wpi::condition_variable m_flushed;
+
+    // records popped but not yet written; kept to keep payloads alive
+    std::vector<Record> m_pending;
+    std::vector<wpi::log::DataLog::RawRecord> m_batch;
+    std::vector<uint8_t> m_scratch;
+  };
+
+  wpi::SafeThreadOwner<Thread> m_owner;
+  // accessed directly (without the SafeThread lock) to keep Append lock-free
+  std::shared_ptr<Thread> m_thread;
+};
+
+}  // namespace nt::local
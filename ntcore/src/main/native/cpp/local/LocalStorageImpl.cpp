@@ -692,7 +692,9 @@ void StorageImpl::RemoveListener(NT_Listener listenerHandle,
 LocalDataLogger* StorageImpl::StartDataLog(wpi::log::DataLog& log,
                                            std::string_view prefix,
                                            std::string_view logPrefix) {
-  auto datalogger = m_dataloggers.Add(m_inst, log, prefix, logPrefix);
+  m_datalogThread.Start();
+  auto datalogger =
+      m_dataloggers.Add(m_inst, m_datalogThread, log, prefix, logPrefix);
 
   // start logging any matching topics
   auto now = nt::Now();
@@ -713,6 +715,8 @@ LocalDataLogger* StorageImpl::StartDataLog(wpi::log::DataLog& log,
 
 void StorageImpl::StopDataLog(NT_DataLogger logger) {
   if (auto datalogger = m_dataloggers.Remove(logger)) {
+    // write any queued values, as the log may be destroyed after this returns
+    m_datalogThread.Flush();
     // finish any active entries
     auto now = Now();
     for (auto&& topic : m_topics) {
@@ -763,6 +767,7 @@ void StorageImpl::Reset() {
   m_subscribers.clear();
   m_entries.clear();
   m_multiSubscribers.clear();
+  m_datalogThread.Flush();
   m_dataloggers.clear();
   m_nameTopics.clear();
   m_listeners.clear();
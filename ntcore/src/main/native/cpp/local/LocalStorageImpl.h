@@ -10,12 +10,13 @@
 
 #include <wpi/DenseMap.h>
 #include <wpi/StringExtras.h>
-#include <wpi/StringMap.h>
+#include <wpi/StringHashMap.h>
 #include <wpi/Synchronization.h>
 #include <wpi/json.h>
 
 #include "HandleMap.h"
 #include "local/LocalDataLogger.h"
+#include "local/LocalDataLoggerThread.h"
 #include "local/LocalEntry.h"
 #include "local/LocalListener.h"
 #include "local/LocalMultiSubscriber.h"
@@ -140,13 +141,8 @@ class StorageImpl {
   bool SetEntryValue(NT_Handle pubentryHandle, const Value& value);
   bool SetDefaultEntryValue(NT_Handle pubsubentryHandle, const Value& value);
 
-  Value* GetSubEntryValue(NT_Handle subentryHandle) {
-    if (auto subscriber = GetSubEntry(subentryHandle)) {
-      return &subscriber->topic->lastValue;
-    } else {
-      return nullptr;
-    }
-  }
+  bool PublishLocalValue(LocalPublisher* publisher, const Value& value,
+                         bool force = false);
 
   //
   // Publish/Subscribe/Entry functions
@@ -199,6 +195,17 @@ class StorageImpl {
 
   LocalSubscriber* GetSubEntry(NT_Handle subentryHandle);
 
+  // returns nullptr if an entry hasn't published yet
+  LocalPublisher* GetPublisher(NT_Handle pubentryHandle) {
+    if (auto publisher = m_publishers.Get(pubentryHandle)) {
+      return publisher;
+    } else if (auto entry = m_entries.Get(pubentryHandle)) {
+      return entry->publisher;
+    } else {
+      return nullptr;
+    }
+  }
+
   LocalEntry* GetEntryByHandle(NT_Entry entryHandle) {
     return m_entries.Get(entryHandle);
   }
@@ -287,9 +294,6 @@ class StorageImpl {
 
   LocalPublisher* PublishEntry(LocalEntry* entry, NT_Type type);
 
-  bool PublishLocalValue(LocalPublisher* publisher, const Value& value,
-                         bool force = false);
-
  private:
   int m_inst;
   IListenerStorage& m_listenerStorage;
@@ -304,8 +308,11 @@ class StorageImpl {
   HandleMap<LocalMultiSubscriber, 16> m_multiSubscribers;
   HandleMap<LocalDataLogger, 16> m_dataloggers;
 
+  // writes values for all data loggers; started with the first data logger
+  LocalDataLoggerThread m_datalogThread;
+
   // name mappings
-  wpi::StringMap<LocalTopic*> m_nameTopics;
+  wpi::StringHashMap<LocalTopic*> m_nameTopics;
 
   // listeners
   wpi::DenseMap<NT_Listener, std::unique_ptr<LocalListener>> m_listeners;
@@ -314,7 +321,7 @@ class StorageImpl {
   VectorSet<LocalListener*> m_topicPrefixListeners;
 
   // schema publishers
-  wpi::StringMap<NT_Publisher> m_schemas;
+  wpi::StringHashMap<NT_Publisher> m_schemas;
 };
 
 }  // namespace nt::local
@@ -17,7 +17,7 @@ void LocalTopic::StartStopDataLog(LocalDataLogger* logger, int64_t timestamp,
       [&](const auto& elem) { return elem.logger == logger->handle; });
   if (publish && it == datalogs.end()) {
     datalogs.emplace_back(
-        logger->log,
+        logger->thread, logger->log,
         logger->Start(name, typeStr,
                       LocalDataLoggerEntry::MakeMetadata(m_propertiesStr),
                       timestamp),
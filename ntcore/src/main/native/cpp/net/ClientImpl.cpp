@@ -13,6 +13,8 @@
 
 #include <fmt/format.h>
 #include <wpi/Logger.h>
+#include <wpi/Profile.h>
+#include <wpi/json.h>
 #include <wpi/raw_ostream.h>
 #include <wpi/timestamp.h>
 
@@ -27,15 +29,21 @@
 using namespace nt;
 using namespace nt::net;
 
+static bool GetDeltaProperty(const wpi::json& properties) {
+  auto it = properties.find("delta");
+  return it != properties.end() && it->is_boolean() && it->get<bool>();
+}
+
 ClientImpl::ClientImpl(
     uint64_t curTimeMs, WireConnection& wire, wpi::Logger& logger,
     std::function<void(int64_t serverTimeOffset, int64_t rtt2, bool valid)>
         timeSyncUpdated,
-    std::function<void(uint32_t repeatMs)> setPeriodic)
+    std::function<void(uint32_t repeatMs)> setPeriodic, bool deltaFrames)
     : m_wire{wire},
       m_logger{logger},
       m_timeSyncUpdated{std::move(timeSyncUpdated)},
       m_setPeriodic{std::move(setPeriodic)},
+      m_deltaFrames{deltaFrames},
       m_ping{wire},
       m_nextPingTimeMs{curTimeMs + (wire.GetVersion() >= 0x0401
                                         ? NetworkPing::kPingIntervalMs
@@ -61,7 +69,8 @@ void ClientImpl::ProcessIncomingBinary(uint64_t curTimeMs,
     Value value;
     std::string error;
     if (!WireDecodeBinary(&data, &id, &value, &error,
-                          -m_outgoing.GetTimeOffset())) {
+                          -m_outgoing.GetTimeOffset(),
+                          m_deltaFrames ? &m_deltaBases : nullptr)) {
       ERR("binary decode error: {}", error);
       break;  // FIXME
     }
@@ -118,6 +127,7 @@ void ClientImpl::HandleLocal(std::span<ClientMessage> msgs) {
 }
 
 void ClientImpl::SendOutgoing(uint64_t curTimeMs, bool flush) {
+  WPI_PROFILE_SCOPE("nt::ClientImpl::SendOutgoing()");
   DEBUG4("SendOutgoing({}, {})", curTimeMs, flush);
 
   if (m_wire.GetVersion() >= 0x0401) {
@@ -174,7 +184,9 @@ void ClientImpl::Publish(int32_t pubuid, std::string_view name,
   if (!publisher) {
     publisher = std::make_unique<PublisherData>();
   }
+  publisher->name = name;
   publisher->options = options;
+  publisher->delta = GetDeltaProperty(properties);
   publisher->periodMs = std::lround(options.periodicMs / 10.0) * 10;
   if (publisher->periodMs < kMinPeriodMs) {
     publisher->periodMs = kMinPeriodMs;
@@ -217,7 +229,8 @@ void ClientImpl::SetValue(int32_t pubuid, const Value& value) {
   auto& publisher = *m_publishers[pubuid];
   m_outgoing.SendValue(
       pubuid, value,
-      publisher.options.sendAll ? ValueSendMode::kAll : ValueSendMode::kNormal);
+      publisher.options.sendAll ? ValueSendMode::kAll : ValueSendMode::kNormal,
+      m_deltaFrames && publisher.delta);
 }
 
 int ClientImpl::ServerAnnounce(std::string_view name, int id,
@@ -226,6 +239,11 @@ int ClientImpl::ServerAnnounce(std::string_view name, int id,
                                std::optional<int> pubuid) {
   DEBUG4("ServerAnnounce({}, {}, {})", name, id, typeStr);
   assert(m_local);
+  if (pubuid && static_cast<uint32_t>(*pubuid) < m_publishers.size() &&
+      m_publishers[*pubuid]) {
+    // the topic may already exist with different properties
+    m_publishers[*pubuid]->delta = GetDeltaProperty(properties);
+  }
   m_topicMap[id] =
       m_local->ServerAnnounce(name, 0, typeStr, properties, pubuid);
   return id;
@@ -236,12 +254,22 @@ void ClientImpl::ServerUnannounce(std::string_view name, int id) {
   assert(m_local);
   m_local->ServerUnannounce(name, m_topicMap[id]);
   m_topicMap.erase(id);
+  m_deltaBases.erase(id);
 }
 
 void ClientImpl::ServerPropertiesUpdate(std::string_view name,
                                         const wpi::json& update, bool ack) {
   DEBUG4("ServerProperties({}, {}, {})", name, update.dump(), ack);
   assert(m_local);
+  if (auto it = update.find("delta"); it != update.end()) {
+    // a null value means the property was deleted
+    bool delta = it->is_boolean() && it->get<bool>();
+    for (auto&& pub : m_publishers) {
+      if (pub && pub->name == name) {
+        pub->delta = delta;
+      }
+    }
+  }
   m_local->ServerPropertiesUpdate(name, update, ack);
 }
 
@@ -9,6 +9,7 @@
 #include <functional>
 #include <memory>
 #include <span>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -41,7 +42,8 @@ class ClientImpl final : private ServerMessageHandler {
       uint64_t curTimeMs, WireConnection& wire, wpi::Logger& logger,
       std::function<void(int64_t serverTimeOffset, int64_t rtt2, bool valid)>
           timeSyncUpdated,
-      std::function<void(uint32_t repeatMs)> setPeriodic);
+      std::function<void(uint32_t repeatMs)> setPeriodic,
+      bool deltaFrames = false);
 
   void ProcessIncomingText(std::string_view data);
   void ProcessIncomingBinary(uint64_t curTimeMs, std::span<const uint8_t> data);
@@ -54,10 +56,13 @@ class ClientImpl final : private ServerMessageHandler {
 
  private:
   struct PublisherData {
+    std::string name;
     PubSubOptionsImpl options;
     // in options as double, but copy here as integer; rounded to the nearest
     // 10 ms
     uint32_t periodMs;
+    // value of the topic "delta" property
+    bool delta = false;
   };
 
   void UpdatePeriodic();
@@ -89,6 +94,11 @@ class ClientImpl final : private ServerMessageHandler {
   // indexed by server-provided topic id
   wpi::DenseMap<int, int> m_topicMap;
 
+  // true if the server negotiated delta binary messages
+  bool m_deltaFrames;
+  // last raw/array value received for each server-provided topic id
+  wpi::DenseMap<int, Value> m_deltaBases;
+
   // ping
   NetworkPing m_ping;
 
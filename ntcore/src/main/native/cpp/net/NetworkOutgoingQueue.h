@@ -107,7 +107,14 @@ class NetworkOutgoingQueue {
     infoIt->getSecond().queueIndex = queueIndex;
   }
 
-  void EraseId(int id) { m_idMap.erase(id); }
+  void EraseId(int id) {
+    if (auto it = m_idMap.find(id); it != m_idMap.end()) {
+      if (it->getSecond().delta) {
+        --m_deltaIds;
+      }
+      m_idMap.erase(it);
+    }
+  }
 
   template <typename T>
   void SendMessage(int id, T&& msg) {
@@ -115,7 +122,13 @@ class NetworkOutgoingQueue {
     m_totalSize += sizeof(Message);
   }
 
-  void SendValue(int id, const Value& value, ValueSendMode mode) {
+  // if delta is true, the value may be sent as a delta against the last value
+  // sent for the id; the connection must have negotiated delta messages
+  void SendValue(int id, const Value& value, ValueSendMode mode,
+                 bool delta = false) {
+    if (delta || m_deltaIds != 0) {
+      SetDelta(id, delta);
+    }
     if (m_local) {
       mode = ValueSendMode::kImm;  // always send local immediately
     }
@@ -224,6 +237,17 @@ class NetworkOutgoingQueue {
           return;  // error
         }
       }
+      if (unsent > 0 && m_deltaIds != 0) {
+        // the unsent values were encoded, but the receiver won't see them, so
+        // send full values next time
+        for (auto&& msg : std::span{it - unsent, it}) {
+          if (std::holds_alternative<ValueMsg>(msg.msg.contents)) {
+            if (auto infoIt = m_idMap.find(msg.id); infoIt != m_idMap.end()) {
+              infoIt->getSecond().deltaBase = {};
+            }
+          }
+        }
+      }
       int delta = it - msgs.begin() - unsent;
       for (auto&& msg : std::span{msgs}.subspan(0, delta)) {
         if (auto m = std::get_if<ValueMsg>(&msg.msg.contents)) {
@@ -265,6 +289,15 @@ class NetworkOutgoingQueue {
  private:
   using ValueMsg = typename MessageType::ValueMsg;
 
+  void SetDelta(int id, bool delta) {
+    auto& info = m_idMap[id];
+    if (info.delta != delta) {
+      info.delta = delta;
+      info.deltaBase = {};
+      m_deltaIds += delta ? 1 : -1;
+    }
+  }
+
   void EncodeValue(wpi::raw_ostream& os, int id, const Value& value) {
     int64_t time = value.time();
     if constexpr (std::same_as<ValueMsg, ClientValueMsg>) {
@@ -276,6 +309,23 @@ class NetworkOutgoingQueue {
         }
       }
     }
+    if (m_deltaIds != 0) {
+      auto infoIt = m_idMap.find(id);
+      if (infoIt != m_idMap.end() && infoIt->getSecond().delta) {
+        // send a full value periodically so the receiver can't drift too far
+        // if it ever decodes a delta differently
+        auto& info = infoIt->getSecond();
+        if (info.deltaBase && info.deltaCount < kMaxDeltas &&
+            WireEncodeBinaryDelta(os, id, time, info.deltaBase, value)) {
+          ++info.deltaCount;
+        } else {
+          WireEncodeBinary(os, id, time, value);
+          info.deltaCount = 0;
+        }
+        info.deltaBase = value;
+        return;
+      }
+    }
     WireEncodeBinary(os, id, time, value);
   }
 
@@ -304,6 +354,9 @@ class NetworkOutgoingQueue {
   struct HandleInfo {
     unsigned int queueIndex = 0;
     int valuePos = -1;  // -1 if not in queue
+    bool delta = false;
+    unsigned int deltaCount = 0;  // deltas sent since the last full value
+    Value deltaBase;              // last value sent, if delta
   };
   wpi::DenseMap<int, HandleInfo> m_idMap;
   size_t m_totalSize{0};
@@ -311,10 +364,14 @@ class NetworkOutgoingQueue {
   int64_t m_timeOffsetUs{0};
   unsigned int m_lastSetPeriodQueueIndex = 0;
   unsigned int m_lastSetPeriod = 100;
+  unsigned int m_deltaIds = 0;  // number of ids with delta enabled
   bool m_local;
 
   // maximum total size of outgoing queues in bytes (approximate)
   static constexpr size_t kOutgoingLimit = 1024 * 1024;
+
+  // maximum number of deltas sent in a row for an id
+  static constexpr unsigned int kMaxDeltas = 50;
 };
 
 }  // namespace nt::net
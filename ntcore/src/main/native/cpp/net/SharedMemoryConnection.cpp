@@ -0,0 +1,305 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "SharedMemoryConnection.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include <uv.h>
+#include <wpi/Endian.h>
+#include <wpi/Logger.h>
+#include <wpi/SmallVector.h>
+#include <wpi/StringExtras.h>
+#include <wpi/raw_ostream.h>
+#include <wpi/timestamp.h>
+#include <wpinet/WebSocket.h>
+#include <wpinet/uv/Stream.h>
+
+using namespace nt;
+using namespace nt::net;
+
+// there's no MTU to fit into, but keep frames bounded so a single Write()
+// can't produce a record larger than the ring allows
+static constexpr size_t kNewFrameThresholdBytes = 65536;
+static constexpr size_t kFlushThresholdFrames = 32;
+static constexpr size_t kFlushThresholdBytes = 262144;
+// the reader thread is woken explicitly on shutdown; this is just a backstop
+static constexpr uint32_t kWaitTimeoutMs = 1000;
+// how often queued records are retried while the ring is full
+static constexpr wpi::uv::Timer::Time kOverflowRetryPeriod{5};
+
+bool SharedMemoryConnection::CanConnect(std::string_view peerAddr) {
+  if (!SharedMemorySegment::IsSupported()) {
+    return false;
+  }
+  if (auto addr = wpi::remove_prefix(peerAddr, "::ffff:")) {
+    peerAddr = *addr;
+  }
+  return peerAddr == "::1" || wpi::starts_with(peerAddr, "127.");
+}
+
+SharedMemoryConnection::SharedMemoryConnection(
+    wpi::WebSocket& ws, std::unique_ptr<SharedMemorySegment> segment,
+    bool server, unsigned int version, wpi::Logger& logger)
+    : m_ws{ws},
+      m_segment{std::move(segment)},
+      m_out{server ? m_segment->GetServerToClient()
+                   : m_segment->GetClientToServer()},
+      m_in{server ? m_segment->GetClientToServer()
+                  : m_segment->GetServerToClient()},
+      m_logger{logger},
+      m_version{version} {
+  m_async = wpi::uv::Async<>::Create(m_ws.GetStream().GetLoopRef());
+  m_async->wakeup.connect([this] { Drain(); });
+  m_overflowTimer = wpi::uv::Timer::Create(m_ws.GetStream().GetLoopRef());
+  m_overflowTimer->timeout.connect([this] { SendOverflow(); });
+  m_thread = std::thread{[this] { ThreadMain(); }};
+}
+
+SharedMemoryConnection::~SharedMemoryConnection() {
+  {
+    std::scoped_lock lock{m_mutex};
+    m_stopping = true;
+  }
+  m_drainedCv.notify_all();
+  m_in.Notify();
+  m_thread.join();
+  m_async->wakeup.disconnect_all();
+  m_async->Close();
+  m_overflowTimer->timeout.disconnect_all();
+  m_overflowTimer->Close();
+}
+
+void SharedMemoryConnection::SendPing(uint64_t time) {
+  WPI_DEBUG4(m_logger, "shm: sending ping {}", time);
+  uint8_t buf[8];
+  wpi::support::endian::write64<wpi::endianness::native>(buf, time);
+  SendRecord(kPing, buf);
+}
+
+void SharedMemoryConnection::SendRecord(State kind,
+                                        std::span<const uint8_t> data) {
+  if (data.size() > m_out.GetMaxRecordSize()) {
+    Disconnect("message too large");
+    return;
+  }
+  if (SendOverflow() && m_out.TryWrite(kind, data)) {
+    m_out.Notify();
+    return;
+  }
+  // the peer isn't keeping up; queue rather than reorder, within reason
+  m_overflowBytes += data.size();
+  if (m_overflowBytes > kRingCapacity) {
+    m_overflow.clear();
+    m_overflowBytes = 0;
+    m_overflowTimer->Stop();
+    Disconnect("shared memory ring overflow");
+    return;
+  }
+  if (m_overflow.empty()) {
+    m_overflowTimer->Start(kOverflowRetryPeriod, kOverflowRetryPeriod);
+  }
+  m_overflow.push_back({kind, {data.begin(), data.end()}});
+}
+
+bool SharedMemoryConnection::SendOverflow() {
+  if (m_overflow.empty()) {
+    return true;
+  }
+  bool sent = false;
+  while (!m_overflow.empty()) {
+    auto& record = m_overflow.front();
+    if (!m_out.TryWrite(record.kind, record.data)) {
+      break;
+    }
+    sent = true;
+    m_overflowBytes -= record.data.size();
+    m_overflow.pop_front();
+  }
+  if (sent) {
+    m_out.Notify();
+  }
+  if (m_overflow.empty()) {
+    m_overflowTimer->Stop();
+    return true;
+  }
+  return false;
+}
+
+void SharedMemoryConnection::FinishFrame() {
+  if (m_state == kText) {
+    m_buf.push_back(']');
+  }
+  if (!m_frames.empty()) {
+    m_frames.back().end = m_buf.size();
+  }
+}
+
+int SharedMemoryConnection::Write(
+    State kind, wpi::function_ref<void(wpi::raw_ostream& os)> writer) {
+  bool first = false;
+  if (m_state != kind ||
+      (m_buf.size() - m_frames.back().start) >= kNewFrameThresholdBytes) {
+    // start a new frame
+    FinishFrame();
+    m_state = kind;
+    m_frames.emplace_back(kind, m_buf.size());
+    first = true;
+  }
+  {
+    wpi::raw_uvector_ostream os{m_buf};
+    if (kind == kText) {
+      os << (first ? '[' : ',');
+    }
+    writer(os);
+  }
+  ++m_frames.back().count;
+  if (m_frames.size() > kFlushThresholdFrames ||
+      m_buf.size() >= kFlushThresholdBytes) {
+    return Flush();
+  }
+  return 0;
+}
+
+int SharedMemoryConnection::Flush() {
+  WPI_DEBUG4(m_logger, "shm: flushing");
+  m_lastFlushTime = wpi::Now();
+  if (m_state == kEmpty) {
+    return 0;
+  }
+  FinishFrame();
+  m_state = kEmpty;
+
+  // once a frame doesn't fit, don't send any later ones, to preserve ordering
+  int count = 0;
+  if (!SendOverflow()) {
+    for (auto&& frame : m_frames) {
+      count += frame.count;
+    }
+    m_frames.clear();
+    m_buf.clear();
+    return count;
+  }
+  bool sent = false;
+  for (auto&& frame : m_frames) {
+    std::span<const uint8_t> data{m_buf.data() + frame.start,
+                                  frame.end - frame.start};
+    if (data.size() > m_out.GetMaxRecordSize()) {
+      m_frames.clear();
+      m_buf.clear();
+      Disconnect("message too large");
+      return UV_EMSGSIZE;
+    }
+    if (count == 0 && m_out.TryWrite(frame.kind, data)) {
+      sent = true;
+    } else {
+      count += frame.count;
+    }
+  }
+  if (sent) {
+    m_out.Notify();
+  }
+  m_frames.clear();
+  m_buf.clear();
+  return count;
+}
+
+void SharedMemoryConnection::Send(
+    State kind, wpi::function_ref<void(wpi::raw_ostream& os)> writer) {
+  wpi::SmallVector<uint8_t, 256> buf;
+  {
+    wpi::raw_usvector_ostream os{buf};
+    if (kind == kText) {
+      os << '[';
+    }
+    writer(os);
+    if (kind == kText) {
+      os << ']';
+    }
+  }
+  WPI_DEBUG4(m_logger, "shm: Send({})", static_cast<uint32_t>(kind));
+  SendRecord(kind, buf);
+}
+
+uint64_t SharedMemoryConnection::GetLastReceivedTime() const {
+  return (std::max)(m_lastReceivedTime, m_ws.GetLastReceivedTime());
+}
+
+void SharedMemoryConnection::StartRead() {
+  if (!m_readActive) {
+    m_readActive = true;
+    // don't drain from within the caller; defer to the loop
+    m_async->UnsafeSend();
+  }
+}
+
+void SharedMemoryConnection::Disconnect(std::string_view reason) {
+  m_reason = reason;
+  m_ws.Fail(1001, reason);
+}
+
+void SharedMemoryConnection::Drain() {
+  // handlers may disconnect us
+  auto self = shared_from_this();
+  bool received = false;
+  while (m_readActive && !m_stopping) {
+    auto record = m_in.Peek();
+    if (!record) {
+      if (m_in.IsCorrupt()) {
+        Disconnect("corrupt shared memory ring");
+        return;
+      }
+      break;
+    }
+    received = true;
+    switch (record->kind) {
+      case kText: {
+        auto data = record->data;
+        text(std::string_view{reinterpret_cast<const char*>(data.data()),
+                              data.size()});
+        break;
+      }
+      case kBinary:
+        binary(record->data);
+        break;
+      case kPing:
+        SendRecord(kPong, record->data);
+        break;
+      default:
+        break;
+    }
+    m_in.Pop();
+  }
+  if (received) {
+    m_lastReceivedTime = wpi::Now();
+  }
+  if (m_readActive) {
+    {
+      std::scoped_lock lock{m_mutex};
+      m_drained = true;
+    }
+    m_drainedCv.notify_one();
+  }
+}
+
+void SharedMemoryConnection::ThreadMain() {
+  while (!m_stopping) {
+    uint32_t seq = m_in.GetSequence();
+    if (m_stopping) {
+      break;
+    }
+    if (!m_in.Wait(seq, kWaitTimeoutMs)) {
+      continue;
+    }
+    {
+      std::scoped_lock lock{m_mutex};
+      m_drained = false;
+    }
+    m_async->Send();
+    std::unique_lock lock{m_mutex};
+    m_drainedCv.wait(lock, [&] { return m_drained || m_stopping; });
+  }
+}
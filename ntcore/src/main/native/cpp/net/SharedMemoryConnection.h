@@ -0,0 +1,161 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <wpi/Signal.h>
+#include <wpi/condition_variable.h>
+#include <wpi/function_ref.h>
+#include <wpi/mutex.h>
+#include <wpinet/uv/Async.h>
+#include <wpinet/uv/Timer.h>
+
+#include "SharedMemoryRing.h"
+#include "WireConnection.h"
+
+namespace wpi {
+class Logger;
+class WebSocket;
+}  // namespace wpi
+
+namespace nt::net {
+
+// NT4 over a pair of shared memory rings, for a client and server on the same
+// host. The messages are encoded exactly as they are for WebSocketConnection
+// (text frames are JSON arrays, binary frames are concatenated msgpack); only
+// the transport differs. The WebSocket that negotiated the connection stays
+// open as a control channel: closing it closes this connection.  All messages
+// go through the ring, so they arrive in order; SendText/SendBinary messages
+// that don't fit are queued and written before anything else, and the
+// connection is dropped if too much is queued.
+class SharedMemoryConnection final
+    : public WireConnection,
+      public std::enable_shared_from_this<SharedMemoryConnection> {
+ public:
+  static constexpr std::string_view kProtocol =
+      "shm.v4.1.networktables.first.wpi.edu";
+
+  // Ring size in each direction
+  static constexpr uint32_t kRingCapacity = 4 * 1024 * 1024;
+
+  // Returns true if a shared memory connection should be attempted with a
+  // peer at the given address (i.e. it is a loopback address and shared
+  // memory is supported on this platform).
+  static bool CanConnect(std::string_view peerAddr);
+
+  SharedMemoryConnection(wpi::WebSocket& ws,
+                         std::unique_ptr<SharedMemorySegment> segment,
+                         bool server, unsigned int version,
+                         wpi::Logger& logger);
+  ~SharedMemoryConnection() override;
+  SharedMemoryConnection(const SharedMemoryConnection&) = delete;
+  SharedMemoryConnection& operator=(const SharedMemoryConnection&) = delete;
+
+  unsigned int GetVersion() const final { return m_version; }
+
+  void SendPing(uint64_t time) final;
+
+  bool Ready() const final {
+    return m_overflow.empty() &&
+           m_out.GetFreeSpace() >= m_out.GetCapacity() / 2;
+  }
+
+  int WriteText(wpi::function_ref<void(wpi::raw_ostream& os)> writer) final {
+    return Write(kText, writer);
+  }
+  int WriteBinary(wpi::function_ref<void(wpi::raw_ostream& os)> writer) final {
+    return Write(kBinary, writer);
+  }
+  int Flush() final;
+
+  void SendText(wpi::function_ref<void(wpi::raw_ostream& os)> writer) final {
+    Send(kText, writer);
+  }
+  void SendBinary(wpi::function_ref<void(wpi::raw_ostream& os)> writer) final {
+    Send(kBinary, writer);
+  }
+
+  uint64_t GetLastFlushTime() const final { return m_lastFlushTime; }
+
+  uint64_t GetLastReceivedTime() const final;
+
+  void StopRead() final { m_readActive = false; }
+  void StartRead() final;
+
+  void Disconnect(std::string_view reason) final;
+
+  std::string_view GetDisconnectReason() const { return m_reason; }
+
+  // Incoming messages; emitted on the loop thread
+  wpi::sig::Signal<std::string_view> text;
+  wpi::sig::Signal<std::span<const uint8_t>> binary;
+
+ private:
+  // these are also the ring record kinds
+  enum State : uint32_t { kEmpty, kText, kBinary, kPing, kPong };
+
+  struct Frame {
+    Frame(State kind, size_t start) : start{start}, end{start}, kind{kind} {}
+    size_t start;
+    size_t end;
+    unsigned int count = 0;
+    State kind;
+  };
+
+  int Write(State kind, wpi::function_ref<void(wpi::raw_ostream& os)> writer);
+  void Send(State kind, wpi::function_ref<void(wpi::raw_ostream& os)> writer);
+  // writes a record that must be sent, queueing it if the ring is full
+  void SendRecord(State kind, std::span<const uint8_t> data);
+  // writes queued records to the ring; returns true if none remain
+  bool SendOverflow();
+  void FinishFrame();
+  void Drain();
+  void ThreadMain();
+
+  wpi::WebSocket& m_ws;
+  std::unique_ptr<SharedMemorySegment> m_segment;
+  SharedMemoryRing& m_out;
+  SharedMemoryRing& m_in;
+  wpi::Logger& m_logger;
+  bool m_readActive = true;
+
+  std::vector<uint8_t> m_buf;
+  std::vector<Frame> m_frames;
+  State m_state = kEmpty;
+
+  struct OverflowRecord {
+    State kind;
+    std::vector<uint8_t> data;
+  };
+  std::deque<OverflowRecord> m_overflow;
+  size_t m_overflowBytes = 0;
+  // retries sending m_overflow while it is not empty
+  std::shared_ptr<wpi::uv::Timer> m_overflowTimer;
+  std::string m_reason;
+  uint64_t m_lastFlushTime = 0;
+  uint64_t m_lastReceivedTime = 0;
+  unsigned int m_version;
+
+  // the reader thread sleeps on the incoming ring and wakes the loop via
+  // m_async; it then waits for the loop to drain before sleeping again
+  std::shared_ptr<wpi::uv::Async<>> m_async;
+  std::thread m_thread;
+  wpi::mutex m_mutex;
+  wpi::condition_variable m_drainedCv;
+  bool m_drained = false;
+  std::atomic_bool m_stopping{false};
+};
+
+}  // namespace nt::net
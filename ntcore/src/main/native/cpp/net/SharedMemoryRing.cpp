@@ -0,0 +1,277 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "SharedMemoryRing.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include <fmt/format.h>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <climits>
+#endif
+
+using namespace nt::net;
+
+static constexpr uint32_t kMagic = 0x4e543453;  // "NT4S"
+static constexpr uint32_t kVersion = 1;
+
+bool SharedMemoryRing::TryWrite(uint32_t kind, std::span<const uint8_t> data) {
+  if (data.size() > GetMaxRecordSize()) {
+    return false;
+  }
+  uint32_t need = kHeaderSize + Align(data.size());
+  uint32_t head = m_control.head.load(std::memory_order_relaxed);
+  uint32_t pos = head & (m_capacity - 1);
+  uint32_t contiguous = m_capacity - pos;
+  uint32_t total = contiguous < need ? contiguous + need : need;
+  if (GetFreeSpace() < total) {
+    return false;
+  }
+
+  if (contiguous < need) {
+    // pad out to the end of the buffer; contiguous is always at least
+    // kHeaderSize because everything is 8-byte aligned
+    uint32_t hdr[2] = {contiguous - kHeaderSize, kPad};
+    std::memcpy(m_data + pos, hdr, sizeof(hdr));
+    head += contiguous;
+    pos = 0;
+  }
+
+  uint32_t hdr[2] = {static_cast<uint32_t>(data.size()), kind};
+  std::memcpy(m_data + pos, hdr, sizeof(hdr));
+  if (!data.empty()) {
+    std::memcpy(m_data + pos + kHeaderSize, data.data(), data.size());
+  }
+  m_control.head.store(head + need, std::memory_order_release);
+  return true;
+}
+
+std::optional<SharedMemoryRing::Record> SharedMemoryRing::Peek() {
+  if (m_corrupt) {
+    return std::nullopt;
+  }
+  for (;;) {
+    uint32_t tail = m_control.tail.load(std::memory_order_relaxed);
+    uint32_t avail = m_control.head.load(std::memory_order_acquire) - tail;
+    if (avail == 0) {
+      return std::nullopt;
+    }
+    // the other process controls everything in shared memory, so check that
+    // the record lies within both the written region and the buffer
+    uint32_t pos = tail & (m_capacity - 1);
+    uint32_t contiguous = m_capacity - pos;
+    if (avail > m_capacity || avail < kHeaderSize) {
+      m_corrupt = true;
+      return std::nullopt;
+    }
+    uint32_t hdr[2];
+    std::memcpy(hdr, m_data + pos, sizeof(hdr));
+    if (hdr[1] == kPad) {
+      if (hdr[0] != contiguous - kHeaderSize || avail < contiguous) {
+        m_corrupt = true;
+        return std::nullopt;
+      }
+      m_control.tail.store(tail + contiguous, std::memory_order_release);
+      continue;
+    }
+    if (hdr[0] > GetMaxRecordSize() ||
+        kHeaderSize + Align(hdr[0]) > (std::min)(avail, contiguous)) {
+      m_corrupt = true;
+      return std::nullopt;
+    }
+    m_peekSize = kHeaderSize + Align(hdr[0]);
+    return Record{hdr[1], {m_data + pos + kHeaderSize, hdr[0]}};
+  }
+}
+
+void SharedMemoryRing::Pop() {
+  m_control.tail.store(
+      m_control.tail.load(std::memory_order_relaxed) + m_peekSize,
+      std::memory_order_release);
+  m_peekSize = 0;
+}
+
+#ifdef __linux__
+
+void SharedMemoryRing::Notify() {
+  m_control.seq.fetch_add(1, std::memory_order_seq_cst);
+  if (m_control.waiters.load(std::memory_order_seq_cst) != 0) {
+    // not FUTEX_PRIVATE_FLAG: the waiter is in another process
+    syscall(SYS_futex, &m_control.seq, FUTEX_WAKE, INT_MAX, nullptr, nullptr,
+            0);
+  }
+}
+
+bool SharedMemoryRing::Wait(uint32_t seq, uint32_t timeoutMs) {
+  if (!IsEmpty()) {
+    return true;
+  }
+  m_control.waiters.fetch_add(1, std::memory_order_seq_cst);
+  if (IsEmpty()) {
+    struct timespec ts;
+    ts.tv_sec = timeoutMs / 1000;
+    ts.tv_nsec = (timeoutMs % 1000) * 1000000;
+    // returns immediately if seq has changed since the caller read it
+    syscall(SYS_futex, &m_control.seq, FUTEX_WAIT, seq, &ts, nullptr, 0);
+  }
+  m_control.waiters.fetch_sub(1, std::memory_order_seq_cst);
+  return !IsEmpty();
+}
+
+#else
+
+void SharedMemoryRing::Notify() {
+  m_control.seq.fetch_add(1, std::memory_order_seq_cst);
+}
+
+bool SharedMemoryRing::Wait(uint32_t, uint32_t) {
+  return !IsEmpty();
+}
+
+#endif
+
+struct SharedMemorySegment::Header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t capacity;
+  SharedMemoryRingControl toServer;
+  SharedMemoryRingControl toClient;
+};
+
+// the ring data areas follow the header, each starting on a cache line
+static constexpr size_t kDataOffset = 512;
+
+SharedMemorySegment::SharedMemorySegment(std::string_view name, void* addr,
+                                         size_t size)
+    : m_name{name}, m_addr{addr}, m_size{size} {
+  static_assert(sizeof(Header) <= kDataOffset);
+  auto hdr = static_cast<Header*>(addr);
+  auto data = static_cast<uint8_t*>(addr) + kDataOffset;
+  m_toServer.emplace(hdr->toServer, data, hdr->capacity);
+  m_toClient.emplace(hdr->toClient, data + hdr->capacity, hdr->capacity);
+}
+
+#ifdef __linux__
+
+static std::string GetPath(std::string_view name) {
+  return fmt::format("/dev/shm/{}", name);
+}
+
+bool SharedMemorySegment::IsSupported() {
+  return access("/dev/shm", W_OK) == 0;
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::Create(
+    uint32_t capacity) {
+  static std::atomic<unsigned int> counter{0};
+  std::string name = fmt::format("nt4-{}-{}", getpid(), counter++);
+  std::string path = GetPath(name);
+  // only the same user can attach
+  int fd = open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    return nullptr;
+  }
+  size_t size = kDataOffset + 2 * static_cast<size_t>(capacity);
+  if (ftruncate(fd, size) != 0) {
+    close(fd);
+    unlink(path.c_str());
+    return nullptr;
+  }
+  void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    unlink(path.c_str());
+    return nullptr;
+  }
+  auto hdr = new (addr) Header{};
+  hdr->capacity = capacity;
+  hdr->version = kVersion;
+  std::atomic_ref<uint32_t>{hdr->magic}.store(kMagic,
+                                              std::memory_order_release);
+  return std::unique_ptr<SharedMemorySegment>{
+      new SharedMemorySegment{name, addr, size}};
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::Open(
+    std::string_view name) {
+  // don't allow escaping /dev/shm
+  if (name.empty() || name.find('/') != std::string_view::npos) {
+    return nullptr;
+  }
+  std::string path = GetPath(name);
+  int fd = open(path.c_str(), O_RDWR | O_CLOEXEC);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_uid != geteuid() ||
+      static_cast<size_t>(st.st_size) < kDataOffset) {
+    close(fd);
+    return nullptr;
+  }
+  size_t size = st.st_size;
+  void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return nullptr;
+  }
+  auto hdr = static_cast<Header*>(addr);
+  uint32_t capacity = hdr->capacity;
+  if (std::atomic_ref<uint32_t>{hdr->magic}.load(std::memory_order_acquire) !=
+          kMagic ||
+      hdr->version != kVersion || capacity == 0 ||
+      (capacity & (capacity - 1)) != 0 ||
+      size < kDataOffset + 2 * static_cast<size_t>(capacity)) {
+    munmap(addr, size);
+    return nullptr;
+  }
+  auto segment = std::unique_ptr<SharedMemorySegment>{
+      new SharedMemorySegment{name, addr, size}};
+  segment->Unlink();
+  return segment;
+}
+
+SharedMemorySegment::~SharedMemorySegment() {
+  Unlink();
+  munmap(m_addr, m_size);
+}
+
+void SharedMemorySegment::Unlink() {
+  if (m_linked) {
+    unlink(GetPath(m_name).c_str());
+    m_linked = false;
+  }
+}
+
+#else
+
+bool SharedMemorySegment::IsSupported() {
+  return false;
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::Create(uint32_t) {
+  return nullptr;
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::Open(
+    std::string_view) {
+  return nullptr;
+}
+
+SharedMemorySegment::~SharedMemorySegment() = default;
+
+void SharedMemorySegment::Unlink() {}
+
+#endif
@@ -0,0 +1,149 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace nt::net {
+
+// Control block for a single-producer single-consumer byte ring. This lives
+// in shared memory, so it must only contain lock-free atomics. The head and
+// tail are free-running byte counters; the consumer sleeps on seq (a futex
+// word on Linux) and the producer only issues a wake syscall if waiters is
+// nonzero.
+struct SharedMemoryRingControl {
+  alignas(64) std::atomic<uint32_t> head{0};
+  alignas(64) std::atomic<uint32_t> tail{0};
+  alignas(64) std::atomic<uint32_t> seq{0};
+  std::atomic<uint32_t> waiters{0};
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+// One end of a ring. Records are an 8-byte header (size, kind) followed by
+// the payload, padded to 8 bytes. Records never wrap; if there is not enough
+// contiguous space at the end of the buffer, a padding record is written and
+// the record starts at the beginning of the buffer. This lets the consumer
+// hand out spans that point directly into the ring.
+class SharedMemoryRing {
+ public:
+  static constexpr uint32_t kPad = 0;
+
+  struct Record {
+    uint32_t kind;
+    std::span<const uint8_t> data;
+  };
+
+  // capacity must be a power of 2
+  SharedMemoryRing(SharedMemoryRingControl& control, uint8_t* data,
+                   uint32_t capacity)
+      : m_control{control}, m_data{data}, m_capacity{capacity} {}
+
+  uint32_t GetCapacity() const { return m_capacity; }
+
+  // Largest payload accepted by TryWrite().
+  uint32_t GetMaxRecordSize() const { return m_capacity / 2 - kHeaderSize; }
+
+  // Bytes the producer can currently write (including record overhead).
+  uint32_t GetFreeSpace() const {
+    return m_capacity - (m_control.head.load(std::memory_order_relaxed) -
+                         m_control.tail.load(std::memory_order_acquire));
+  }
+
+  bool IsEmpty() const {
+    return m_control.head.load(std::memory_order_acquire) ==
+           m_control.tail.load(std::memory_order_relaxed);
+  }
+
+  // Producer side. Returns false (and writes nothing) if the ring does not
+  // have room for the record. kind must not be kPad. Does not wake the
+  // consumer; call Notify() after a batch of writes.
+  bool TryWrite(uint32_t kind, std::span<const uint8_t> data);
+
+  // Wakes the consumer if it is sleeping in Wait().
+  void Notify();
+
+  // Consumer side. Returns the next record without consuming it; the data
+  // span remains valid until Pop() is called. Returns nullopt if the ring is
+  // empty or corrupt (see IsCorrupt()).
+  std::optional<Record> Peek();
+
+  // Returns true if Peek() found a malformed record. The ring is shared with
+  // another process, so this can't be recovered from; no further records are
+  // returned.
+  bool IsCorrupt() const { return m_corrupt; }
+
+  // Consumes the record returned by the last Peek().
+  void Pop();
+
+  // Consumer side. Gets the current wake sequence; pass this to Wait().
+  uint32_t GetSequence() const {
+    return m_control.seq.load(std::memory_order_seq_cst);
+  }
+
+  // Waits until the ring is nonempty, Notify() is called after seq was
+  // obtained, or the timeout expires. Returns true if the ring is nonempty.
+  bool Wait(uint32_t seq, uint32_t timeoutMs);
+
+ private:
+  static constexpr uint32_t kHeaderSize = 8;
+
+  static constexpr uint32_t Align(uint32_t size) { return (size + 7) & ~7u; }
+
+  SharedMemoryRingControl& m_control;
+  uint8_t* m_data;
+  uint32_t m_capacity;
+  uint32_t m_peekSize = 0;
+  bool m_corrupt = false;
+};
+
+// A shared memory segment containing a pair of rings, one for each direction.
+// The server creates the segment and passes its name to the client over the
+// WebSocket control channel; the client opens it and immediately unlinks the
+// name so nothing is left behind if either process exits uncleanly.
+class SharedMemorySegment {
+ public:
+  ~SharedMemorySegment();
+  SharedMemorySegment(const SharedMemorySegment&) = delete;
+  SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+  // Returns false on platforms without shared memory transport support.
+  static bool IsSupported();
+
+  // Creates a new uniquely named segment. Returns nullptr on failure.
+  static std::unique_ptr<SharedMemorySegment> Create(uint32_t capacity);
+
+  // Opens and unlinks an existing segment. Returns nullptr on failure.
+  static std::unique_ptr<SharedMemorySegment> Open(std::string_view name);
+
+  const std::string& GetName() const { return m_name; }
+
+  // Removes the name from the filesystem (the mapping stays valid).
+  void Unlink();
+
+  SharedMemoryRing& GetClientToServer() { return *m_toServer; }
+  SharedMemoryRing& GetServerToClient() { return *m_toClient; }
+
+ private:
+  struct Header;
+
+  SharedMemorySegment(std::string_view name, void* addr, size_t size);
+
+  std::string m_name;
+  void* m_addr;
+  size_t m_size;
+  bool m_linked = true;
+  std::optional<SharedMemoryRing> m_toServer;
+  std::optional<SharedMemoryRing> m_toClient;
+};
+
+}  // namespace nt::net
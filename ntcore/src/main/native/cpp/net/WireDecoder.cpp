@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <concepts>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -18,6 +19,7 @@
 
 #include "Message.h"
 #include "MessageHandler.h"
+#include "WireEncoder.h"
 
 using namespace nt;
 using namespace nt::net;
@@ -474,9 +476,124 @@ void nt::net::WireDecodeText(std::string_view in, ServerMessageHandler& out,
   ::WireDecodeTextImpl(in, out, logger);
 }
 
+// Reads the changed ranges of a delta message and applies them to arr.
+// readRange is called with the reader, the start index, and the span of
+// elements to overwrite.
+template <typename T, typename F>
+static void ApplyDelta(mpack_reader_t* reader, std::vector<T>& arr,
+                       F&& readRange) {
+  auto count = mpack_expect_array(reader);
+  if (count % 2 != 0) {
+    mpack_reader_flag_error(reader, mpack_error_data);
+  }
+  for (uint32_t i = 0; i < count / 2; ++i) {
+    auto start = mpack_expect_u32(reader);
+    if (mpack_reader_error(reader) != mpack_ok) {
+      break;
+    }
+    readRange(reader, start, std::span{arr});
+    if (mpack_reader_error(reader) != mpack_ok) {
+      break;
+    }
+  }
+  mpack_done_array(reader);
+}
+
+// Reads an array of elements into arr starting at index start
+template <typename T, typename F>
+static void ReadDeltaElements(mpack_reader_t* reader, uint32_t start,
+                              std::span<T> arr, F&& readElement) {
+  auto length = mpack_expect_array(reader);
+  if (start > arr.size() || length > arr.size() - start) {
+    mpack_reader_flag_error(reader, mpack_error_data);
+    return;
+  }
+  for (uint32_t i = 0; i < length; ++i) {
+    arr[start + i] = readElement(reader);
+    if (mpack_reader_error(reader) != mpack_ok) {
+      return;
+    }
+  }
+  mpack_done_array(reader);
+}
+
+static bool DecodeDelta(mpack_reader_t* reader, int type, const Value& base,
+                        Value* outValue, std::string* error) {
+  switch (type) {
+    case 5:  // raw
+      if (base.IsRaw()) {
+        auto raw = base.GetRaw();
+        std::vector<uint8_t> arr{raw.begin(), raw.end()};
+        ApplyDelta(reader, arr, [](auto reader, uint32_t start, auto arr) {
+          auto length = mpack_expect_bin(reader);
+          if (start > arr.size() || length > arr.size() - start) {
+            mpack_reader_flag_error(reader, mpack_error_data);
+            return;
+          }
+          mpack_read_bytes(reader, reinterpret_cast<char*>(arr.data() + start),
+                           length);
+          mpack_done_bin(reader);
+        });
+        *outValue = Value::MakeRaw(std::move(arr), 1);
+        return true;
+      }
+      break;
+    case 16:  // boolean array
+      if (base.IsBooleanArray()) {
+        auto v = base.GetBooleanArray();
+        std::vector<int> arr{v.begin(), v.end()};
+        ApplyDelta(reader, arr, [](auto reader, uint32_t start, auto arr) {
+          ReadDeltaElements(reader, start, arr, mpack_expect_bool);
+        });
+        *outValue = Value::MakeBooleanArray(std::move(arr), 1);
+        return true;
+      }
+      break;
+    case 18:  // integer array
+      if (base.IsIntegerArray()) {
+        auto v = base.GetIntegerArray();
+        std::vector<int64_t> arr{v.begin(), v.end()};
+        ApplyDelta(reader, arr, [](auto reader, uint32_t start, auto arr) {
+          ReadDeltaElements(reader, start, arr, mpack_expect_i64);
+        });
+        *outValue = Value::MakeIntegerArray(std::move(arr), 1);
+        return true;
+      }
+      break;
+    case 19:  // float array
+      if (base.IsFloatArray()) {
+        auto v = base.GetFloatArray();
+        std::vector<float> arr{v.begin(), v.end()};
+        ApplyDelta(reader, arr, [](auto reader, uint32_t start, auto arr) {
+          ReadDeltaElements(reader, start, arr, mpack_expect_float);
+        });
+        *outValue = Value::MakeFloatArray(std::move(arr), 1);
+        return true;
+      }
+      break;
+    case 17:  // double array
+      if (base.IsDoubleArray()) {
+        auto v = base.GetDoubleArray();
+        std::vector<double> arr{v.begin(), v.end()};
+        ApplyDelta(reader, arr, [](auto reader, uint32_t start, auto arr) {
+          ReadDeltaElements(reader, start, arr, mpack_expect_double);
+        });
+        *outValue = Value::MakeDoubleArray(std::move(arr), 1);
+        return true;
+      }
+      break;
+    default:
+      *error = fmt::format("unrecognized delta type {}", type);
+      return false;
+  }
+  *error = fmt::format("delta type {} does not match base value", type);
+  return false;
+}
+
 bool nt::net::WireDecodeBinary(std::span<const uint8_t>* in, int* outId,
                                Value* outValue, std::string* error,
-                               int64_t localTimeOffset) {
+                               int64_t localTimeOffset,
+                               wpi::DenseMap<int, Value>* deltaBases) {
   mpack_reader_t reader;
   mpack_reader_init_data(&reader, reinterpret_cast<const char*>(in->data()),
                          in->size());
@@ -484,7 +601,22 @@ bool nt::net::WireDecodeBinary(std::span<const uint8_t>* in, int* outId,
   *outId = mpack_expect_int(&reader);
   auto time = mpack_expect_i64(&reader);
   int type = mpack_expect_int(&reader);
+  if (deltaBases && (type & kDeltaTypeFlag) != 0 &&
+      mpack_reader_error(&reader) == mpack_ok) {
+    auto it = deltaBases->find(*outId);
+    if (it == deltaBases->end()) {
+      *error = fmt::format("delta for id {} without a base value", *outId);
+      return false;
+    }
+    if (!DecodeDelta(&reader, type & ~kDeltaTypeFlag, it->second, outValue,
+                     error)) {
+      return false;
+    }
+    type = -1;  // already decoded
+  }
   switch (type) {
+    case -1:
+      break;
     case 0:  // boolean
       *outValue = Value::MakeBoolean(mpack_expect_bool(&reader), 1);
       break;
@@ -613,6 +745,21 @@ bool nt::net::WireDecodeBinary(std::span<const uint8_t>* in, int* outId,
   // set time
   outValue->SetServerTime(time);
   outValue->SetTime(time == 0 ? 0 : time + localTimeOffset);
+  // keep values that later deltas may be based on
+  if (deltaBases) {
+    switch (outValue->type()) {
+      case NT_RAW:
+      case NT_BOOLEAN_ARRAY:
+      case NT_INTEGER_ARRAY:
+      case NT_FLOAT_ARRAY:
+      case NT_DOUBLE_ARRAY:
+        (*deltaBases)[*outId] = *outValue;
+        break;
+      default:
+        deltaBases->erase(*outId);
+        break;
+    }
+  }
   // update input range
   *in = wpi::take_back(*in, mpack_reader_remaining(&reader, nullptr));
   return true;
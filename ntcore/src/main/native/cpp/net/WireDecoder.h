@@ -10,6 +10,8 @@
 #include <string>
 #include <string_view>
 
+#include <wpi/DenseMap.h>
+
 namespace wpi {
 class Logger;
 }  // namespace wpi
@@ -29,8 +31,11 @@ bool WireDecodeText(std::string_view in, ClientMessageHandler& out,
 void WireDecodeText(std::string_view in, ServerMessageHandler& out,
                     wpi::Logger& logger);
 
-// returns true if successfully decoded a message
+// returns true if successfully decoded a message; if deltaBases is not null,
+// delta messages are accepted and applied to (and raw and array values are
+// stored as) the base value for the id
 bool WireDecodeBinary(std::span<const uint8_t>* in, int* outId, Value* outValue,
-                      std::string* error, int64_t localTimeOffset);
+                      std::string* error, int64_t localTimeOffset,
+                      wpi::DenseMap<int, Value>* deltaBases = nullptr);
 
 }  // namespace nt::net
@@ -4,9 +4,11 @@
 
 #include "WireEncoder.h"
 
+#include <cstring>
 #include <optional>
 #include <string>
 
+#include <wpi/SmallVector.h>
 #include <wpi/json.h>
 #include <wpi/mpack.h>
 #include <wpi/raw_ostream.h>
@@ -312,3 +314,146 @@ bool nt::net::WireEncodeBinary(wpi::raw_ostream& os, int id, int64_t time,
   mpack_finish_array(&writer);
   return mpack_writer_destroy(&writer) == mpack_ok;
 }
+
+namespace {
+struct DeltaRange {
+  size_t start;
+  size_t end;
+};
+}  // namespace
+
+// Finds the ranges of elements that differ between base and value, merging
+// ranges separated by at most mergeGap unchanged elements.  Returns false if
+// more than half of the elements have changed, as a full value is then about
+// as small as a delta.
+template <typename T>
+static bool FindDeltaRanges(std::span<const T> base, std::span<const T> value,
+                            size_t mergeGap,
+                            wpi::SmallVectorImpl<DeltaRange>& ranges) {
+  if (base.size() != value.size()) {
+    return false;
+  }
+  size_t changed = 0;
+  for (size_t i = 0; i < value.size(); ++i) {
+    // compare representations so NaN values compare equal to themselves
+    if (std::memcmp(&base[i], &value[i], sizeof(T)) == 0) {
+      continue;
+    }
+    if (!ranges.empty() && i - ranges.back().end <= mergeGap) {
+      changed += i + 1 - ranges.back().end;
+      ranges.back().end = i + 1;
+    } else {
+      ranges.push_back({i, i + 1});
+      ++changed;
+    }
+  }
+  return changed * 2 <= value.size();
+}
+
+bool nt::net::WireEncodeBinaryDelta(wpi::raw_ostream& os, int id, int64_t time,
+                                    const Value& base, const Value& value) {
+  if (base.type() != value.type()) {
+    return false;
+  }
+  // each range costs a few bytes, so merge ranges of small elements
+  wpi::SmallVector<DeltaRange, 16> ranges;
+  int type;
+  switch (value.type()) {
+    case NT_RAW:
+      if (!FindDeltaRanges(base.GetRaw(), value.GetRaw(), 4, ranges)) {
+        return false;
+      }
+      type = 5;
+      break;
+    case NT_BOOLEAN_ARRAY:
+      if (!FindDeltaRanges(base.GetBooleanArray(), value.GetBooleanArray(), 4,
+                           ranges)) {
+        return false;
+      }
+      type = 16;
+      break;
+    case NT_INTEGER_ARRAY:
+      if (!FindDeltaRanges(base.GetIntegerArray(), value.GetIntegerArray(), 0,
+                           ranges)) {
+        return false;
+      }
+      type = 18;
+      break;
+    case NT_FLOAT_ARRAY:
+      if (!FindDeltaRanges(base.GetFloatArray(), value.GetFloatArray(), 0,
+                           ranges)) {
+        return false;
+      }
+      type = 19;
+      break;
+    case NT_DOUBLE_ARRAY:
+      if (!FindDeltaRanges(base.GetDoubleArray(), value.GetDoubleArray(), 0,
+                           ranges)) {
+        return false;
+      }
+      type = 17;
+      break;
+    default:
+      return false;
+  }
+
+  char buf[128];
+  mpack_writer_t writer;
+  mpack_writer_init(&writer, buf, sizeof(buf));
+  mpack_writer_set_context(&writer, &os);
+  mpack_writer_set_flush(
+      &writer, [](mpack_writer_t* writer, const char* buffer, size_t count) {
+        static_cast<wpi::raw_ostream*>(writer->context)->write(buffer, count);
+      });
+  mpack_start_array(&writer, 4);
+  mpack_write_int(&writer, id);
+  mpack_write_int(&writer, time);
+  mpack_write_u8(&writer, type | kDeltaTypeFlag);
+  // alternating start index and changed elements
+  mpack_start_array(&writer, ranges.size() * 2);
+  for (auto&& range : ranges) {
+    mpack_write_uint(&writer, range.start);
+    size_t len = range.end - range.start;
+    switch (value.type()) {
+      case NT_RAW:
+        mpack_write_bin(
+            &writer,
+            reinterpret_cast<const char*>(value.GetRaw().data() + range.start),
+            len);
+        break;
+      case NT_BOOLEAN_ARRAY:
+        mpack_start_array(&writer, len);
+        for (auto val : value.GetBooleanArray().subspan(range.start, len)) {
+          mpack_write_bool(&writer, val);
+        }
+        mpack_finish_array(&writer);
+        break;
+      case NT_INTEGER_ARRAY:
+        mpack_start_array(&writer, len);
+        for (auto val : value.GetIntegerArray().subspan(range.start, len)) {
+          mpack_write_int(&writer, val);
+        }
+        mpack_finish_array(&writer);
+        break;
+      case NT_FLOAT_ARRAY:
+        mpack_start_array(&writer, len);
+        for (auto val : value.GetFloatArray().subspan(range.start, len)) {
+          mpack_write_float(&writer, val);
+        }
+        mpack_finish_array(&writer);
+        break;
+      case NT_DOUBLE_ARRAY:
+        mpack_start_array(&writer, len);
+        for (auto val : value.GetDoubleArray().subspan(range.start, len)) {
+          mpack_write_double(&writer, val);
+        }
+        mpack_finish_array(&writer);
+        break;
+      default:
+        break;
+    }
+  }
+  mpack_finish_array(&writer);
+  mpack_finish_array(&writer);
+  return mpack_writer_destroy(&writer) == mpack_ok;
+}
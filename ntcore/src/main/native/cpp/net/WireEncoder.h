@@ -58,4 +58,17 @@ bool WireEncodeText(wpi::raw_ostream& os, const ServerMessage& msg);
 bool WireEncodeBinary(wpi::raw_ostream& os, int id, int64_t time,
                       const Value& value);
 
+// WebSocket subprotocol for version 4.1 with delta binary messages
+inline constexpr std::string_view kDeltaProtocol =
+    "delta.v4.1.networktables.first.wpi.edu";
+
+// added to the data type of delta binary messages
+inline constexpr int kDeltaTypeFlag = 0x40;
+
+// encoder for delta binary messages; the delta is against base, which must be
+// the last value sent for the id.  Returns false (and writes nothing) if a
+// delta cannot be used for the value or would not be smaller than the value.
+bool WireEncodeBinaryDelta(wpi::raw_ostream& os, int id, int64_t time,
+                           const Value& base, const Value& value);
+
 }  // namespace nt::net
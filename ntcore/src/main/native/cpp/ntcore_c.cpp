@@ -582,6 +582,10 @@ void NT_StopDSClient(NT_Inst inst) {
   nt::StopDSClient(inst);
 }
 
+void NT_SetSharedMemoryTransport(NT_Inst inst, NT_Bool enabled) {
+  nt::SetSharedMemoryTransport(inst, enabled);
+}
+
 void NT_FlushLocal(NT_Inst inst) {
   nt::FlushLocal(inst);
 }
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include <fmt/format.h>
+#include <wpi/Profile.h>
 #include <wpi/json.h>
 #include <wpi/timestamp.h>
 
@@ -732,7 +733,14 @@ void StopDSClient(NT_Inst inst) {
   }
 }
 
+void SetSharedMemoryTransport(NT_Inst inst, bool enabled) {
+  if (auto ii = InstanceImpl::GetTyped(inst, Handle::kInstance)) {
+    ii->sharedMemory = enabled;
+  }
+}
+
 void FlushLocal(NT_Inst inst) {
+  WPI_PROFILE_SCOPE("nt::FlushLocal()");
   if (auto ii = InstanceImpl::GetTyped(inst, Handle::kInstance)) {
     if (auto client = ii->GetClient()) {
       client->FlushLocal();
@@ -743,6 +751,7 @@ void FlushLocal(NT_Inst inst) {
 }
 
 void Flush(NT_Inst inst) {
+  WPI_PROFILE_SCOPE("nt::Flush()");
   if (auto ii = InstanceImpl::GetTyped(inst, Handle::kInstance)) {
     if (auto client = ii->GetClient()) {
       client->Flush();
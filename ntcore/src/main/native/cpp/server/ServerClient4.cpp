@@ -6,6 +6,7 @@
 
 #include <string>
 
+#include <wpi/Profile.h>
 #include <wpi/timestamp.h>
 
 #include "Log.h"
@@ -19,13 +20,14 @@ ServerClient4::ServerClient4(std::string_view name, std::string_view connInfo,
                              bool local, net::WireConnection& wire,
                              SetPeriodicFunc setPeriodic,
                              ServerStorage& storage, int id,
-                             wpi::Logger& logger)
+                             wpi::Logger& logger, bool deltaFrames)
     : ServerClient4Base{name,    connInfo, local, setPeriodic,
                         storage, id,       logger},
       m_wire{wire},
       m_ping{wire},
       m_incoming{logger},
-      m_outgoing{wire, local} {
+      m_outgoing{wire, local},
+      m_deltaFrames{deltaFrames} {
   // create client meta topics
   m_metaPub = storage.CreateMetaTopic(fmt::format("$clientpub${}", name));
   m_metaSub = storage.CreateMetaTopic(fmt::format("$clientsub${}", name));
@@ -61,7 +63,8 @@ bool ServerClient4::ProcessIncomingBinary(std::span<const uint8_t> data) {
     int pubuid;
     Value value;
     std::string error;
-    if (!net::WireDecodeBinary(&data, &pubuid, &value, &error, 0)) {
+    if (!net::WireDecodeBinary(&data, &pubuid, &value, &error, 0,
+                               m_deltaFrames ? &m_deltaBases : nullptr)) {
       m_wire.Disconnect(fmt::format("binary decode error: {}", error));
       break;
     }
@@ -91,7 +94,7 @@ bool ServerClient4::ProcessIncomingBinary(std::span<const uint8_t> data) {
 
 void ServerClient4::SendValue(ServerTopic* topic, const Value& value,
                               net::ValueSendMode mode) {
-  m_outgoing.SendValue(topic->id, value, mode);
+  m_outgoing.SendValue(topic->id, value, mode, m_deltaFrames && topic->delta);
 }
 
 void ServerClient4::SendAnnounce(ServerTopic* topic,
@@ -164,6 +167,7 @@ void ServerClient4::SendPropertiesUpdate(ServerTopic* topic,
 }
 
 void ServerClient4::SendOutgoing(uint64_t curTimeMs, bool flush) {
+  WPI_PROFILE_SCOPE("nt::ServerClient4::SendOutgoing()");
   if (m_wire.GetVersion() >= 0x0401) {
     if (!m_ping.Send(curTimeMs)) {
       return;
@@ -6,6 +6,8 @@
 
 #include <string_view>
 
+#include <wpi/DenseMap.h>
+
 #include "net/NetworkPing.h"
 #include "net/WireConnection.h"
 #include "server/Functions.h"
@@ -17,7 +19,8 @@ class ServerClient4 final : public ServerClient4Base {
  public:
   ServerClient4(std::string_view name, std::string_view connInfo, bool local,
                 net::WireConnection& wire, SetPeriodicFunc setPeriodic,
-                ServerStorage& storage, int id, wpi::Logger& logger);
+                ServerStorage& storage, int id, wpi::Logger& logger,
+                bool deltaFrames = false);
 
   bool ProcessIncomingText(std::string_view data) final;
   bool ProcessIncomingBinary(std::span<const uint8_t> data) final;
@@ -49,6 +52,13 @@ class ServerClient4 final : public ServerClient4Base {
   net::NetworkPing m_ping;
   net::NetworkIncomingClientQueue m_incoming;
   net::NetworkOutgoingQueue<net::ServerMessage> m_outgoing;
+
+  // true if the client negotiated delta binary messages
+  bool m_deltaFrames;
+  // last raw/array value received for each pubuid, for delta messages; not
+  // erased on unpublish, as binary messages are decoded before queued text
+  // messages are processed
+  wpi::DenseMap<int, Value> m_deltaBases;
 };
 
 }  // namespace nt::server
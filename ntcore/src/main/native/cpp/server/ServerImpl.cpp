@@ -42,7 +42,8 @@ std::pair<std::string, int> ServerImpl::AddClient(std::string_view name,
                                                   std::string_view connInfo,
                                                   bool local,
                                                   net::WireConnection& wire,
-                                                  SetPeriodicFunc setPeriodic) {
+                                                  SetPeriodicFunc setPeriodic,
+                                                  bool deltaFrames) {
   if (name.empty()) {
     name = "NT4";
   }
@@ -54,7 +55,8 @@ std::pair<std::string, int> ServerImpl::AddClient(std::string_view name,
   auto& clientData = m_clients[index];
   clientData = std::make_unique<ServerClient4>(dedupName, connInfo, local, wire,
                                                std::move(setPeriodic),
-                                               m_storage, index, m_logger);
+                                               m_storage, index, m_logger,
+                                               deltaFrames);
 
   DEBUG3("AddClient('{}', '{}') -> {}", name, connInfo, index);
   return {std::move(dedupName), index};
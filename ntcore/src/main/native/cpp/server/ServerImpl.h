@@ -60,7 +60,8 @@ class ServerImpl final {
   std::pair<std::string, int> AddClient(std::string_view name,
                                         std::string_view connInfo, bool local,
                                         net::WireConnection& wire,
-                                        SetPeriodicFunc setPeriodic);
+                                        SetPeriodicFunc setPeriodic,
+                                        bool deltaFrames = false);
   int AddClient3(std::string_view connInfo, bool local,
                  net3::WireConnection3& wire, Connected3Func connected,
                  SetPeriodicFunc setPeriodic);
@@ -27,7 +27,10 @@ ServerTopic* ServerStorage::CreateTopic(ServerClient* client,
                                         std::string_view typeStr,
                                         const wpi::json& properties,
                                         bool special) {
-  auto& topic = m_nameTopics[name];
+  // creating meta topics below inserts into m_nameTopics, which invalidates
+  // references into it, so only hold the reference until the topic is stored
+  auto& nameTopic = m_nameTopics[name];
+  ServerTopic* topic = nameTopic;
   if (topic) {
     if (typeStr != topic->typeStr) {
       if (client) {
@@ -40,6 +43,7 @@ ServerTopic* ServerStorage::CreateTopic(ServerClient* client,
     unsigned int id = m_topics.emplace_back(
         std::make_unique<ServerTopic>(m_logger, name, typeStr, properties));
     topic = m_topics[id].get();
+    nameTopic = topic;
     topic->id = id;
     topic->special = special;
 
@@ -9,7 +9,7 @@
 #include <string_view>
 #include <utility>
 
-#include <wpi/StringMap.h>
+#include <wpi/StringHashMap.h>
 #include <wpi/UidVector.h>
 #include <wpi/json_fwd.h>
 
@@ -88,7 +88,7 @@ class ServerStorage final {
   std::function<void(ServerTopic* topic, ServerClient* client)> m_sendAnnounce;
 
   wpi::UidVector<std::unique_ptr<ServerTopic>, 16> m_topics;
-  wpi::StringMap<ServerTopic*> m_nameTopics;
+  wpi::StringHashMap<ServerTopic*> m_nameTopics;
   bool m_persistentChanged{false};
 };
 
@@ -31,6 +31,7 @@ void ServerTopic::RefreshProperties() {
   persistent = false;
   retained = false;
   cached = true;
+  delta = false;
 
   auto persistentIt = properties.find("persistent");
   if (persistentIt != properties.end()) {
@@ -53,6 +54,13 @@ void ServerTopic::RefreshProperties() {
     }
   }
 
+  auto deltaIt = properties.find("delta");
+  if (deltaIt != properties.end()) {
+    if (auto val = deltaIt->get_ptr<bool*>()) {
+      delta = *val;
+    }
+  }
+
   if (!cached) {
     lastValue = {};
     lastValueClient = nullptr;
@@ -79,6 +79,7 @@ struct ServerTopic {
   bool persistent{false};
   bool retained{false};
   bool cached{true};
+  bool delta{false};
   bool special{false};
   int localTopic{0};
 
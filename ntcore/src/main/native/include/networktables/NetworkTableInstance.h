@@ -715,6 +715,24 @@ class NetworkTableInstance final {
    */
   void StopDSClient() { ::nt::StopDSClient(m_handle); }
 
+  /**
+   * Enables or disables the shared memory transport for clients and servers
+   * on the same host.  When enabled, a NetworkTables 4 client connecting to a
+   * server on a loopback address exchanges messages through shared memory
+   * rather than the WebSocket, if both sides support it.  Takes effect the
+   * next time the client or server is started.
+   *
+   * The transport is not negotiated automatically: it is disabled by default
+   * and is only used if both the client and the server enable it, because
+   * each shared memory connection uses an extra reader thread in each
+   * process.
+   *
+   * @param enabled true to enable
+   */
+  void SetSharedMemoryTransport(bool enabled) {
+    ::nt::SetSharedMemoryTransport(m_handle, enabled);
+  }
+
   /**
    * Flushes all updated values immediately to the local client/server. This
    * does not flush to the network.
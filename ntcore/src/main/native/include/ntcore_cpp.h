@@ -1151,6 +1151,22 @@ void StartDSClient(NT_Inst inst, unsigned int port);
  */
 void StopDSClient(NT_Inst inst);
 
+/**
+ * Enables or disables the shared memory transport for clients and servers on
+ * the same host.  When enabled, a NetworkTables 4 client connecting to a server
+ * on a loopback address exchanges messages through shared memory rather than
+ * the WebSocket, if both sides support it.  Takes effect the next time the
+ * client or server is started.
+ *
+ * The transport is not negotiated automatically: it is disabled by default and
+ * is only used if both the client and the server enable it, because each
+ * shared memory connection uses an extra reader thread in each process.
+ *
+ * @param inst     instance handle
+ * @param enabled  true to enable
+ */
+void SetSharedMemoryTransport(NT_Inst inst, bool enabled);
+
 /**
  * Flush local updates.
  *
@@ -0,0 +1,170 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <wpi/DataLogReader.h>
+#include <wpi/DataLogWriter.h>
+#include <wpi/DenseMap.h>
+#include <wpi/Logger.h>
+#include <wpi/MemoryBuffer.h>
+#include <wpi/StringMap.h>
+#include <wpi/raw_ostream.h>
+
+#include "networktables/BooleanArrayTopic.h"
+#include "networktables/DoubleArrayTopic.h"
+#include "networktables/DoubleTopic.h"
+#include "networktables/IntegerTopic.h"
+#include "networktables/NetworkTableInstance.h"
+#include "networktables/RawTopic.h"
+#include "networktables/StringArrayTopic.h"
+#include "networktables/StringTopic.h"
+
+class DataLoggerTest : public ::testing::Test {
+ public:
+  DataLoggerTest() : m_inst(nt::NetworkTableInstance::Create()) {}
+
+  ~DataLoggerTest() override { nt::NetworkTableInstance::Destroy(m_inst); }
+
+  // Stops the logger and returns the data records for each entry name
+  wpi::StringMap<std::vector<wpi::log::DataLogRecord>> Read() {
+    nt::NetworkTableInstance::StopEntryDataLog(m_logger);
+    m_log.Flush();
+    m_reader = std::make_unique<wpi::log::DataLogReader>(
+        wpi::MemoryBuffer::GetMemBuffer(m_data));
+    EXPECT_TRUE(m_reader->IsValid());
+
+    wpi::DenseMap<int, std::string> names;
+    wpi::StringMap<std::vector<wpi::log::DataLogRecord>> records;
+    for (auto&& record : *m_reader) {
+      wpi::log::StartRecordData start;
+      if (record.GetStartData(&start)) {
+        names[start.entry] = start.name;
+      } else if (!record.IsControl()) {
+        records[names[record.GetEntry()]].emplace_back(record);
+      }
+    }
+    return records;
+  }
+
+ protected:
+  nt::NetworkTableInstance m_inst;
+  wpi::Logger m_msglog;
+  std::vector<uint8_t> m_data;
+  wpi::log::DataLogWriter m_log{
+      m_msglog, std::make_unique<wpi::raw_uvector_ostream>(m_data)};
+  NT_DataLogger m_logger = m_inst.StartEntryDataLog(m_log, "", "NT:");
+  std::unique_ptr<wpi::log::DataLogReader> m_reader;
+};
+
+TEST_F(DataLoggerTest, Types) {
+  auto boolArr = m_inst.GetBooleanArrayTopic("/boolArr").Publish();
+  auto dbl = m_inst.GetDoubleTopic("/dbl").Publish();
+  auto dblArr = m_inst.GetDoubleArrayTopic("/dblArr").Publish();
+  auto integer = m_inst.GetIntegerTopic("/int").Publish();
+  auto raw = m_inst.GetRawTopic("/raw").Publish("struct:Thing");
+  auto str = m_inst.GetStringTopic("/str").Publish();
+  auto strArr = m_inst.GetStringArrayTopic("/strArr").Publish();
+
+  boolArr.Set({{1, 0, 1}}, 10);
+  dbl.Set(1.5, 11);
+  dblArr.Set({{2.5, -3.0}}, 12);
+  integer.Set(-7, 13);
+  raw.Set({{1, 2, 3}}, 14);
+  str.Set("hello", 15);
+  strArr.Set({{"a", "", "bc"}}, 16);
+
+  auto records = Read();
+
+  ASSERT_EQ(records["NT:/boolArr"].size(), 1u);
+  std::vector<int> bools;
+  ASSERT_TRUE(records["NT:/boolArr"][0].GetBooleanArray(&bools));
+  EXPECT_EQ(bools, (std::vector<int>{1, 0, 1}));
+  EXPECT_EQ(records["NT:/boolArr"][0].GetTimestamp(), 10);
+
+  ASSERT_EQ(records["NT:/dbl"].size(), 1u);
+  double d;
+  ASSERT_TRUE(records["NT:/dbl"][0].GetDouble(&d));
+  EXPECT_EQ(d, 1.5);
+
+  ASSERT_EQ(records["NT:/dblArr"].size(), 1u);
+  std::vector<double> doubles;
+  ASSERT_TRUE(records["NT:/dblArr"][0].GetDoubleArray(&doubles));
+  EXPECT_EQ(doubles, (std::vector<double>{2.5, -3.0}));
+
+  ASSERT_EQ(records["NT:/int"].size(), 1u);
+  int64_t i;
+  ASSERT_TRUE(records["NT:/int"][0].GetInteger(&i));
+  EXPECT_EQ(i, -7);
+
+  ASSERT_EQ(records["NT:/raw"].size(), 1u);
+  auto rawData = records["NT:/raw"][0].GetRaw();
+  EXPECT_EQ(std::vector<uint8_t>(rawData.begin(), rawData.end()),
+            (std::vector<uint8_t>{1, 2, 3}));
+
+  ASSERT_EQ(records["NT:/str"].size(), 1u);
+  std::string_view s;
+  ASSERT_TRUE(records["NT:/str"][0].GetString(&s));
+  EXPECT_EQ(s, "hello");
+
+  ASSERT_EQ(records["NT:/strArr"].size(), 1u);
+  std::vector<std::string_view> strs;
+  ASSERT_TRUE(records["NT:/strArr"][0].GetStringArray(&strs));
+  EXPECT_EQ(strs, (std::vector<std::string_view>{"a", "", "bc"}));
+  EXPECT_EQ(records["NT:/strArr"][0].GetTimestamp(), 16);
+}
+
+TEST_F(DataLoggerTest, ManyValues) {
+  // more values than fit in the queue at once
+  constexpr int kCount = 10000;
+  auto pub = m_inst.GetIntegerTopic("/int").Publish();
+  for (int i = 1; i <= kCount; ++i) {
+    pub.Set(i, i);
+  }
+
+  auto records = Read();
+  ASSERT_EQ(records["NT:/int"].size(), static_cast<size_t>(kCount));
+  for (int i = 1; i <= kCount; ++i) {
+    auto& record = records["NT:/int"][i - 1];
+    int64_t value;
+    ASSERT_TRUE(record.GetInteger(&value));
+    EXPECT_EQ(value, i);
+    EXPECT_EQ(record.GetTimestamp(), i);
+  }
+}
+
+TEST_F(DataLoggerTest, FinishAfterValues) {
+  auto pub = m_inst.GetDoubleTopic("/dbl").Publish();
+  pub.Set(1.0, 5);
+  pub.Set(2.0, 6);
+  pub = nt::DoublePublisher{};
+
+  // values are written before the entry is finished
+  nt::NetworkTableInstance::StopEntryDataLog(m_logger);
+  m_log.Flush();
+  wpi::log::DataLogReader reader{wpi::MemoryBuffer::GetMemBuffer(m_data)};
+  int entry = 0;
+  int values = 0;
+  bool finished = false;
+  for (auto&& record : reader) {
+    wpi::log::StartRecordData start;
+    if (record.GetStartData(&start) && start.name == "NT:/dbl") {
+      entry = start.entry;
+    } else if (record.GetEntry() == entry && entry != 0) {
+      EXPECT_FALSE(finished);
+      ++values;
+    } else if (int finishEntry; record.GetFinishEntry(&finishEntry) &&
+                                finishEntry == entry) {
+      finished = true;
+    }
+  }
+  EXPECT_EQ(values, 2);
+  EXPECT_TRUE(finished);
+}
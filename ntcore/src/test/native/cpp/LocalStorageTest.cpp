@@ -3,6 +3,7 @@
 // the WPILib BSD license file in the root directory of this project.
 
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -1079,4 +1080,41 @@ TEST_F(LocalStorageTest, ReadQueueInitialRemote) {
   EXPECT_THAT(storage.ReadQueue<double>(subLocal), IsEmpty());
 }
 
+TEST_F(LocalStorageTest, SetValuesFromMultipleThreads) {
+  static constexpr int kThreads = 4;
+  static constexpr int kValues = 1000;
+  EXPECT_CALL(network, ClientPublish(_, _, _, _, _)).Times(kThreads);
+  EXPECT_CALL(network, ClientSubscribe(_, _, _)).Times(kThreads);
+  EXPECT_CALL(network, ClientSetValue(_, _)).Times(kThreads * kValues);
+
+  std::vector<NT_Publisher> pubs;
+  std::vector<NT_Subscriber> subs;
+  for (int i = 0; i < kThreads; ++i) {
+    auto topic = storage.GetTopic("thread" + std::to_string(i));
+    pubs.emplace_back(storage.Publish(topic, NT_INTEGER, "int", {}, {}));
+    subs.emplace_back(storage.Subscribe(topic, NT_INTEGER, "int",
+                                        {.pollStorage = kValues}));
+  }
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&, i] {
+      for (int j = 1; j <= kValues; ++j) {
+        storage.SetEntryValue(pubs[i], Value::MakeInteger(j, j));
+        storage.GetAtomic<int64_t>(subs[(i + 1) % kThreads], 0);
+      }
+    });
+  }
+  for (auto&& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 0; i < kThreads; ++i) {
+    auto vals = storage.ReadQueue<int64_t>(subs[i]);
+    ASSERT_EQ(vals.size(), static_cast<size_t>(kValues));
+    EXPECT_EQ(vals.back().value, kValues);
+    EXPECT_EQ(storage.GetAtomic<int64_t>(subs[i], 0).value, kValues);
+  }
+}
+
 }  // namespace nt
@@ -0,0 +1,94 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <wpi/mutex.h>
+
+#include "net/SharedMemoryRing.h"
+#include "networktables/DoubleTopic.h"
+#include "networktables/NetworkTableInstance.h"
+
+class SharedMemoryTransportTest : public ::testing::Test {
+ public:
+  SharedMemoryTransportTest()
+      : m_server(nt::NetworkTableInstance::Create()),
+        m_client(nt::NetworkTableInstance::Create()) {
+    m_server.AddLogger(NT_LOG_INFO, NT_LOG_CRITICAL, [this](auto& event) {
+      if (auto msg = event.GetLogMessage()) {
+        std::scoped_lock lock{m_mutex};
+        m_messages.emplace_back(msg->message);
+      }
+    });
+  }
+
+  ~SharedMemoryTransportTest() override {
+    nt::NetworkTableInstance::Destroy(m_client);
+    nt::NetworkTableInstance::Destroy(m_server);
+  }
+
+  // Connects the client to the server, checks a value gets through, and
+  // returns true if the connection used shared memory.
+  bool Connect();
+
+ protected:
+  nt::NetworkTableInstance m_server;
+  nt::NetworkTableInstance m_client;
+  wpi::mutex m_mutex;
+  std::vector<std::string> m_messages;
+};
+
+bool SharedMemoryTransportTest::Connect() {
+  auto sub = m_server.GetDoubleTopic("/value").Subscribe(0);
+  auto pub = m_client.GetDoubleTopic("/value").Publish();
+  m_server.StartServer("sharedmemorytest.json", "127.0.0.1", 0, 10040);
+  m_client.StartClient4("client");
+  m_client.SetServer("127.0.0.1", 10040);
+
+  pub.Set(1.5);
+  for (int count = 0; sub.Get() != 1.5; ++count) {
+    if (count > 30) {
+      ADD_FAILURE() << "timed out waiting for value";
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    m_client.Flush();
+  }
+
+  std::scoped_lock lock{m_mutex};
+  for (auto&& msg : m_messages) {
+    if (msg.starts_with("CONNECTED NT4 client")) {
+      return msg.ends_with("(shared memory)");
+    }
+  }
+  ADD_FAILURE() << "no connection message";
+  return false;
+}
+
+TEST_F(SharedMemoryTransportTest, DisabledByDefault) {
+  EXPECT_FALSE(Connect());
+}
+
+TEST_F(SharedMemoryTransportTest, ClientOnly) {
+  m_client.SetSharedMemoryTransport(true);
+  EXPECT_FALSE(Connect());
+}
+
+TEST_F(SharedMemoryTransportTest, ServerOnly) {
+  m_server.SetSharedMemoryTransport(true);
+  EXPECT_FALSE(Connect());
+}
+
+TEST_F(SharedMemoryTransportTest, Enabled) {
+  if (!nt::net::SharedMemorySegment::IsSupported()) {
+    GTEST_SKIP();
+  }
+  m_server.SetSharedMemoryTransport(true);
+  m_client.SetSharedMemoryTransport(true);
+  EXPECT_TRUE(Connect());
+}
@@ -0,0 +1,201 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "net/SharedMemoryConnection.h"  // NOLINT(build/include_order)
+
+#include <stdint.h>
+
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <wpi/Logger.h>
+#include <wpi/raw_ostream.h>
+#include <wpinet/WebSocket.h>
+#include <wpinet/WebSocketServer.h>
+#include <wpinet/uv/Loop.h>
+#include <wpinet/uv/Pipe.h>
+#include <wpinet/uv/Timer.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace uv = wpi::uv;
+
+namespace nt {
+
+class SharedMemoryConnectionTest : public ::testing::Test {
+ protected:
+#ifdef _WIN32
+  static constexpr const char* kPipeName = "\\\\.\\pipe\\ntcore-shm-unit-test";
+#else
+  static constexpr const char* kPipeName = "/tmp/ntcore-shm-unit-test";
+#endif
+  static constexpr uint32_t kCapacity = 4096;
+
+  void SetUp() override {
+    if (!net::SharedMemorySegment::IsSupported()) {
+      GTEST_SKIP();
+    }
+#ifndef _WIN32
+    unlink(kPipeName);
+#endif
+    serverSegment = net::SharedMemorySegment::Create(kCapacity);
+    ASSERT_TRUE(serverSegment);
+    clientSegment = net::SharedMemorySegment::Open(serverSegment->GetName());
+    ASSERT_TRUE(clientSegment);
+
+    loop = uv::Loop::Create();
+    auto failTimer = uv::Timer::Create(loop);
+    failTimer->timeout.connect([this] {
+      Finish();
+      FAIL() << "loop failed to terminate";
+    });
+    failTimer->Start(uv::Timer::Time{5000});
+    failTimer->Unreference();
+  }
+
+  // Runs the loop; connected is called once both ends are set up
+  void Run(std::function<void()> connected) {
+    auto serverPipe = uv::Pipe::Create(loop);
+    auto clientPipe = uv::Pipe::Create(loop);
+    serverPipe->Bind(kPipeName);
+    auto check = [this, connected] {
+      if (server && client) {
+        connected();
+      }
+    };
+    serverPipe->Listen([this, serverPipe, check] {
+      auto conn = serverPipe->Accept();
+      auto wsServer = wpi::WebSocketServer::Create(*conn, {"test"});
+      wsServer->connected.connect([this, check](std::string_view,
+                                                wpi::WebSocket& ws) {
+        ws.closed.connect([this](uint16_t, std::string_view) { Finish(); });
+        server = std::make_shared<net::SharedMemoryConnection>(
+            ws, std::move(serverSegment), true, 0x0401, logger);
+        check();
+      });
+    });
+    clientPipe->Connect(kPipeName, [this, clientPipe, check] {
+      auto ws =
+          wpi::WebSocket::CreateClient(*clientPipe, "/", kPipeName, {"test"});
+      ws->closed.connect([this](uint16_t, std::string_view) { Finish(); });
+      ws->open.connect([this, check, ws = ws.get()](std::string_view) {
+        client = std::make_shared<net::SharedMemoryConnection>(
+            *ws, std::move(clientSegment), false, 0x0401, logger);
+        check();
+      });
+    });
+    loop->Run();
+    if (server) {
+      serverReason = server->GetDisconnectReason();
+    }
+    if (client) {
+      clientReason = client->GetDisconnectReason();
+    }
+    server.reset();
+    client.reset();
+  }
+
+  // Stops the loop; the connections are destroyed once Run() returns
+  void Finish() {
+    loop->Walk([](uv::Handle& h) { h.Close(); });
+  }
+
+  static void SendByte(net::SharedMemoryConnection& conn, uint8_t first,
+                       size_t size) {
+    conn.SendBinary([&](wpi::raw_ostream& os) {
+      std::vector<uint8_t> data(size);
+      data[0] = first;
+      os << std::span<const uint8_t>{data};
+    });
+  }
+
+  wpi::Logger logger;
+  std::shared_ptr<uv::Loop> loop;
+  std::unique_ptr<net::SharedMemorySegment> serverSegment;
+  std::unique_ptr<net::SharedMemorySegment> clientSegment;
+  std::shared_ptr<net::SharedMemoryConnection> server;
+  std::shared_ptr<net::SharedMemoryConnection> client;
+  std::string serverReason;
+  std::string clientReason;
+};
+
+TEST_F(SharedMemoryConnectionTest, Text) {
+  std::vector<std::string> received;
+  Run([&] {
+    client->text.connect([&](std::string_view data) {
+      received.emplace_back(data);
+      if (received.size() == 2) {
+        Finish();
+      }
+    });
+    server->WriteText([](wpi::raw_ostream& os) { os << "{\"a\":1}"; });
+    server->WriteText([](wpi::raw_ostream& os) { os << "{\"b\":2}"; });
+    EXPECT_EQ(server->Flush(), 0);
+    server->SendText([](wpi::raw_ostream& os) { os << "{\"c\":3}"; });
+  });
+  ASSERT_EQ(received.size(), 2u);
+  EXPECT_EQ(received[0], "[{\"a\":1},{\"b\":2}]");
+  EXPECT_EQ(received[1], "[{\"c\":3}]");
+}
+
+TEST_F(SharedMemoryConnectionTest, FullRingKeepsOrder) {
+  constexpr int kCount = 20;
+  std::vector<uint8_t> received;
+  Run([&] {
+    client->StopRead();
+    client->binary.connect([&](std::span<const uint8_t> data) {
+      received.push_back(data[0]);
+      if (received.size() == kCount + 1) {
+        Finish();
+      }
+    });
+    // only a few of these fit in the ring; the rest must be queued
+    for (int i = 0; i < kCount; ++i) {
+      SendByte(*server, i, 1000);
+    }
+    EXPECT_FALSE(server->Ready());
+    // frames written while messages are queued are not sent ahead of them
+    server->WriteBinary(
+        [](wpi::raw_ostream& os) { os << std::span<const uint8_t>{}; });
+    EXPECT_EQ(server->Flush(), 1);
+    SendByte(*server, kCount, 8);
+    client->StartRead();
+  });
+  ASSERT_EQ(received.size(), kCount + 1u);
+  for (int i = 0; i <= kCount; ++i) {
+    EXPECT_EQ(received[i], i);
+  }
+}
+
+TEST_F(SharedMemoryConnectionTest, Overflow) {
+  Run([&] {
+    client->StopRead();
+    // more than the queue allows
+    for (uint32_t sent = 0;
+         sent <= net::SharedMemoryConnection::kRingCapacity + kCapacity;
+         sent += 2000) {
+      SendByte(*server, 0, 2000);
+    }
+  });
+  EXPECT_EQ(serverReason, "shared memory ring overflow");
+}
+
+TEST_F(SharedMemoryConnectionTest, CorruptRing) {
+  net::SharedMemoryRing* toClient = &serverSegment->GetServerToClient();
+  Run([&] {
+    // a padding record that doesn't reach the end of the ring
+    uint8_t junk[4] = {0, 0, 0, 0};
+    ASSERT_TRUE(toClient->TryWrite(net::SharedMemoryRing::kPad, junk));
+    toClient->Notify();
+  });
+  EXPECT_EQ(clientReason, "corrupt shared memory ring");
+}
+
+}  // namespace nt
@@ -0,0 +1,185 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "net/SharedMemoryRing.h"
+
+namespace nt {
+
+class SharedMemoryRingTest : public ::testing::Test {
+ protected:
+  static constexpr uint32_t kCapacity = 256;
+
+  std::span<const uint8_t> Bytes(std::string_view str) {
+    return {reinterpret_cast<const uint8_t*>(str.data()), str.size()};
+  }
+
+  std::string_view Str(std::span<const uint8_t> data) {
+    return {reinterpret_cast<const char*>(data.data()), data.size()};
+  }
+
+  net::SharedMemoryRingControl control;
+  std::vector<uint8_t> data = std::vector<uint8_t>(kCapacity);
+  net::SharedMemoryRing ring{control, data.data(), kCapacity};
+};
+
+TEST_F(SharedMemoryRingTest, Empty) {
+  EXPECT_TRUE(ring.IsEmpty());
+  EXPECT_FALSE(ring.Peek());
+  EXPECT_EQ(ring.GetFreeSpace(), kCapacity);
+}
+
+TEST_F(SharedMemoryRingTest, WriteRead) {
+  ASSERT_TRUE(ring.TryWrite(1, Bytes("hello")));
+  ASSERT_TRUE(ring.TryWrite(2, Bytes("")));
+  EXPECT_FALSE(ring.IsEmpty());
+
+  auto rec = ring.Peek();
+  ASSERT_TRUE(rec);
+  EXPECT_EQ(rec->kind, 1u);
+  EXPECT_EQ(Str(rec->data), "hello");
+  ring.Pop();
+
+  rec = ring.Peek();
+  ASSERT_TRUE(rec);
+  EXPECT_EQ(rec->kind, 2u);
+  EXPECT_TRUE(rec->data.empty());
+  ring.Pop();
+
+  EXPECT_TRUE(ring.IsEmpty());
+  EXPECT_EQ(ring.GetFreeSpace(), kCapacity);
+}
+
+TEST_F(SharedMemoryRingTest, TooLarge) {
+  std::vector<uint8_t> big(ring.GetMaxRecordSize() + 1);
+  EXPECT_FALSE(ring.TryWrite(1, big));
+  big.pop_back();
+  EXPECT_TRUE(ring.TryWrite(1, big));
+}
+
+TEST_F(SharedMemoryRingTest, Full) {
+  std::vector<uint8_t> rec(56);  // 64 bytes with header
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(ring.TryWrite(1, rec));
+  }
+  EXPECT_EQ(ring.GetFreeSpace(), 0u);
+  EXPECT_FALSE(ring.TryWrite(1, Bytes("x")));
+  ASSERT_TRUE(ring.Peek());
+  ring.Pop();
+  EXPECT_TRUE(ring.TryWrite(1, rec));
+}
+
+TEST_F(SharedMemoryRingTest, WrapPads) {
+  std::vector<uint8_t> rec(88);  // 96 bytes with header
+  ASSERT_TRUE(ring.TryWrite(1, rec));
+  ASSERT_TRUE(ring.TryWrite(2, rec));
+  ASSERT_TRUE(ring.Peek());
+  ring.Pop();
+  // 64 bytes left at the end, 96 free at the start; the record can't be split
+  ASSERT_TRUE(ring.TryWrite(3, rec));
+  EXPECT_FALSE(ring.TryWrite(4, Bytes("x")));
+
+  auto r = ring.Peek();
+  ASSERT_TRUE(r);
+  EXPECT_EQ(r->kind, 2u);
+  ring.Pop();
+  r = ring.Peek();
+  ASSERT_TRUE(r);
+  EXPECT_EQ(r->kind, 3u);
+  EXPECT_EQ(r->data.data(), data.data() + 8);
+  EXPECT_EQ(r->data.size(), rec.size());
+  ring.Pop();
+  EXPECT_TRUE(ring.IsEmpty());
+}
+
+TEST_F(SharedMemoryRingTest, CorruptSize) {
+  ASSERT_TRUE(ring.TryWrite(1, Bytes("hello")));
+  // record claims to extend past what was written
+  uint32_t size = 64;
+  std::memcpy(data.data(), &size, sizeof(size));
+  EXPECT_FALSE(ring.Peek());
+  EXPECT_TRUE(ring.IsCorrupt());
+  // stays corrupt even if a valid record follows
+  ASSERT_TRUE(ring.TryWrite(2, Bytes("x")));
+  EXPECT_FALSE(ring.Peek());
+}
+
+TEST_F(SharedMemoryRingTest, CorruptHead) {
+  // head more than a full ring ahead of tail
+  control.head = kCapacity + 8;
+  EXPECT_FALSE(ring.Peek());
+  EXPECT_TRUE(ring.IsCorrupt());
+}
+
+TEST_F(SharedMemoryRingTest, CorruptPad) {
+  ASSERT_TRUE(ring.TryWrite(net::SharedMemoryRing::kPad, Bytes("x")));
+  EXPECT_FALSE(ring.Peek());
+  EXPECT_TRUE(ring.IsCorrupt());
+}
+
+TEST_F(SharedMemoryRingTest, Threaded) {
+  constexpr uint32_t kCount = 10000;
+  std::thread producer{[&] {
+    for (uint32_t i = 0; i < kCount;) {
+      std::span<const uint8_t> bytes{reinterpret_cast<const uint8_t*>(&i),
+                                     i % 5};
+      if (ring.TryWrite(i + 1, bytes)) {
+        ring.Notify();
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }};
+  for (uint32_t i = 0; i < kCount;) {
+    auto rec = ring.Peek();
+    if (!rec) {
+      ring.Wait(ring.GetSequence(), 10);
+      continue;
+    }
+    ASSERT_EQ(rec->kind, i + 1);
+    ASSERT_EQ(rec->data.size(), i % 5);
+    ring.Pop();
+    ++i;
+  }
+  producer.join();
+  EXPECT_TRUE(ring.IsEmpty());
+}
+
+TEST(SharedMemorySegmentTest, CreateOpen) {
+  if (!net::SharedMemorySegment::IsSupported()) {
+    GTEST_SKIP();
+  }
+  auto server = net::SharedMemorySegment::Create(4096);
+  ASSERT_TRUE(server);
+  auto client = net::SharedMemorySegment::Open(server->GetName());
+  ASSERT_TRUE(client);
+  // the name is removed once the client attaches
+  EXPECT_FALSE(net::SharedMemorySegment::Open(server->GetName()));
+
+  std::string_view msg = "hello";
+  ASSERT_TRUE(server->GetServerToClient().TryWrite(
+      1, {reinterpret_cast<const uint8_t*>(msg.data()), msg.size()}));
+  auto rec = client->GetServerToClient().Peek();
+  ASSERT_TRUE(rec);
+  EXPECT_EQ(rec->data.size(), msg.size());
+  EXPECT_TRUE(client->GetClientToServer().IsEmpty());
+}
+
+TEST(SharedMemorySegmentTest, OpenRejectsPaths) {
+  EXPECT_FALSE(net::SharedMemorySegment::Open(""));
+  EXPECT_FALSE(net::SharedMemorySegment::Open("../etc/passwd"));
+}
+
+}  // namespace nt
@@ -3,8 +3,10 @@
 // the WPILib BSD license file in the root directory of this project.
 
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
+#include <wpi/DenseMap.h>
 #include <wpi/SmallString.h>
 #include <wpi/raw_ostream.h>
 
@@ -16,6 +18,7 @@
 #include "gmock/gmock.h"
 #include "net/MessageHandler.h"
 #include "net/WireDecoder.h"
+#include "net/WireEncoder.h"
 #include "networktables/NetworkTableValue.h"
 
 using namespace std::string_view_literals;
@@ -23,6 +26,23 @@ using testing::_;
 using testing::MockFunction;
 using testing::StrictMock;
 
+static std::vector<uint8_t> EncodeBinary(int id, int64_t time,
+                                         const nt::Value& value) {
+  std::vector<uint8_t> out;
+  wpi::raw_uvector_ostream os{out};
+  nt::net::WireEncodeBinary(os, id, time, value);
+  return out;
+}
+
+static std::vector<uint8_t> EncodeBinaryDelta(int id, int64_t time,
+                                              const nt::Value& base,
+                                              const nt::Value& value) {
+  std::vector<uint8_t> out;
+  wpi::raw_uvector_ostream os{out};
+  EXPECT_TRUE(nt::net::WireEncodeBinaryDelta(os, id, time, base, value));
+  return out;
+}
+
 namespace nt {
 
 class WireDecodeTextClientTest : public ::testing::Test {
@@ -192,4 +212,89 @@ TEST_F(WireDecodeTextClientTest, UnpublishError) {
       logger);
 }
 
+TEST(WireDecodeBinaryTest, Delta) {
+  wpi::DenseMap<int, Value> bases;
+  auto base = Value::MakeDoubleArray({1, 2, 3, 4, 5});
+  auto value = Value::MakeDoubleArray({1, 2, 6, 4, 5});
+  auto full = EncodeBinary(5, 6, base);
+  auto delta = EncodeBinaryDelta(5, 7, base, value);
+
+  int id;
+  Value out;
+  std::string error;
+  std::span<const uint8_t> data = full;
+  ASSERT_TRUE(net::WireDecodeBinary(&data, &id, &out, &error, 0, &bases));
+  EXPECT_TRUE(data.empty());
+  EXPECT_EQ(id, 5);
+  EXPECT_EQ(out, base);
+
+  data = delta;
+  ASSERT_TRUE(net::WireDecodeBinary(&data, &id, &out, &error, 0, &bases));
+  EXPECT_TRUE(data.empty());
+  EXPECT_EQ(id, 5);
+  EXPECT_EQ(out, value);
+  EXPECT_EQ(out.time(), 7);
+
+  // the decoded value is the base for the next delta
+  auto value2 = Value::MakeDoubleArray({1, 2, 6, 4, 7});
+  auto delta2 = EncodeBinaryDelta(5, 8, value, value2);
+  data = delta2;
+  ASSERT_TRUE(net::WireDecodeBinary(&data, &id, &out, &error, 0, &bases));
+  EXPECT_EQ(out, value2);
+}
+
+TEST(WireDecodeBinaryTest, DeltaRaw) {
+  wpi::DenseMap<int, Value> bases;
+  std::vector<uint8_t> baseData(20, 1);
+  std::vector<uint8_t> valueData = baseData;
+  valueData[3] = 5;
+  valueData[15] = 6;
+  auto base = Value::MakeRaw(baseData);
+  auto value = Value::MakeRaw(valueData);
+  auto full = EncodeBinary(2, 6, base);
+  auto delta = EncodeBinaryDelta(2, 7, base, value);
+
+  int id;
+  Value out;
+  std::string error;
+  std::span<const uint8_t> data = full;
+  ASSERT_TRUE(net::WireDecodeBinary(&data, &id, &out, &error, 0, &bases));
+  data = delta;
+  ASSERT_TRUE(net::WireDecodeBinary(&data, &id, &out, &error, 0, &bases));
+  EXPECT_EQ(out, value);
+}
+
+TEST(WireDecodeBinaryTest, DeltaWithoutBase) {
+  wpi::DenseMap<int, Value> bases;
+  auto delta = EncodeBinaryDelta(5, 7, Value::MakeIntegerArray({1, 2, 3}),
+                                 Value::MakeIntegerArray({1, 2, 4}));
+
+  int id;
+  Value out;
+  std::string error;
+  std::span<const uint8_t> data = delta;
+  ASSERT_FALSE(net::WireDecodeBinary(&data, &id, &out, &error, 0, &bases));
+  EXPECT_EQ(error, "delta for id 5 without a base value");
+
+  // not accepted unless negotiated
+  data = delta;
+  ASSERT_FALSE(net::WireDecodeBinary(&data, &id, &out, &error, 0));
+  EXPECT_EQ(error, "unrecognized type 82");
+}
+
+TEST(WireDecodeBinaryTest, DeltaMismatch) {
+  wpi::DenseMap<int, Value> bases;
+  auto full = EncodeBinary(5, 6, Value::MakeIntegerArray({1, 2}));
+  auto delta = EncodeBinaryDelta(5, 7, Value::MakeIntegerArray({1, 2, 3}),
+                                 Value::MakeIntegerArray({1, 2, 4}));
+
+  int id;
+  Value out;
+  std::string error;
+  std::span<const uint8_t> data = full;
+  ASSERT_TRUE(net::WireDecodeBinary(&data, &id, &out, &error, 0, &bases));
+  data = delta;
+  ASSERT_FALSE(net::WireDecodeBinary(&data, &id, &out, &error, 0, &bases));
+}
+
 }  // namespace nt
@@ -286,4 +286,51 @@ TEST_F(WireEncoderBinaryTest, StringArray) {
                                "bye"_us));
 }
 
+TEST_F(WireEncoderBinaryTest, DoubleArrayDelta) {
+  ASSERT_TRUE(net::WireEncodeBinaryDelta(os, 5, 6,
+                                         Value::MakeDoubleArray({1, 2, 3}),
+                                         Value::MakeDoubleArray({1, 5, 3})));
+  ASSERT_THAT(out, wpi::SpanEq("\x94\x05\x06\x51\x92\x01\x91"
+                               "\xcb\x40\x14\x00\x00\x00\x00\x00\x00"_us));
+}
+
+TEST_F(WireEncoderBinaryTest, IntegerArrayDeltaRanges) {
+  ASSERT_TRUE(net::WireEncodeBinaryDelta(os, 5, 6,
+                                         Value::MakeIntegerArray({1, 2, 3, 4}),
+                                         Value::MakeIntegerArray({1, 9, 3, 8})));
+  ASSERT_THAT(out,
+              wpi::SpanEq("\x94\x05\x06\x52\x94\x01\x91\x09\x03\x91\x08"_us));
+}
+
+TEST_F(WireEncoderBinaryTest, RawDeltaMergesRanges) {
+  std::vector<uint8_t> base(10, 0);
+  std::vector<uint8_t> value = base;
+  value[1] = 1;
+  value[4] = 2;
+  ASSERT_TRUE(net::WireEncodeBinaryDelta(os, 5, 6, Value::MakeRaw(base),
+                                         Value::MakeRaw(value)));
+  ASSERT_THAT(out, wpi::SpanEq("\x94\x05\x06\x45\x92\x01"
+                               "\xc4\x04\x01\x00\x00\x02"_us));
+}
+
+TEST_F(WireEncoderBinaryTest, DeltaNotSmaller) {
+  ASSERT_FALSE(net::WireEncodeBinaryDelta(os, 5, 6,
+                                          Value::MakeDoubleArray({1, 2, 3}),
+                                          Value::MakeDoubleArray({4, 5, 3})));
+  ASSERT_TRUE(out.empty());
+}
+
+TEST_F(WireEncoderBinaryTest, DeltaMismatch) {
+  ASSERT_FALSE(net::WireEncodeBinaryDelta(os, 5, 6,
+                                          Value::MakeDoubleArray({1, 2, 3}),
+                                          Value::MakeDoubleArray({1, 2})));
+  ASSERT_FALSE(net::WireEncodeBinaryDelta(os, 5, 6,
+                                          Value::MakeIntegerArray({1, 2}),
+                                          Value::MakeDoubleArray({1, 3})));
+  ASSERT_FALSE(net::WireEncodeBinaryDelta(os, 5, 6,
+                                          Value::MakeStringArray({"a", "b"}),
+                                          Value::MakeStringArray({"a", "c"})));
+  ASSERT_TRUE(out.empty());
+}
+
 }  // namespace nt
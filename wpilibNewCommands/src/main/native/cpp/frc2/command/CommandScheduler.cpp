@@ -19,6 +19,7 @@
 #include <networktables/IntegerArrayTopic.h>
 #include <networktables/StringArrayTopic.h>
 #include <wpi/DenseMap.h>
+#include <wpi/Profile.h>
 #include <wpi/SmallVector.h>
 #include <wpi/sendable/SendableBuilder.h>
 #include <wpi/sendable/SendableRegistry.h>
@@ -177,10 +178,12 @@ void CommandScheduler::Run() {
     return;
   }
 
+  WPI_PROFILE_SCOPE("CommandScheduler::Run()");
   m_watchdog.Reset();
 
   // Run the periodic method of all registered subsystems.
   for (auto&& subsystem : m_impl->subsystems) {
+    WPI_PROFILE_SCOPE("Subsystem::Periodic()");
     subsystem.getFirst()->Periodic();
     if constexpr (frc::RobotBase::IsSimulation()) {
       subsystem.getFirst()->SimulationPeriodic();
@@ -192,7 +195,10 @@ void CommandScheduler::Run() {
   // is called from inside the button bindings.
   frc::EventLoop* loopCache = m_impl->activeButtonLoop;
   // Poll buttons for new commands to add.
-  loopCache->Poll();
+  {
+    WPI_PROFILE_SCOPE("EventLoop::Poll()");
+    loopCache->Poll();
+  }
   m_watchdog.AddEpoch("buttons.Run()");
 
   bool isDisabled = frc::RobotState::IsDisabled();
@@ -207,6 +213,7 @@ void CommandScheduler::Run() {
       continue;
     }
 
+    WPI_PROFILE_SCOPE("Command::Execute()");
     command->Execute();
     for (auto&& action : m_impl->executeActions) {
       action(*command);
@@ -139,7 +139,8 @@ void MecanumControllerCommand::Initialize() {
     };
   }
   m_prevTime = 0_s;
-  auto initialState = m_trajectory.Sample(0_s);
+  m_sampler = frc::Trajectory::Sampler{m_trajectory};
+  auto initialState = m_sampler.Sample(0_s);
 
   auto initialXVelocity =
       initialState.velocity * initialState.pose.Rotation().Cos();
@@ -161,7 +162,7 @@ void MecanumControllerCommand::Initialize() {
 void MecanumControllerCommand::Execute() {
   auto curTime = m_timer.Get();
 
-  auto m_desiredState = m_trajectory.Sample(curTime);
+  auto m_desiredState = m_sampler.Sample(curTime);
 
   auto targetChassisSpeeds =
       m_controller.Calculate(m_pose(), m_desiredState, m_desiredRotation());
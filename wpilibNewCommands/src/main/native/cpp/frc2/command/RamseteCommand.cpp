@@ -55,7 +55,8 @@ RamseteCommand::RamseteCommand(
 
 void RamseteCommand::Initialize() {
   m_prevTime = -1_s;
-  auto initialState = m_trajectory.Sample(0_s);
+  m_sampler = frc::Trajectory::Sampler{m_trajectory};
+  auto initialState = m_sampler.Sample(0_s);
   m_prevSpeeds = m_kinematics.ToWheelSpeeds(
       frc::ChassisSpeeds{initialState.velocity, 0_mps,
                          initialState.velocity * initialState.curvature});
@@ -81,7 +82,7 @@ void RamseteCommand::Execute() {
   }
 
   auto targetWheelSpeeds = m_kinematics.ToWheelSpeeds(
-      m_controller.Calculate(m_pose(), m_trajectory.Sample(curTime)));
+      m_controller.Calculate(m_pose(), m_sampler.Sample(curTime)));
 
   if (m_usePID) {
     auto leftFeedforward =
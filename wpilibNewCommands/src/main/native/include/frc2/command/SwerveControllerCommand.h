@@ -231,12 +231,13 @@ class SwerveControllerCommand
         return m_trajectory.States().back().pose.Rotation();
       };
     }
+    m_sampler = frc::Trajectory::Sampler{m_trajectory};
     m_timer.Restart();
   }
 
   void Execute() override {
     auto curTime = m_timer.Get();
-    auto m_desiredState = m_trajectory.Sample(curTime);
+    auto m_desiredState = m_sampler.Sample(curTime);
 
     auto targetChassisSpeeds =
         m_controller.Calculate(m_pose(), m_desiredState, m_desiredRotation());
@@ -254,6 +255,7 @@ class SwerveControllerCommand
 
  private:
   frc::Trajectory m_trajectory;
+  frc::Trajectory::Sampler m_sampler;
   std::function<frc::Pose2d()> m_pose;
   frc::SwerveDriveKinematics<NumModules> m_kinematics;
   frc::HolonomicDriveController m_controller;
@@ -9,6 +9,7 @@
 #include <hal/DriverStation.h>
 #include <hal/FRCUsageReporting.h>
 #include <networktables/NetworkTableInstance.h>
+#include <wpi/Profile.h>
 #include <wpi/print.h>
 
 #include "frc/DSControlWord.h"
@@ -120,6 +121,7 @@ units::second_t IterativeRobotBase::GetPeriod() const {
 }
 
 void IterativeRobotBase::LoopFunc() {
+  WPI_PROFILE_SCOPE("IterativeRobotBase::LoopFunc()");
   DriverStation::RefreshData();
   m_watchdog.Reset();
 
@@ -183,33 +185,50 @@ void IterativeRobotBase::LoopFunc() {
   // Call the appropriate function depending upon the current robot mode
   if (mode == Mode::kDisabled) {
     HAL_ObserveUserProgramDisabled();
+    WPI_PROFILE_SCOPE("DisabledPeriodic()");
     DisabledPeriodic();
     m_watchdog.AddEpoch("DisabledPeriodic()");
   } else if (mode == Mode::kAutonomous) {
     HAL_ObserveUserProgramAutonomous();
+    WPI_PROFILE_SCOPE("AutonomousPeriodic()");
     AutonomousPeriodic();
     m_watchdog.AddEpoch("AutonomousPeriodic()");
   } else if (mode == Mode::kTeleop) {
     HAL_ObserveUserProgramTeleop();
+    WPI_PROFILE_SCOPE("TeleopPeriodic()");
     TeleopPeriodic();
     m_watchdog.AddEpoch("TeleopPeriodic()");
   } else if (mode == Mode::kTest) {
     HAL_ObserveUserProgramTest();
+    WPI_PROFILE_SCOPE("TestPeriodic()");
     TestPeriodic();
     m_watchdog.AddEpoch("TestPeriodic()");
   }
 
-  RobotPeriodic();
+  {
+    WPI_PROFILE_SCOPE("RobotPeriodic()");
+    RobotPeriodic();
+  }
   m_watchdog.AddEpoch("RobotPeriodic()");
 
-  SmartDashboard::UpdateValues();
+  {
+    WPI_PROFILE_SCOPE("SmartDashboard::UpdateValues()");
+    SmartDashboard::UpdateValues();
+  }
   m_watchdog.AddEpoch("SmartDashboard::UpdateValues()");
-  LiveWindow::UpdateValues();
+  {
+    WPI_PROFILE_SCOPE("LiveWindow::UpdateValues()");
+    LiveWindow::UpdateValues();
+  }
   m_watchdog.AddEpoch("LiveWindow::UpdateValues()");
-  Shuffleboard::Update();
+  {
+    WPI_PROFILE_SCOPE("Shuffleboard::Update()");
+    Shuffleboard::Update();
+  }
   m_watchdog.AddEpoch("Shuffleboard::Update()");
 
   if constexpr (IsSimulation()) {
+    WPI_PROFILE_SCOPE("SimulationPeriodic()");
     HAL_SimPeriodicBefore();
     SimulationPeriodic();
     HAL_SimPeriodicAfter();
@@ -328,13 +328,17 @@ void PowerDistribution::InitSendable(wpi::SendableBuilder& builder) {
   int numChannels = GetNumChannels();
   // Use manual reads to avoid printing errors
   for (int i = 0; i < numChannels; ++i) {
+    auto key = fmt::format("Chan{}", i);
     builder.AddDoubleProperty(
-        fmt::format("Chan{}", i),
+        key,
         [=, this] {
           int32_t lStatus = 0;
           return HAL_GetPowerDistributionChannelCurrent(m_handle, i, &lStatus);
         },
         nullptr);
+    // reading every channel on every update is expensive, and dashboards
+    // don't display them any faster than this
+    builder.SetUpdatePeriod(key, 0.1);
   }
   builder.AddDoubleProperty(
       "Voltage",
@@ -0,0 +1,108 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc/Profiler.h"
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <wpi/DataLog.h>
+#include <wpi/Profile.h>
+#include <wpi/SafeThread.h>
+
+#include "frc/DataLogManager.h"
+#include "frc/Errors.h"
+
+using namespace frc;
+
+namespace {
+
+struct Thread final : public wpi::SafeThread {
+  Thread(wpi::log::DataLog& log, std::string_view traceFilename,
+         double period);
+
+  void Main() final;
+
+  void Collect();
+
+  std::chrono::duration<double> m_period;
+  wpi::profile::DataLogger m_logger;
+  wpi::log::IntegerLogEntry m_lostEntry;
+  std::optional<wpi::profile::TraceWriter> m_trace;
+  std::vector<wpi::profile::Event> m_events;
+};
+
+}  // namespace
+
+Thread::Thread(wpi::log::DataLog& log, std::string_view traceFilename,
+               double period)
+    : m_period{period},
+      m_logger{log},
+      m_lostEntry{log, "profile/lostEvents"} {
+  if (!traceFilename.empty()) {
+    std::error_code ec;
+    m_trace.emplace(traceFilename, ec);
+    if (ec) {
+      FRC_ReportError(err::Error, "Could not open profile trace file '{}': {}",
+                      traceFilename, ec.message());
+      m_trace.reset();
+    }
+  }
+}
+
+void Thread::Main() {
+  std::unique_lock lock{m_mutex};
+  while (m_active) {
+    m_cond.wait_for(lock, m_period);
+    lock.unlock();
+    Collect();
+    lock.lock();
+  }
+  lock.unlock();
+  // collect anything recorded before stopping
+  Collect();
+  if (m_trace) {
+    m_trace->Flush();
+  }
+}
+
+void Thread::Collect() {
+  m_events.clear();
+  size_t lost = wpi::profile::Collect(&m_events);
+  if (lost != 0) {
+    m_lostEntry.Append(lost);
+  }
+  m_logger.Append(m_events);
+  if (m_trace) {
+    m_trace->Append(m_events);
+  }
+}
+
+static wpi::SafeThreadOwner<Thread>& GetInstance() {
+  static wpi::SafeThreadOwner<Thread> instance;
+  return instance;
+}
+
+void Profiler::Start(std::string_view traceFilename, double period) {
+  Start(DataLogManager::GetLog(), traceFilename, period);
+}
+
+void Profiler::Start(wpi::log::DataLog& log, std::string_view traceFilename,
+                     double period) {
+  auto& inst = GetInstance();
+  if (inst) {
+    return;
+  }
+  inst.Start(log, traceFilename, period);
+  wpi::profile::SetEnabled(true);
+}
+
+void Profiler::Stop() {
+  wpi::profile::SetEnabled(false);
+  GetInstance().Join();
+}
@@ -0,0 +1,56 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc/SensorSnapshot.h"
+
+#include <hal/SensorSnapshot.h>
+
+#include "frc/AnalogInput.h"
+#include "frc/DigitalInput.h"
+#include "frc/DutyCycle.h"
+#include "frc/Encoder.h"
+#include "frc/Errors.h"
+
+using namespace frc;
+
+SensorSnapshot::SensorSnapshot() {
+  int32_t status = 0;
+  m_handle = HAL_InitializeSensorSnapshot(&status);
+  FRC_CheckErrorStatus(status, "InitializeSensorSnapshot");
+}
+
+int SensorSnapshot::Add(const DigitalInput& input) {
+  return AddSensor(HAL_SensorSnapshot_kDIO, input.GetPortHandleForRouting());
+}
+
+int SensorSnapshot::Add(const AnalogInput& input) {
+  return AddSensor(HAL_SensorSnapshot_kAnalogVoltage, input.m_port);
+}
+
+int SensorSnapshot::Add(const Encoder& encoder) {
+  return AddSensor(HAL_SensorSnapshot_kEncoder, encoder.m_encoder);
+}
+
+int SensorSnapshot::Add(const DutyCycle& dutyCycle) {
+  return AddSensor(HAL_SensorSnapshot_kDutyCycle, dutyCycle.m_handle);
+}
+
+void SensorSnapshot::Update() {
+  int32_t status = 0;
+  HAL_ReadSensorSnapshot(m_handle, m_values.data(), m_values.size(),
+                         &m_timestamp, &status);
+  FRC_CheckErrorStatus(status, "ReadSensorSnapshot");
+}
+
+units::second_t SensorSnapshot::GetTimestamp() const {
+  return units::microsecond_t{static_cast<double>(m_timestamp)};
+}
+
+int SensorSnapshot::AddSensor(HAL_SensorSnapshotType type, HAL_Handle handle) {
+  int32_t status = 0;
+  int index = HAL_AddSensorSnapshotSensor(m_handle, type, handle, &status);
+  FRC_CheckErrorStatus(status, "AddSensor");
+  m_values.resize(index + 1);
+  return index;
+}
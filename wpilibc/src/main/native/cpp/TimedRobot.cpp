@@ -12,12 +12,14 @@
 #include <hal/DriverStation.h>
 #include <hal/FRCUsageReporting.h>
 #include <hal/Notifier.h>
+#include <wpi/Profile.h>
 
 #include "frc/Errors.h"
 
 using namespace frc;
 
 void TimedRobot::StartCompetition() {
+  wpi::profile::SetThreadName("Robot main");
   RobotInit();
 
   if constexpr (IsSimulation()) {
@@ -48,7 +50,10 @@ void TimedRobot::StartCompetition() {
 
     m_loopStartTimeUs = RobotController::GetFPGATime();
 
-    callback.func();
+    {
+      WPI_PROFILE_SCOPE("TimedRobot callback");
+      callback.func();
+    }
 
     // Increment the expiration time by the number of full periods it's behind
     // plus one to avoid rapid repeat fires from a large loop overrun. We assume
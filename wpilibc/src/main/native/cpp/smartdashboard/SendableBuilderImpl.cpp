@@ -4,9 +4,12 @@
 
 #include "frc/smartdashboard/SendableBuilderImpl.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <networktables/BooleanArrayTopic.h>
 #include <networktables/BooleanTopic.h>
@@ -24,14 +27,63 @@
 
 using namespace frc;
 
+namespace {
+
+// Last published value of a property, used to skip publishing unchanged values
+template <typename T>
+class LastValue {
+ public:
+  // Stores the value and returns true if it differs from the stored value
+  template <typename U>
+  bool Changed(const U& value) {
+    if constexpr (std::is_arithmetic_v<T>) {
+      if (m_valid && m_value == value) {
+        return false;
+      }
+      m_value = value;
+    } else {
+      if (m_valid && std::ranges::equal(m_value, value)) {
+        return false;
+      }
+      m_value.assign(std::ranges::begin(value), std::ranges::end(value));
+    }
+    m_valid = true;
+    return true;
+  }
+
+ private:
+  T m_value{};
+  bool m_valid = false;
+};
+
+}  // namespace
+
 template <typename Topic>
 void SendableBuilderImpl::PropertyImpl<Topic>::Update(bool controllable,
-                                                      int64_t time) {
-  if (controllable && sub && updateLocal) {
-    updateLocal(sub);
+                                                      int64_t time,
+                                                      bool changed) {
+  if (sub) {
+    if (controllable && updateLocal) {
+      // echo back the resulting value, as the setter may not have accepted
+      // the received one as-is
+      if (updateLocal(sub)) {
+        pending = true;
+        force = true;
+      }
+    } else if (pub && sub.GetLastChange() > lastPublish) {
+      // a value written by someone else is being ignored; overwrite it, as
+      // the value would be if it was published on every update
+      pending = true;
+      force = true;
+    }
   }
-  if (pub && updateNetwork) {
-    updateNetwork(pub, time);
+  pending = pending || changed;
+  if (pending && pub && updateNetwork && time >= nextUpdate) {
+    updateNetwork(pub, time, force);
+    pending = false;
+    force = false;
+    lastPublish = time;
+    nextUpdate = time + period;
   }
 }
 
@@ -55,11 +107,15 @@ bool SendableBuilderImpl::IsActuator() const {
 
 void SendableBuilderImpl::Update() {
   uint64_t time = nt::Now();
+  // without change tracking, anything may have changed
+  bool changed = !m_changed || m_changed->exchange(false);
   for (auto& property : m_properties) {
-    property->Update(m_controllable, time);
+    property->Update(m_controllable, time, changed);
   }
-  for (auto& updateTable : m_updateTables) {
-    updateTable();
+  if (changed) {
+    for (auto& updateTable : m_updateTables) {
+      updateTable();
+    }
   }
 }
 
@@ -93,6 +149,7 @@ void SendableBuilderImpl::StopLiveWindowMode() {
 
 void SendableBuilderImpl::ClearProperties() {
   m_properties.clear();
+  m_changed.reset();
 }
 
 void SendableBuilderImpl::SetSmartDashboardType(std::string_view type) {
@@ -123,23 +180,47 @@ nt::Topic SendableBuilderImpl::GetTopic(std::string_view key) {
   return m_table->GetTopic(key);
 }
 
+void SendableBuilderImpl::SetUpdatePeriod(std::string_view key,
+                                          double period) {
+  auto name = m_table->GetTopic(key).GetName();
+  for (auto& property : m_properties) {
+    if (property->name == name) {
+      property->period = static_cast<int64_t>(period * 1e6);
+    }
+  }
+}
+
+std::function<void()> SendableBuilderImpl::EnableChangeTracking() {
+  if (!m_changed) {
+    // update everything the first time
+    m_changed = std::make_shared<std::atomic_bool>(true);
+  }
+  return [changed = m_changed] { changed->store(true); };
+}
+
 template <typename Topic, typename Getter, typename Setter>
 void SendableBuilderImpl::AddPropertyImpl(Topic topic, Getter getter,
                                           Setter setter) {
-  auto prop = std::make_unique<PropertyImpl<Topic>>();
+  auto prop = std::make_unique<PropertyImpl<Topic>>(topic);
   if (getter) {
     prop->pub = topic.Publish();
-    prop->updateNetwork = [=](auto& pub, int64_t time) {
-      pub.Set(getter(), time);
+    prop->updateNetwork = [=, last = LastValue<typename Topic::ValueType>{}](
+                              auto& pub, int64_t time, bool force) mutable {
+      auto value = getter();
+      if (last.Changed(value) || force) {
+        pub.Set(value, time);
+      }
     };
   }
+  // also used by getter-only properties to detect values written by others
+  prop->sub = topic.Subscribe({}, {.excludePublisher = prop->pub.GetHandle()});
   if (setter) {
-    prop->sub =
-        topic.Subscribe({}, {.excludePublisher = prop->pub.GetHandle()});
     prop->updateLocal = [=](auto& sub) {
-      for (auto&& val : sub.ReadQueue()) {
+      auto values = sub.ReadQueue();
+      for (auto&& val : values) {
         setter(val.value);
       }
+      return !values.empty();
     };
   }
   m_properties.emplace_back(std::move(prop));
@@ -147,7 +228,7 @@ void SendableBuilderImpl::AddPropertyImpl(Topic topic, Getter getter,
 
 template <typename Topic, typename Value>
 void SendableBuilderImpl::PublishConstImpl(Topic topic, Value value) {
-  auto prop = std::make_unique<PropertyImpl<Topic>>();
+  auto prop = std::make_unique<PropertyImpl<Topic>>(topic);
   prop->pub = topic.Publish();
   prop->pub.Set(value);
   m_properties.emplace_back(std::move(prop));
@@ -277,20 +358,26 @@ void SendableBuilderImpl::AddRawProperty(
     std::function<std::vector<uint8_t>()> getter,
     std::function<void(std::span<const uint8_t>)> setter) {
   auto topic = m_table->GetRawTopic(key);
-  auto prop = std::make_unique<PropertyImpl<nt::RawTopic>>();
+  auto prop = std::make_unique<PropertyImpl<nt::RawTopic>>(topic);
   if (getter) {
     prop->pub = topic.Publish(typeString);
-    prop->updateNetwork = [=](auto& pub, int64_t time) {
-      pub.Set(getter(), time);
+    prop->updateNetwork = [=, last = LastValue<std::vector<uint8_t>>{}](
+                              auto& pub, int64_t time, bool force) mutable {
+      auto value = getter();
+      if (last.Changed(value) || force) {
+        pub.Set(value, time);
+      }
     };
   }
   if (setter) {
     prop->sub = topic.Subscribe(typeString, {},
                                 {.excludePublisher = prop->pub.GetHandle()});
     prop->updateLocal = [=](auto& sub) {
-      for (auto&& val : sub.ReadQueue()) {
+      auto values = sub.ReadQueue();
+      for (auto&& val : values) {
         setter(val.value);
       }
+      return !values.empty();
     };
   }
   m_properties.emplace_back(std::move(prop));
@@ -300,7 +387,7 @@ void SendableBuilderImpl::PublishConstRaw(std::string_view key,
                                           std::string_view typeString,
                                           std::span<const uint8_t> value) {
   auto topic = m_table->GetRawTopic(key);
-  auto prop = std::make_unique<PropertyImpl<nt::RawTopic>>();
+  auto prop = std::make_unique<PropertyImpl<nt::RawTopic>>(topic);
   prop->pub = topic.Publish(typeString);
   prop->pub.Set(value);
   m_properties.emplace_back(std::move(prop));
@@ -310,21 +397,27 @@ template <typename T, size_t Size, typename Topic, typename Getter,
           typename Setter>
 void SendableBuilderImpl::AddSmallPropertyImpl(Topic topic, Getter getter,
                                                Setter setter) {
-  auto prop = std::make_unique<PropertyImpl<Topic>>();
+  auto prop = std::make_unique<PropertyImpl<Topic>>(topic);
   if (getter) {
     prop->pub = topic.Publish();
-    prop->updateNetwork = [=](auto& pub, int64_t time) {
+    prop->updateNetwork = [=, last = LastValue<typename Topic::ValueType>{}](
+                              auto& pub, int64_t time, bool force) mutable {
       wpi::SmallVector<T, Size> buf;
-      pub.Set(getter(buf), time);
+      auto value = getter(buf);
+      if (last.Changed(value) || force) {
+        pub.Set(value, time);
+      }
     };
   }
+  // also used by getter-only properties to detect values written by others
+  prop->sub = topic.Subscribe({}, {.excludePublisher = prop->pub.GetHandle()});
   if (setter) {
-    prop->sub =
-        topic.Subscribe({}, {.excludePublisher = prop->pub.GetHandle()});
     prop->updateLocal = [=](auto& sub) {
-      for (auto&& val : sub.ReadQueue()) {
+      auto values = sub.ReadQueue();
+      for (auto&& val : values) {
         setter(val.value);
       }
+      return !values.empty();
     };
   }
   m_properties.emplace_back(std::move(prop));
@@ -389,21 +482,27 @@ void SendableBuilderImpl::AddSmallRawProperty(
         getter,
     std::function<void(std::span<const uint8_t>)> setter) {
   auto topic = m_table->GetRawTopic(key);
-  auto prop = std::make_unique<PropertyImpl<nt::RawTopic>>();
+  auto prop = std::make_unique<PropertyImpl<nt::RawTopic>>(topic);
   if (getter) {
     prop->pub = topic.Publish(typeString);
-    prop->updateNetwork = [=](auto& pub, int64_t time) {
+    prop->updateNetwork = [=, last = LastValue<std::vector<uint8_t>>{}](
+                              auto& pub, int64_t time, bool force) mutable {
       wpi::SmallVector<uint8_t, 128> buf;
-      pub.Set(getter(buf), time);
+      auto value = getter(buf);
+      if (last.Changed(value) || force) {
+        pub.Set(value, time);
+      }
     };
   }
   if (setter) {
     prop->sub = topic.Subscribe(typeString, {},
                                 {.excludePublisher = prop->pub.GetHandle()});
     prop->updateLocal = [=](auto& sub) {
-      for (auto&& val : sub.ReadQueue()) {
+      auto values = sub.ReadQueue();
+      for (auto&& val : values) {
         setter(val.value);
       }
+      return !values.empty();
     };
   }
   m_properties.emplace_back(std::move(prop));
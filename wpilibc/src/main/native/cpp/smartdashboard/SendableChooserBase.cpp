@@ -21,7 +21,8 @@ SendableChooserBase::SendableChooserBase(SendableChooserBase&& oth)
       m_defaultChoice(std::move(oth.m_defaultChoice)),
       m_selected(std::move(oth.m_selected)),
       m_haveSelected(std::move(oth.m_haveSelected)),
-      m_instance(std::move(oth.m_instance)) {}
+      m_instance(std::move(oth.m_instance)),
+      m_changed(std::move(oth.m_changed)) {}
 
 SendableChooserBase& SendableChooserBase::operator=(SendableChooserBase&& oth) {
   SendableHelper::operator=(oth);
@@ -30,5 +31,6 @@ SendableChooserBase& SendableChooserBase::operator=(SendableChooserBase&& oth) {
   m_selected = std::move(oth.m_selected);
   m_haveSelected = std::move(oth.m_haveSelected);
   m_instance = std::move(oth.m_instance);
+  m_changed = std::move(oth.m_changed);
   return *this;
 }
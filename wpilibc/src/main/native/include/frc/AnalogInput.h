@@ -34,6 +34,7 @@ class AnalogInput : public wpi::Sendable,
   friend class AnalogGyro;
   friend class DMA;
   friend class DMASample;
+  friend class SensorSnapshot;
 
  public:
   static constexpr int kAccumulatorModuleNumber = 1;
@@ -33,6 +33,7 @@ class DutyCycle : public wpi::Sendable, public wpi::SendableHelper<DutyCycle> {
   friend class AnalogTrigger;
   friend class DMA;
   friend class DMASample;
+  friend class SensorSnapshot;
 
  public:
   /**
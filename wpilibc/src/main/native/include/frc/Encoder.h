@@ -41,6 +41,7 @@ class Encoder : public CounterBase,
                 public wpi::SendableHelper<Encoder> {
   friend class DMA;
   friend class DMASample;
+  friend class SensorSnapshot;
 
  public:
   /**
@@ -0,0 +1,60 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <string_view>
+
+namespace wpi::log {
+class DataLog;
+}  // namespace wpi::log
+
+namespace frc {
+
+/**
+ * Records where time goes in the robot loop.
+ *
+ * While started, the profiling zones (see wpi/Profile.h) in the robot loop,
+ * command scheduler, dashboard updates and NetworkTables flushes, as well as
+ * any zones added with WPI_PROFILE_SCOPE() in robot code, are recorded with
+ * nanosecond resolution.  A background thread periodically collects them and
+ * writes them to a data log (one "profile/{zone}" entry per zone, containing
+ * durations in nanoseconds), and optionally to a Chrome trace file that can
+ * be opened in Perfetto (https://ui.perfetto.dev).
+ *
+ * Recording a zone only takes two clock reads and a write to a per-thread
+ * buffer, but profiling is still meant for diagnosing loop overruns rather
+ * than being left enabled in competition.
+ */
+class Profiler final {
+ public:
+  Profiler() = delete;
+
+  /**
+   * Start profiling, logging to the DataLogManager log.  No effect if already
+   * started.
+   *
+   * @param traceFilename if not empty, also write a Chrome trace to this file
+   * @param period time between collections, in seconds
+   */
+  static void Start(std::string_view traceFilename = "", double period = 0.1);
+
+  /**
+   * Start profiling.  No effect if already started.
+   *
+   * @param log data log
+   * @param traceFilename if not empty, also write a Chrome trace to this file
+   * @param period time between collections, in seconds
+   */
+  static void Start(wpi::log::DataLog& log, std::string_view traceFilename = "",
+                    double period = 0.1);
+
+  /**
+   * Stop profiling.  Events recorded so far are written, and the trace file
+   * (if any) is completed.
+   */
+  static void Stop();
+};
+
+}  // namespace frc
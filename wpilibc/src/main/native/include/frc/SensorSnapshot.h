@@ -0,0 +1,120 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <span>
+#include <vector>
+
+#include <hal/SensorSnapshot.h>
+#include <hal/Types.h>
+#include <units/time.h>
+
+namespace frc {
+class AnalogInput;
+class DigitalInput;
+class DutyCycle;
+class Encoder;
+
+/**
+ * Reads a group of sensors in a single HAL call.
+ *
+ * Sensors are added once, then Update() reads all of them at once with a
+ * common timestamp. Digital and analog inputs are resolved to their hardware
+ * channel when they're added, and all digital inputs are read together, so
+ * this is cheaper than reading each sensor individually when a robot has many
+ * of them. On the roboRIO, encoders and duty cycles are still read one at a
+ * time (in simulation, every sensor type is resolved when it's added).
+ *
+ * The sensors must outlive the snapshot, or at least their values must not be
+ * read from it after they're destroyed.
+ */
+class SensorSnapshot {
+ public:
+  SensorSnapshot();
+
+  SensorSnapshot(SensorSnapshot&&) = default;
+  SensorSnapshot& operator=(SensorSnapshot&&) = default;
+
+  /**
+   * Adds the value of a digital input to the snapshot. It reads as 0.0 or 1.0.
+   *
+   * @param input Digital input to add.
+   * @return The index of the input's value.
+   */
+  int Add(const DigitalInput& input);
+
+  /**
+   * Adds the voltage of an analog input to the snapshot.
+   *
+   * @param input Analog input to add.
+   * @return The index of the input's voltage.
+   */
+  int Add(const AnalogInput& input);
+
+  /**
+   * Adds the count of an encoder to the snapshot, as returned by
+   * Encoder::Get().
+   *
+   * @param encoder Encoder to add.
+   * @return The index of the encoder's count.
+   */
+  int Add(const Encoder& encoder);
+
+  /**
+   * Adds the output ratio of a duty cycle input to the snapshot, as returned by
+   * DutyCycle::GetOutput().
+   *
+   * @param dutyCycle Duty cycle input to add.
+   * @return The index of the duty cycle's output.
+   */
+  int Add(const DutyCycle& dutyCycle);
+
+  /**
+   * Reads every sensor in the snapshot.
+   */
+  void Update();
+
+  /**
+   * Gets the FPGA time the values were last read at.
+   *
+   * @return The timestamp of the last Update(), or 0 if it hasn't been called.
+   */
+  units::second_t GetTimestamp() const;
+
+  /**
+   * Gets a value read by the last Update().
+   *
+   * @param index The index returned when the sensor was added.
+   * @return The sensor's value.
+   */
+  double Get(int index) const { return m_values[index]; }
+
+  /**
+   * Gets a digital input value read by the last Update().
+   *
+   * @param index The index returned when the input was added.
+   * @return The input's value.
+   */
+  bool GetBoolean(int index) const { return m_values[index] != 0.0; }
+
+  /**
+   * Gets every value read by the last Update(), in the order the sensors were
+   * added.
+   *
+   * @return The sensor values.
+   */
+  std::span<const double> GetValues() const { return m_values; }
+
+ private:
+  int AddSensor(HAL_SensorSnapshotType type, HAL_Handle handle);
+
+  hal::Handle<HAL_SensorSnapshotHandle, HAL_FreeSensorSnapshot> m_handle;
+  std::vector<double> m_values;
+  uint64_t m_timestamp = 0;
+};
+
+}  // namespace frc
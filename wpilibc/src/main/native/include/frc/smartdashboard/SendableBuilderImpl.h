@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <span>
@@ -60,6 +61,10 @@ class SendableBuilderImpl : public nt::NTSendableBuilder {
   /**
    * Synchronize with network table values by calling the getters for all
    * properties and setters when the network table value has changed.
+   * Values are only published when they differ from the last published value,
+   * or to overwrite a value written by someone else that the setter (if any)
+   * did not receive. If change tracking is enabled, getters are only called
+   * after a change has been signaled or such a value has been written.
    */
   void Update() override;
 
@@ -209,22 +214,44 @@ class SendableBuilderImpl : public nt::NTSendableBuilder {
           getter,
       std::function<void(std::span<const uint8_t>)> setter) override;
 
+  void SetUpdatePeriod(std::string_view key, double period) override;
+  std::function<void()> EnableChangeTracking() override;
+
  private:
   struct Property {
+    explicit Property(std::string name) : name{std::move(name)} {}
     virtual ~Property() = default;
-    virtual void Update(bool controllable, int64_t time) = 0;
+    virtual void Update(bool controllable, int64_t time, bool changed) = 0;
+
+    // full topic name
+    std::string name;
+    // minimum time between updates, in microseconds
+    int64_t period = 0;
+    int64_t nextUpdate = 0;
+    // a change was signaled (or a remote value was received) but the
+    // property has not been updated yet
+    bool pending = true;
+    // publish even if the value matches the last published value
+    bool force = false;
   };
 
   template <typename Topic>
   struct PropertyImpl : public Property {
-    void Update(bool controllable, int64_t time) override;
+    explicit PropertyImpl(const Topic& topic) : Property{topic.GetName()} {}
+
+    void Update(bool controllable, int64_t time, bool changed) override;
 
     using Publisher = typename Topic::PublisherType;
     using Subscriber = typename Topic::SubscriberType;
     Publisher pub;
     Subscriber sub;
-    std::function<void(Publisher& pub, int64_t time)> updateNetwork;
-    std::function<void(Subscriber& sub)> updateLocal;
+    // publishes the getter value if it changed (or force is true)
+    std::function<void(Publisher& pub, int64_t time, bool force)>
+        updateNetwork;
+    // returns true if any values were received
+    std::function<bool(Subscriber& sub)> updateLocal;
+    // time of the last publish
+    int64_t lastPublish = 0;
   };
 
   template <typename Topic, typename Getter, typename Setter>
@@ -243,6 +270,8 @@ class SendableBuilderImpl : public nt::NTSendableBuilder {
   std::shared_ptr<nt::NetworkTable> m_table;
   bool m_controllable = false;
   bool m_actuator = false;
+  // set when change tracking is enabled
+  std::shared_ptr<std::atomic_bool> m_changed;
 
   nt::BooleanPublisher m_controllablePublisher;
   nt::StringPublisher m_typePublisher;
@@ -67,6 +67,7 @@ class SendableChooser : public SendableChooserBase {
    */
   void AddOption(std::string_view name, T object) {
     m_choices[name] = std::move(object);
+    m_changed();
   }
 
   /**
@@ -126,6 +127,8 @@ class SendableChooser : public SendableChooserBase {
 
   void InitSendable(wpi::SendableBuilder& builder) override {
     builder.SetSmartDashboardType("String Chooser");
+    // the options rarely change, so only update them when they do
+    m_changed = builder.EnableChangeTracking();
     builder.PublishConstInteger(kInstance, m_instance);
     builder.AddStringArrayProperty(
         kOptions,
@@ -169,6 +172,7 @@ class SendableChooser : public SendableChooserBase {
                                   }
                                   m_previousVal = val;
                                 }
+                                m_changed();
                                 if (listener) {
                                   listener(choice);
                                 }
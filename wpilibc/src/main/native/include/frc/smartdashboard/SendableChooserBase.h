@@ -5,6 +5,7 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <string>
 
 #include <wpi/mutex.h>
@@ -41,6 +42,9 @@ class SendableChooserBase : public wpi::Sendable,
   mutable wpi::mutex m_mutex;
   int m_instance;
   std::string m_previousVal;
+  // signals a change to the builder (see wpi::SendableBuilder::
+  // EnableChangeTracking())
+  std::function<void()> m_changed = [] {};
   static std::atomic_int s_instances;
 };
 
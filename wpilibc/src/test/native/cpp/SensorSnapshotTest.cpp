@@ -0,0 +1,53 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc/SensorSnapshot.h"  // NOLINT(build/include_order)
+
+#include <gtest/gtest.h>
+#include <hal/HAL.h>
+
+#include "frc/AnalogInput.h"
+#include "frc/DigitalInput.h"
+#include "frc/DutyCycle.h"
+#include "frc/Encoder.h"
+#include "frc/simulation/AnalogInputSim.h"
+#include "frc/simulation/DIOSim.h"
+#include "frc/simulation/DutyCycleSim.h"
+#include "frc/simulation/EncoderSim.h"
+
+namespace frc {
+
+TEST(SensorSnapshotTest, Update) {
+  HAL_Initialize(500, 0);
+
+  DigitalInput di{0};
+  AnalogInput ai{1};
+  Encoder encoder{2, 3};
+  DigitalInput dutyCycleInput{4};
+  DutyCycle dutyCycle{dutyCycleInput};
+
+  SensorSnapshot snapshot;
+  int diIndex = snapshot.Add(di);
+  int aiIndex = snapshot.Add(ai);
+  int encoderIndex = snapshot.Add(encoder);
+  int dutyCycleIndex = snapshot.Add(dutyCycle);
+  EXPECT_EQ(4u, snapshot.GetValues().size());
+
+  sim::DIOSim{di}.SetValue(true);
+  sim::AnalogInputSim{ai}.SetVoltage(1.5);
+  sim::EncoderSim{encoder}.SetCount(-42);
+  sim::DutyCycleSim{dutyCycle}.SetOutput(0.25);
+
+  snapshot.Update();
+  EXPECT_TRUE(snapshot.GetBoolean(diIndex));
+  EXPECT_DOUBLE_EQ(ai.GetVoltage(), snapshot.Get(aiIndex));
+  EXPECT_EQ(encoder.Get(), snapshot.Get(encoderIndex));
+  EXPECT_DOUBLE_EQ(dutyCycle.GetOutput(), snapshot.Get(dutyCycleIndex));
+
+  sim::DIOSim{di}.SetValue(false);
+  snapshot.Update();
+  EXPECT_FALSE(snapshot.GetBoolean(diIndex));
+}
+
+}  // namespace frc
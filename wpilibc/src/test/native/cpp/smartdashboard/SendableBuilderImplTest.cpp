@@ -0,0 +1,225 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <frc/smartdashboard/SendableBuilderImpl.h>
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+#include <networktables/DoubleTopic.h>
+#include <networktables/NetworkTableInstance.h>
+#include <networktables/StringTopic.h>
+#include <ntcore_cpp.h>
+
+class SendableBuilderImplTest : public ::testing::Test {
+ protected:
+  SendableBuilderImplTest() {
+    m_builder.SetTable(m_inst.GetTable("/test"));
+  }
+
+  ~SendableBuilderImplTest() override {
+    nt::NetworkTableInstance::Destroy(m_inst);
+  }
+
+  // subscriber that also sees values republished unchanged
+  nt::DoubleSubscriber SubscribeAll(std::string_view name) {
+    return m_inst.GetDoubleTopic(name).Subscribe(
+        0, {.pollStorage = 10, .keepDuplicates = true});
+  }
+
+  nt::NetworkTableInstance m_inst = nt::NetworkTableInstance::Create();
+  frc::SendableBuilderImpl m_builder;
+};
+
+// Waits until nt::Now() has advanced, so later values have newer timestamps
+static void WaitForNextTimestamp() {
+  int64_t start = nt::Now();
+  while (nt::Now() == start) {
+  }
+}
+
+TEST_F(SendableBuilderImplTest, SkipsUnchangedValues) {
+  double value = 1.0;
+  auto sub = SubscribeAll("/test/value");
+  m_builder.AddDoubleProperty("value", [&] { return value; }, nullptr);
+
+  m_builder.Update();
+  m_builder.Update();
+  m_builder.Update();
+  auto values = sub.ReadQueue();
+  ASSERT_EQ(values.size(), 1u);
+  EXPECT_EQ(values[0].value, 1.0);
+
+  value = 2.0;
+  m_builder.Update();
+  m_builder.Update();
+  values = sub.ReadQueue();
+  ASSERT_EQ(values.size(), 1u);
+  EXPECT_EQ(values[0].value, 2.0);
+}
+
+TEST_F(SendableBuilderImplTest, SkipsUnchangedStrings) {
+  std::string value = "a";
+  auto sub = m_inst.GetStringTopic("/test/value")
+                 .Subscribe("", {.pollStorage = 10, .keepDuplicates = true});
+  m_builder.AddSmallStringProperty(
+      "value", [&](auto&) -> std::string_view { return value; }, nullptr);
+
+  m_builder.Update();
+  m_builder.Update();
+  value = "b";
+  m_builder.Update();
+  auto values = sub.ReadQueue();
+  ASSERT_EQ(values.size(), 2u);
+  EXPECT_EQ(values[0].value, "a");
+  EXPECT_EQ(values[1].value, "b");
+}
+
+TEST_F(SendableBuilderImplTest, UpdatePeriod) {
+  int calls = 0;
+  m_builder.AddDoubleProperty("slow", [&] { return ++calls; }, nullptr);
+  m_builder.SetUpdatePeriod("slow", 1000.0);
+
+  m_builder.Update();
+  m_builder.Update();
+  m_builder.Update();
+  EXPECT_EQ(calls, 1);
+}
+
+TEST_F(SendableBuilderImplTest, ChangeTracking) {
+  int calls = 0;
+  int tableUpdates = 0;
+  m_builder.AddDoubleProperty("value", [&] { return ++calls; }, nullptr);
+  m_builder.SetUpdateTable([&] { ++tableUpdates; });
+  auto changed = m_builder.EnableChangeTracking();
+
+  // everything is updated the first time
+  m_builder.Update();
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(tableUpdates, 1);
+
+  m_builder.Update();
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(tableUpdates, 1);
+
+  changed();
+  m_builder.Update();
+  m_builder.Update();
+  EXPECT_EQ(calls, 2);
+  EXPECT_EQ(tableUpdates, 2);
+}
+
+TEST_F(SendableBuilderImplTest, ChangeTrackingOutlivesBuilder) {
+  std::function<void()> changed;
+  {
+    frc::SendableBuilderImpl builder;
+    builder.SetTable(m_inst.GetTable("/other"));
+    changed = builder.EnableChangeTracking();
+  }
+  changed();
+}
+
+TEST_F(SendableBuilderImplTest, RemoteValueReceived) {
+  double value = 1.0;
+  m_builder.AddDoubleProperty(
+      "value", [&] { return value; }, [&](double v) { value = v + 1; });
+  m_builder.StartListeners();
+  auto sub = m_inst.GetDoubleTopic("/test/value").Subscribe(0);
+  auto remote = m_inst.GetDoubleTopic("/test/value").Publish();
+
+  m_builder.Update();
+  EXPECT_EQ(sub.Get(), 1.0);
+
+  // the setter changes the value to something else, which is published back
+  WaitForNextTimestamp();
+  remote.Set(5.0);
+  m_builder.Update();
+  EXPECT_EQ(value, 6.0);
+  EXPECT_EQ(sub.Get(), 6.0);
+}
+
+TEST_F(SendableBuilderImplTest, RemoteValueRejected) {
+  double value = 1.0;
+  m_builder.AddDoubleProperty(
+      "value", [&] { return value; }, [&](double v) {});
+  m_builder.StartListeners();
+  auto sub = m_inst.GetDoubleTopic("/test/value").Subscribe(0);
+  auto remote = m_inst.GetDoubleTopic("/test/value").Publish();
+
+  m_builder.Update();
+  EXPECT_EQ(sub.Get(), 1.0);
+
+  // the local value doesn't change, but is published again to replace the
+  // rejected remote value
+  WaitForNextTimestamp();
+  remote.Set(5.0);
+  m_builder.Update();
+  EXPECT_EQ(sub.Get(), 1.0);
+}
+
+TEST_F(SendableBuilderImplTest, RemoteValueOverwritesGetterOnly) {
+  double value = 1.0;
+  m_builder.AddDoubleProperty("value", [&] { return value; }, nullptr);
+  auto sub = m_inst.GetDoubleTopic("/test/value").Subscribe(0);
+  auto remote = m_inst.GetDoubleTopic("/test/value").Publish();
+
+  m_builder.Update();
+  EXPECT_EQ(sub.Get(), 1.0);
+
+  // the remote value is overwritten even though the local value did not
+  // change, in both modes
+  WaitForNextTimestamp();
+  remote.Set(5.0);
+  WaitForNextTimestamp();
+  m_builder.Update();
+  EXPECT_EQ(sub.Get(), 1.0);
+
+  m_builder.StartListeners();
+  WaitForNextTimestamp();
+  remote.Set(5.0);
+  WaitForNextTimestamp();
+  m_builder.Update();
+  EXPECT_EQ(sub.Get(), 1.0);
+}
+
+TEST_F(SendableBuilderImplTest, RemoteValueOverwritesWithChangeTracking) {
+  double value = 1.0;
+  m_builder.AddDoubleProperty("value", [&] { return value; }, nullptr);
+  auto changed = m_builder.EnableChangeTracking();
+  auto sub = m_inst.GetDoubleTopic("/test/value").Subscribe(0);
+  auto remote = m_inst.GetDoubleTopic("/test/value").Publish();
+
+  m_builder.Update();
+  EXPECT_EQ(sub.Get(), 1.0);
+
+  // overwritten without a change being signaled
+  WaitForNextTimestamp();
+  remote.Set(5.0);
+  WaitForNextTimestamp();
+  m_builder.Update();
+  EXPECT_EQ(sub.Get(), 1.0);
+}
+
+TEST_F(SendableBuilderImplTest, RemoteValueIgnored) {
+  double value = 1.0;
+  m_builder.AddDoubleProperty(
+      "value", [&] { return value; }, [&](double v) { value = v; });
+  auto sub = m_inst.GetDoubleTopic("/test/value").Subscribe(0);
+  auto remote = m_inst.GetDoubleTopic("/test/value").Publish();
+
+  m_builder.Update();
+  EXPECT_EQ(sub.Get(), 1.0);
+
+  // not controllable, so the remote value is overwritten even though the
+  // local value did not change
+  WaitForNextTimestamp();
+  remote.Set(5.0);
+  EXPECT_EQ(sub.Get(), 5.0);
+  WaitForNextTimestamp();
+  m_builder.Update();
+  EXPECT_EQ(value, 1.0);
+  EXPECT_EQ(sub.Get(), 1.0);
+}
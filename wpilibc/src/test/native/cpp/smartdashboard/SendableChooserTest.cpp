@@ -7,10 +7,12 @@
 #include <frc/smartdashboard/SmartDashboard.h>
 
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 #include <networktables/NetworkTableInstance.h>
+#include <networktables/StringArrayTopic.h>
 #include <networktables/StringTopic.h>
 
 class SendableChooserTest : public ::testing::TestWithParam<int> {};
@@ -76,5 +78,21 @@ TEST(SendableChooserTest, ChangeListener) {
   EXPECT_EQ(3, currentVal);
 }
 
+TEST(SendableChooserTest, OptionsAddedAfterPublish) {
+  frc::SendableChooser<int> chooser;
+  chooser.AddOption("1", 1);
+
+  frc::SmartDashboard::PutData("OptionsAddedAfterPublishChooser", &chooser);
+  frc::SmartDashboard::UpdateValues();
+  chooser.SetDefaultOption("2", 2);
+  frc::SmartDashboard::UpdateValues();
+
+  auto table = nt::NetworkTableInstance::GetDefault().GetTable(
+      "/SmartDashboard/OptionsAddedAfterPublishChooser");
+  EXPECT_EQ(table->GetStringArrayTopic("options").Subscribe({}).Get(),
+            (std::vector<std::string>{"1", "2"}));
+  EXPECT_EQ(table->GetStringTopic("default").Subscribe("").Get(), "2");
+}
+
 INSTANTIATE_TEST_SUITE_P(SendableChooserTests, SendableChooserTest,
                          ::testing::Values(0, 1, 2, 3));
@@ -5,21 +5,64 @@
 #include "frc/controller/ArmFeedforward.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
-#include <sleipnir/autodiff/gradient.hpp>
-#include <sleipnir/autodiff/hessian.hpp>
-
-#include "frc/EigenCore.h"
 #include "frc/system/NumericalIntegration.h"
 
 using namespace frc;
 
+namespace {
+
+/**
+ * A scalar along with its first and second derivatives with respect to the
+ * input voltage. This lets the Newton iteration below evaluate the cost's
+ * gradient and Hessian alongside the cost in one RK4 pass, without building an
+ * autodiff expression graph on every call.
+ */
+struct Jet {
+  double value = 0.0;
+  double d = 0.0;
+  double dd = 0.0;
+};
+
+constexpr Jet operator+(const Jet& lhs, const Jet& rhs) {
+  return {lhs.value + rhs.value, lhs.d + rhs.d, lhs.dd + rhs.dd};
+}
+
+constexpr Jet operator-(const Jet& lhs, const Jet& rhs) {
+  return {lhs.value - rhs.value, lhs.d - rhs.d, lhs.dd - rhs.dd};
+}
+
+constexpr Jet operator*(double lhs, const Jet& rhs) {
+  return {lhs * rhs.value, lhs * rhs.d, lhs * rhs.dd};
+}
+
+Jet cos(const Jet& x) {
+  double c = std::cos(x.value);
+  double s = std::sin(x.value);
+  return {c, -s * x.d, -c * x.d * x.d - s * x.dd};
+}
+
+/// Arm state [angle, angular velocity] for RK4.
+struct JetState {
+  Jet angle;
+  Jet velocity;
+};
+
+constexpr JetState operator+(const JetState& lhs, const JetState& rhs) {
+  return {lhs.angle + rhs.angle, lhs.velocity + rhs.velocity};
+}
+
+constexpr JetState operator*(double lhs, const JetState& rhs) {
+  return {lhs * rhs.angle, lhs * rhs.velocity};
+}
+
+}  // namespace
+
 units::volt_t ArmFeedforward::Calculate(
     units::unit_t<Angle> currentAngle, units::unit_t<Velocity> currentVelocity,
     units::unit_t<Velocity> nextVelocity) const {
-  using VarMat = slp::VariableMatrix;
-
   // Small kₐ values make the solver ill-conditioned
   if (kA < units::unit_t<ka_unit>{1e-1}) {
     auto acceleration = (nextVelocity - currentVelocity) / m_dt;
@@ -28,84 +71,73 @@ units::volt_t ArmFeedforward::Calculate(
   }
 
   // Arm dynamics
-  Matrixd<2, 2> A{{0.0, 1.0}, {0.0, -kV.value() / kA.value()}};
-  Matrixd<2, 1> B{{0.0}, {1.0 / kA.value()}};
-  const auto& f = [&](const VarMat& x, const VarMat& u) -> VarMat {
-    VarMat c{{0.0},
-             {-(kS / kA).value() * slp::sign(x[1]) -
-              (kG / kA).value() * slp::cos(x[0])}};
-    return A * x + B * u + c;
+  //
+  //   dx/dt = [0      1   ]x + [ 0  ]u + [            0             ]
+  //           [0  −kᵥ/kₐ  ]    [1/kₐ]    [−kₛ/kₐ sgn(ω) − k_g/kₐ cos θ]
+  double kVOverkA = (kV / kA).value();
+  double kSOverkA = (kS / kA).value();
+  double kGOverkA = (kG / kA).value();
+  double invkA = 1.0 / kA.value();
+
+  // Returns the cost (r − ωₖ₊₁)² and its derivatives with respect to uₖ
+  auto cost = [&](double u) {
+    const auto& f = [&](const JetState& x, const Jet& u) -> JetState {
+      return {x.velocity,
+              (-kVOverkA) * x.velocity + invkA * u +
+                  Jet{-kSOverkA * wpi::sgn(x.velocity.value)} -
+                  kGOverkA * cos(x.angle)};
+    };
+
+    JetState r_k{Jet{currentAngle.value()}, Jet{currentVelocity.value()}};
+    JetState r_k1 = RK4<decltype(f), JetState, Jet>(f, r_k, Jet{u, 1.0}, m_dt);
+
+    // J = e², dJ/du = 2e de/du, d²J/du² = 2(de/du)² + 2e d²e/du²
+    Jet e = Jet{nextVelocity.value()} - r_k1.velocity;
+    return Jet{e.value * e.value, 2.0 * e.value * e.d,
+               2.0 * e.d * e.d + 2.0 * e.value * e.dd};
   };
 
-  Vectord<2> r_k{currentAngle.value(), currentVelocity.value()};
-
-  slp::Variable u_k;
-
   // Initial guess
   auto acceleration = (nextVelocity - currentVelocity) / m_dt;
-  u_k.set_value((kS * wpi::sgn(currentVelocity.value()) + kV * currentVelocity +
-                 kA * acceleration + kG * units::math::cos(currentAngle))
-                    .value());
-
-  auto r_k1 = RK4<decltype(f), VarMat, VarMat>(f, r_k, u_k, m_dt);
-
-  // Minimize difference between desired and actual next velocity
-  auto cost =
-      (nextVelocity.value() - r_k1[1]) * (nextVelocity.value() - r_k1[1]);
+  double x = (kS * wpi::sgn(currentVelocity.value()) + kV * currentVelocity +
+              kA * acceleration + kG * units::math::cos(currentAngle))
+                 .value();
 
   // Refine solution via Newton's method
-  {
-    auto xAD = u_k;
-    double x = xAD.value();
-
-    slp::Gradient gradientF{cost, xAD};
-    Eigen::SparseVector<double> g = gradientF.value();
-
-    slp::Hessian hessianF{cost, xAD};
-    Eigen::SparseMatrix<double> H = hessianF.value();
-
-    double error_k = std::numeric_limits<double>::infinity();
-    double error_k1 = std::abs(g.coeff(0));
-
-    // Loop until error stops decreasing or max iterations is reached
-    for (size_t iteration = 0;
-         iteration < 50 && error_k1 < (1.0 - 1e-10) * error_k; ++iteration) {
-      error_k = error_k1;
-
-      // Iterate via Newton's method.
-      //
-      //   xₖ₊₁ = xₖ − H⁻¹g
-      //
-      // The Hessian is regularized to at least 1e-4.
-      double p_x = -g.coeff(0) / std::max(H.coeff(0, 0), 1e-4);
-
-      // Shrink step until cost goes down
-      {
-        double oldCost = cost.value();
-
-        double α = 1.0;
-        double trial_x = x + α * p_x;
-
-        xAD.set_value(trial_x);
-
-        while (cost.value() > oldCost) {
-          α *= 0.5;
-          trial_x = x + α * p_x;
-
-          xAD.set_value(trial_x);
-        }
-
-        x = trial_x;
-      }
-
-      xAD.set_value(x);
+  Jet J = cost(x);
+
+  double error_k = std::numeric_limits<double>::infinity();
+  double error_k1 = std::abs(J.d);
+
+  // Loop until error stops decreasing or max iterations is reached
+  for (size_t iteration = 0;
+       iteration < 50 && error_k1 < (1.0 - 1e-10) * error_k; ++iteration) {
+    error_k = error_k1;
+
+    // Iterate via Newton's method.
+    //
+    //   xₖ₊₁ = xₖ − H⁻¹g
+    //
+    // The Hessian is regularized to at least 1e-4.
+    double p_x = -J.d / std::max(J.dd, 1e-4);
+
+    // Shrink step until cost goes down
+    double oldCost = J.value;
+
+    double α = 1.0;
+    double trial_x = x + α * p_x;
+    J = cost(trial_x);
+
+    while (J.value > oldCost) {
+      α *= 0.5;
+      trial_x = x + α * p_x;
+      J = cost(trial_x);
+    }
 
-      g = gradientF.value();
-      H = hessianF.value();
+    x = trial_x;
 
-      error_k1 = std::abs(g.coeff(0));
-    }
+    error_k1 = std::abs(J.d);
   }
 
-  return units::volt_t{u_k.value()};
+  return units::volt_t{x};
 }
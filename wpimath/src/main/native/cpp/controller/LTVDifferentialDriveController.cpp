@@ -42,19 +42,16 @@ class State {
   static constexpr int kRightVelocity = 4;
 };
 
-}  // namespace
-
-LTVDifferentialDriveController::LTVDifferentialDriveController(
+detail::LTVGainTable<2, 5> MakeGainTable(
     const frc::LinearSystem<2, 2, 2>& plant, units::meter_t trackwidth,
     const wpi::array<double, 5>& Qelems, const wpi::array<double, 2>& Relems,
-    units::second_t dt)
-    : m_trackwidth{trackwidth} {
+    units::second_t dt) {
   // Control law derivation is in section 8.7 of
   // https://file.tavsys.net/control/controls-engineering-in-frc.pdf
   Matrixd<5, 5> A{
       {0.0, 0.0, 0.0, 0.5, 0.5},
       {0.0, 0.0, 0.0, 0.0, 0.0},
-      {0.0, 0.0, 0.0, -1.0 / m_trackwidth.value(), 1.0 / m_trackwidth.value()},
+      {0.0, 0.0, 0.0, -1.0 / trackwidth.value(), 1.0 / trackwidth.value()},
       {0.0, 0.0, 0.0, plant.A(0, 0), plant.A(0, 1)},
       {0.0, 0.0, 0.0, plant.A(1, 0), plant.A(1, 1)}};
   Matrixd<5, 2> B{{0.0, 0.0},
@@ -84,28 +81,42 @@ LTVDifferentialDriveController::LTVDifferentialDriveController(
 
   auto R_llt = R.llt();
 
-  for (auto velocity = -maxV; velocity < maxV; velocity += 0.01_mps) {
-    // The DARE is ill-conditioned if the velocity is close to zero, so don't
-    // let the system stop.
-    if (units::math::abs(velocity) < 1e-4_mps) {
-      A(State::kY, State::kHeading) = 1e-4;
-    } else {
-      A(State::kY, State::kHeading) = velocity.value();
-    }
-
-    Matrixd<5, 5> discA;
-    Matrixd<5, 2> discB;
-    DiscretizeAB(A, B, dt, &discA, &discB);
-
-    auto S = detail::DARE<5, 2>(discA, discB, Q, R_llt);
-
-    // K = (BᵀSB + R)⁻¹BᵀSA
-    m_table.insert(velocity, (discB.transpose() * S * discB + R)
-                                 .llt()
-                                 .solve(discB.transpose() * S * discA));
-  }
+  return {-maxV, maxV, 0.01_mps,
+          [&](units::meters_per_second_t velocity) -> Matrixd<2, 5> {
+            // Entries are computed concurrently, so linearize around the
+            // velocity in a local copy of A.
+            Matrixd<5, 5> A_v = A;
+
+            // The DARE is ill-conditioned if the velocity is close to zero, so
+            // don't let the system stop.
+            if (units::math::abs(velocity) < 1e-4_mps) {
+              A_v(State::kY, State::kHeading) = 1e-4;
+            } else {
+              A_v(State::kY, State::kHeading) = velocity.value();
+            }
+
+            Matrixd<5, 5> discA;
+            Matrixd<5, 2> discB;
+            DiscretizeAB(A_v, B, dt, &discA, &discB);
+
+            auto S = detail::DARE<5, 2>(discA, discB, Q, R_llt);
+
+            // K = (BᵀSB + R)⁻¹BᵀSA
+            return (discB.transpose() * S * discB + R)
+                .llt()
+                .solve(discB.transpose() * S * discA);
+          }};
 }
 
+}  // namespace
+
+LTVDifferentialDriveController::LTVDifferentialDriveController(
+    const frc::LinearSystem<2, 2, 2>& plant, units::meter_t trackwidth,
+    const wpi::array<double, 5>& Qelems, const wpi::array<double, 2>& Relems,
+    units::second_t dt)
+    : m_trackwidth{trackwidth},
+      m_table{MakeGainTable(plant, trackwidth, Qelems, Relems, dt)} {}
+
 bool LTVDifferentialDriveController::AtReference() const {
   return std::abs(m_error(0)) < m_tolerance(0) &&
          std::abs(m_error(1)) < m_tolerance(1) &&
@@ -33,14 +33,7 @@ class State {
   static constexpr int kHeading = 2;
 };
 
-}  // namespace
-
-LTVUnicycleController::LTVUnicycleController(
-    units::second_t dt, units::meters_per_second_t maxVelocity)
-    : LTVUnicycleController{{0.0625, 0.125, 2.0}, {1.0, 2.0}, dt, maxVelocity} {
-}
-
-LTVUnicycleController::LTVUnicycleController(
+detail::LTVGainTable<2, 3> MakeGainTable(
     const wpi::array<double, 3>& Qelems, const wpi::array<double, 2>& Relems,
     units::second_t dt, units::meters_per_second_t maxVelocity) {
   if (maxVelocity <= 0_mps) {
@@ -89,29 +82,45 @@ LTVUnicycleController::LTVUnicycleController(
 
   auto R_llt = R.llt();
 
-  for (auto velocity = -maxVelocity; velocity < maxVelocity;
-       velocity += 0.01_mps) {
-    // The DARE is ill-conditioned if the velocity is close to zero, so don't
-    // let the system stop.
-    if (units::math::abs(velocity) < 1e-4_mps) {
-      A(State::kY, State::kHeading) = 1e-4;
-    } else {
-      A(State::kY, State::kHeading) = velocity.value();
-    }
-
-    Matrixd<3, 3> discA;
-    Matrixd<3, 2> discB;
-    DiscretizeAB(A, B, dt, &discA, &discB);
-
-    auto S = detail::DARE<3, 2>(discA, discB, Q, R_llt);
-
-    // K = (BᵀSB + R)⁻¹BᵀSA
-    m_table.insert(velocity, (discB.transpose() * S * discB + R)
-                                 .llt()
-                                 .solve(discB.transpose() * S * discA));
-  }
+  return {-maxVelocity, maxVelocity, 0.01_mps,
+          [&](units::meters_per_second_t velocity) -> Matrixd<2, 3> {
+            // Entries are computed concurrently, so linearize around the
+            // velocity in a local copy of A.
+            Matrixd<3, 3> A_v = A;
+
+            // The DARE is ill-conditioned if the velocity is close to zero, so
+            // don't let the system stop.
+            if (units::math::abs(velocity) < 1e-4_mps) {
+              A_v(State::kY, State::kHeading) = 1e-4;
+            } else {
+              A_v(State::kY, State::kHeading) = velocity.value();
+            }
+
+            Matrixd<3, 3> discA;
+            Matrixd<3, 2> discB;
+            DiscretizeAB(A_v, B, dt, &discA, &discB);
+
+            auto S = detail::DARE<3, 2>(discA, discB, Q, R_llt);
+
+            // K = (BᵀSB + R)⁻¹BᵀSA
+            return (discB.transpose() * S * discB + R)
+                .llt()
+                .solve(discB.transpose() * S * discA);
+          }};
+}
+
+}  // namespace
+
+LTVUnicycleController::LTVUnicycleController(
+    units::second_t dt, units::meters_per_second_t maxVelocity)
+    : LTVUnicycleController{{0.0625, 0.125, 2.0}, {1.0, 2.0}, dt, maxVelocity} {
 }
 
+LTVUnicycleController::LTVUnicycleController(
+    const wpi::array<double, 3>& Qelems, const wpi::array<double, 2>& Relems,
+    units::second_t dt, units::meters_per_second_t maxVelocity)
+    : m_table{MakeGainTable(Qelems, Relems, dt, maxVelocity)} {}
+
 bool LTVUnicycleController::AtReference() const {
   const auto& eTranslate = m_poseError.Translation();
   const auto& eRotate = m_poseError.Rotation();
@@ -0,0 +1,315 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc/trajectory/TrajectoryGeneratorService.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "frc/spline/SplineHelper.h"
+#include "frc/trajectory/TrajectoryGenerator.h"
+#include "frc/trajectory/TrajectoryParameterizer.h"
+
+using namespace frc;
+
+struct TrajectoryGeneratorService::Job {
+  Job(std::vector<double> key, TrajectoryConfig config)
+      : key{std::move(key)}, config{std::move(config)} {}
+
+  // Cache key: spline type, reversed flag, then the waypoint components
+  std::vector<double> key;
+  TrajectoryConfig config;
+  std::promise<Trajectory> promise;
+
+  // Builds one parameterization task per spline of the path
+  std::function<std::vector<std::function<Points()>>()> makeSplines;
+
+  // Parameterized points of each spline
+  std::vector<Points> segments;
+
+  // Number of segments that haven't been parameterized yet
+  std::atomic<size_t> remaining = 0;
+
+  // First malformed spline error reported by a segment, if any
+  wpi::mutex errorMutex;
+  std::string error;
+};
+
+size_t TrajectoryGeneratorService::KeyHash::operator()(
+    const std::vector<double>& key) const {
+  size_t hash = key.size();
+  for (double value : key) {
+    hash ^= std::hash<double>{}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+TrajectoryGeneratorService::TrajectoryGeneratorService(int numThreads,
+                                                       size_t maxCacheSize)
+    : m_maxCacheSize{maxCacheSize} {
+  if (numThreads <= 0) {
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  for (int i = 0; i < numThreads; ++i) {
+    m_workers.emplace_back([this] { WorkerMain(); });
+  }
+}
+
+TrajectoryGeneratorService::~TrajectoryGeneratorService() {
+  {
+    std::scoped_lock lock{m_mutex};
+    m_shutdown = true;
+  }
+  m_cv.notify_all();
+  for (auto&& worker : m_workers) {
+    worker.join();
+  }
+}
+
+std::future<Trajectory> TrajectoryGeneratorService::GenerateAsync(
+    std::vector<Pose2d> waypoints, TrajectoryConfig config) {
+  std::vector<double> key{0.0, config.IsReversed() ? 1.0 : 0.0};
+  key.reserve(2 + 4 * waypoints.size());
+  for (auto&& waypoint : waypoints) {
+    key.insert(key.end(), {waypoint.X().value(), waypoint.Y().value(),
+                           waypoint.Rotation().Cos(),
+                           waypoint.Rotation().Sin()});
+  }
+
+  auto job = std::make_shared<Job>(std::move(key), std::move(config));
+  job->makeSplines = [waypoints = std::move(waypoints),
+                      reversed = job->config.IsReversed()]() mutable {
+    const Transform2d flip{Translation2d{}, 180_deg};
+    if (reversed) {
+      for (auto& waypoint : waypoints) {
+        waypoint = waypoint + flip;
+      }
+    }
+
+    std::vector<std::function<Points()>> tasks;
+    for (auto&& spline : SplineHelper::OptimizeCurvature(
+             SplineHelper::QuinticSplinesFromWaypoints(waypoints))) {
+      tasks.emplace_back(
+          [spline] { return SplineParameterizer::Parameterize(spline); });
+    }
+    return tasks;
+  };
+  return Submit(std::move(job));
+}
+
+std::future<Trajectory> TrajectoryGeneratorService::GenerateAsync(
+    const Pose2d& start, std::vector<Translation2d> interiorWaypoints,
+    const Pose2d& end, TrajectoryConfig config) {
+  std::vector<double> key{1.0, config.IsReversed() ? 1.0 : 0.0};
+  key.reserve(10 + 2 * interiorWaypoints.size());
+  key.insert(key.end(), {start.X().value(), start.Y().value(),
+                         start.Rotation().Cos(), start.Rotation().Sin()});
+  for (auto&& waypoint : interiorWaypoints) {
+    key.insert(key.end(), {waypoint.X().value(), waypoint.Y().value()});
+  }
+  key.insert(key.end(), {end.X().value(), end.Y().value(),
+                         end.Rotation().Cos(), end.Rotation().Sin()});
+
+  auto job = std::make_shared<Job>(std::move(key), std::move(config));
+  job->makeSplines = [start, interiorWaypoints = std::move(interiorWaypoints),
+                      end, reversed = job->config.IsReversed()] {
+    auto [initialCV, endCV] = SplineHelper::CubicControlVectorsFromWaypoints(
+        start, interiorWaypoints, end);
+
+    // Make theta normal for trajectory generation if path is reversed.
+    // Flip the headings.
+    if (reversed) {
+      initialCV.x[1] *= -1;
+      initialCV.y[1] *= -1;
+      endCV.x[1] *= -1;
+      endCV.y[1] *= -1;
+    }
+
+    std::vector<std::function<Points()>> tasks;
+    for (auto&& spline : SplineHelper::CubicSplinesFromControlVectors(
+             initialCV, interiorWaypoints, endCV)) {
+      tasks.emplace_back(
+          [spline] { return SplineParameterizer::Parameterize(spline); });
+    }
+    return tasks;
+  };
+  return Submit(std::move(job));
+}
+
+void TrajectoryGeneratorService::ClearCache() {
+  std::scoped_lock lock{m_cacheMutex};
+  m_cache.clear();
+  m_cacheList.clear();
+}
+
+size_t TrajectoryGeneratorService::GetCacheSize() const {
+  std::scoped_lock lock{m_cacheMutex};
+  return m_cache.size();
+}
+
+size_t TrajectoryGeneratorService::GetCacheHits() const {
+  std::scoped_lock lock{m_cacheMutex};
+  return m_cacheHits;
+}
+
+void TrajectoryGeneratorService::AddToCache(
+    const std::vector<double>& key, std::shared_ptr<const Points> points) {
+  std::scoped_lock lock{m_cacheMutex};
+  if (m_maxCacheSize == 0 || m_cache.contains(key)) {
+    return;
+  }
+  if (m_cache.size() >= m_maxCacheSize) {
+    m_cache.erase(m_cacheList.back().first);
+    m_cacheList.pop_back();
+  }
+  m_cacheList.emplace_front(key, std::move(points));
+  m_cache.emplace(key, m_cacheList.begin());
+}
+
+std::future<Trajectory> TrajectoryGeneratorService::Submit(
+    std::shared_ptr<Job> job) {
+  auto future = job->promise.get_future();
+
+  std::shared_ptr<const Points> cached;
+  {
+    std::scoped_lock lock{m_cacheMutex};
+    if (auto it = m_cache.find(job->key); it != m_cache.end()) {
+      m_cacheList.splice(m_cacheList.begin(), m_cacheList, it->second);
+      cached = it->second->second;
+      ++m_cacheHits;
+    }
+  }
+
+  if (cached) {
+    Post([this, job, cached = std::move(cached)] { Finish(*job, cached); });
+  } else {
+    Post([this, job] { StartParameterizing(job); });
+  }
+  return future;
+}
+
+void TrajectoryGeneratorService::StartParameterizing(std::shared_ptr<Job> job) {
+  std::vector<std::function<Points()>> tasks;
+  try {
+    tasks = job->makeSplines();
+  } catch (SplineParameterizer::MalformedSplineException& e) {
+    TrajectoryGenerator::ReportError(e.what());
+    job->promise.set_value(TrajectoryGenerator::kDoNothingTrajectory);
+    return;
+  } catch (...) {
+    job->promise.set_exception(std::current_exception());
+    return;
+  }
+
+  if (tasks.empty()) {
+    TrajectoryGenerator::ReportError(
+        "A trajectory requires at least two waypoints.");
+    job->promise.set_value(TrajectoryGenerator::kDoNothingTrajectory);
+    return;
+  }
+
+  job->segments.resize(tasks.size());
+  job->remaining = tasks.size();
+
+  // This thread parameterizes the first spline itself; the rest are spread
+  // across the pool. Whichever task finishes last merges the segments.
+  for (size_t i = tasks.size(); i-- > 0;) {
+    auto parameterize = [this, job, i, task = std::move(tasks[i])] {
+      try {
+        job->segments[i] = task();
+      } catch (SplineParameterizer::MalformedSplineException& e) {
+        std::scoped_lock lock{job->errorMutex};
+        if (job->error.empty()) {
+          job->error = e.what();
+        }
+      }
+
+      if (job->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+      }
+
+      if (!job->error.empty()) {
+        TrajectoryGenerator::ReportError(job->error.c_str());
+        job->promise.set_value(TrajectoryGenerator::kDoNothingTrajectory);
+        return;
+      }
+
+      // Every spline after the first starts with a duplicate of the previous
+      // spline's last point, so it's skipped
+      auto points = std::make_shared<Points>(std::move(job->segments[0]));
+      for (size_t j = 1; j < job->segments.size(); ++j) {
+        points->insert(points->end(), job->segments[j].begin() + 1,
+                       job->segments[j].end());
+      }
+      job->segments.clear();
+
+      AddToCache(job->key, points);
+      Finish(*job, std::move(points));
+    };
+
+    if (i == 0) {
+      parameterize();
+    } else {
+      Post(std::move(parameterize));
+    }
+  }
+}
+
+void TrajectoryGeneratorService::Finish(Job& job,
+                                        std::shared_ptr<const Points> points) {
+  try {
+    const auto& config = job.config;
+    if (config.IsReversed()) {
+      // After trajectory generation, flip theta back so it's relative to the
+      // field. Also fix curvature.
+      const Transform2d flip{Translation2d{}, 180_deg};
+      Points flipped;
+      flipped.reserve(points->size());
+      for (auto& point : *points) {
+        flipped.emplace_back(point.first + flip, -point.second);
+      }
+      job.promise.set_value(TrajectoryParameterizer::TimeParameterizeTrajectory(
+          flipped, config.Constraints(), config.StartVelocity(),
+          config.EndVelocity(), config.MaxVelocity(), config.MaxAcceleration(),
+          config.IsReversed()));
+    } else {
+      job.promise.set_value(TrajectoryParameterizer::TimeParameterizeTrajectory(
+          *points, config.Constraints(), config.StartVelocity(),
+          config.EndVelocity(), config.MaxVelocity(), config.MaxAcceleration(),
+          config.IsReversed()));
+    }
+  } catch (...) {
+    job.promise.set_exception(std::current_exception());
+  }
+}
+
+void TrajectoryGeneratorService::Post(std::function<void()> task) {
+  {
+    std::scoped_lock lock{m_mutex};
+    m_tasks.emplace_back(std::move(task));
+  }
+  m_cv.notify_one();
+}
+
+void TrajectoryGeneratorService::WorkerMain() {
+  std::unique_lock lock{m_mutex};
+  for (;;) {
+    m_cv.wait(lock, [&] { return m_shutdown || !m_tasks.empty(); });
+    if (m_tasks.empty()) {
+      // Only reached on shutdown, once every pending task has run
+      return;
+    }
+    auto task = std::move(m_tasks.front());
+    m_tasks.pop_front();
+
+    lock.unlock();
+    task();
+    lock.lock();
+  }
+}
@@ -28,6 +28,7 @@
 
 #include "frc/trajectory/TrajectoryParameterizer.h"
 
+#include <limits>
 #include <vector>
 
 #include <fmt/format.h>
@@ -43,6 +44,36 @@ Trajectory TrajectoryParameterizer::TimeParameterizeTrajectory(
     units::meters_per_second_t endVelocity,
     units::meters_per_second_t maxVelocity,
     units::meters_per_second_squared_t maxAcceleration, bool reversed) {
+  // Evaluate the constraints that support it over the whole trajectory up
+  // front. The rest are evaluated per state as the passes below need them.
+  std::vector<Pose2d> poses;
+  std::vector<units::curvature_t> curvatures;
+  poses.reserve(points.size());
+  curvatures.reserve(points.size());
+  for (auto&& [pose, curvature] : points) {
+    poses.emplace_back(pose);
+    curvatures.emplace_back(curvature);
+  }
+  const TrajectoryConstraint::PointBatch batch{poses, curvatures};
+
+  std::vector<units::meters_per_second_t> velocityLimits(
+      points.size(),
+      units::meters_per_second_t{std::numeric_limits<double>::infinity()});
+  std::vector<TrajectoryConstraint::MinMax> accelerationBounds(points.size());
+  std::vector<const TrajectoryConstraint*> velocityConstraints;
+  std::vector<const TrajectoryConstraint*> accelerationConstraints;
+  bool hasVelocityLimits = false;
+  for (auto&& constraint : constraints) {
+    if (constraint->LimitMaxVelocities(batch, velocityLimits)) {
+      hasVelocityLimits = true;
+    } else {
+      velocityConstraints.emplace_back(constraint.get());
+    }
+    if (!constraint->LimitAccelerations(batch, accelerationBounds)) {
+      accelerationConstraints.emplace_back(constraint.get());
+    }
+  }
+
   std::vector<ConstrainedState> constrainedStates(points.size());
 
   ConstrainedState predecessor{points.front(), 0_m, startVelocity,
@@ -76,7 +107,11 @@ Trajectory TrajectoryParameterizer::TimeParameterizeTrajectory(
 
       // At this point, the constrained state is fully constructed apart from
       // all the custom-defined user constraints.
-      for (const auto& constraint : constraints) {
+      if (hasVelocityLimits) {
+        constrainedState.maxVelocity =
+            units::math::min(constrainedState.maxVelocity, velocityLimits[i]);
+      }
+      for (auto constraint : velocityConstraints) {
         constrainedState.maxVelocity = units::math::min(
             constrainedState.maxVelocity,
             constraint->MaxVelocity(constrainedState.pose.first,
@@ -85,7 +120,8 @@ Trajectory TrajectoryParameterizer::TimeParameterizeTrajectory(
       }
 
       // Now enforce all acceleration limits.
-      EnforceAccelerationLimits(reversed, constraints, &constrainedState);
+      EnforceAccelerationLimits(reversed, accelerationBounds[i],
+                                accelerationConstraints, &constrainedState);
 
       if (ds.value() < kEpsilon) {
         break;
@@ -141,7 +177,8 @@ Trajectory TrajectoryParameterizer::TimeParameterizeTrajectory(
       constrainedState.maxVelocity = newMaxVelocity;
 
       // Check all acceleration constraints with the new max velocity.
-      EnforceAccelerationLimits(reversed, constraints, &constrainedState);
+      EnforceAccelerationLimits(reversed, accelerationBounds[i],
+                                accelerationConstraints, &constrainedState);
 
       if (ds.value() > -kEpsilon) {
         break;
@@ -214,10 +251,18 @@ Trajectory TrajectoryParameterizer::TimeParameterizeTrajectory(
 }
 
 void TrajectoryParameterizer::EnforceAccelerationLimits(
-    bool reverse,
-    const std::vector<std::unique_ptr<TrajectoryConstraint>>& constraints,
+    bool reverse, const TrajectoryConstraint::MinMax& bounds,
+    std::span<const TrajectoryConstraint* const> constraints,
     ConstrainedState* state) {
-  for (auto&& constraint : constraints) {
+  state->minAcceleration = units::math::max(
+      state->minAcceleration,
+      reverse ? -bounds.maxAcceleration : bounds.minAcceleration);
+
+  state->maxAcceleration = units::math::min(
+      state->maxAcceleration,
+      reverse ? -bounds.minAcceleration : bounds.maxAcceleration);
+
+  for (auto constraint : constraints) {
     double factor = reverse ? -1.0 : 1.0;
 
     auto minMaxAccel = constraint->MinMaxAcceleration(
@@ -6,10 +6,10 @@
 
 #include <wpi/SymbolExports.h>
 #include <wpi/array.h>
-#include <wpi/interpolating_map.h>
 
 #include "frc/EigenCore.h"
 #include "frc/controller/DifferentialDriveWheelVoltages.h"
+#include "frc/controller/LTVGainTable.h"
 #include "frc/geometry/Pose2d.h"
 #include "frc/system/LinearSystem.h"
 #include "frc/trajectory/Trajectory.h"
@@ -129,7 +129,7 @@ class WPILIB_DLLEXPORT LTVDifferentialDriveController {
   units::meter_t m_trackwidth;
 
   // LUT from drivetrain linear velocity to LQR gain
-  wpi::interpolating_map<units::meters_per_second_t, Matrixd<2, 5>> m_table;
+  detail::LTVGainTable<2, 5> m_table;
 
   Vectord<5> m_error;
   Vectord<5> m_tolerance;
@@ -0,0 +1,112 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "frc/EigenCore.h"
+#include "units/velocity.h"
+
+namespace frc::detail {
+
+/**
+ * Lookup table from linear velocity to controller gain for the LTV
+ * controllers.
+ *
+ * Gains are stored on a uniform velocity grid, so a lookup is a single index
+ * computation followed by a linear interpolation between the two neighboring
+ * entries. Lookups outside the grid return the gain at the nearest end.
+ *
+ * @tparam Inputs Number of inputs.
+ * @tparam States Number of states.
+ */
+template <int Inputs, int States>
+class LTVGainTable {
+ public:
+  using GainMatrix = Matrixd<Inputs, States>;
+
+  /**
+   * Constructs a gain table with entries at minVelocity, minVelocity + step,
+   * ..., up to but excluding maxVelocity.
+   *
+   * The entries are independent, so they're computed in parallel across the
+   * available hardware threads. The gain function must be safe to call
+   * concurrently.
+   *
+   * @param minVelocity The velocity of the first entry.
+   * @param maxVelocity The exclusive upper bound of the grid.
+   * @param step The velocity spacing between entries.
+   * @param gain Function that computes the gain for a given velocity.
+   */
+  template <typename F>
+  LTVGainTable(units::meters_per_second_t minVelocity,
+               units::meters_per_second_t maxVelocity,
+               units::meters_per_second_t step, F&& gain)
+      : m_minVelocity{minVelocity}, m_step{step} {
+    size_t size = 0;
+    while (minVelocity + static_cast<double>(size) * step < maxVelocity) {
+      ++size;
+    }
+    m_gains.resize(std::max<size_t>(size, 1));
+
+    auto fill = [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        m_gains[i] = gain(minVelocity + static_cast<double>(i) * step);
+      }
+    };
+
+    size_t numThreads = std::clamp<size_t>(std::thread::hardware_concurrency(),
+                                           1, m_gains.size());
+    size_t chunk = (m_gains.size() + numThreads - 1) / numThreads;
+
+    // The calling thread takes the first chunk. Futures rethrow any exception
+    // from the gain function when waited on.
+    std::vector<std::future<void>> workers;
+    for (size_t begin = chunk; begin < m_gains.size(); begin += chunk) {
+      workers.emplace_back(std::async(std::launch::async, fill, begin,
+                                      std::min(begin + chunk, m_gains.size())));
+    }
+    fill(0, std::min(chunk, m_gains.size()));
+    for (auto&& worker : workers) {
+      worker.get();
+    }
+  }
+
+  /**
+   * Returns the gain for the given velocity, linearly interpolated between the
+   * nearest two entries.
+   *
+   * @param velocity The velocity.
+   */
+  GainMatrix operator[](units::meters_per_second_t velocity) const {
+    double index = ((velocity - m_minVelocity) / m_step).value();
+    if (!(index > 0.0)) {
+      return m_gains.front();
+    }
+    if (index >= static_cast<double>(m_gains.size() - 1)) {
+      return m_gains.back();
+    }
+
+    size_t lower = static_cast<size_t>(index);
+    double delta = index - static_cast<double>(lower);
+    return (1.0 - delta) * m_gains[lower] + delta * m_gains[lower + 1];
+  }
+
+  /**
+   * Returns the number of entries in the table.
+   */
+  size_t size() const { return m_gains.size(); }
+
+ private:
+  units::meters_per_second_t m_minVelocity;
+  units::meters_per_second_t m_step;
+  std::vector<GainMatrix> m_gains;
+};
+
+}  // namespace frc::detail
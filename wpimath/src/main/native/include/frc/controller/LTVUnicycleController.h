@@ -6,9 +6,9 @@
 
 #include <wpi/SymbolExports.h>
 #include <wpi/array.h>
-#include <wpi/interpolating_map.h>
 
 #include "frc/EigenCore.h"
+#include "frc/controller/LTVGainTable.h"
 #include "frc/geometry/Pose2d.h"
 #include "frc/kinematics/ChassisSpeeds.h"
 #include "frc/trajectory/Trajectory.h"
@@ -125,7 +125,7 @@ class WPILIB_DLLEXPORT LTVUnicycleController {
 
  private:
   // LUT from drivetrain linear velocity to LQR gain
-  wpi::interpolating_map<units::meters_per_second_t, Matrixd<2, 3>> m_table;
+  detail::LTVGainTable<2, 3> m_table;
 
   Pose2d m_poseError;
   Pose2d m_poseTolerance;
@@ -4,8 +4,10 @@
 
 #pragma once
 
-#include <map>
+#include <algorithm>
 #include <optional>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
@@ -43,6 +45,22 @@ namespace frc {
 template <typename WheelSpeeds, typename WheelPositions>
 class WPILIB_DLLEXPORT PoseEstimator {
  public:
+  /**
+   * A timestamped vision pose measurement for AddVisionMeasurements().
+   */
+  struct VisionMeasurement {
+    /// The pose of the robot as measured by the vision camera.
+    Pose2d visionRobotPose;
+
+    /// The timestamp of the vision measurement. This must use the same epoch as
+    /// the timestamps passed to AddVisionMeasurement().
+    units::second_t timestamp;
+
+    /// If set, the standard deviations of this measurement; otherwise, the ones
+    /// set with SetVisionMeasurementStdDevs() are used.
+    std::optional<wpi::array<double, 3>> stdDevs;
+  };
+
   /**
    * Constructs a PoseEstimator.
    *
@@ -150,7 +168,7 @@ class WPILIB_DLLEXPORT PoseEstimator {
     const std::optional<std::pair<units::second_t, VisionUpdate>>
         latestVisionUpdate =
             m_visionUpdates.empty() ? std::nullopt
-                                    : std::optional{*m_visionUpdates.crbegin()};
+                                    : std::optional{m_visionUpdates.back()};
     m_odometryPoseBuffer.Clear();
     m_visionUpdates.clear();
 
@@ -160,7 +178,7 @@ class WPILIB_DLLEXPORT PoseEstimator {
           Pose2d{translation, latestVisionUpdate->second.visionPose.Rotation()},
           Pose2d{translation,
                  latestVisionUpdate->second.odometryPose.Rotation()}};
-      m_visionUpdates[latestVisionUpdate->first] = visionUpdate;
+      m_visionUpdates.emplace_back(latestVisionUpdate->first, visionUpdate);
       m_poseEstimate = visionUpdate.Compensate(m_odometry.GetPose());
     } else {
       m_poseEstimate = m_odometry.GetPose();
@@ -185,7 +203,7 @@ class WPILIB_DLLEXPORT PoseEstimator {
     const std::optional<std::pair<units::second_t, VisionUpdate>>
         latestVisionUpdate =
             m_visionUpdates.empty() ? std::nullopt
-                                    : std::optional{*m_visionUpdates.crbegin()};
+                                    : std::optional{m_visionUpdates.back()};
     m_odometryPoseBuffer.Clear();
     m_visionUpdates.clear();
 
@@ -195,7 +213,7 @@ class WPILIB_DLLEXPORT PoseEstimator {
           Pose2d{latestVisionUpdate->second.visionPose.Translation(), rotation},
           Pose2d{latestVisionUpdate->second.odometryPose.Translation(),
                  rotation}};
-      m_visionUpdates[latestVisionUpdate->first] = visionUpdate;
+      m_visionUpdates.emplace_back(latestVisionUpdate->first, visionUpdate);
       m_poseEstimate = visionUpdate.Compensate(m_odometry.GetPose());
     } else {
       m_poseEstimate = m_odometry.GetPose();
@@ -221,7 +239,7 @@ class WPILIB_DLLEXPORT PoseEstimator {
    */
   std::optional<Pose2d> SampleAt(units::second_t timestamp) const {
     // Step 0: If there are no odometry updates to sample, skip.
-    if (m_odometryPoseBuffer.GetInternalBuffer().empty()) {
+    if (m_odometryPoseBuffer.GetSamples().empty()) {
       return std::nullopt;
     }
 
@@ -229,15 +247,15 @@ class WPILIB_DLLEXPORT PoseEstimator {
     // buffer. (When sampling, the buffer will always use a timestamp
     // between the first and last timestamps)
     units::second_t oldestOdometryTimestamp =
-        m_odometryPoseBuffer.GetInternalBuffer().front().first;
+        m_odometryPoseBuffer.GetSamples().front().first;
     units::second_t newestOdometryTimestamp =
-        m_odometryPoseBuffer.GetInternalBuffer().back().first;
+        m_odometryPoseBuffer.GetSamples().back().first;
     timestamp =
         std::clamp(timestamp, oldestOdometryTimestamp, newestOdometryTimestamp);
 
     // Step 2: If there are no applicable vision updates, use the odometry-only
     // information.
-    if (m_visionUpdates.empty() || timestamp < m_visionUpdates.begin()->first) {
+    if (m_visionUpdates.empty() || timestamp < m_visionUpdates.front().first) {
       return m_odometryPoseBuffer.Sample(timestamp);
     }
 
@@ -246,7 +264,7 @@ class WPILIB_DLLEXPORT PoseEstimator {
     // First, find the iterator past the sample timestamp, then go back one.
     // Note that upper_bound() won't return begin() because we check begin()
     // earlier.
-    auto floorIter = m_visionUpdates.upper_bound(timestamp);
+    auto floorIter = FirstVisionUpdateAfter(timestamp);
     --floorIter;
     auto visionUpdate = floorIter->second;
 
@@ -283,63 +301,12 @@ class WPILIB_DLLEXPORT PoseEstimator {
    */
   void AddVisionMeasurement(const Pose2d& visionRobotPose,
                             units::second_t timestamp) {
-    // Step 0: If this measurement is old enough to be outside the pose buffer's
-    // timespan, skip.
-    if (m_odometryPoseBuffer.GetInternalBuffer().empty() ||
-        m_odometryPoseBuffer.GetInternalBuffer().front().first -
-                kBufferDuration >
-            timestamp) {
-      return;
+    if (RecordVisionMeasurement(visionRobotPose, timestamp)) {
+      // Update latest pose estimate. Since we cleared all updates after this
+      // vision update, it's guaranteed to be the latest vision update.
+      m_poseEstimate =
+          m_visionUpdates.back().second.Compensate(m_odometry.GetPose());
     }
-
-    // Step 1: Clean up any old entries
-    CleanUpVisionUpdates();
-
-    // Step 2: Get the pose measured by odometry at the moment the vision
-    // measurement was made.
-    auto odometrySample = m_odometryPoseBuffer.Sample(timestamp);
-
-    if (!odometrySample) {
-      return;
-    }
-
-    // Step 3: Get the vision-compensated pose estimate at the moment the vision
-    // measurement was made.
-    auto visionSample = SampleAt(timestamp);
-
-    if (!visionSample) {
-      return;
-    }
-
-    // Step 4: Measure the transform between the old pose estimate and the
-    // vision transform.
-    auto transform = visionRobotPose - visionSample.value();
-
-    // Step 5: We should not trust the transform entirely, so instead we scale
-    // this transform by a Kalman gain matrix representing how much we trust
-    // vision measurements compared to our current pose.
-    Eigen::Vector3d k_times_transform =
-        m_vision_K * Eigen::Vector3d{transform.X().value(),
-                                     transform.Y().value(),
-                                     transform.Rotation().Radians().value()};
-
-    // Step 6: Convert back to Transform2d.
-    Transform2d scaledTransform{
-        units::meter_t{k_times_transform(0)},
-        units::meter_t{k_times_transform(1)},
-        Rotation2d{units::radian_t{k_times_transform(2)}}};
-
-    // Step 7: Calculate and record the vision update.
-    VisionUpdate visionUpdate{*visionSample + scaledTransform, *odometrySample};
-    m_visionUpdates[timestamp] = visionUpdate;
-
-    // Step 8: Remove later vision measurements. (Matches previous behavior)
-    auto firstAfter = m_visionUpdates.upper_bound(timestamp);
-    m_visionUpdates.erase(firstAfter, m_visionUpdates.end());
-
-    // Step 9: Update latest pose estimate. Since we cleared all updates after
-    // this vision update, it's guaranteed to be the latest vision update.
-    m_poseEstimate = visionUpdate.Compensate(m_odometry.GetPose());
   }
 
   /**
@@ -377,6 +344,55 @@ class WPILIB_DLLEXPORT PoseEstimator {
     AddVisionMeasurement(visionRobotPose, timestamp);
   }
 
+  /**
+   * Adds several vision measurements to the Kalman Filter, for example the
+   * results of every camera from one loop. This is equivalent to calling
+   * AddVisionMeasurement() for each measurement in timestamp order, except that
+   * the latest pose estimate is only recomputed once.
+   *
+   * Since the measurements are applied in timestamp order, an older
+   * measurement in the batch doesn't discard the newer ones the way it would
+   * if they were added one at a time in arbitrary order.
+   *
+   * Unlike AddVisionMeasurement(), standard deviations given with a
+   * measurement only apply to that measurement; the ones set with
+   * SetVisionMeasurementStdDevs() are unchanged.
+   *
+   * @param measurements The vision measurements.
+   */
+  void AddVisionMeasurements(std::span<const VisionMeasurement> measurements) {
+    m_batchOrder.clear();
+    for (size_t i = 0; i < measurements.size(); ++i) {
+      m_batchOrder.push_back(i);
+    }
+    std::sort(m_batchOrder.begin(), m_batchOrder.end(),
+              [&](size_t lhs, size_t rhs) {
+                return std::pair{measurements[lhs].timestamp, lhs} <
+                       std::pair{measurements[rhs].timestamp, rhs};
+              });
+
+    const auto visionK = m_vision_K;
+    bool recorded = false;
+    for (size_t i : m_batchOrder) {
+      const auto& measurement = measurements[i];
+      if (measurement.stdDevs) {
+        SetVisionMeasurementStdDevs(*measurement.stdDevs);
+      } else {
+        m_vision_K = visionK;
+      }
+      if (RecordVisionMeasurement(measurement.visionRobotPose,
+                                  measurement.timestamp)) {
+        recorded = true;
+      }
+    }
+    m_vision_K = visionK;
+
+    if (recorded) {
+      m_poseEstimate =
+          m_visionUpdates.back().second.Compensate(m_odometry.GetPose());
+    }
+  }
+
   /**
    * Updates the pose estimator with wheel encoder and gyro information. This
    * should be called every loop.
@@ -412,7 +428,7 @@ class WPILIB_DLLEXPORT PoseEstimator {
     if (m_visionUpdates.empty()) {
       m_poseEstimate = odometryEstimate;
     } else {
-      auto visionUpdate = m_visionUpdates.rbegin()->second;
+      auto visionUpdate = m_visionUpdates.back().second;
       m_poseEstimate = visionUpdate.Compensate(odometryEstimate);
     }
 
@@ -420,22 +436,89 @@ class WPILIB_DLLEXPORT PoseEstimator {
   }
 
  private:
+  /**
+   * Records the vision update for a measurement without updating the latest
+   * pose estimate.
+   *
+   * @return True if the measurement was recorded.
+   */
+  bool RecordVisionMeasurement(const Pose2d& visionRobotPose,
+                               units::second_t timestamp) {
+    // Step 0: If this measurement is old enough to be outside the pose buffer's
+    // timespan, skip.
+    if (m_odometryPoseBuffer.GetSamples().empty() ||
+        m_odometryPoseBuffer.GetSamples().front().first - kBufferDuration >
+            timestamp) {
+      return false;
+    }
+
+    // Step 1: Clean up any old entries
+    CleanUpVisionUpdates();
+
+    // Step 2: Get the pose measured by odometry at the moment the vision
+    // measurement was made.
+    auto odometrySample = m_odometryPoseBuffer.Sample(timestamp);
+
+    if (!odometrySample) {
+      return false;
+    }
+
+    // Step 3: Get the vision-compensated pose estimate at the moment the vision
+    // measurement was made.
+    auto visionSample = SampleAt(timestamp);
+
+    if (!visionSample) {
+      return false;
+    }
+
+    // Step 4: Measure the transform between the old pose estimate and the
+    // vision transform.
+    auto transform = visionRobotPose - visionSample.value();
+
+    // Step 5: We should not trust the transform entirely, so instead we scale
+    // this transform by a Kalman gain matrix representing how much we trust
+    // vision measurements compared to our current pose.
+    Eigen::Vector3d k_times_transform =
+        m_vision_K * Eigen::Vector3d{transform.X().value(),
+                                     transform.Y().value(),
+                                     transform.Rotation().Radians().value()};
+
+    // Step 6: Convert back to Transform2d.
+    Transform2d scaledTransform{
+        units::meter_t{k_times_transform(0)},
+        units::meter_t{k_times_transform(1)},
+        Rotation2d{units::radian_t{k_times_transform(2)}}};
+
+    // Step 7: Calculate and record the vision update.
+    VisionUpdate visionUpdate{*visionSample + scaledTransform, *odometrySample};
+
+    // Step 8: Remove later vision measurements. (Matches previous behavior)
+    m_visionUpdates.erase(
+        std::lower_bound(
+            m_visionUpdates.begin(), m_visionUpdates.end(), timestamp,
+            [](const auto& entry, auto t) { return entry.first < t; }),
+        m_visionUpdates.end());
+    m_visionUpdates.emplace_back(timestamp, visionUpdate);
+
+    return true;
+  }
+
   /**
    * Removes stale vision updates that won't affect sampling.
    */
   void CleanUpVisionUpdates() {
     // Step 0: If there are no odometry samples, skip.
-    if (m_odometryPoseBuffer.GetInternalBuffer().empty()) {
+    if (m_odometryPoseBuffer.GetSamples().empty()) {
       return;
     }
 
     // Step 1: Find the oldest timestamp that needs a vision update.
     units::second_t oldestOdometryTimestamp =
-        m_odometryPoseBuffer.GetInternalBuffer().front().first;
+        m_odometryPoseBuffer.GetSamples().front().first;
 
     // Step 2: If there are no vision updates before that timestamp, skip.
     if (m_visionUpdates.empty() ||
-        oldestOdometryTimestamp < m_visionUpdates.begin()->first) {
+        oldestOdometryTimestamp < m_visionUpdates.front().first) {
       return;
     }
 
@@ -445,13 +528,23 @@ class WPILIB_DLLEXPORT PoseEstimator {
     // back one. Note that upper_bound() won't return begin() because we check
     // begin() earlier.
     auto newestNeededVisionUpdate =
-        m_visionUpdates.upper_bound(oldestOdometryTimestamp);
+        FirstVisionUpdateAfter(oldestOdometryTimestamp);
     --newestNeededVisionUpdate;
 
     // Step 4: Remove all entries strictly before the newest timestamp we need.
     m_visionUpdates.erase(m_visionUpdates.begin(), newestNeededVisionUpdate);
   }
 
+  /**
+   * Returns an iterator to the first vision update with a timestamp after the
+   * given one.
+   */
+  auto FirstVisionUpdateAfter(units::second_t timestamp) const {
+    return std::upper_bound(
+        m_visionUpdates.begin(), m_visionUpdates.end(), timestamp,
+        [](auto t, const auto& entry) { return t < entry.first; });
+  }
+
   struct VisionUpdate {
     // The vision-compensated pose estimate
     Pose2d visionPose;
@@ -491,7 +584,13 @@ class WPILIB_DLLEXPORT PoseEstimator {
   // unless there have been no vision measurements after the last reset. May
   // contain one entry while m_odometryPoseBuffer is empty to correct for
   // translation/rotation after a call to ResetRotation/ResetTranslation.
-  std::map<units::second_t, VisionUpdate> m_visionUpdates;
+  //
+  // Sorted by timestamp. New updates are only ever appended after truncating
+  // the later ones, so this stays small and doesn't allocate once warmed up.
+  std::vector<std::pair<units::second_t, VisionUpdate>> m_visionUpdates;
+
+  // Scratch space for AddVisionMeasurements()
+  std::vector<size_t> m_batchOrder;
 
   Pose2d m_poseEstimate;
 };
@@ -64,6 +64,9 @@ class UnscentedKalmanFilter {
 
   using StateMatrix = Matrixd<States, States>;
 
+  /// Matrix with one sigma point per column.
+  using SigmaMatrix = Matrixd<States, 2 * States + 1>;
+
   /**
    * Constructs an unscented Kalman filter.
    *
@@ -232,6 +235,39 @@ class UnscentedKalmanFilter {
    */
   void SetXhat(int i, double value) { m_xHat(i) = value; }
 
+  /**
+   * Sets a vector-valued function of the sigma points and u that returns the
+   * derivative of each sigma point, one per column. If set, Predict() calls it
+   * once per integration stage for all 2 * States + 1 sigma points instead of
+   * calling f(x, u) once per sigma point. f(x, u) is still used to linearize
+   * the model when discretizing the process noise.
+   *
+   * @param f A function equivalent to applying f(x, u) to each column, or
+   *          nullptr to go back to calling f(x, u) per sigma point.
+   */
+  void SetBatchDynamics(
+      std::function<SigmaMatrix(const SigmaMatrix&, const InputVector&)> f) {
+    m_batchF = std::move(f);
+  }
+
+  /**
+   * Sets whether Predict() reuses the square root of the discretized process
+   * noise covariance while the timestep doesn't change.
+   *
+   * The discretized process noise depends on the model linearized around the
+   * state estimate, so enabling this keeps the linearization from the first
+   * Predict() call after the timestep changes. This skips a numerical Jacobian,
+   * a matrix exponential and a Cholesky decomposition each Predict() call, and
+   * is a good approximation when the process noise is small relative to how
+   * fast the model's Jacobian changes over one timestep.
+   *
+   * @param cache Whether to cache the discretized process noise.
+   */
+  void SetCacheProcessNoise(bool cache) {
+    m_cacheProcessNoise = cache;
+    m_sqrtDiscQDt = -1_s;
+  }
+
   /**
    * Resets the observer.
    */
@@ -239,6 +275,7 @@ class UnscentedKalmanFilter {
     m_xHat.setZero();
     m_S.setZero();
     m_sigmasF.setZero();
+    m_sqrtDiscQDt = -1_s;
   }
 
   /**
@@ -251,18 +288,20 @@ class UnscentedKalmanFilter {
     m_dt = dt;
 
     // Discretize Q before projecting mean and covariance forward
-    StateMatrix contA =
-        NumericalJacobianX<States, States, Inputs>(m_f, m_xHat, u);
-    StateMatrix discA;
-    StateMatrix discQ;
-    DiscretizeAQ<States>(contA, m_contQ, m_dt, &discA, &discQ);
-    Eigen::internal::llt_inplace<double, Eigen::Lower>::blocked(discQ);
+    if (!m_cacheProcessNoise || m_sqrtDiscQDt != dt) {
+      StateMatrix contA =
+          NumericalJacobianX<States, States, Inputs>(m_f, m_xHat, u);
+      StateMatrix discA;
+      DiscretizeAQ<States>(contA, m_contQ, m_dt, &discA, &m_sqrtDiscQ);
+      Eigen::internal::llt_inplace<double, Eigen::Lower>::blocked(
+          m_sqrtDiscQ);
+      m_sqrtDiscQDt = dt;
+    }
 
     // Generate sigma points around the state mean
     //
     // equation (17)
-    Matrixd<States, 2 * States + 1> sigmas =
-        m_pts.SquareRootSigmaPoints(m_xHat, m_S);
+    SigmaMatrix sigmas = m_pts.SquareRootSigmaPoints(m_xHat, m_S);
 
     // Project each sigma point forward in time according to the
     // dynamics f(x, u)
@@ -271,9 +310,13 @@ class UnscentedKalmanFilter {
     //   sigmasF = 𝒳ₖ,ₖ₋₁ or just 𝒳 for readability
     //
     // equation (18)
-    for (int i = 0; i < m_pts.NumSigmas(); ++i) {
-      StateVector x = sigmas.template block<States, 1>(0, i);
-      m_sigmasF.template block<States, 1>(0, i) = RK4(m_f, x, u, dt);
+    if (m_batchF) {
+      m_sigmasF = RK4(m_batchF, sigmas, u, dt);
+    } else {
+      for (int i = 0; i < m_pts.NumSigmas(); ++i) {
+        StateVector x = sigmas.template block<States, 1>(0, i);
+        m_sigmasF.template block<States, 1>(0, i) = RK4(m_f, x, u, dt);
+      }
     }
 
     // Pass the predicted sigmas (𝒳) through the Unscented Transform
@@ -282,7 +325,7 @@ class UnscentedKalmanFilter {
     // equations (18) (19) and (20)
     auto [xHat, S] = SquareRootUnscentedTransform<States, States>(
         m_sigmasF, m_pts.Wm(), m_pts.Wc(), m_meanFuncX, m_residualFuncX,
-        discQ.template triangularView<Eigen::Lower>());
+        m_sqrtDiscQ.template triangularView<Eigen::Lower>());
     m_xHat = xHat;
     m_S = S;
   }
@@ -294,8 +337,15 @@ class UnscentedKalmanFilter {
    * @param y Measurement vector.
    */
   void Correct(const InputVector& u, const OutputVector& y) {
-    Correct<Outputs>(u, y, m_h, m_contR, m_meanFuncY, m_residualFuncY,
-                     m_residualFuncX, m_addFuncX);
+    // R is constant here, so its discretized square root only changes with dt
+    if (m_sqrtDiscRDt != m_dt) {
+      m_sqrtDiscR = DiscretizeR<Outputs>(m_contR, m_dt);
+      Eigen::internal::llt_inplace<double, Eigen::Lower>::blocked(m_sqrtDiscR);
+      m_sqrtDiscRDt = m_dt;
+    }
+
+    CorrectImpl<Outputs>(u, y, m_h, m_sqrtDiscR, m_meanFuncY, m_residualFuncY,
+                         m_residualFuncX, m_addFuncX);
   }
 
   /**
@@ -387,6 +437,75 @@ class UnscentedKalmanFilter {
     Matrixd<Rows, Rows> discR = DiscretizeR<Rows>(R, m_dt);
     Eigen::internal::llt_inplace<double, Eigen::Lower>::blocked(discR);
 
+    CorrectImpl<Rows>(u, y, h, discR, meanFuncY, residualFuncY, residualFuncX,
+                      addFuncX);
+  }
+
+ private:
+  std::function<StateVector(const StateVector&, const InputVector&)> m_f;
+  std::function<OutputVector(const StateVector&, const InputVector&)> m_h;
+  std::function<SigmaMatrix(const SigmaMatrix&, const InputVector&)> m_batchF;
+  std::function<StateVector(const Matrixd<States, 2 * States + 1>&,
+                            const Vectord<2 * States + 1>&)>
+      m_meanFuncX;
+  std::function<OutputVector(const Matrixd<Outputs, 2 * States + 1>&,
+                             const Vectord<2 * States + 1>&)>
+      m_meanFuncY;
+  std::function<StateVector(const StateVector&, const StateVector&)>
+      m_residualFuncX;
+  std::function<OutputVector(const OutputVector&, const OutputVector&)>
+      m_residualFuncY;
+  std::function<StateVector(const StateVector&, const StateVector&)> m_addFuncX;
+  StateVector m_xHat;
+  StateMatrix m_S;
+  StateMatrix m_contQ;
+  Matrixd<Outputs, Outputs> m_contR;
+  Matrixd<States, 2 * States + 1> m_sigmasF;
+  units::second_t m_dt;
+
+  // Lower Cholesky factors of the discretized noise covariances and the
+  // timesteps they were computed for
+  StateMatrix m_sqrtDiscQ;
+  units::second_t m_sqrtDiscQDt = -1_s;
+  bool m_cacheProcessNoise = false;
+  Matrixd<Outputs, Outputs> m_sqrtDiscR;
+  units::second_t m_sqrtDiscRDt = -1_s;
+
+  MerweScaledSigmaPoints<States> m_pts;
+
+  /**
+   * Correct the state estimate x-hat using the measurements in y and the
+   * square root of the discretized measurement noise covariance.
+   *
+   * @param u             Same control input used in the predict step.
+   * @param y             Measurement vector.
+   * @param h             A vector-valued function of x and u that returns the
+   *                      measurement vector.
+   * @param sqrtDiscR     Lower Cholesky factor of the discrete measurement
+   *                      noise covariance matrix.
+   * @param meanFuncY     A function that computes the mean of 2 * States + 1
+   *                      measurement vectors using a given set of weights.
+   * @param residualFuncY A function that computes the residual of two
+   *                      measurement vectors (i.e. it subtracts them.)
+   * @param residualFuncX A function that computes the residual of two state
+   *                      vectors (i.e. it subtracts them.)
+   * @param addFuncX      A function that adds two state vectors.
+   */
+  template <int Rows>
+  void CorrectImpl(
+      const InputVector& u, const Vectord<Rows>& y,
+      const std::function<Vectord<Rows>(const StateVector&,
+                                        const InputVector&)>& h,
+      const Matrixd<Rows, Rows>& sqrtDiscR,
+      const std::function<Vectord<Rows>(const Matrixd<Rows, 2 * States + 1>&,
+                                        const Vectord<2 * States + 1>&)>&
+          meanFuncY,
+      const std::function<Vectord<Rows>(const Vectord<Rows>&,
+                                        const Vectord<Rows>&)>& residualFuncY,
+      const std::function<StateVector(const StateVector&, const StateVector&)>&
+          residualFuncX,
+      const std::function<StateVector(const StateVector&, const StateVector&)>&
+          addFuncX) {
     // Generate new sigma points from the prior mean and covariance
     // and transform them into measurement space using h(x, u)
     //
@@ -411,7 +530,7 @@ class UnscentedKalmanFilter {
     // equations (23) (24) and (25)
     auto [yHat, Sy] = SquareRootUnscentedTransform<Rows, States>(
         sigmasH, m_pts.Wm(), m_pts.Wc(), meanFuncY, residualFuncY,
-        discR.template triangularView<Eigen::Lower>());
+        sqrtDiscR.template triangularView<Eigen::Lower>());
 
     // Compute cross covariance of the predicted state and measurement sigma
     // points given as:
@@ -467,29 +586,6 @@ class UnscentedKalmanFilter {
           m_S, U.template block<States, 1>(0, i), -1);
     }
   }
-
- private:
-  std::function<StateVector(const StateVector&, const InputVector&)> m_f;
-  std::function<OutputVector(const StateVector&, const InputVector&)> m_h;
-  std::function<StateVector(const Matrixd<States, 2 * States + 1>&,
-                            const Vectord<2 * States + 1>&)>
-      m_meanFuncX;
-  std::function<OutputVector(const Matrixd<Outputs, 2 * States + 1>&,
-                             const Vectord<2 * States + 1>&)>
-      m_meanFuncY;
-  std::function<StateVector(const StateVector&, const StateVector&)>
-      m_residualFuncX;
-  std::function<OutputVector(const OutputVector&, const OutputVector&)>
-      m_residualFuncY;
-  std::function<StateVector(const StateVector&, const StateVector&)> m_addFuncX;
-  StateVector m_xHat;
-  StateMatrix m_S;
-  StateMatrix m_contQ;
-  Matrixd<Outputs, Outputs> m_contR;
-  Matrixd<States, 2 * States + 1> m_sigmasF;
-  units::second_t m_dt;
-
-  MerweScaledSigmaPoints<States> m_pts;
 };
 
 extern template class EXPORT_TEMPLATE_DECLARE(WPILIB_DLLEXPORT)
@@ -4,18 +4,19 @@
 
 #pragma once
 
-#include <algorithm>
+#include <cstddef>
 #include <vector>
 
-#include <wpi/Algorithm.h>
-#include <wpi/circular_buffer.h>
-
 namespace frc {
 /**
  * A class that implements a moving-window median filter.  Useful for reducing
  * measurement noise, especially with processes that generate occasional,
  * extreme outliers (such as values from vision processing, LIDAR, or ultrasonic
  * sensors).
+ *
+ * The window is split between a max-heap holding the lower half of the values
+ * and a min-heap holding the upper half, so each call to Calculate() takes
+ * O(log n) time in the window size and doesn't allocate.
  */
 template <class T>
 class MedianFilter {
@@ -26,7 +27,10 @@ class MedianFilter {
    * @param size The number of samples in the moving window.
    */
   constexpr explicit MedianFilter(size_t size)
-      : m_valueBuffer(size), m_size{size} {}
+      : m_values(size), m_heapIndex(size), m_inLower(size), m_size{size} {
+    m_lower.reserve(size / 2 + 1);
+    m_upper.reserve(size / 2);
+  }
 
   /**
    * Calculates the moving-window median for the next value of the input stream.
@@ -35,30 +39,24 @@ class MedianFilter {
    * @return The median of the moving window, updated to include the next value.
    */
   constexpr T Calculate(T next) {
-    // Insert next value at proper point in sorted array
-    wpi::insert_sorted(m_orderedValues, next);
-
-    size_t curSize = m_orderedValues.size();
-
-    // If buffer is at max size, pop element off of end of circular buffer
-    // and remove from ordered list
-    if (curSize > m_size) {
-      m_orderedValues.erase(std::find(m_orderedValues.begin(),
-                                      m_orderedValues.end(),
-                                      m_valueBuffer.pop_back()));
-      --curSize;
-    }
+    // Window slots are overwritten oldest-first, so the slot being written
+    // holds the value leaving the window once the window is full
+    size_t slot = m_next;
+    m_next = (m_next + 1) % m_size;
+    m_values[slot] = next;
 
-    // Add next value to circular buffer
-    m_valueBuffer.push_front(next);
+    if (m_lower.size() + m_upper.size() < m_size) {
+      Insert(slot);
+    } else {
+      Replace(slot);
+    }
 
-    if (curSize % 2 != 0) {
-      // If size is odd, return middle element of sorted list
-      return m_orderedValues[curSize / 2];
+    if (m_lower.size() > m_upper.size()) {
+      // If size is odd, return middle element
+      return m_values[m_lower[0]];
     } else {
       // If size is even, return average of middle elements
-      return (m_orderedValues[curSize / 2 - 1] + m_orderedValues[curSize / 2]) /
-             2.0;
+      return (m_values[m_lower[0]] + m_values[m_upper[0]]) / 2.0;
     }
   }
 
@@ -67,19 +65,144 @@ class MedianFilter {
    *
    * @return The last value.
    */
-  constexpr T LastValue() const { return m_valueBuffer.front(); }
+  constexpr T LastValue() const {
+    return m_values[(m_next + m_size - 1) % m_size];
+  }
 
   /**
    * Resets the filter, clearing the window of all elements.
    */
   constexpr void Reset() {
-    m_orderedValues.clear();
-    m_valueBuffer.reset();
+    m_lower.clear();
+    m_upper.clear();
+    m_next = 0;
   }
 
  private:
-  wpi::circular_buffer<T> m_valueBuffer;
-  std::vector<T> m_orderedValues;
+  /**
+   * Returns true if slot a belongs above slot b in the given heap.
+   */
+  constexpr bool Before(bool lower, size_t a, size_t b) const {
+    return lower ? m_values[b] < m_values[a] : m_values[a] < m_values[b];
+  }
+
+  constexpr void Place(bool lower, size_t index, size_t slot) {
+    (lower ? m_lower : m_upper)[index] = slot;
+    m_heapIndex[slot] = index;
+    m_inLower[slot] = lower;
+  }
+
+  constexpr void SiftUp(bool lower, size_t index) {
+    auto& heap = lower ? m_lower : m_upper;
+    size_t slot = heap[index];
+    while (index > 0) {
+      size_t parent = (index - 1) / 2;
+      if (!Before(lower, slot, heap[parent])) {
+        break;
+      }
+      Place(lower, index, heap[parent]);
+      index = parent;
+    }
+    Place(lower, index, slot);
+  }
+
+  constexpr void SiftDown(bool lower, size_t index) {
+    auto& heap = lower ? m_lower : m_upper;
+    size_t slot = heap[index];
+    for (;;) {
+      size_t child = 2 * index + 1;
+      if (child >= heap.size()) {
+        break;
+      }
+      if (child + 1 < heap.size() &&
+          Before(lower, heap[child + 1], heap[child])) {
+        ++child;
+      }
+      if (!Before(lower, heap[child], slot)) {
+        break;
+      }
+      Place(lower, index, heap[child]);
+      index = child;
+    }
+    Place(lower, index, slot);
+  }
+
+  constexpr void Push(bool lower, size_t slot) {
+    auto& heap = lower ? m_lower : m_upper;
+    heap.push_back(slot);
+    Place(lower, heap.size() - 1, slot);
+    SiftUp(lower, heap.size() - 1);
+  }
+
+  constexpr size_t Pop(bool lower) {
+    auto& heap = lower ? m_lower : m_upper;
+    size_t top = heap[0];
+    heap[0] = heap.back();
+    heap.pop_back();
+    if (!heap.empty()) {
+      m_heapIndex[heap[0]] = 0;
+      SiftDown(lower, 0);
+    }
+    return top;
+  }
+
+  /**
+   * Adds a slot while the window is still filling up.
+   */
+  constexpr void Insert(size_t slot) {
+    if (m_lower.empty() || !(m_values[m_lower[0]] < m_values[slot])) {
+      Push(true, slot);
+    } else {
+      Push(false, slot);
+    }
+
+    // Rebalance so m_lower has as many elements as m_upper or one more
+    if (m_lower.size() > m_upper.size() + 1) {
+      Push(false, Pop(true));
+    } else if (m_upper.size() > m_lower.size()) {
+      Push(true, Pop(false));
+    }
+  }
+
+  /**
+   * Restores the heaps after the value in a slot has been overwritten.
+   */
+  constexpr void Replace(size_t slot) {
+    bool lower = m_inLower[slot];
+    SiftUp(lower, m_heapIndex[slot]);
+    SiftDown(lower, m_heapIndex[slot]);
+
+    // The new value may have crossed over the median. Only the top of the heap
+    // it's in can be out of order with the other heap, so swapping the two
+    // tops restores the ordering between the halves.
+    if (!m_upper.empty() && m_values[m_upper[0]] < m_values[m_lower[0]]) {
+      size_t top = m_lower[0];
+      Place(true, 0, m_upper[0]);
+      Place(false, 0, top);
+      SiftDown(true, 0);
+      SiftDown(false, 0);
+    }
+  }
+
+  // Values in the window, indexed by slot
+  std::vector<T> m_values;
+
+  // Index of each slot within the heap that holds it
+  std::vector<size_t> m_heapIndex;
+
+  // Whether each slot is in the lower or the upper heap
+  std::vector<bool> m_inLower;
+
+  // Max-heap of the slots holding the lower half of the window. Has one more
+  // element than m_upper when the window size is odd.
+  std::vector<size_t> m_lower;
+
+  // Min-heap of the slots holding the upper half of the window
+  std::vector<size_t> m_upper;
+
+  // Slot the next value will be written to
+  size_t m_next = 0;
+
   size_t m_size;
 };
 }  // namespace frc
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <functional>
 #include <optional>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -65,18 +66,19 @@ class TimeInterpolatableBuffer {
    */
   void AddSample(units::second_t time, T sample) {
     // Add the new state into the vector
-    if (m_pastSnapshots.size() == 0 || time > m_pastSnapshots.back().first) {
+    if (size() == 0 || time > m_pastSnapshots.back().first) {
       m_pastSnapshots.emplace_back(time, sample);
     } else {
+      auto first = m_pastSnapshots.begin() + m_first;
       auto first_after = std::upper_bound(
-          m_pastSnapshots.begin(), m_pastSnapshots.end(), time,
+          first, m_pastSnapshots.end(), time,
           [](auto t, const auto& pair) { return t < pair.first; });
 
-      if (first_after == m_pastSnapshots.begin()) {
+      if (first_after == first) {
         // All entries come after the sample
         m_pastSnapshots.insert(first_after, std::pair{time, sample});
       } else if (auto last_not_greater_than = first_after - 1;
-                 last_not_greater_than == m_pastSnapshots.begin() ||
+                 last_not_greater_than == first ||
                  last_not_greater_than->first < time) {
         // Some entries come before the sample, but none are recorded with the
         // same time
@@ -86,13 +88,24 @@ class TimeInterpolatableBuffer {
         last_not_greater_than->second = sample;
       }
     }
-    while (time - m_pastSnapshots[0].first > m_historySize) {
-      m_pastSnapshots.erase(m_pastSnapshots.begin());
+
+    // Evicting a sample only moves the start of the live window. The dead
+    // prefix is erased in one go once it's at least as large as the window,
+    // so each sample is moved a bounded number of times on average instead of
+    // shifting the whole window on every eviction.
+    while (time - m_pastSnapshots[m_first].first > m_historySize) {
+      ++m_first;
+    }
+    if (m_first >= kMinCompactSize && m_first >= size()) {
+      Compact();
     }
   }
 
   /** Clear all old samples. */
-  void Clear() { m_pastSnapshots.clear(); }
+  void Clear() {
+    m_pastSnapshots.clear();
+    m_first = 0;
+  }
 
   /**
    * Sample the buffer at the given time. If the buffer is empty, an empty
@@ -101,7 +114,8 @@ class TimeInterpolatableBuffer {
    * @param time The time at which to sample the buffer.
    */
   std::optional<T> Sample(units::second_t time) const {
-    if (m_pastSnapshots.empty()) {
+    auto snapshots = GetSamples();
+    if (snapshots.empty()) {
       return {};
     }
 
@@ -109,22 +123,22 @@ class TimeInterpolatableBuffer {
     // vector that has a timestamp that is equal to or greater than the vision
     // measurement timestamp.
 
-    if (time <= m_pastSnapshots.front().first) {
-      return m_pastSnapshots.front().second;
+    if (time <= snapshots.front().first) {
+      return snapshots.front().second;
     }
-    if (time > m_pastSnapshots.back().first) {
-      return m_pastSnapshots.back().second;
+    if (time > snapshots.back().first) {
+      return snapshots.back().second;
     }
-    if (m_pastSnapshots.size() < 2) {
-      return m_pastSnapshots[0].second;
+    if (snapshots.size() < 2) {
+      return snapshots[0].second;
     }
 
     // Get the iterator which has a key no less than the requested key.
     auto upper_bound = std::lower_bound(
-        m_pastSnapshots.begin(), m_pastSnapshots.end(), time,
+        snapshots.begin(), snapshots.end(), time,
         [](const auto& pair, auto t) { return t > pair.first; });
 
-    if (upper_bound == m_pastSnapshots.begin()) {
+    if (upper_bound == snapshots.begin()) {
       return upper_bound->second;
     }
 
@@ -139,22 +153,56 @@ class TimeInterpolatableBuffer {
   /**
    * Grant access to the internal sample buffer. Used in Pose Estimation to
    * replay odometry inputs stored within this buffer.
+   *
+   * Evicted samples are erased from the buffer first; use GetSamples() for
+   * read-only access without that cost.
    */
   std::vector<std::pair<units::second_t, T>>& GetInternalBuffer() {
+    Compact();
     return m_pastSnapshots;
   }
 
   /**
    * Grant access to the internal sample buffer.
+   *
+   * @deprecated Use GetSamples() instead.
    */
-  const std::vector<std::pair<units::second_t, T>>& GetInternalBuffer() const {
-    return m_pastSnapshots;
+  [[deprecated("Use GetSamples() instead.")]]
+  std::span<const std::pair<units::second_t, T>> GetInternalBuffer() const {
+    return GetSamples();
+  }
+
+  /**
+   * Returns the samples in the buffer, sorted by time.
+   *
+   * The returned span is invalidated by AddSample(), Clear() and
+   * GetInternalBuffer().
+   */
+  std::span<const std::pair<units::second_t, T>> GetSamples() const {
+    return std::span{m_pastSnapshots}.subspan(m_first);
   }
 
  private:
+  // Don't bother compacting until at least this many samples have been evicted
+  static constexpr size_t kMinCompactSize = 32;
+
   units::second_t m_historySize;
+
+  // Samples sorted by time. Only the samples starting at m_first are live; the
+  // ones before it have been evicted but not erased yet.
   std::vector<std::pair<units::second_t, T>> m_pastSnapshots;
+  size_t m_first = 0;
+
   std::function<T(const T&, const T&, double)> m_interpolatingFunc;
+
+  size_t size() const { return m_pastSnapshots.size() - m_first; }
+
+  // Erases the evicted samples
+  void Compact() {
+    m_pastSnapshots.erase(m_pastSnapshots.begin(),
+                          m_pastSnapshots.begin() + m_first);
+    m_first = 0;
+  }
 };
 
 // Template specializations to ensure that Pose2d and Pose3d use pose
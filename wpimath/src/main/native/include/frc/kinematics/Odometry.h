@@ -117,10 +117,36 @@ class WPILIB_DLLEXPORT Odometry {
    */
   const Pose2d& Update(const Rotation2d& gyroAngle,
                        const WheelPositions& wheelPositions) {
+    return UpdateWithTwist(
+        gyroAngle,
+        m_kinematics.ToTwist2d(m_previousWheelPositions, wheelPositions),
+        wheelPositions);
+  }
+
+ protected:
+  /**
+   * Returns the wheel positions from the last update.
+   */
+  const WheelPositions& GetPreviousWheelPositions() const {
+    return m_previousWheelPositions;
+  }
+
+  /**
+   * Updates the robot's position on the field with a twist already computed
+   * from the previous wheel positions to the given ones. This lets derived
+   * classes compute the twists of several updates at once.
+   *
+   * @param gyroAngle The angle reported by the gyroscope.
+   * @param twist The twist from the previous wheel positions to the current
+   * ones. Its dtheta is replaced using the gyro angle.
+   * @param wheelPositions The current distances measured by each wheel.
+   *
+   * @return The new pose of the robot.
+   */
+  const Pose2d& UpdateWithTwist(const Rotation2d& gyroAngle, Twist2d twist,
+                                const WheelPositions& wheelPositions) {
     auto angle = gyroAngle.RotateBy(m_gyroOffset);
 
-    auto twist =
-        m_kinematics.ToTwist2d(m_previousWheelPositions, wheelPositions);
     twist.dtheta = (angle - m_previousAngle).Radians();
 
     auto newPose = m_pose.Exp(twist);
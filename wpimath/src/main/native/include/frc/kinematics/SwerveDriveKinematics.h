@@ -5,8 +5,11 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <concepts>
 #include <cstddef>
+#include <span>
+#include <vector>
 
 #include <Eigen/QR>
 #include <wpi/SymbolExports.h>
@@ -43,7 +46,8 @@ namespace frc {
  *
  * The inverse kinematics: [moduleStates] = [moduleLocations] * [chassisSpeeds]
  * We take the Moore-Penrose pseudoinverse of [moduleLocations] and then
- * multiply by [moduleStates] to get our chassis speeds.
+ * multiply by [moduleStates] to get our chassis speeds. The pseudoinverse only
+ * depends on the module locations, so it's computed once at construction.
  *
  * Forward kinematics is also used for odometry -- determining the position of
  * the robot on the field using encoders and a gyro.
@@ -53,6 +57,41 @@ class SwerveDriveKinematics
     : public Kinematics<wpi::array<SwerveModuleState, NumModules>,
                         wpi::array<SwerveModulePosition, NumModules>> {
  public:
+  /**
+   * Module states for a batch of chassis speeds, stored as one contiguous
+   * array per module and component. Entry j of each array belongs to the j-th
+   * chassis speeds of the batch.
+   */
+  struct ModuleStateBatch {
+    /// Each module's speed in meters per second.
+    std::array<std::vector<double>, NumModules> speeds;
+
+    /// Cosine of each module's angle.
+    std::array<std::vector<double>, NumModules> cos;
+
+    /// Sine of each module's angle.
+    std::array<std::vector<double>, NumModules> sin;
+
+    /**
+     * Returns the number of entries in the batch.
+     */
+    size_t size() const { return speeds[0].size(); }
+
+    /**
+     * Returns the module states of one entry of the batch.
+     *
+     * @param index The index of the entry.
+     */
+    wpi::array<SwerveModuleState, NumModules> operator[](size_t index) const {
+      wpi::array<SwerveModuleState, NumModules> states(wpi::empty_array);
+      for (size_t i = 0; i < NumModules; ++i) {
+        states[i] = {units::meters_per_second_t{speeds[i][index]},
+                     Rotation2d{cos[i][index], sin[i][index]}};
+      }
+      return states;
+    }
+  };
+
   /**
    * Constructs a swerve drive kinematics object. This takes in a variable
    * number of module locations as Translation2ds. The order in which you pass
@@ -76,7 +115,8 @@ class SwerveDriveKinematics
       // clang-format on
     }
 
-    m_forwardKinematics = m_inverseKinematics.householderQr();
+    m_forwardKinematics = m_inverseKinematics.householderQr().solve(
+        Matrixd<NumModules * 2, NumModules * 2>::Identity());
 
     wpi::math::MathSharedStore::ReportUsage(
         wpi::math::MathUsageId::kKinematics_SwerveDrive, 1);
@@ -93,7 +133,8 @@ class SwerveDriveKinematics
       // clang-format on
     }
 
-    m_forwardKinematics = m_inverseKinematics.householderQr();
+    m_forwardKinematics = m_inverseKinematics.householderQr().solve(
+        Matrixd<NumModules * 2, NumModules * 2>::Identity());
 
     wpi::math::MathSharedStore::ReportUsage(
         wpi::math::MathUsageId::kKinematics_SwerveDrive, 1);
@@ -253,7 +294,7 @@ class SwerveDriveKinematics
     }
 
     Eigen::Vector3d chassisSpeedsVector =
-        m_forwardKinematics.solve(moduleStateMatrix);
+        m_forwardKinematics * moduleStateMatrix;
 
     return {units::meters_per_second_t{chassisSpeedsVector(0)},
             units::meters_per_second_t{chassisSpeedsVector(1)},
@@ -306,7 +347,7 @@ class SwerveDriveKinematics
     }
 
     Eigen::Vector3d chassisDeltaVector =
-        m_forwardKinematics.solve(moduleDeltaMatrix);
+        m_forwardKinematics * moduleDeltaMatrix;
 
     return {units::meter_t{chassisDeltaVector(0)},
             units::meter_t{chassisDeltaVector(1)},
@@ -324,6 +365,154 @@ class SwerveDriveKinematics
     return ToTwist2d(result);
   }
 
+  /**
+   * Performs inverse kinematics for a batch of chassis speeds. This is
+   * equivalent to calling ToSwerveModuleStates(const ChassisSpeeds&, const
+   * Translation2d&) on each entry in order, including how the module headings
+   * are kept for stationary modules, but computes the whole batch with one
+   * matrix product.
+   *
+   * @param chassisSpeeds The desired chassis speeds.
+   * @param centerOfRotation The center of rotation.
+   * @return The module states of each entry.
+   */
+  ModuleStateBatch ToSwerveModuleStates(
+      std::span<const ChassisSpeeds> chassisSpeeds,
+      const Translation2d& centerOfRotation = Translation2d{}) const {
+    const auto size = static_cast<Eigen::Index>(chassisSpeeds.size());
+
+    Matrixd<NumModules * 2, 3> inverseKinematics;
+    for (size_t i = 0; i < NumModules; i++) {
+      // clang-format off
+      inverseKinematics.template block<2, 3>(i * 2, 0) <<
+        1, 0, (-m_modules[i].Y() + centerOfRotation.Y()).value(),
+        0, 1, (+m_modules[i].X() - centerOfRotation.X()).value();
+      // clang-format on
+    }
+
+    Eigen::Matrix<double, 3, Eigen::Dynamic, Eigen::RowMajor> speedMatrix{
+        3, size};
+    for (Eigen::Index j = 0; j < size; ++j) {
+      speedMatrix.col(j) << chassisSpeeds[j].vx.value(),
+          chassisSpeeds[j].vy.value(), chassisSpeeds[j].omega.value();
+    }
+    BatchMatrix moduleVelocities = inverseKinematics * speedMatrix;
+
+    ModuleStateBatch batch;
+    for (size_t i = 0; i < NumModules; ++i) {
+      batch.speeds[i].resize(size);
+      batch.cos[i].resize(size);
+      batch.sin[i].resize(size);
+      RowMap speeds{batch.speeds[i].data(), size};
+      RowMap cos{batch.cos[i].data(), size};
+      RowMap sin{batch.sin[i].data(), size};
+
+      auto x = moduleVelocities.row(i * 2).array();
+      auto y = moduleVelocities.row(i * 2 + 1).array();
+      speeds = (x.square() + y.square()).sqrt();
+      cos = x / speeds;
+      sin = y / speeds;
+
+      // Stationary modules keep the heading of the previous entry
+      bool moved = false;
+      double prevCos = m_moduleHeadings[i].Cos();
+      double prevSin = m_moduleHeadings[i].Sin();
+      for (Eigen::Index j = 0; j < size; ++j) {
+        if (speeds(j) > 1e-6) {
+          prevCos = cos(j);
+          prevSin = sin(j);
+          moved = true;
+        } else {
+          cos(j) = prevCos;
+          sin(j) = prevSin;
+        }
+      }
+      if (moved) {
+        m_moduleHeadings[i] = Rotation2d{prevCos, prevSin};
+      }
+    }
+
+    return batch;
+  }
+
+  /**
+   * Performs forward kinematics for a batch of module states.
+   *
+   * @param moduleStates The module states of each entry.
+   * @return The resulting chassis speeds of each entry.
+   */
+  std::vector<ChassisSpeeds> ToChassisSpeeds(
+      const ModuleStateBatch& moduleStates) const {
+    const auto size = static_cast<Eigen::Index>(moduleStates.size());
+
+    // Accumulate each module's contribution to the chassis speeds, one
+    // contiguous row at a time
+    Eigen::Array<double, 3, Eigen::Dynamic, Eigen::RowMajor> speedMatrix =
+        Eigen::Array<double, 3, Eigen::Dynamic, Eigen::RowMajor>::Zero(3,
+                                                                       size);
+    for (size_t i = 0; i < NumModules; ++i) {
+      ConstRowMap speeds{moduleStates.speeds[i].data(), size};
+      ConstRowMap cos{moduleStates.cos[i].data(), size};
+      ConstRowMap sin{moduleStates.sin[i].data(), size};
+      for (int k = 0; k < 3; ++k) {
+        speedMatrix.row(k) += speeds * (m_forwardKinematics(k, i * 2) * cos +
+                                        m_forwardKinematics(k, i * 2 + 1) * sin);
+      }
+    }
+
+    std::vector<ChassisSpeeds> chassisSpeeds;
+    chassisSpeeds.reserve(size);
+    for (Eigen::Index j = 0; j < size; ++j) {
+      chassisSpeeds.push_back(
+          {units::meters_per_second_t{speedMatrix(0, j)},
+           units::meters_per_second_t{speedMatrix(1, j)},
+           units::radians_per_second_t{speedMatrix(2, j)}});
+    }
+    return chassisSpeeds;
+  }
+
+  /**
+   * Performs forward kinematics for a sequence of module positions, such as a
+   * log of odometry measurements. Twist j is the motion from positions[j - 1]
+   * to positions[j], where positions[-1] is start. This is equivalent to
+   * calling ToTwist2d(start, end) for each consecutive pair, but computes all
+   * twists with one matrix product.
+   *
+   * @param start The module positions before the first entry.
+   * @param positions The module positions of each entry.
+   * @return The twist of each entry.
+   */
+  std::vector<Twist2d> ToTwist2d(
+      const wpi::array<SwerveModulePosition, NumModules>& start,
+      std::span<const wpi::array<SwerveModulePosition, NumModules>> positions)
+      const {
+    const auto size = static_cast<Eigen::Index>(positions.size());
+
+    BatchMatrix moduleDeltas{NumModules * 2, size};
+    const auto* previous = &start;
+    for (Eigen::Index j = 0; j < size; ++j) {
+      for (size_t i = 0; i < NumModules; ++i) {
+        const auto& module = positions[j][i];
+        double distance = (module.distance - (*previous)[i].distance).value();
+        moduleDeltas(i * 2, j) = distance * module.angle.Cos();
+        moduleDeltas(i * 2 + 1, j) = distance * module.angle.Sin();
+      }
+      previous = &positions[j];
+    }
+
+    Eigen::Matrix<double, 3, Eigen::Dynamic, Eigen::RowMajor> deltaMatrix =
+        m_forwardKinematics * moduleDeltas;
+
+    std::vector<Twist2d> twists;
+    twists.reserve(size);
+    for (Eigen::Index j = 0; j < size; ++j) {
+      twists.push_back({units::meter_t{deltaMatrix(0, j)},
+                        units::meter_t{deltaMatrix(1, j)},
+                        units::radian_t{deltaMatrix(2, j)}});
+    }
+    return twists;
+  }
+
   /**
    * Renormalizes the wheel speeds if any individual speed is above the
    * specified maximum.
@@ -444,9 +633,18 @@ class SwerveDriveKinematics
   }
 
  private:
+  // Module velocities or deltas of a batch, one row per module component so
+  // that each row is contiguous
+  using BatchMatrix =
+      Eigen::Matrix<double, NumModules * 2, Eigen::Dynamic, Eigen::RowMajor>;
+  using RowMap = Eigen::Map<Eigen::Array<double, 1, Eigen::Dynamic>>;
+  using ConstRowMap =
+      Eigen::Map<const Eigen::Array<double, 1, Eigen::Dynamic>>;
+
   wpi::array<Translation2d, NumModules> m_modules;
   mutable Matrixd<NumModules * 2, 3> m_inverseKinematics;
-  Eigen::HouseholderQR<Matrixd<NumModules * 2, 3>> m_forwardKinematics;
+  // Pseudoinverse of the inverse kinematics about the robot's center
+  Matrixd<3, NumModules * 2> m_forwardKinematics;
   mutable wpi::array<Rotation2d, NumModules> m_moduleHeadings;
 
   mutable Translation2d m_previousCoR;
@@ -6,7 +6,10 @@
 
 #include <cstddef>
 #include <ctime>
+#include <span>
+#include <stdexcept>
 
+#include <fmt/format.h>
 #include <wpi/SymbolExports.h>
 #include <wpi/timestamp.h>
 
@@ -52,6 +55,41 @@ class SwerveDriveOdometry
         wpi::math::MathUsageId::kOdometry_SwerveDrive, 1);
   }
 
+  using SwerveDriveOdometry::Odometry::Update;
+
+  /**
+   * Updates the robot's position on the field with a sequence of
+   * measurements, such as samples buffered by a high-frequency odometry
+   * thread. This is equivalent to calling Update(const Rotation2d&, const
+   * wpi::array<SwerveModulePosition, NumModules>&) with each measurement in
+   * order, but computes the forward kinematics of all measurements at once.
+   *
+   * @param gyroAngles The angle reported by the gyroscope for each
+   * measurement.
+   * @param modulePositions The module positions of each measurement. Must be
+   * the same length as gyroAngles.
+   *
+   * @return The new pose of the robot.
+   * @throws std::invalid_argument if gyroAngles and modulePositions have
+   * different lengths.
+   */
+  const Pose2d& Update(
+      std::span<const Rotation2d> gyroAngles,
+      std::span<const wpi::array<SwerveModulePosition, NumModules>>
+          modulePositions) {
+    if (gyroAngles.size() != modulePositions.size()) {
+      throw std::invalid_argument(fmt::format(
+          "Got {} gyro angles but {} sets of module positions",
+          gyroAngles.size(), modulePositions.size()));
+    }
+    auto twists = m_kinematicsImpl.ToTwist2d(this->GetPreviousWheelPositions(),
+                                             modulePositions);
+    for (size_t i = 0; i < twists.size(); ++i) {
+      this->UpdateWithTwist(gyroAngles[i], twists[i], modulePositions[i]);
+    }
+    return this->GetPose();
+  }
+
  private:
   SwerveDriveKinematics<NumModules> m_kinematicsImpl;
 };
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -151,27 +153,138 @@ class WPILIB_DLLEXPORT Trajectory {
       return m_states.back();
     }
 
-    // Use binary search to get the element with a timestamp no less than the
-    // requested timestamp. This starts at 1 because we use the previous state
-    // later on for interpolation.
-    auto sample =
-        std::lower_bound(m_states.cbegin() + 1, m_states.cend(), t,
-                         [](const auto& a, const auto& b) { return a.t < b; });
+    return SampleBefore(FindState(t), t);
+  }
 
-    auto prevSample = sample - 1;
+  /**
+   * Sample the trajectory at each of the given points in time.
+   *
+   * Sorted times are sampled in amortized constant time each, as with
+   * Sampler.
+   *
+   * @param times The points in time since the beginning of the trajectory to
+   *              sample.
+   * @return The state at each point in time.
+   * @throws std::runtime_error if the trajectory has no states.
+   */
+  std::vector<State> Sample(std::span<const units::second_t> times) const {
+    std::vector<State> states;
+    states.reserve(times.size());
+    Sampler sampler{*this};
+    for (auto t : times) {
+      states.emplace_back(sampler.Sample(t));
+    }
+    return states;
+  }
 
-    // The sample's timestamp is now greater than or equal to the requested
-    // timestamp. If it is greater, we need to interpolate between the
-    // previous state and the current state to get the exact state that we
-    // want.
+  /**
+   * Samples a trajectory at increasing points in time, such as once per loop
+   * while following it.
+   *
+   * Each sample picks up the search for the surrounding states where the
+   * previous one left off, so sampling at increasing times takes amortized
+   * constant time instead of a binary search over all states. Sampling at an
+   * earlier time than the previous sample falls back to a binary search. The
+   * results are the same as Trajectory::Sample().
+   *
+   * The sampler refers to the trajectory, which must outlive it.
+   */
+  class Sampler {
+   public:
+    /**
+     * Constructs a sampler that isn't associated with a trajectory. It must be
+     * assigned a sampler for a trajectory before it's used.
+     */
+    Sampler() = default;
 
-    // If the difference in states is negligible, then we are spot on!
-    if (units::math::abs(sample->t - prevSample->t) < 1E-9_s) {
-      return *sample;
+    /**
+     * Constructs a sampler for the given trajectory.
+     *
+     * @param trajectory The trajectory to sample.
+     */
+    explicit Sampler(const Trajectory& trajectory)
+        : m_trajectory{&trajectory} {}
+
+    /**
+     * Sample the trajectory at a point in time.
+     *
+     * @param t The point in time since the beginning of the trajectory to
+     *          sample.
+     * @return The state at that point in time.
+     * @throws std::runtime_error if the trajectory has no states.
+     */
+    State Sample(units::second_t t) {
+      const auto& states = m_trajectory->m_states;
+      if (states.empty()) {
+        throw std::runtime_error(
+            "Trajectory cannot be sampled if it has no states.");
+      }
+
+      if (t <= states.front().t) {
+        return states.front();
+      }
+      if (t >= m_trajectory->m_totalTime) {
+        return states.back();
+      }
+
+      if (m_index >= states.size() || states[m_index - 1].t >= t) {
+        // Time went backwards, or the trajectory changed size
+        m_index = m_trajectory->FindState(t);
+      } else {
+        while (states[m_index].t < t) {
+          ++m_index;
+        }
+      }
+
+      return m_trajectory->SampleBefore(m_index, t);
     }
-    // Interpolate between the two states for the state that we want.
-    return prevSample->Interpolate(
-        *sample, (t - prevSample->t) / (sample->t - prevSample->t));
+
+   private:
+    const Trajectory* m_trajectory = nullptr;
+
+    // Index of the state found by the last sample
+    size_t m_index = 1;
+  };
+
+  /**
+   * Returns a copy of this trajectory resampled at a fixed period, starting at
+   * its first state and ending at its last.
+   *
+   * Sampling the resampled trajectory finds the surrounding states by index
+   * arithmetic instead of a binary search. Its states lie on this trajectory,
+   * but between them it's interpolated with constant acceleration, which only
+   * approximates this trajectory where a period spans more than one of its
+   * states.
+   *
+   * @param period The time between resampled states.
+   * @return The resampled trajectory.
+   * @throws std::invalid_argument if the period isn't positive.
+   * @throws std::runtime_error if the trajectory has no states.
+   */
+  Trajectory Resample(units::second_t period) const {
+    if (!(period > 0_s)) {
+      throw std::invalid_argument(
+          "Trajectory resampling period must be positive.");
+    }
+
+    if (m_states.empty()) {
+      throw std::runtime_error(
+          "Trajectory cannot be sampled if it has no states.");
+    }
+
+    Sampler sampler{*this};
+    std::vector<State> states;
+    const auto start = m_states.front().t;
+    for (size_t i = 0; start + static_cast<double>(i) * period < m_totalTime;
+         ++i) {
+      states.emplace_back(
+          sampler.Sample(start + static_cast<double>(i) * period));
+    }
+    states.emplace_back(m_states.back());
+
+    Trajectory trajectory{states};
+    trajectory.m_period = period;
+    return trajectory;
   }
 
   /**
@@ -198,7 +311,9 @@ class WPILIB_DLLEXPORT Trajectory {
       state.pose = newFirstPose + (state.pose - firstPose);
     }
 
-    return Trajectory(newStates);
+    Trajectory trajectory{newStates};
+    trajectory.m_period = m_period;
+    return trajectory;
   }
 
   /**
@@ -215,7 +330,10 @@ class WPILIB_DLLEXPORT Trajectory {
     for (auto& state : newStates) {
       state.pose = state.pose.RelativeTo(pose);
     }
-    return Trajectory(newStates);
+
+    Trajectory trajectory{newStates};
+    trajectory.m_period = m_period;
+    return trajectory;
   }
 
   /**
@@ -257,11 +375,68 @@ class WPILIB_DLLEXPORT Trajectory {
   /**
    * Checks equality between this Trajectory and another object.
    */
-  bool operator==(const Trajectory&) const = default;
+  bool operator==(const Trajectory& other) const {
+    return m_states == other.m_states;
+  }
 
  private:
   std::vector<State> m_states;
   units::second_t m_totalTime = 0_s;
+
+  // Time between states if this trajectory was resampled, zero otherwise
+  units::second_t m_period = 0_s;
+
+  /**
+   * Returns the index of the first state at or after the given time, which
+   * must be after the first state and before the last.
+   */
+  size_t FindState(units::second_t t) const {
+    if (m_period > 0_s) {
+      // Estimate the index from the period, then correct it for rounding so it
+      // matches the binary search exactly
+      size_t index = std::clamp<size_t>(
+          static_cast<size_t>(
+              std::ceil(((t - m_states.front().t) / m_period).value())),
+          1, m_states.size() - 1);
+      while (index > 1 && m_states[index - 1].t >= t) {
+        --index;
+      }
+      while (m_states[index].t < t) {
+        ++index;
+      }
+      return index;
+    }
+
+    // Use binary search to get the element with a timestamp no less than the
+    // requested timestamp. This starts at 1 because we use the previous state
+    // later on for interpolation.
+    return std::lower_bound(
+               m_states.cbegin() + 1, m_states.cend(), t,
+               [](const auto& a, const auto& b) { return a.t < b; }) -
+           m_states.cbegin();
+  }
+
+  /**
+   * Interpolates the state at the given time between the state at the given
+   * index and the one before it.
+   */
+  State SampleBefore(size_t index, units::second_t t) const {
+    const auto& sample = m_states[index];
+    const auto& prevSample = m_states[index - 1];
+
+    // The sample's timestamp is now greater than or equal to the requested
+    // timestamp. If it is greater, we need to interpolate between the
+    // previous state and the current state to get the exact state that we
+    // want.
+
+    // If the difference in states is negligible, then we are spot on!
+    if (units::math::abs(sample.t - prevSample.t) < 1E-9_s) {
+      return sample;
+    }
+    // Interpolate between the two states for the state that we want.
+    return prevSample.Interpolate(
+        sample, (t - prevSample.t) / (sample.t - prevSample.t));
+  }
 };
 
 WPILIB_DLLEXPORT
@@ -122,6 +122,8 @@ class WPILIB_DLLEXPORT TrajectoryGenerator {
   static void SetErrorHandler(std::function<void(const char*)> func);
 
  private:
+  friend class TrajectoryGeneratorService;
+
   static void ReportError(const char* error);
 
   static const Trajectory kDoNothingTrajectory;
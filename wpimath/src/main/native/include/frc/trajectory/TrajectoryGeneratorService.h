@@ -0,0 +1,166 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <wpi/SymbolExports.h>
+#include <wpi/condition_variable.h>
+#include <wpi/mutex.h>
+
+#include "frc/geometry/Pose2d.h"
+#include "frc/geometry/Translation2d.h"
+#include "frc/spline/SplineParameterizer.h"
+#include "frc/trajectory/Trajectory.h"
+#include "frc/trajectory/TrajectoryConfig.h"
+
+namespace frc {
+
+/**
+ * Generates trajectories on a set of background threads.
+ *
+ * This produces the same trajectories as TrajectoryGenerator, but
+ * GenerateAsync() returns immediately, so paths can be generated (for example
+ * when an autonomous routine is selected) without stalling the robot loop.
+ * The splines of each path are parameterized in parallel, and several paths
+ * can be in flight at once.
+ *
+ * The parameterized spline points of each path are cached, keyed by the
+ * waypoints and whether the path is reversed. Generating the same path again,
+ * even with different velocity or acceleration limits or constraints, only
+ * repeats the time parameterization. Constraints are arbitrary user objects
+ * which can't be compared, so the time parameterization itself isn't cached.
+ * The cache holds a limited number of paths; the least recently used path is
+ * evicted when it is full.
+ */
+class WPILIB_DLLEXPORT TrajectoryGeneratorService {
+ public:
+  /**
+   * Creates a trajectory generator service.
+   *
+   * @param numThreads Number of background threads. Zero uses one thread per
+   *                   hardware thread.
+   * @param maxCacheSize Maximum number of paths whose spline points are
+   *                     cached. Zero disables caching.
+   */
+  explicit TrajectoryGeneratorService(int numThreads = 0,
+                                      size_t maxCacheSize = 32);
+
+  /**
+   * Finishes generating any pending trajectories, then stops the background
+   * threads.
+   */
+  ~TrajectoryGeneratorService();
+
+  TrajectoryGeneratorService(const TrajectoryGeneratorService&) = delete;
+  TrajectoryGeneratorService& operator=(const TrajectoryGeneratorService&) =
+      delete;
+
+  /**
+   * Starts generating a trajectory from the given waypoints, using quintic
+   * splines as TrajectoryGenerator::GenerateTrajectory(const
+   * std::vector<Pose2d>&, const TrajectoryConfig&) does.
+   *
+   * @param waypoints A vector of points that the trajectory must go through.
+   * @param config The configuration for the trajectory.
+   * @return A future for the generated trajectory.
+   */
+  std::future<Trajectory> GenerateAsync(std::vector<Pose2d> waypoints,
+                                        TrajectoryConfig config);
+
+  /**
+   * Starts generating a trajectory from the given waypoints, using clamped
+   * cubic splines as TrajectoryGenerator::GenerateTrajectory(const Pose2d&,
+   * const std::vector<Translation2d>&, const Pose2d&, const TrajectoryConfig&)
+   * does.
+   *
+   * @param start The starting waypoint.
+   * @param interiorWaypoints The interior waypoints.
+   * @param end The ending waypoint.
+   * @param config The configuration for the trajectory.
+   * @return A future for the generated trajectory.
+   */
+  std::future<Trajectory> GenerateAsync(
+      const Pose2d& start, std::vector<Translation2d> interiorWaypoints,
+      const Pose2d& end, TrajectoryConfig config);
+
+  /**
+   * Generates a trajectory from the given waypoints, using quintic splines,
+   * and waits for it.
+   *
+   * @param waypoints A vector of points that the trajectory must go through.
+   * @param config The configuration for the trajectory.
+   * @return The generated trajectory.
+   */
+  Trajectory Generate(std::vector<Pose2d> waypoints, TrajectoryConfig config) {
+    return GenerateAsync(std::move(waypoints), std::move(config)).get();
+  }
+
+  /**
+   * Removes all cached spline points.
+   */
+  void ClearCache();
+
+  /**
+   * Returns the number of paths whose spline points are cached.
+   *
+   * @return The number of cached paths.
+   */
+  size_t GetCacheSize() const;
+
+  /**
+   * Returns the number of trajectories that were generated from cached spline
+   * points.
+   *
+   * @return The number of cache hits.
+   */
+  size_t GetCacheHits() const;
+
+ private:
+  using PoseWithCurvature = SplineParameterizer::PoseWithCurvature;
+  using Points = std::vector<PoseWithCurvature>;
+
+  struct KeyHash {
+    size_t operator()(const std::vector<double>& key) const;
+  };
+
+  struct Job;
+
+  std::future<Trajectory> Submit(std::shared_ptr<Job> job);
+  void StartParameterizing(std::shared_ptr<Job> job);
+  void Finish(Job& job, std::shared_ptr<const Points> points);
+  void AddToCache(const std::vector<double>& key,
+                  std::shared_ptr<const Points> points);
+  void Post(std::function<void()> task);
+  void WorkerMain();
+
+  using CacheList =
+      std::list<std::pair<std::vector<double>, std::shared_ptr<const Points>>>;
+
+  mutable wpi::mutex m_cacheMutex;
+  size_t m_maxCacheSize;
+  size_t m_cacheHits = 0;
+  // Most recently used first
+  CacheList m_cacheList;
+  std::unordered_map<std::vector<double>, CacheList::iterator, KeyHash>
+      m_cache;
+
+  wpi::mutex m_mutex;
+  wpi::condition_variable m_cv;
+  std::deque<std::function<void()>> m_tasks;
+  bool m_shutdown = false;
+
+  std::vector<std::thread> m_workers;
+};
+
+}  // namespace frc
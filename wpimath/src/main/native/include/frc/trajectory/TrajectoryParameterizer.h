@@ -29,6 +29,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -93,14 +94,16 @@ class WPILIB_DLLEXPORT TrajectoryParameterizer {
    * is used when time parameterizing a trajectory.
    *
    * @param reverse Whether the robot is traveling backwards.
-   * @param constraints A vector of the user-defined velocity and acceleration
-   * constraints.
+   * @param bounds The acceleration bounds at this state from the constraints
+   * that were evaluated over the whole trajectory up front.
+   * @param constraints The remaining constraints, which are evaluated at the
+   * state's current velocity.
    * @param state Pointer to the constrained state that we are operating on.
    * This is mutated in place.
    */
   static void EnforceAccelerationLimits(
-      bool reverse,
-      const std::vector<std::unique_ptr<TrajectoryConstraint>>& constraints,
+      bool reverse, const TrajectoryConstraint::MinMax& bounds,
+      std::span<const TrajectoryConstraint* const> constraints,
       ConstrainedState* state);
 };
 }  // namespace frc
@@ -55,6 +55,23 @@ class WPILIB_DLLEXPORT CentripetalAccelerationConstraint
     return {};
   }
 
+  constexpr bool LimitMaxVelocities(
+      const PointBatch& points,
+      std::span<units::meters_per_second_t> maxVelocities) const override {
+    for (size_t i = 0; i < maxVelocities.size(); ++i) {
+      maxVelocities[i] = units::math::min(
+          maxVelocities[i],
+          units::math::sqrt(m_maxCentripetalAcceleration /
+                            units::math::abs(points.curvatures[i]) * 1_rad));
+    }
+    return true;
+  }
+
+  constexpr bool LimitAccelerations(const PointBatch& points,
+                                    std::span<MinMax> bounds) const override {
+    return true;
+  }
+
  private:
   units::meters_per_second_squared_t m_maxCentripetalAcceleration;
 };
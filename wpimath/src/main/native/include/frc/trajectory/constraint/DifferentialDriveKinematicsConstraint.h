@@ -43,6 +43,26 @@ class WPILIB_DLLEXPORT DifferentialDriveKinematicsConstraint
     return {};
   }
 
+  constexpr bool LimitMaxVelocities(
+      const PointBatch& points,
+      std::span<units::meters_per_second_t> maxVelocities) const override {
+    // The outer wheel is the fastest at v(1 + T/2 |k|), so desaturating it to
+    // the max speed caps the chassis velocity at maxSpeed / (1 + T/2 |k|).
+    for (size_t i = 0; i < maxVelocities.size(); ++i) {
+      maxVelocities[i] = units::math::min(
+          maxVelocities[i],
+          m_maxSpeed / (1.0 + m_kinematics.trackWidth / 2 *
+                                  units::math::abs(points.curvatures[i]) /
+                                  1_rad));
+    }
+    return true;
+  }
+
+  constexpr bool LimitAccelerations(const PointBatch& points,
+                                    std::span<MinMax> bounds) const override {
+    return true;
+  }
+
  private:
   DifferentialDriveKinematics m_kinematics;
   units::meters_per_second_t m_maxSpeed;
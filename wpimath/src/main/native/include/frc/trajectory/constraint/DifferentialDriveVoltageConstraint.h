@@ -51,6 +51,12 @@ class WPILIB_DLLEXPORT DifferentialDriveVoltageConstraint
     return units::meters_per_second_t{std::numeric_limits<double>::max()};
   }
 
+  constexpr bool LimitMaxVelocities(
+      const PointBatch& points,
+      std::span<units::meters_per_second_t> maxVelocities) const override {
+    return true;
+  }
+
   constexpr MinMax MinMaxAcceleration(
       const Pose2d& pose, units::curvature_t curvature,
       units::meters_per_second_t speed) const override {
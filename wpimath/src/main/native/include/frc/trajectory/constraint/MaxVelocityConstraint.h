@@ -40,6 +40,20 @@ class WPILIB_DLLEXPORT MaxVelocityConstraint : public TrajectoryConstraint {
     return {};
   }
 
+  constexpr bool LimitMaxVelocities(
+      const PointBatch& points,
+      std::span<units::meters_per_second_t> maxVelocities) const override {
+    for (auto& maxVelocity : maxVelocities) {
+      maxVelocity = units::math::min(maxVelocity, m_maxVelocity);
+    }
+    return true;
+  }
+
+  constexpr bool LimitAccelerations(const PointBatch& points,
+                                    std::span<MinMax> bounds) const override {
+    return true;
+  }
+
  private:
   units::meters_per_second_t m_maxVelocity;
 };
@@ -46,6 +46,11 @@ class WPILIB_DLLEXPORT MecanumDriveKinematicsConstraint
     return {};
   }
 
+  bool LimitAccelerations(const PointBatch& points,
+                          std::span<MinMax> bounds) const override {
+    return true;
+  }
+
  private:
   MecanumDriveKinematics m_kinematics;
   units::meters_per_second_t m_maxSpeed;
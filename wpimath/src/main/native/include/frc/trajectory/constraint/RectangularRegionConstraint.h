@@ -6,6 +6,7 @@
 
 #include <concepts>
 #include <limits>
+#include <vector>
 
 #include "frc/geometry/Rectangle2d.h"
 #include "frc/geometry/Translation2d.h"
@@ -68,6 +69,47 @@ class RectangularRegionConstraint : public TrajectoryConstraint {
     }
   }
 
+  constexpr bool LimitMaxVelocities(
+      const PointBatch& points,
+      std::span<units::meters_per_second_t> maxVelocities) const override {
+    // Evaluate the wrapped constraint everywhere, then only keep its limits at
+    // points inside the region
+    std::vector<units::meters_per_second_t> limits(
+        maxVelocities.size(),
+        units::meters_per_second_t{std::numeric_limits<double>::infinity()});
+    if (!m_constraint.LimitMaxVelocities(points, limits)) {
+      return false;
+    }
+    for (size_t i = 0; i < maxVelocities.size(); ++i) {
+      // The containment check is the expensive part, so skip it where the
+      // limit wouldn't change anything
+      if (limits[i] < maxVelocities[i] &&
+          m_rectangle.Contains(points.poses[i].Translation())) {
+        maxVelocities[i] = limits[i];
+      }
+    }
+    return true;
+  }
+
+  constexpr bool LimitAccelerations(const PointBatch& points,
+                                    std::span<MinMax> bounds) const override {
+    std::vector<MinMax> limits(bounds.size());
+    if (!m_constraint.LimitAccelerations(points, limits)) {
+      return false;
+    }
+    for (size_t i = 0; i < bounds.size(); ++i) {
+      if ((limits[i].minAcceleration > bounds[i].minAcceleration ||
+           limits[i].maxAcceleration < bounds[i].maxAcceleration) &&
+          m_rectangle.Contains(points.poses[i].Translation())) {
+        bounds[i].minAcceleration = units::math::max(
+            bounds[i].minAcceleration, limits[i].minAcceleration);
+        bounds[i].maxAcceleration = units::math::min(
+            bounds[i].maxAcceleration, limits[i].maxAcceleration);
+      }
+    }
+    return true;
+  }
+
  private:
   Rectangle2d m_rectangle;
   Constraint m_constraint;
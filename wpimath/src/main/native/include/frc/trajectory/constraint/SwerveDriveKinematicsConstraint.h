@@ -45,6 +45,11 @@ class SwerveDriveKinematicsConstraint : public TrajectoryConstraint {
     return {};
   }
 
+  bool LimitAccelerations(const PointBatch& points,
+                          std::span<MinMax> bounds) const override {
+    return true;
+  }
+
  private:
   frc::SwerveDriveKinematics<NumModules> m_kinematics;
   units::meters_per_second_t m_maxSpeed;
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <limits>
+#include <span>
 
 #include <wpi/SymbolExports.h>
 
@@ -48,6 +49,21 @@ class WPILIB_DLLEXPORT TrajectoryConstraint {
         std::numeric_limits<double>::max()};
   };
 
+  /**
+   * A batch of trajectory points, stored as parallel arrays.
+   */
+  struct PointBatch {
+    /**
+     * The pose at each point.
+     */
+    std::span<const Pose2d> poses;
+
+    /**
+     * The curvature at each point.
+     */
+    std::span<const units::curvature_t> curvatures;
+  };
+
   /**
    * Returns the max velocity given the current pose and curvature.
    *
@@ -75,5 +91,48 @@ class WPILIB_DLLEXPORT TrajectoryConstraint {
   constexpr virtual MinMax MinMaxAcceleration(
       const Pose2d& pose, units::curvature_t curvature,
       units::meters_per_second_t speed) const = 0;
+
+  /**
+   * Lowers the max velocity at each point of a batch to the limit this
+   * constraint imposes there.
+   *
+   * This lets the trajectory parameterizer evaluate the constraint once per
+   * point up front instead of calling MaxVelocity() on every pass. It's only
+   * valid if the limit doesn't depend on the velocity passed to MaxVelocity(),
+   * other than never exceeding it. Constraints that can't do this return false
+   * without modifying the velocities, and MaxVelocity() is called instead.
+   *
+   * @param points The points of the trajectory.
+   * @param maxVelocities The max velocity at each point, which is lowered in
+   *                      place.
+   *
+   * @return Whether the velocities were limited.
+   */
+  constexpr virtual bool LimitMaxVelocities(
+      const PointBatch& points,
+      std::span<units::meters_per_second_t> maxVelocities) const {
+    return false;
+  }
+
+  /**
+   * Narrows the acceleration bounds at each point of a batch to the bounds
+   * this constraint imposes there.
+   *
+   * This lets the trajectory parameterizer evaluate the constraint once per
+   * point up front instead of calling MinMaxAcceleration() on every pass. It's
+   * only valid if the bounds don't depend on speed. Constraints that can't do
+   * this return false without modifying the bounds, and MinMaxAcceleration()
+   * is called instead.
+   *
+   * @param points The points of the trajectory.
+   * @param bounds The acceleration bounds at each point, which are narrowed in
+   *               place.
+   *
+   * @return Whether the bounds were narrowed.
+   */
+  constexpr virtual bool LimitAccelerations(const PointBatch& points,
+                                            std::span<MinMax> bounds) const {
+    return false;
+  }
 };
 }  // namespace frc
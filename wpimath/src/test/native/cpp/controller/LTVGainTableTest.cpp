@@ -0,0 +1,33 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <gtest/gtest.h>
+
+#include "frc/controller/LTVGainTable.h"
+
+namespace {
+frc::Matrixd<1, 2> Gain(units::meters_per_second_t velocity) {
+  return frc::Matrixd<1, 2>{{velocity.value(), 2.0 * velocity.value()}};
+}
+}  // namespace
+
+TEST(LTVGainTableTest, Size) {
+  frc::detail::LTVGainTable<1, 2> table{-1_mps, 1_mps, 0.01_mps, Gain};
+  EXPECT_EQ(200u, table.size());
+}
+
+TEST(LTVGainTableTest, Interpolation) {
+  frc::detail::LTVGainTable<1, 2> table{-1_mps, 1_mps, 0.01_mps, Gain};
+
+  // Grid point
+  EXPECT_NEAR(0.5, table[0.5_mps](0, 0), 1e-9);
+
+  // Between grid points
+  EXPECT_NEAR(0.123, table[0.123_mps](0, 0), 1e-9);
+  EXPECT_NEAR(-0.246, table[-0.123_mps](0, 1), 1e-9);
+
+  // Clamped to the ends of the grid
+  EXPECT_NEAR(-1.0, table[-5_mps](0, 0), 1e-9);
+  EXPECT_NEAR(0.99, table[5_mps](0, 0), 1e-9);
+}
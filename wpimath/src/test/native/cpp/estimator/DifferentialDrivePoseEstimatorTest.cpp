@@ -425,3 +425,49 @@ TEST(DifferentialDrivePoseEstimatorTest, TestReset) {
   EXPECT_DOUBLE_EQ(
       0, estimator.GetEstimatedPosition().Rotation().Radians().value());
 }
+
+TEST(DifferentialDrivePoseEstimatorTest, TestAddVisionMeasurements) {
+  frc::DifferentialDriveKinematics kinematics{1_m};
+  frc::DifferentialDrivePoseEstimator sequential{
+      kinematics,      frc::Rotation2d{}, 0_m, 0_m, frc::Pose2d{},
+      {0.1, 0.1, 0.1}, {0.45, 0.45, 0.45}};
+  frc::DifferentialDrivePoseEstimator batched{
+      kinematics,      frc::Rotation2d{}, 0_m, 0_m, frc::Pose2d{},
+      {0.1, 0.1, 0.1}, {0.45, 0.45, 0.45}};
+
+  for (int i = 0; i <= 100; ++i) {
+    auto time = i * 20_ms;
+    auto distance = i * 0.02_m;
+    sequential.UpdateWithTime(time, frc::Rotation2d{}, distance, distance);
+    batched.UpdateWithTime(time, frc::Rotation2d{}, distance, distance);
+  }
+
+  // Out of order, as if from several cameras with different latencies
+  std::vector<frc::DifferentialDrivePoseEstimator::VisionMeasurement>
+      measurements{
+          {frc::Pose2d{1.9_m, 0.1_m, 0.05_rad}, 1.95_s, std::nullopt},
+          {frc::Pose2d{1.5_m, -0.1_m, 0_rad}, 1.5_s, {{0.2, 0.2, 0.2}}},
+          {frc::Pose2d{1.8_m, 0.05_m, 0.02_rad}, 1.83_s, std::nullopt}};
+
+  // The standard deviations given with a measurement only apply to it
+  sequential.AddVisionMeasurement(frc::Pose2d{1.5_m, -0.1_m, 0_rad}, 1.5_s,
+                                  {0.2, 0.2, 0.2});
+  sequential.SetVisionMeasurementStdDevs({0.45, 0.45, 0.45});
+  sequential.AddVisionMeasurement(frc::Pose2d{1.8_m, 0.05_m, 0.02_rad},
+                                  1.83_s);
+  sequential.AddVisionMeasurement(frc::Pose2d{1.9_m, 0.1_m, 0.05_rad}, 1.95_s);
+  batched.AddVisionMeasurements(measurements);
+
+  EXPECT_EQ(sequential.GetEstimatedPosition(), batched.GetEstimatedPosition());
+  for (auto time = 1_s; time <= 2_s; time += 10_ms) {
+    EXPECT_EQ(sequential.SampleAt(time), batched.SampleAt(time));
+  }
+
+  // The newest measurement in the batch has to have been kept
+  EXPECT_GT(batched.GetEstimatedPosition().Y(), 0_m);
+
+  // The standard deviations set before the batch still apply after it
+  sequential.AddVisionMeasurement(frc::Pose2d{2.1_m, 0.2_m, 0.1_rad}, 1.99_s);
+  batched.AddVisionMeasurement(frc::Pose2d{2.1_m, 0.2_m, 0.1_rad}, 1.99_s);
+  EXPECT_EQ(sequential.GetEstimatedPosition(), batched.GetEstimatedPosition());
+}
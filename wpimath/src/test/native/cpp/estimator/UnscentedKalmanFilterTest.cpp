@@ -221,6 +221,79 @@ TEST(UnscentedKalmanFilterTest, RoundTripP) {
   ASSERT_TRUE(observer.P().isApprox(P));
 }
 
+TEST(UnscentedKalmanFilterTest, BatchDynamicsMatchesPerSigmaPoint) {
+  constexpr units::second_t dt = 5_ms;
+
+  frc::UnscentedKalmanFilter<5, 2, 3> observer{
+      DriveDynamics, DriveLocalMeasurementModel, {0.5, 0.5, 10.0, 1.0, 1.0},
+      {0.0001, 0.01, 0.01}, dt};
+  frc::UnscentedKalmanFilter<5, 2, 3> batchObserver{
+      DriveDynamics, DriveLocalMeasurementModel, {0.5, 0.5, 10.0, 1.0, 1.0},
+      {0.0001, 0.01, 0.01}, dt};
+  batchObserver.SetBatchDynamics(
+      [](const frc::Matrixd<5, 11>& sigmas, const frc::Vectord<2>& u) {
+        frc::Matrixd<5, 11> xdot;
+        for (int i = 0; i < sigmas.cols(); ++i) {
+          xdot.col(i) = DriveDynamics(sigmas.col(i), u);
+        }
+        return xdot;
+      });
+
+  frc::Vectord<5> x0{1.0, 2.0, 0.5, 1.0, 1.5};
+  frc::Matrixd<5, 5> P0 = frc::Vectord<5>::Constant(0.01).asDiagonal();
+  observer.SetXhat(x0);
+  observer.SetP(P0);
+  batchObserver.SetXhat(x0);
+  batchObserver.SetP(P0);
+
+  frc::Vectord<2> u{12.0, 10.0};
+  for (int i = 0; i < 20; ++i) {
+    observer.Predict(u, dt);
+    batchObserver.Predict(u, dt);
+
+    auto y = DriveLocalMeasurementModel(observer.Xhat(), u);
+    observer.Correct(u, y);
+    batchObserver.Correct(u, y);
+  }
+
+  EXPECT_TRUE(observer.Xhat().isApprox(batchObserver.Xhat(), 1e-9));
+  EXPECT_TRUE(observer.S().isApprox(batchObserver.S(), 1e-9));
+}
+
+TEST(UnscentedKalmanFilterTest, CachedProcessNoiseLinear) {
+  constexpr units::second_t dt = 20_ms;
+  auto plant = frc::LinearSystemId::IdentifyVelocitySystem<units::meters>(
+      0.02_V / 1_mps, 0.006_V / 1_mps_sq);
+  auto f = [&](const frc::Vectord<1>& x, const frc::Vectord<1>& u) {
+    return plant.A() * x + plant.B() * u;
+  };
+  auto h = [&](const frc::Vectord<1>& x, const frc::Vectord<1>& u) {
+    return plant.CalculateY(x, u);
+  };
+
+  // For a linear model the linearization never changes, so caching the
+  // discretized process noise doesn't change the estimate
+  frc::UnscentedKalmanFilter<1, 1, 1> observer{f, h, {0.05}, {1.0}, dt};
+  frc::UnscentedKalmanFilter<1, 1, 1> cachedObserver{f, h, {0.05}, {1.0}, dt};
+  cachedObserver.SetCacheProcessNoise(true);
+
+  frc::Vectord<1> u{0.0};
+  for (int i = 0; i < 100; ++i) {
+    auto step = i % 10 == 0 ? dt / 2 : dt;
+    observer.Predict(u, step);
+    cachedObserver.Predict(u, step);
+
+    frc::Vectord<1> y{static_cast<double>(i)};
+    observer.Correct(u, y);
+    cachedObserver.Correct(u, y);
+
+    u(0) = 1.0 + 0.01 * i;
+  }
+
+  EXPECT_NEAR(observer.Xhat(0), cachedObserver.Xhat(0), 1e-9);
+  EXPECT_NEAR(observer.S(0, 0), cachedObserver.S(0, 0), 1e-9);
+}
+
 // Second system, single motor feedforward estimator
 frc::Vectord<4> MotorDynamics(const frc::Vectord<4>& x,
                               const frc::Vectord<1>& u) {
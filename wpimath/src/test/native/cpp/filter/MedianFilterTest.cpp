@@ -2,6 +2,10 @@
 // Open Source Software; you can modify and/or share it under the terms of
 // the WPILib BSD license file in the root directory of this project.
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "frc/filter/MedianFilter.h"
@@ -51,3 +55,35 @@ TEST(MedianFilterTest, MedianFilterFullTestOdd) {
 
   EXPECT_EQ(filter.Calculate(99), 5);
 }
+
+TEST(MedianFilterTest, MedianFilterMatchesSortedWindow) {
+  std::mt19937 gen{42};
+  std::uniform_int_distribution<int> dist{-50, 50};
+
+  for (size_t size : {1, 2, 5, 8, 101}) {
+    frc::MedianFilter<double> filter{size};
+    std::vector<double> inputs;
+
+    for (int i = 0; i < 1000; ++i) {
+      // Small integer range so the window has plenty of duplicates
+      double next = dist(gen);
+      inputs.push_back(next);
+
+      std::vector<double> window{
+          inputs.end() - std::min(inputs.size(), size), inputs.end()};
+      std::sort(window.begin(), window.end());
+      size_t n = window.size();
+      double expected = n % 2 != 0
+                            ? window[n / 2]
+                            : (window[n / 2 - 1] + window[n / 2]) / 2.0;
+
+      EXPECT_EQ(expected, filter.Calculate(next)) << "size " << size;
+      EXPECT_EQ(next, filter.LastValue());
+
+      if (i == 500) {
+        filter.Reset();
+        inputs.clear();
+      }
+    }
+  }
+}
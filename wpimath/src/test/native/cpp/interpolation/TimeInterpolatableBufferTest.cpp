@@ -3,6 +3,8 @@
 // the WPILib BSD license file in the root directory of this project.
 
 #include <cmath>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -59,3 +61,55 @@ TEST(TimeInterpolatableBufferTest, Pose2d) {
   EXPECT_TRUE(std::abs(sample.Y().value() - (1.0 / std::sqrt(2.0))) < 0.01);
   EXPECT_TRUE(std::abs(sample.Rotation().Degrees().value() - 45.0) < 0.01);
 }
+
+TEST(TimeInterpolatableBufferTest, Eviction) {
+  frc::TimeInterpolatableBuffer<double> buffer{1.5_s};
+
+  // Use a power-of-two period so the sample times are exact. Run long enough
+  // for evicted samples to be compacted several times.
+  constexpr units::second_t kPeriod = 1_s / 256;
+  for (int i = 0; i <= 2560; ++i) {
+    buffer.AddSample(i * kPeriod, i);
+  }
+
+  auto samples = buffer.GetSamples();
+  EXPECT_EQ(385u, samples.size());
+  EXPECT_DOUBLE_EQ(2176.0, samples.front().second);
+  EXPECT_DOUBLE_EQ(2560.0, samples.back().second);
+
+  EXPECT_DOUBLE_EQ(2176.0, buffer.Sample(0_s).value());
+  EXPECT_DOUBLE_EQ(2300.5, buffer.Sample(2300.5 * kPeriod).value());
+
+  // Out-of-order sample inside the live window
+  buffer.AddSample(2300.25 * kPeriod, 0.0);
+  EXPECT_DOUBLE_EQ(0.0, buffer.Sample(2300.25 * kPeriod).value());
+  EXPECT_EQ(386u, buffer.GetSamples().size());
+
+  buffer.Clear();
+  EXPECT_FALSE(buffer.Sample(0_s).has_value());
+  EXPECT_TRUE(buffer.GetSamples().empty());
+}
+
+TEST(TimeInterpolatableBufferTest, InternalBufferHasOnlyLiveSamples) {
+  frc::TimeInterpolatableBuffer<double> buffer{1.5_s};
+
+  constexpr units::second_t kPeriod = 1_s / 256;
+  for (int i = 0; i <= 1000; ++i) {
+    buffer.AddSample(i * kPeriod, i);
+  }
+
+  std::vector<std::pair<units::second_t, double>>& internal =
+      buffer.GetInternalBuffer();
+  ASSERT_EQ(385u, internal.size());
+  EXPECT_DOUBLE_EQ(616.0, internal.front().second);
+  EXPECT_DOUBLE_EQ(1000.0, internal.back().second);
+
+  // Changes made through the vector are seen by the buffer
+  internal.back().second = -1.0;
+  EXPECT_DOUBLE_EQ(-1.0, buffer.Sample(1000 * kPeriod).value());
+  EXPECT_EQ(internal.size(), buffer.GetSamples().size());
+
+  buffer.AddSample(1001 * kPeriod, 1001);
+  EXPECT_EQ(385u, buffer.GetInternalBuffer().size());
+  EXPECT_DOUBLE_EQ(617.0, buffer.GetInternalBuffer().front().second);
+}
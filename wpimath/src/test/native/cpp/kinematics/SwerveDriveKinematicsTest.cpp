@@ -3,6 +3,7 @@
 // the WPILib BSD license file in the root directory of this project.
 
 #include <numbers>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -309,3 +310,63 @@ TEST_F(SwerveDriveKinematicsTest, DesaturateNegativeSpeed) {
   EXPECT_NEAR(arr[2].speed.value(), -1.0, kEpsilon);
   EXPECT_NEAR(arr[3].speed.value(), -1.0, kEpsilon);
 }
+
+TEST_F(SwerveDriveKinematicsTest, BatchMatchesSingle) {
+  std::vector<ChassisSpeeds> speeds{{5_mps, 0_mps, 0_rad_per_s},
+                                    {0_mps, 0_mps, 0_rad_per_s},
+                                    {1_mps, -2_mps, 0.5_rad_per_s},
+                                    {0_mps, 0_mps, 2_rad_per_s},
+                                    {0_mps, 0_mps, 0_rad_per_s},
+                                    {-3_mps, 1_mps, -1_rad_per_s}};
+  const Translation2d centerOfRotation{12_m, 12_m};
+
+  SwerveDriveKinematics<4> batchKinematics{m_fl, m_fr, m_bl, m_br};
+  auto batch = batchKinematics.ToSwerveModuleStates(speeds, centerOfRotation);
+  auto forward = batchKinematics.ToChassisSpeeds(batch);
+
+  ASSERT_EQ(speeds.size(), batch.size());
+  ASSERT_EQ(speeds.size(), forward.size());
+  for (size_t j = 0; j < speeds.size(); ++j) {
+    auto expected =
+        m_kinematics.ToSwerveModuleStates(speeds[j], centerOfRotation);
+    auto actual = batch[j];
+    for (size_t i = 0; i < 4; ++i) {
+      EXPECT_NEAR(expected[i].speed.value(), actual[i].speed.value(), 1e-9);
+      EXPECT_NEAR(expected[i].angle.Cos(), actual[i].angle.Cos(), 1e-9);
+      EXPECT_NEAR(expected[i].angle.Sin(), actual[i].angle.Sin(), 1e-9);
+    }
+
+    auto expectedForward = m_kinematics.ToChassisSpeeds(actual);
+    EXPECT_NEAR(expectedForward.vx.value(), forward[j].vx.value(), 1e-9);
+    EXPECT_NEAR(expectedForward.vy.value(), forward[j].vy.value(), 1e-9);
+    EXPECT_NEAR(expectedForward.omega.value(), forward[j].omega.value(), 1e-9);
+  }
+}
+
+TEST_F(SwerveDriveKinematicsTest, BatchTwists) {
+  wpi::array<SwerveModulePosition, 4> start{
+      SwerveModulePosition{1_m, 0_deg}, SwerveModulePosition{2_m, 0_deg},
+      SwerveModulePosition{3_m, 0_deg}, SwerveModulePosition{4_m, 0_deg}};
+  std::vector<wpi::array<SwerveModulePosition, 4>> positions;
+  for (int j = 1; j <= 5; ++j) {
+    wpi::array<SwerveModulePosition, 4> next = positions.empty()
+                                                   ? start
+                                                   : positions.back();
+    for (size_t i = 0; i < 4; ++i) {
+      next[i].distance += units::meter_t{0.1 * j * (i + 1)};
+      next[i].angle = units::degree_t{10.0 * j * i};
+    }
+    positions.push_back(next);
+  }
+
+  auto twists = m_kinematics.ToTwist2d(start, positions);
+
+  ASSERT_EQ(positions.size(), twists.size());
+  for (size_t j = 0; j < positions.size(); ++j) {
+    auto expected =
+        m_kinematics.ToTwist2d(j == 0 ? start : positions[j - 1], positions[j]);
+    EXPECT_NEAR(expected.dx.value(), twists[j].dx.value(), 1e-9);
+    EXPECT_NEAR(expected.dy.value(), twists[j].dy.value(), 1e-9);
+    EXPECT_NEAR(expected.dtheta.value(), twists[j].dtheta.value(), 1e-9);
+  }
+}
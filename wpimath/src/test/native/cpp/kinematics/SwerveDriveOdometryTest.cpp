@@ -4,6 +4,8 @@
 
 #include <limits>
 #include <random>
+#include <stdexcept>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -199,3 +201,45 @@ TEST_F(SwerveDriveOdometryTest, AccuracyFacingXAxis) {
   EXPECT_LT(errorSum / (trajectory.TotalTime().value() / dt.value()), 0.06);
   EXPECT_LT(maxError, 0.125);
 }
+
+TEST_F(SwerveDriveOdometryTest, BatchUpdate) {
+  SwerveDriveOdometry<4> batchOdometry{
+      m_kinematics, 0_rad, {zero, zero, zero, zero}};
+
+  std::vector<Rotation2d> gyroAngles;
+  std::vector<wpi::array<SwerveModulePosition, 4>> positions;
+  for (int j = 1; j <= 10; ++j) {
+    gyroAngles.emplace_back(units::degree_t{9.0 * j});
+    positions.push_back(
+        {SwerveModulePosition{units::meter_t{1.8 * j}, 90_deg},
+         SwerveModulePosition{units::meter_t{4.2 * j}, 26.565_deg},
+         SwerveModulePosition{units::meter_t{1.8 * j}, -90_deg},
+         SwerveModulePosition{units::meter_t{4.2 * j}, -26.565_deg}});
+  }
+
+  Pose2d expected;
+  for (size_t j = 0; j < positions.size(); ++j) {
+    expected = m_odometry.Update(gyroAngles[j], positions[j]);
+  }
+  auto pose = batchOdometry.Update(gyroAngles, positions);
+
+  EXPECT_NEAR(expected.X().value(), pose.X().value(), 1e-9);
+  EXPECT_NEAR(expected.Y().value(), pose.Y().value(), 1e-9);
+  EXPECT_NEAR(expected.Rotation().Radians().value(),
+              pose.Rotation().Radians().value(), 1e-9);
+}
+
+TEST_F(SwerveDriveOdometryTest, BatchUpdateSizeMismatch) {
+  SwerveModulePosition position{0.5_m, 0_deg};
+  std::vector<Rotation2d> gyroAngles{0_deg, 0_deg};
+  std::vector<wpi::array<SwerveModulePosition, 4>> positions{
+      {position, position, position, position}};
+
+  EXPECT_THROW(m_odometry.Update(gyroAngles, positions),
+               std::invalid_argument);
+
+  // The pose is unchanged
+  auto pose = m_odometry.GetPose();
+  EXPECT_DOUBLE_EQ(0.0, pose.X().value());
+  EXPECT_DOUBLE_EQ(0.0, pose.Y().value());
+}
@@ -41,3 +41,27 @@ TEST(DifferentialDriveKinematicsConstraintTest, Constraint) {
     EXPECT_TRUE(right < maxVelocity + 0.05_mps);
   }
 }
+
+TEST(DifferentialDriveKinematicsConstraintTest, BatchMatchesPerPoint) {
+  const DifferentialDriveKinematicsConstraint constraint{
+      DifferentialDriveKinematics{27_in}, 12_fps};
+
+  std::vector<Pose2d> poses(41);
+  std::vector<units::curvature_t> curvatures;
+  for (int i = -20; i <= 20; ++i) {
+    curvatures.emplace_back(0.25 * i);
+  }
+
+  for (auto velocity : {2_fps, 8_fps, 12_fps, 20_fps}) {
+    std::vector<units::meters_per_second_t> maxVelocities(poses.size(),
+                                                          velocity);
+    ASSERT_TRUE(
+        constraint.LimitMaxVelocities({poses, curvatures}, maxVelocities));
+
+    for (size_t i = 0; i < poses.size(); ++i) {
+      EXPECT_NEAR(
+          constraint.MaxVelocity(poses[i], curvatures[i], velocity).value(),
+          maxVelocities[i].value(), 1e-12);
+    }
+  }
+}
@@ -2,6 +2,8 @@
 // Open Source Software; you can modify and/or share it under the terms of
 // the WPILib BSD license file in the root directory of this project.
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "frc/trajectory/constraint/MaxVelocityConstraint.h"
@@ -33,3 +35,32 @@ TEST(RectangularRegionConstraintTest, Constraint) {
   }
   EXPECT_TRUE(exceededConstraintOutsideRegion);
 }
+
+TEST(RectangularRegionConstraintTest, BatchMatchesPerPoint) {
+  constexpr frc::Rectangle2d rectangle{{1_ft, 1_ft}, {5_ft, 27_ft}};
+  RectangularRegionConstraint constraint{rectangle,
+                                         MaxVelocityConstraint{2_fps}};
+
+  std::vector<Pose2d> poses;
+  std::vector<units::curvature_t> curvatures;
+  for (int i = 0; i < 30; ++i) {
+    poses.emplace_back(units::foot_t{0.25 * i}, units::foot_t{1.0 * i}, 0_deg);
+    curvatures.emplace_back(0.1 * i);
+  }
+
+  std::vector<units::meters_per_second_t> maxVelocities(poses.size(), 13_fps);
+  std::vector<TrajectoryConstraint::MinMax> bounds(poses.size());
+  ASSERT_TRUE(
+      constraint.LimitMaxVelocities({poses, curvatures}, maxVelocities));
+  ASSERT_TRUE(constraint.LimitAccelerations({poses, curvatures}, bounds));
+
+  for (size_t i = 0; i < poses.size(); ++i) {
+    EXPECT_EQ(units::math::min(13_fps, constraint.MaxVelocity(
+                                           poses[i], curvatures[i], 13_fps)),
+              maxVelocities[i]);
+    EXPECT_EQ(TrajectoryConstraint::MinMax{}.minAcceleration,
+              bounds[i].minAcceleration);
+    EXPECT_EQ(TrajectoryConstraint::MinMax{}.maxAcceleration,
+              bounds[i].maxAcceleration);
+  }
+}
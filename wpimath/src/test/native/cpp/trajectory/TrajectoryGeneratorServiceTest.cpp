@@ -0,0 +1,173 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <future>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "frc/trajectory/Trajectory.h"
+#include "frc/trajectory/TrajectoryGenerator.h"
+#include "frc/trajectory/TrajectoryGeneratorService.h"
+#include "frc/trajectory/constraint/CentripetalAccelerationConstraint.h"
+
+using namespace frc;
+
+static const std::vector<Pose2d> kWaypoints{{0_m, 0_m, 0_deg},
+                                            {2_m, 1_m, 45_deg},
+                                            {4_m, 3_m, 0_deg},
+                                            {6_m, 2_m, -45_deg},
+                                            {8_m, 0_m, 0_deg}};
+
+static void ExpectSameTrajectory(const Trajectory& expected,
+                                 const Trajectory& actual) {
+  ASSERT_EQ(expected.States().size(), actual.States().size());
+  for (size_t i = 0; i < expected.States().size(); ++i) {
+    EXPECT_EQ(expected.States()[i], actual.States()[i]);
+  }
+}
+
+TEST(TrajectoryGeneratorServiceTest, MatchesTrajectoryGenerator) {
+  TrajectoryGeneratorService service{4};
+
+  TrajectoryConfig config{12_fps, 12_fps_sq};
+  config.AddConstraint(CentripetalAccelerationConstraint{8_fps_sq});
+  auto future = service.GenerateAsync(kWaypoints, std::move(config));
+
+  TrajectoryConfig expectedConfig{12_fps, 12_fps_sq};
+  expectedConfig.AddConstraint(CentripetalAccelerationConstraint{8_fps_sq});
+  ExpectSameTrajectory(
+      TrajectoryGenerator::GenerateTrajectory(kWaypoints, expectedConfig),
+      future.get());
+}
+
+TEST(TrajectoryGeneratorServiceTest, MatchesTrajectoryGeneratorReversed) {
+  TrajectoryGeneratorService service{4};
+
+  TrajectoryConfig config{12_fps, 12_fps_sq};
+  config.SetReversed(true);
+  auto trajectory = service.Generate(kWaypoints, std::move(config));
+
+  TrajectoryConfig expectedConfig{12_fps, 12_fps_sq};
+  expectedConfig.SetReversed(true);
+  ExpectSameTrajectory(
+      TrajectoryGenerator::GenerateTrajectory(kWaypoints, expectedConfig),
+      trajectory);
+}
+
+TEST(TrajectoryGeneratorServiceTest, MatchesTrajectoryGeneratorCubic) {
+  TrajectoryGeneratorService service{4};
+
+  const Pose2d start{0_m, 0_m, 0_deg};
+  const std::vector<Translation2d> interior{{2_m, 1_m}, {4_m, 2_m}};
+  const Pose2d end{6_m, 0_m, -30_deg};
+  auto future = service.GenerateAsync(start, interior, end,
+                                      TrajectoryConfig{12_fps, 12_fps_sq});
+
+  ExpectSameTrajectory(
+      TrajectoryGenerator::GenerateTrajectory(
+          start, interior, end, TrajectoryConfig{12_fps, 12_fps_sq}),
+      future.get());
+}
+
+TEST(TrajectoryGeneratorServiceTest, CachesSplinePoints) {
+  TrajectoryGeneratorService service{2};
+
+  auto first = service.Generate(kWaypoints, TrajectoryConfig{12_fps, 12_fps_sq});
+  EXPECT_EQ(1u, service.GetCacheSize());
+
+  // Different limits reuse the cached spline points
+  auto slower = service.Generate(kWaypoints, TrajectoryConfig{6_fps, 6_fps_sq});
+  EXPECT_EQ(1u, service.GetCacheSize());
+  EXPECT_EQ(1u, service.GetCacheHits());
+  EXPECT_GT(slower.TotalTime(), first.TotalTime());
+  ExpectSameTrajectory(
+      TrajectoryGenerator::GenerateTrajectory(kWaypoints,
+                                              TrajectoryConfig{6_fps, 6_fps_sq}),
+      slower);
+
+  // Reversing the path changes the splines, so it's cached separately
+  TrajectoryConfig reversed{12_fps, 12_fps_sq};
+  reversed.SetReversed(true);
+  service.Generate(kWaypoints, std::move(reversed));
+  EXPECT_EQ(2u, service.GetCacheSize());
+
+  service.ClearCache();
+  EXPECT_EQ(0u, service.GetCacheSize());
+}
+
+TEST(TrajectoryGeneratorServiceTest, EvictsLeastRecentlyUsed) {
+  TrajectoryGeneratorService service{2, 2};
+
+  auto path = [](int i) {
+    auto waypoints = kWaypoints;
+    waypoints.back() = Pose2d{8_m, units::meter_t{0.25 * i}, 0_deg};
+    return waypoints;
+  };
+  auto config = [] { return TrajectoryConfig{12_fps, 12_fps_sq}; };
+
+  service.Generate(path(0), config());
+  service.Generate(path(1), config());
+  EXPECT_EQ(2u, service.GetCacheSize());
+
+  // Using path 0 makes path 1 the least recently used
+  service.Generate(path(0), config());
+  EXPECT_EQ(1u, service.GetCacheHits());
+  service.Generate(path(2), config());
+  EXPECT_EQ(2u, service.GetCacheSize());
+
+  service.Generate(path(0), config());
+  EXPECT_EQ(2u, service.GetCacheHits());
+  service.Generate(path(2), config());
+  EXPECT_EQ(3u, service.GetCacheHits());
+  // Evicted, so regenerated (evicting path 0)
+  ExpectSameTrajectory(
+      TrajectoryGenerator::GenerateTrajectory(path(1), config()),
+      service.Generate(path(1), config()));
+  EXPECT_EQ(3u, service.GetCacheHits());
+  EXPECT_EQ(2u, service.GetCacheSize());
+}
+
+TEST(TrajectoryGeneratorServiceTest, CacheDisabled) {
+  TrajectoryGeneratorService service{2, 0};
+
+  service.Generate(kWaypoints, TrajectoryConfig{12_fps, 12_fps_sq});
+  service.Generate(kWaypoints, TrajectoryConfig{12_fps, 12_fps_sq});
+  EXPECT_EQ(0u, service.GetCacheSize());
+  EXPECT_EQ(0u, service.GetCacheHits());
+}
+
+TEST(TrajectoryGeneratorServiceTest, ConcurrentRequests) {
+  TrajectoryGeneratorService service{3};
+
+  std::vector<std::future<Trajectory>> futures;
+  for (int i = 0; i < 8; ++i) {
+    auto waypoints = kWaypoints;
+    waypoints.back() = Pose2d{8_m, units::meter_t{0.25 * i}, 0_deg};
+    futures.emplace_back(service.GenerateAsync(
+        std::move(waypoints), TrajectoryConfig{12_fps, 12_fps_sq}));
+  }
+
+  for (int i = 0; i < 8; ++i) {
+    auto waypoints = kWaypoints;
+    waypoints.back() = Pose2d{8_m, units::meter_t{0.25 * i}, 0_deg};
+    ExpectSameTrajectory(
+        TrajectoryGenerator::GenerateTrajectory(
+            waypoints, TrajectoryConfig{12_fps, 12_fps_sq}),
+        futures[i].get());
+  }
+  EXPECT_EQ(8u, service.GetCacheSize());
+}
+
+TEST(TrajectoryGeneratorServiceTest, ReturnsEmptyOnMalformed) {
+  TrajectoryGeneratorService service{2};
+
+  auto t = service.Generate(
+      std::vector<Pose2d>{Pose2d{0_m, 0_m, 0_deg}, Pose2d{1_m, 0_m, 180_deg}},
+      TrajectoryConfig{12_fps, 12_fps_sq});
+
+  ASSERT_EQ(t.States().size(), 1u);
+  ASSERT_EQ(t.TotalTime(), 0_s);
+  EXPECT_EQ(0u, service.GetCacheSize());
+}
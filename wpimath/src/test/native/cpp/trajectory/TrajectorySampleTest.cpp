@@ -0,0 +1,73 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "frc/trajectory/Trajectory.h"
+#include "trajectory/TestTrajectory.h"
+#include "units/math.h"
+
+using namespace frc;
+
+TEST(TrajectorySampleTest, SamplerMatchesSample) {
+  TrajectoryConfig config{12_fps, 12_fps_sq};
+  auto trajectory = TestTrajectory::GetTrajectory(config);
+
+  Trajectory::Sampler sampler{trajectory};
+  for (auto t = -0.1_s; t < trajectory.TotalTime() + 0.1_s; t += 7_ms) {
+    EXPECT_EQ(trajectory.Sample(t), sampler.Sample(t));
+  }
+
+  // Going backwards falls back to a search
+  for (auto t : {1.5_s, 0.5_s, 0.51_s, 3_s, 0_s}) {
+    EXPECT_EQ(trajectory.Sample(t), sampler.Sample(t));
+  }
+}
+
+TEST(TrajectorySampleTest, BatchMatchesSample) {
+  TrajectoryConfig config{12_fps, 12_fps_sq};
+  auto trajectory = TestTrajectory::GetTrajectory(config);
+
+  std::vector<units::second_t> times{0_s,   0.25_s, 0.3_s, 2_s,
+                                     1_s,   1.1_s,  4_s,   -1_s,
+                                     100_s, trajectory.TotalTime()};
+  auto states = trajectory.Sample(times);
+
+  ASSERT_EQ(times.size(), states.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    EXPECT_EQ(trajectory.Sample(times[i]), states[i]);
+  }
+}
+
+TEST(TrajectorySampleTest, Resample) {
+  TrajectoryConfig config{12_fps, 12_fps_sq};
+  auto trajectory = TestTrajectory::GetTrajectory(config);
+  auto resampled = trajectory.Resample(20_ms);
+
+  // The resampled states lie on the original trajectory at a fixed period
+  const auto& states = resampled.States();
+  EXPECT_EQ(trajectory.States().front(), states.front());
+  EXPECT_EQ(trajectory.States().back(), states.back());
+  EXPECT_EQ(trajectory.TotalTime(), resampled.TotalTime());
+  for (size_t i = 0; i < states.size() - 1; ++i) {
+    EXPECT_DOUBLE_EQ(0.02 * i, states[i].t.value());
+    EXPECT_EQ(trajectory.Sample(states[i].t), states[i]);
+  }
+  EXPECT_LE(states.back().t - states[states.size() - 2].t, 20_ms);
+
+  // Index lookups find the same states as a binary search over the resampled
+  // states, and stay close to the original trajectory
+  Trajectory searched{states};
+  for (auto t = 0_s; t < trajectory.TotalTime(); t += 3_ms) {
+    auto state = resampled.Sample(t);
+    EXPECT_EQ(searched.Sample(t), state);
+    EXPECT_LT(state.pose.Translation().Distance(
+                  trajectory.Sample(t).pose.Translation()),
+              1_cm);
+  }
+
+  EXPECT_THROW(trajectory.Resample(0_s), std::invalid_argument);
+}
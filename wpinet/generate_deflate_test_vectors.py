@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+
+# Copyright (c) FIRST and other WPILib contributors.
+# Open Source Software; you can modify and/or share it under the terms of
+# the WPILib BSD license file in the root directory of this project.
+
+"""Generates the reference zlib streams used by DeflateTest."""
+
+import zlib
+from pathlib import Path
+
+WORDS = [
+    b"robot",
+    b"drive",
+    b"pose",
+    b"vision",
+    b"value",
+    b"/SmartDashboard/",
+    b"true",
+    b"false",
+]
+
+# name, seed, size, level, window bits, strategy, chunk sizes, final
+VECTORS = [
+    ("Stored", 1, 1500, 0, 15, zlib.Z_DEFAULT_STRATEGY, [600, 0, 900], False),
+    ("Fixed", 2, 6000, 6, 15, zlib.Z_FIXED, [3000, 3000], False),
+    ("Dynamic", 3, 16000, 6, 15, zlib.Z_DEFAULT_STRATEGY, [8000, 8000], False),
+    ("DynamicFast", 4, 8000, 1, 15, zlib.Z_DEFAULT_STRATEGY, [8000], True),
+    ("HuffmanOnly", 5, 3000, 6, 15, zlib.Z_HUFFMAN_ONLY, [3000], False),
+    ("Rle", 6, 3000, 6, 15, zlib.Z_RLE, [3000], False),
+    ("SmallWindow", 7, 8000, 9, 9, zlib.Z_DEFAULT_STRATEGY, [4000] * 2, False),
+]
+
+
+def test_input(seed: int, size: int) -> bytes:
+    """Same as DeflateTestInput() in DeflateTest.cpp."""
+    x = seed
+    out = bytearray()
+    while len(out) < size:
+        x ^= (x << 13) & 0xFFFFFFFF
+        x ^= x >> 17
+        x ^= (x << 5) & 0xFFFFFFFF
+        kind = x % 8
+        if kind < 4:
+            out += WORDS[(x >> 8) % 8] + b" "
+        elif kind < 6:
+            out += f"{(x >> 8) % 100000}\n".encode()
+        elif kind == 6 and out:
+            dist = 1 + (x >> 8) % min(len(out), 32768)
+            start = len(out) - dist
+            for k in range(3 + (x >> 24) % 100):
+                out.append(out[start + k])
+        else:
+            out.append((x >> 8) & 0xFF)
+    return bytes(out[:size])
+
+
+def wrap(prefix: str, fields: list[str], suffix: str) -> list[str]:
+    """Packs fields onto lines of at most 80 columns, like clang-format."""
+    lines = []
+    line = prefix + fields[0]
+    for i, field in enumerate(fields[1:], 1):
+        piece = field + (suffix if i == len(fields) - 1 else "")
+        if len(line) + 2 + len(piece) > 80:
+            lines.append(line + ",")
+            line = " " * len(prefix) + piece
+        else:
+            line += ", " + piece
+    lines.append(line)
+    return lines
+
+
+def main():
+    out = [
+        f"""// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <span>
+
+// Raw deflate streams produced by zlib {zlib.ZLIB_VERSION} from DeflateTestInput(), in
+// chunks.  Each chunk ends with a sync flush (or, if final is set, the last
+// chunk ends with a final block), so it can be inflated on its own, as
+// permessage-deflate does.
+//
+// Generated by wpinet/generate_deflate_test_vectors.py; do not edit.
+namespace wpi::detail {{
+
+struct ZlibVector {{
+  const char* name;
+  uint32_t seed;
+  size_t size;
+  std::span<const size_t> chunkSizes;       // uncompressed
+  std::span<const size_t> compressedSizes;  // per chunk
+  std::span<const uint8_t> compressed;
+  bool final;
+}};
+"""
+    ]
+
+    entries = []
+    for name, seed, size, level, wbits, strategy, chunks, final in VECTORS:
+        data = test_input(seed, size)
+        c = zlib.compressobj(level, zlib.DEFLATED, -wbits, 9, strategy)
+        compressed = bytearray()
+        sizes = []
+        pos = 0
+        for i, n in enumerate(chunks):
+            last = i == len(chunks) - 1
+            flush = zlib.Z_FINISH if last and final else zlib.Z_SYNC_FLUSH
+            part = c.compress(data[pos : pos + n]) + c.flush(flush)
+            pos += n
+            compressed += part
+            sizes.append(len(part))
+        assert zlib.decompressobj(-15).decompress(bytes(compressed)) == data
+
+        lines = []
+        for i in range(0, len(compressed), 12):
+            row = ", ".join(f"0x{b:02x}" for b in compressed[i : i + 12])
+            lines.append(f"    {row},")
+        lines[-1] = lines[-1].rstrip(",")
+        out.append(
+            f"inline constexpr size_t k{name}Chunks[] = {{"
+            + ", ".join(str(n) for n in chunks)
+            + "};"
+        )
+        out.append(
+            f"inline constexpr size_t k{name}Compressed[] = {{"
+            + ", ".join(str(n) for n in sizes)
+            + "};"
+        )
+        out.append(
+            f"inline constexpr uint8_t k{name}Data[] = {{\n"
+            + "\n".join(lines)
+            + "};\n"
+        )
+        fields = [
+            f'"{name}"',
+            str(seed),
+            str(size),
+            f"k{name}Chunks",
+            f"k{name}Compressed",
+            f"k{name}Data",
+            "true" if final else "false",
+        ]
+        entries.extend(wrap("    {", fields, "},"))
+
+    out.append("inline const ZlibVector kZlibVectors[] = {")
+    out.extend(entries)
+    out.append("};\n")
+    out.append("}  // namespace wpi::detail\n")
+
+    path = Path(__file__).parent / "src/test/native/cpp/DeflateZlibVectors.h"
+    path.write_text("\n".join(out), encoding="utf-8", newline="\n")
+
+
+if __name__ == "__main__":
+    main()
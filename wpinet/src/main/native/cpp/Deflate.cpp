@@ -0,0 +1,970 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "Deflate.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+
+using namespace wpi::detail;
+
+static constexpr size_t kWindowSize = 32768;
+static constexpr int kHashBits = 15;
+static constexpr size_t kHashSize = 1 << kHashBits;
+// compression effort; these favor speed over ratio
+static constexpr int kMaxChain = 8;
+static constexpr size_t kNiceLength = 128;
+static constexpr size_t kMinMatch = 3;
+static constexpr size_t kMaxMatch = 258;
+// input bytes per block
+static constexpr size_t kBlockSize = 16384;
+// blocks with fewer symbols always use the fixed code (or are stored)
+static constexpr size_t kMinDynamicSymbols = 64;
+
+static constexpr int kNumLitLen = 286;
+// the fixed code also assigns codes to the two unused symbols 286 and 287
+static constexpr int kNumFixedLitLen = 288;
+static constexpr int kNumDist = 30;
+static constexpr int kNumCodeLen = 19;
+static constexpr int kMaxBits = 15;
+static constexpr int kMaxCodeLenBits = 7;
+
+static constexpr uint16_t kLenBase[29] = {
+    3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+    31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static constexpr uint8_t kLenExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+                                          1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                          4, 4, 4, 4, 5, 5, 5, 5, 0};
+static constexpr uint16_t kDistBase[30] = {
+    1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+    33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+    1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static constexpr uint8_t kDistExtra[30] = {0, 0, 0, 0, 1, 1, 2,  2,  3,  3,
+                                           4, 4, 5, 5, 6, 6, 7,  7,  8,  8,
+                                           9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+static constexpr uint8_t kCodeLenOrder[kNumCodeLen] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+namespace {
+
+struct SymbolTables {
+  uint8_t len[256];   // match length - 3 -> length code
+  uint8_t dist[512];  // see DistCode()
+};
+
+constexpr SymbolTables MakeSymbolTables() {
+  SymbolTables t{};
+  for (int i = 0; i < 29; ++i) {
+    for (int l = kLenBase[i]; l < kLenBase[i] + (1 << kLenExtra[i]); ++l) {
+      // 258 is also reachable from code 27; it must use code 28
+      if (l <= 258) {
+        t.len[l - 3] = i;
+      }
+    }
+  }
+  for (int i = 0; i < 30; ++i) {
+    for (int d = kDistBase[i]; d < kDistBase[i] + (1 << kDistExtra[i]); ++d) {
+      if (d <= 256) {
+        t.dist[d - 1] = i;
+      } else {
+        t.dist[256 + ((d - 1) >> 7)] = i;
+      }
+    }
+  }
+  return t;
+}
+
+constexpr SymbolTables kSymbols = MakeSymbolTables();
+
+constexpr int LenCode(size_t len) {
+  return kSymbols.len[len - kMinMatch];
+}
+
+constexpr int DistCode(size_t dist) {
+  return dist <= 256 ? kSymbols.dist[dist - 1]
+                     : kSymbols.dist[256 + ((dist - 1) >> 7)];
+}
+
+constexpr uint8_t FixedLitLen(int sym) {
+  if (sym < 144) {
+    return 8;
+  } else if (sym < 256) {
+    return 9;
+  } else if (sym < 280) {
+    return 7;
+  } else {
+    return 8;
+  }
+}
+
+uint16_t ReverseBits(uint32_t code, int len) {
+  code = ((code & 0x5555) << 1) | ((code >> 1) & 0x5555);
+  code = ((code & 0x3333) << 2) | ((code >> 2) & 0x3333);
+  code = ((code & 0x0f0f) << 4) | ((code >> 4) & 0x0f0f);
+  code = ((code & 0x00ff) << 8) | ((code >> 8) & 0x00ff);
+  return code >> (16 - len);
+}
+
+// Computes Huffman code lengths limited to maxBits. Unused symbols get a
+// length of 0. Codes are always complete (a lone symbol is paired with an
+// unused one) so any decoder accepts them.
+void BuildLengths(const uint32_t* freqs, int n, int maxBits, uint8_t* lengths) {
+  std::fill(lengths, lengths + n, 0);
+  uint16_t syms[kNumLitLen];
+  int count = 0;
+  for (int i = 0; i < n; ++i) {
+    if (freqs[i] != 0) {
+      syms[count++] = i;
+    }
+  }
+  if (count == 0) {
+    return;
+  }
+  if (count == 1) {
+    lengths[syms[0]] = 1;
+    lengths[syms[0] == 0 ? 1 : 0] = 1;
+    return;
+  }
+  std::sort(syms, syms + count, [&](uint16_t a, uint16_t b) {
+    return freqs[a] < freqs[b] || (freqs[a] == freqs[b] && a < b);
+  });
+
+  // two-queue construction: leaves are sorted, and internal nodes are
+  // created in nondecreasing weight order
+  uint32_t weight[2 * kNumLitLen];
+  int parent[2 * kNumLitLen];
+  for (int i = 0; i < count; ++i) {
+    weight[i] = freqs[syms[i]];
+  }
+  int leaf = 0;
+  int node = count;
+  int next = count;
+  auto pick = [&] {
+    if (leaf < count && (node >= next || weight[leaf] <= weight[node])) {
+      return leaf++;
+    }
+    return node++;
+  };
+  for (int i = 0; i < count - 1; ++i) {
+    int a = pick();
+    int b = pick();
+    weight[next] = weight[a] + weight[b];
+    parent[a] = next;
+    parent[b] = next;
+    ++next;
+  }
+
+  // parents always have higher indices than their children
+  int depth[2 * kNumLitLen];
+  int blCount[kNumLitLen + 1] = {};
+  depth[next - 1] = 0;
+  for (int i = next - 2; i >= 0; --i) {
+    depth[i] = depth[parent[i]] + 1;
+  }
+  for (int i = 0; i < count; ++i) {
+    ++blCount[(std::min)(depth[i], maxBits)];
+  }
+
+  // clamping made the code oversubscribed; lengthen shorter codes until it
+  // is complete again
+  uint32_t total = 0;
+  for (int i = maxBits; i > 0; --i) {
+    total += static_cast<uint32_t>(blCount[i]) << (maxBits - i);
+  }
+  while (total != (1u << maxBits)) {
+    --blCount[maxBits];
+    for (int i = maxBits - 1; i > 0; --i) {
+      if (blCount[i] != 0) {
+        --blCount[i];
+        blCount[i + 1] += 2;
+        break;
+      }
+    }
+    --total;
+  }
+
+  // least frequent symbols get the longest codes
+  int i = 0;
+  for (int len = maxBits; len > 0; --len) {
+    for (int k = 0; k < blCount[len]; ++k) {
+      lengths[syms[i++]] = len;
+    }
+  }
+}
+
+// Computes bit-reversed canonical codes from code lengths
+void BuildCodes(const uint8_t* lengths, int n, uint16_t* codes) {
+  int blCount[kMaxBits + 1] = {};
+  for (int i = 0; i < n; ++i) {
+    ++blCount[lengths[i]];
+  }
+  blCount[0] = 0;
+  uint32_t nextCode[kMaxBits + 1];
+  uint32_t code = 0;
+  for (int bits = 1; bits <= kMaxBits; ++bits) {
+    code = (code + blCount[bits - 1]) << 1;
+    nextCode[bits] = code;
+  }
+  for (int i = 0; i < n; ++i) {
+    if (lengths[i] != 0) {
+      codes[i] = ReverseBits(nextCode[lengths[i]]++, lengths[i]);
+    }
+  }
+}
+
+struct FixedCodes {
+  FixedCodes() {
+    for (int i = 0; i < kNumFixedLitLen; ++i) {
+      litLens[i] = FixedLitLen(i);
+    }
+    std::fill(std::begin(distLens), std::end(distLens), 5);
+    BuildCodes(litLens, kNumFixedLitLen, litCodes);
+    BuildCodes(distLens, kNumDist, distCodes);
+  }
+
+  uint8_t litLens[kNumFixedLitLen];
+  uint16_t litCodes[kNumFixedLitLen];
+  uint8_t distLens[kNumDist];
+  uint16_t distCodes[kNumDist];
+};
+
+class BitWriter {
+ public:
+  BitWriter(std::vector<uint8_t>& out, uint64_t& bits, int& count)
+      : m_out{out}, m_savedBits{bits}, m_savedCount{count} {
+    m_bits = bits;
+    m_count = count;
+  }
+  ~BitWriter() {
+    m_savedBits = m_bits;
+    m_savedCount = m_count;
+  }
+  BitWriter(const BitWriter&) = delete;
+  BitWriter& operator=(const BitWriter&) = delete;
+
+  // n must be at most 32
+  void Put(uint32_t value, int n) {
+    m_bits |= static_cast<uint64_t>(value) << m_count;
+    m_count += n;
+    if (m_count >= 32) {
+      uint8_t buf[4] = {static_cast<uint8_t>(m_bits),
+                        static_cast<uint8_t>(m_bits >> 8),
+                        static_cast<uint8_t>(m_bits >> 16),
+                        static_cast<uint8_t>(m_bits >> 24)};
+      m_out.insert(m_out.end(), buf, buf + 4);
+      m_bits >>= 32;
+      m_count -= 32;
+    }
+  }
+
+  // pads with zero bits to a byte boundary and writes out all bits
+  void Align() {
+    while (m_count > 0) {
+      m_out.push_back(static_cast<uint8_t>(m_bits));
+      m_bits >>= 8;
+      m_count -= 8;
+    }
+    m_bits = 0;
+    m_count = 0;
+  }
+
+ private:
+  std::vector<uint8_t>& m_out;
+  uint64_t& m_savedBits;
+  int& m_savedCount;
+  uint64_t m_bits;
+  int m_count;
+};
+
+}  // namespace
+
+Deflater::Deflater(int windowBits)
+    : m_maxDist{static_cast<size_t>(1) << std::clamp(windowBits, 8, 15)},
+      m_buf(2 * kWindowSize),
+      m_head(kHashSize, -1),
+      m_prev(kWindowSize, -1) {
+  m_syms.reserve(kBlockSize);
+}
+
+void Deflater::Reset() {
+  m_pos = 0;
+  m_blockStart = 0;
+  m_syms.clear();
+  std::fill(m_head.begin(), m_head.end(), -1);
+}
+
+void Deflater::Compress(std::span<const uint8_t> data,
+                        std::vector<uint8_t>& out, bool flush) {
+  while (!data.empty()) {
+    if (m_pos == m_buf.size()) {
+      FlushBlock(out);
+      Slide();
+    }
+    size_t n = (std::min)({data.size(), m_buf.size() - m_pos, kBlockSize});
+    std::memcpy(m_buf.data() + m_pos, data.data(), n);
+    data = data.subspan(n);
+    Tokenize(m_pos, m_pos + n);
+    m_pos += n;
+    if (m_pos - m_blockStart >= kBlockSize) {
+      FlushBlock(out);
+    }
+  }
+  if (flush) {
+    FlushBlock(out);
+    // sync flush: empty stored block
+    BitWriter bw{out, m_bits, m_bitCount};
+    bw.Put(0, 3);
+    bw.Align();
+    const uint8_t marker[4] = {0x00, 0x00, 0xff, 0xff};
+    out.insert(out.end(), marker, marker + 4);
+  }
+}
+
+// Number of leading bytes that match, up to maxLen
+static inline size_t MatchLength(const uint8_t* a, const uint8_t* b,
+                                 size_t maxLen) {
+  size_t len = 0;
+  if constexpr (std::endian::native == std::endian::little) {
+    for (; len + 8 <= maxLen; len += 8) {
+      uint64_t x;
+      uint64_t y;
+      std::memcpy(&x, a + len, 8);
+      std::memcpy(&y, b + len, 8);
+      if (x != y) {
+        return len + (std::countr_zero(x ^ y) >> 3);
+      }
+    }
+  }
+  while (len < maxLen && a[len] == b[len]) {
+    ++len;
+  }
+  return len;
+}
+
+static inline uint32_t Hash(const uint8_t* p) {
+  uint32_t v = (static_cast<uint32_t>(p[0]) << 16) |
+               (static_cast<uint32_t>(p[1]) << 8) | p[2];
+  return (v * 2654435761u) >> (32 - kHashBits);
+}
+
+void Deflater::Tokenize(size_t start, size_t end) {
+  const uint8_t* buf = m_buf.data();
+  size_t p = start;
+  while (p < end) {
+    size_t bestLen = 0;
+    size_t bestDist = 0;
+    if (end - p >= kMinMatch) {
+      uint32_t h = Hash(buf + p);
+      int32_t cand = m_head[h];
+      m_prev[p & (kWindowSize - 1)] = cand;
+      m_head[h] = static_cast<int32_t>(p);
+      size_t maxLen = (std::min)(kMaxMatch, end - p);
+      for (int chain = kMaxChain; cand >= 0 && chain > 0; --chain) {
+        size_t dist = p - cand;
+        if (dist > m_maxDist) {
+          break;
+        }
+        // quick reject on the byte that would extend the best match
+        if (buf[cand + bestLen] == buf[p + bestLen]) {
+          size_t len = MatchLength(buf + cand, buf + p, maxLen);
+          if (len > bestLen) {
+            bestLen = len;
+            bestDist = dist;
+            if (len >= kNiceLength || len == maxLen) {
+              break;
+            }
+          }
+        }
+        int32_t next = m_prev[cand & (kWindowSize - 1)];
+        if (next >= cand) {
+          break;  // slot was reused by a newer position
+        }
+        cand = next;
+      }
+    }
+
+    if (bestLen >= kMinMatch) {
+      m_syms.push_back(
+          {static_cast<uint16_t>(bestDist), static_cast<uint16_t>(bestLen)});
+      // index the rest of the match so later data can refer into it
+      for (size_t q = p + 1; q < p + bestLen && end - q >= kMinMatch; ++q) {
+        uint32_t h = Hash(buf + q);
+        m_prev[q & (kWindowSize - 1)] = m_head[h];
+        m_head[h] = static_cast<int32_t>(q);
+      }
+      p += bestLen;
+    } else {
+      m_syms.push_back({0, buf[p]});
+      ++p;
+    }
+  }
+}
+
+void Deflater::Slide() {
+  std::memmove(m_buf.data(), m_buf.data() + kWindowSize, m_pos - kWindowSize);
+  m_pos -= kWindowSize;
+  m_blockStart -= kWindowSize;
+  auto adjust = [](int32_t& v) {
+    v = v >= static_cast<int32_t>(kWindowSize)
+            ? v - static_cast<int32_t>(kWindowSize)
+            : -1;
+  };
+  std::for_each(m_head.begin(), m_head.end(), adjust);
+  std::for_each(m_prev.begin(), m_prev.end(), adjust);
+}
+
+void Deflater::FlushBlock(std::vector<uint8_t>& out) {
+  if (m_syms.empty()) {
+    return;
+  }
+
+  uint32_t litFreq[kNumLitLen] = {};
+  uint32_t distFreq[kNumDist] = {};
+  for (auto&& sym : m_syms) {
+    if (sym.dist == 0) {
+      ++litFreq[sym.litlen];
+    } else {
+      ++litFreq[257 + LenCode(sym.litlen)];
+      ++distFreq[DistCode(sym.dist)];
+    }
+  }
+  litFreq[256] = 1;
+
+  uint64_t extraBits = 0;
+  for (int i = 0; i < 29; ++i) {
+    extraBits += static_cast<uint64_t>(litFreq[257 + i]) * kLenExtra[i];
+  }
+  for (int i = 0; i < kNumDist; ++i) {
+    extraBits += static_cast<uint64_t>(distFreq[i]) * kDistExtra[i];
+  }
+  uint64_t fixedBits = 3 + extraBits;
+  for (int i = 0; i < kNumLitLen; ++i) {
+    fixedBits += static_cast<uint64_t>(litFreq[i]) * FixedLitLen(i);
+  }
+  for (int i = 0; i < kNumDist; ++i) {
+    fixedBits += static_cast<uint64_t>(distFreq[i]) * 5;
+  }
+  size_t rawLen = m_pos - m_blockStart;
+  uint64_t storedBits = (rawLen / 65535 + 1) * (3 + 7 + 32) + rawLen * 8;
+
+  // the dynamic code header alone is tens of bytes, so it can't win for
+  // small blocks; skip building it
+  uint8_t litLens[kNumLitLen];
+  uint8_t distLens[kNumDist];
+  uint8_t clLens[kNumCodeLen];
+  struct Run {
+    uint8_t sym;
+    uint8_t extra;
+  };
+  Run runs[kNumLitLen + kNumDist];
+  int numRuns = 0;
+  int hlit = 0;
+  int hdist = 0;
+  int hclen = 0;
+  uint64_t dynamicBits = UINT64_MAX;
+  if (m_syms.size() >= kMinDynamicSymbols) {
+    BuildLengths(litFreq, kNumLitLen, kMaxBits, litLens);
+    BuildLengths(distFreq, kNumDist, kMaxBits, distLens);
+    if (std::all_of(distLens, distLens + kNumDist,
+                    [](uint8_t l) { return l == 0; })) {
+      distLens[0] = 1;
+      distLens[1] = 1;
+    }
+    hlit = kNumLitLen;
+    while (hlit > 257 && litLens[hlit - 1] == 0) {
+      --hlit;
+    }
+    hdist = kNumDist;
+    while (hdist > 1 && distLens[hdist - 1] == 0) {
+      --hdist;
+    }
+
+    // run-length encode the code lengths; hlit and hdist entries are
+    // contiguous in the stream, so pack them together first
+    uint8_t seq[kNumLitLen + kNumDist];
+    std::memcpy(seq, litLens, hlit);
+    std::memcpy(seq + hlit, distLens, hdist);
+    int seqLen = hlit + hdist;
+    uint32_t clFreq[kNumCodeLen] = {};
+    for (int i = 0; i < seqLen;) {
+      uint8_t v = seq[i];
+      int run = 1;
+      while (i + run < seqLen && seq[i + run] == v) {
+        ++run;
+      }
+      i += run;
+      if (v == 0) {
+        while (run >= 11) {
+          int n = (std::min)(run, 138);
+          runs[numRuns++] = {18, static_cast<uint8_t>(n - 11)};
+          run -= n;
+        }
+        if (run >= 3) {
+          runs[numRuns++] = {17, static_cast<uint8_t>(run - 3)};
+          run = 0;
+        }
+      } else {
+        runs[numRuns++] = {v, 0};
+        --run;
+        while (run >= 3) {
+          int n = (std::min)(run, 6);
+          runs[numRuns++] = {16, static_cast<uint8_t>(n - 3)};
+          run -= n;
+        }
+      }
+      while (run-- > 0) {
+        runs[numRuns++] = {v, 0};
+      }
+    }
+    for (int i = 0; i < numRuns; ++i) {
+      ++clFreq[runs[i].sym];
+    }
+    BuildLengths(clFreq, kNumCodeLen, kMaxCodeLenBits, clLens);
+    hclen = kNumCodeLen;
+    while (hclen > 4 && clLens[kCodeLenOrder[hclen - 1]] == 0) {
+      --hclen;
+    }
+
+    dynamicBits = 3 + 14 + 3 * hclen + extraBits;
+    for (int i = 0; i < kNumCodeLen; ++i) {
+      dynamicBits += static_cast<uint64_t>(clFreq[i]) * clLens[i];
+    }
+    dynamicBits += 2 * clFreq[16] + 3 * clFreq[17] + 7 * clFreq[18];
+    for (int i = 0; i < kNumLitLen; ++i) {
+      dynamicBits += static_cast<uint64_t>(litFreq[i]) * litLens[i];
+    }
+    for (int i = 0; i < kNumDist; ++i) {
+      dynamicBits += static_cast<uint64_t>(distFreq[i]) * distLens[i];
+    }
+  }
+
+  BitWriter bw{out, m_bits, m_bitCount};
+  auto writeSymbols = [&](const uint16_t* litCodes, const uint8_t* litLens,
+                          const uint16_t* distCodes, const uint8_t* distLens) {
+    for (auto&& sym : m_syms) {
+      if (sym.dist == 0) {
+        bw.Put(litCodes[sym.litlen], litLens[sym.litlen]);
+      } else {
+        int lc = LenCode(sym.litlen);
+        bw.Put(litCodes[257 + lc], litLens[257 + lc]);
+        bw.Put(sym.litlen - kLenBase[lc], kLenExtra[lc]);
+        int dc = DistCode(sym.dist);
+        bw.Put(distCodes[dc], distLens[dc]);
+        bw.Put(sym.dist - kDistBase[dc], kDistExtra[dc]);
+      }
+    }
+    bw.Put(litCodes[256], litLens[256]);
+  };
+  if (storedBits < dynamicBits && storedBits < fixedBits) {
+    const uint8_t* data = m_buf.data() + m_blockStart;
+    do {
+      size_t n = (std::min)(rawLen, static_cast<size_t>(65535));
+      bw.Put(0, 3);
+      bw.Align();
+      uint8_t hdr[4] = {static_cast<uint8_t>(n), static_cast<uint8_t>(n >> 8),
+                        static_cast<uint8_t>(~n), static_cast<uint8_t>(~n >> 8)};
+      out.insert(out.end(), hdr, hdr + 4);
+      out.insert(out.end(), data, data + n);
+      data += n;
+      rawLen -= n;
+    } while (rawLen > 0);
+  } else if (fixedBits <= dynamicBits) {
+    static const FixedCodes fixed;
+    bw.Put(2, 3);  // BFINAL=0, BTYPE=01
+    writeSymbols(fixed.litCodes, fixed.litLens, fixed.distCodes,
+                 fixed.distLens);
+  } else {
+    bw.Put(4, 3);  // BFINAL=0, BTYPE=10
+    bw.Put(hlit - 257, 5);
+    bw.Put(hdist - 1, 5);
+    bw.Put(hclen - 4, 4);
+    for (int i = 0; i < hclen; ++i) {
+      bw.Put(clLens[kCodeLenOrder[i]], 3);
+    }
+    uint16_t clCodes[kNumCodeLen];
+    BuildCodes(clLens, kNumCodeLen, clCodes);
+    for (int i = 0; i < numRuns; ++i) {
+      auto [sym, extra] = runs[i];
+      bw.Put(clCodes[sym], clLens[sym]);
+      if (sym == 16) {
+        bw.Put(extra, 2);
+      } else if (sym == 17) {
+        bw.Put(extra, 3);
+      } else if (sym == 18) {
+        bw.Put(extra, 7);
+      }
+    }
+    uint16_t litCodes[kNumLitLen];
+    uint16_t distCodes[kNumDist];
+    BuildCodes(litLens, kNumLitLen, litCodes);
+    BuildCodes(distLens, kNumDist, distCodes);
+    writeSymbols(litCodes, litLens, distCodes, distLens);
+  }
+
+  m_syms.clear();
+  m_blockStart = m_pos;
+}
+
+namespace {
+
+class BitReader {
+ public:
+  explicit BitReader(std::span<const uint8_t> data)
+      : m_p{data.data()}, m_end{data.data() + data.size()} {}
+
+  void Refill() {
+    while (m_count <= 56 && m_p != m_end) {
+      m_bits |= static_cast<uint64_t>(*m_p++) << m_count;
+      m_count += 8;
+    }
+  }
+
+  int GetCount() const { return m_count; }
+
+  // if fewer than n bits are available, the missing high bits are zero
+  uint32_t Peek(int n) const {
+    return static_cast<uint32_t>(m_bits & ((static_cast<uint64_t>(1) << n) - 1));
+  }
+
+  void Drop(int n) {
+    m_bits >>= n;
+    m_count -= n;
+  }
+
+  bool Get(int n, uint32_t* value) {
+    if (m_count < n) {
+      Refill();
+      if (m_count < n) {
+        return false;
+      }
+    }
+    *value = Peek(n);
+    Drop(n);
+    return true;
+  }
+
+  void AlignToByte() { Drop(m_count & 7); }
+
+  // true if only padding bits are left
+  bool AtEnd() const { return m_p == m_end && m_count < 8; }
+
+  // must be byte aligned
+  bool CopyBytes(size_t n, std::vector<uint8_t>& out) {
+    while (n > 0 && m_count >= 8) {
+      out.push_back(static_cast<uint8_t>(m_bits));
+      Drop(8);
+      --n;
+    }
+    if (n > static_cast<size_t>(m_end - m_p)) {
+      return false;
+    }
+    out.insert(out.end(), m_p, m_p + n);
+    m_p += n;
+    return true;
+  }
+
+ private:
+  const uint8_t* m_p;
+  const uint8_t* m_end;
+  uint64_t m_bits = 0;
+  int m_count = 0;
+};
+
+class Huffman {
+ public:
+  // returns false if the code is oversubscribed
+  bool Build(const uint8_t* lengths, int n) {
+    std::fill(std::begin(m_count), std::end(m_count), 0);
+    for (int i = 0; i < n; ++i) {
+      ++m_count[lengths[i]];
+    }
+    m_count[0] = 0;
+    int left = 1;
+    for (int len = 1; len <= kMaxBits; ++len) {
+      left <<= 1;
+      left -= m_count[len];
+      if (left < 0) {
+        return false;
+      }
+    }
+    uint16_t offs[kMaxBits + 1];
+    offs[1] = 0;
+    for (int len = 1; len < kMaxBits; ++len) {
+      offs[len + 1] = offs[len] + m_count[len];
+    }
+    for (int i = 0; i < n; ++i) {
+      if (lengths[i] != 0) {
+        m_symbol[offs[lengths[i]]++] = i;
+      }
+    }
+
+    // codes of up to kFastBits bits are decoded with a single lookup
+    std::fill(std::begin(m_fast), std::end(m_fast), 0);
+    uint32_t code = 0;
+    int index = 0;
+    for (int len = 1; len <= kFastBits; ++len) {
+      for (int k = 0; k < m_count[len]; ++k) {
+        uint16_t entry = (m_symbol[index++] << 4) | len;
+        for (uint32_t fill = ReverseBits(code++, len); fill < kFastSize;
+             fill += 1u << len) {
+          m_fast[fill] = entry;
+        }
+      }
+      code <<= 1;
+    }
+    return true;
+  }
+
+  // returns -1 on error
+  int Decode(BitReader& br) const {
+    if (br.GetCount() < kMaxBits) {
+      br.Refill();
+    }
+    uint16_t entry = m_fast[br.Peek(kFastBits)];
+    if (entry != 0) {
+      int len = entry & 15;
+      if (len > br.GetCount()) {
+        return -1;
+      }
+      br.Drop(len);
+      return entry >> 4;
+    }
+    uint32_t bits = br.Peek(kMaxBits);
+    int code = 0;
+    int first = 0;
+    int index = 0;
+    for (int len = 1; len <= kMaxBits && len <= br.GetCount(); ++len) {
+      code |= (bits >> (len - 1)) & 1;
+      int count = m_count[len];
+      if (code - first < count) {
+        br.Drop(len);
+        return m_symbol[index + code - first];
+      }
+      index += count;
+      first += count;
+      first <<= 1;
+      code <<= 1;
+    }
+    return -1;
+  }
+
+ private:
+  static constexpr int kFastBits = 9;
+  static constexpr uint32_t kFastSize = 1u << kFastBits;
+
+  uint16_t m_fast[kFastSize];
+  uint16_t m_count[kMaxBits + 1];
+  uint16_t m_symbol[kNumFixedLitLen];
+};
+
+struct FixedHuffman {
+  FixedHuffman() {
+    uint8_t lens[kNumFixedLitLen];
+    for (int i = 0; i < kNumFixedLitLen; ++i) {
+      lens[i] = FixedLitLen(i);
+    }
+    lit.Build(lens, kNumFixedLitLen);
+    std::fill(lens, lens + 30, 5);
+    dist.Build(lens, 30);
+  }
+
+  Huffman lit;
+  Huffman dist;
+};
+
+}  // namespace
+
+static Inflater::Result InflateCodes(BitReader& br, const Huffman& lit,
+                                     const Huffman& dist,
+                                     const std::vector<uint8_t>& history,
+                                     size_t outStart, size_t maxSize,
+                                     std::vector<uint8_t>& out) {
+  for (;;) {
+    int sym = lit.Decode(br);
+    if (sym < 0) {
+      return Inflater::kInvalid;
+    }
+    if (sym < 256) {
+      if (out.size() - outStart >= maxSize) {
+        return Inflater::kTooLarge;
+      }
+      out.push_back(sym);
+      continue;
+    }
+    if (sym == 256) {
+      return Inflater::kOk;
+    }
+    sym -= 257;
+    if (sym >= 29) {
+      return Inflater::kInvalid;
+    }
+    uint32_t extra;
+    if (!br.Get(kLenExtra[sym], &extra)) {
+      return Inflater::kInvalid;
+    }
+    size_t len = kLenBase[sym] + extra;
+    int dsym = dist.Decode(br);
+    if (dsym < 0 || dsym >= kNumDist) {
+      return Inflater::kInvalid;
+    }
+    if (!br.Get(kDistExtra[dsym], &extra)) {
+      return Inflater::kInvalid;
+    }
+    size_t d = kDistBase[dsym] + extra;
+
+    size_t produced = out.size() - outStart;
+    if (d > produced + history.size()) {
+      return Inflater::kInvalid;
+    }
+    if (produced + len > maxSize) {
+      return Inflater::kTooLarge;
+    }
+    size_t pos = out.size();
+    out.resize(pos + len);
+    uint8_t* dst = out.data() + pos;
+    size_t k = 0;
+    if (d > produced) {
+      // starts in the history from previous calls
+      size_t back = d - produced;
+      k = (std::min)(back, len);
+      std::memcpy(dst, history.data() + history.size() - back, k);
+    }
+    // may overlap the bytes being written, so copy forwards byte by byte
+    for (const uint8_t* src = dst - d; k < len; ++k) {
+      dst[k] = src[k];
+    }
+  }
+}
+
+Inflater::Inflater(bool keepHistory) : m_keepHistory{keepHistory} {}
+
+Inflater::Result Inflater::Inflate(std::span<const uint8_t> data,
+                                   size_t maxSize, std::vector<uint8_t>& out) {
+  static const FixedHuffman fixed;
+  size_t outStart = out.size();
+  BitReader br{data};
+  for (;;) {
+    br.Refill();
+    if (br.AtEnd()) {
+      break;
+    }
+    uint32_t hdr;
+    if (!br.Get(3, &hdr)) {
+      return kInvalid;
+    }
+    uint32_t type = hdr >> 1;
+    if (type == 0) {
+      br.AlignToByte();
+      uint32_t len, nlen;
+      if (!br.Get(16, &len) || !br.Get(16, &nlen) || (len ^ 0xffff) != nlen) {
+        return kInvalid;
+      }
+      if (out.size() - outStart + len > maxSize) {
+        return kTooLarge;
+      }
+      if (!br.CopyBytes(len, out)) {
+        return kInvalid;
+      }
+    } else if (type == 1) {
+      Result result = InflateCodes(br, fixed.lit, fixed.dist, m_history,
+                                   outStart, maxSize, out);
+      if (result != kOk) {
+        return result;
+      }
+    } else if (type == 2) {
+      uint32_t hlit, hdist, hclen;
+      if (!br.Get(5, &hlit) || !br.Get(5, &hdist) || !br.Get(4, &hclen)) {
+        return kInvalid;
+      }
+      hlit += 257;
+      hdist += 1;
+      hclen += 4;
+      if (hlit > kNumLitLen || hdist > kNumDist) {
+        return kInvalid;
+      }
+      uint8_t clLens[kNumCodeLen] = {};
+      for (uint32_t i = 0; i < hclen; ++i) {
+        uint32_t v;
+        if (!br.Get(3, &v)) {
+          return kInvalid;
+        }
+        clLens[kCodeLenOrder[i]] = v;
+      }
+      Huffman cl;
+      if (!cl.Build(clLens, kNumCodeLen)) {
+        return kInvalid;
+      }
+      uint8_t lens[kNumLitLen + kNumDist] = {};
+      for (uint32_t i = 0; i < hlit + hdist;) {
+        int sym = cl.Decode(br);
+        if (sym < 0) {
+          return kInvalid;
+        }
+        if (sym < 16) {
+          lens[i++] = sym;
+          continue;
+        }
+        uint8_t v = 0;
+        uint32_t rep;
+        if (sym == 16) {
+          if (i == 0 || !br.Get(2, &rep)) {
+            return kInvalid;
+          }
+          v = lens[i - 1];
+          rep += 3;
+        } else if (sym == 17) {
+          if (!br.Get(3, &rep)) {
+            return kInvalid;
+          }
+          rep += 3;
+        } else {
+          if (!br.Get(7, &rep)) {
+            return kInvalid;
+          }
+          rep += 11;
+        }
+        if (i + rep > hlit + hdist) {
+          return kInvalid;
+        }
+        std::fill(lens + i, lens + i + rep, v);
+        i += rep;
+      }
+      if (lens[256] == 0) {
+        return kInvalid;
+      }
+      Huffman lit;
+      Huffman dist;
+      if (!lit.Build(lens, hlit) || !dist.Build(lens + hlit, hdist)) {
+        return kInvalid;
+      }
+      Result result =
+          InflateCodes(br, lit, dist, m_history, outStart, maxSize, out);
+      if (result != kOk) {
+        return result;
+      }
+    } else {
+      return kInvalid;
+    }
+    if ((hdr & 1) != 0) {
+      break;  // BFINAL
+    }
+  }
+
+  if (m_keepHistory) {
+    std::span<const uint8_t> produced{out.data() + outStart,
+                                      out.size() - outStart};
+    if (produced.size() >= kWindowSize) {
+      m_history.assign(produced.end() - kWindowSize, produced.end());
+    } else {
+      m_history.insert(m_history.end(), produced.begin(), produced.end());
+      if (m_history.size() > kWindowSize) {
+        m_history.erase(m_history.begin(),
+                        m_history.end() - kWindowSize);
+      }
+    }
+  }
+  return kOk;
+}
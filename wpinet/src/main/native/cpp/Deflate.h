@@ -0,0 +1,113 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <span>
+#include <vector>
+
+namespace wpi::detail {
+
+/**
+ * Raw DEFLATE (RFC 1951) compressor, as used by the WebSocket
+ * permessage-deflate extension. Matches may refer back into data from
+ * previous calls until Reset() is called ("context takeover").
+ *
+ * This is a fast single-pass LZ77 compressor with short hash chains; each
+ * block is emitted with dynamic Huffman codes, fixed codes, or stored,
+ * whichever is smallest.
+ */
+class Deflater {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param windowBits log2 of the maximum match distance (8 to 15)
+   */
+  explicit Deflater(int windowBits = 15);
+
+  /**
+   * Discards the history, so the next output does not depend on previous
+   * input.
+   */
+  void Reset();
+
+  /**
+   * Compresses data, appending the compressed bytes to out. If flush is true,
+   * all pending output is written, ending with a sync flush (an empty stored
+   * block, so the output ends on a byte boundary with 00 00 FF FF).
+   *
+   * @param data input data
+   * @param out output buffer (appended to)
+   * @param flush true to flush all pending output
+   */
+  void Compress(std::span<const uint8_t> data, std::vector<uint8_t>& out,
+                bool flush);
+
+ private:
+  struct Symbol {
+    uint16_t dist;    // 0 for literals
+    uint16_t litlen;  // literal byte or match length
+  };
+
+  void Tokenize(size_t start, size_t end);
+  void Slide();
+  void FlushBlock(std::vector<uint8_t>& out);
+
+  size_t m_maxDist;
+  std::vector<uint8_t> m_buf;  // history followed by pending input
+  size_t m_pos = 0;            // end of data in m_buf
+  size_t m_blockStart = 0;     // start of data not yet emitted in a block
+  std::vector<int32_t> m_head;
+  std::vector<int32_t> m_prev;
+  std::vector<Symbol> m_syms;
+
+  // bit output state; always flushed to a byte boundary by a sync flush
+  uint64_t m_bits = 0;
+  int m_bitCount = 0;
+};
+
+/**
+ * Raw DEFLATE (RFC 1951) decompressor, as used by the WebSocket
+ * permessage-deflate extension. Each call to Inflate() must be passed input
+ * that ends on a block boundary; back-references into the output of previous
+ * calls are resolved from a 32 KiB history window.
+ */
+class Inflater {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param keepHistory if false, each call is independent and no history is
+   *                    kept between calls
+   */
+  explicit Inflater(bool keepHistory = true);
+
+  enum Result { kOk, kInvalid, kTooLarge };
+
+  /**
+   * Discards the history.
+   */
+  void Reset() { m_history.clear(); }
+
+  /**
+   * Decompresses data, appending to out.
+   *
+   * @param data compressed data
+   * @param maxSize maximum number of bytes to output
+   * @param out output buffer (appended to)
+   * @return kInvalid if the data is invalid, kTooLarge if the output would
+   *         exceed maxSize
+   */
+  Result Inflate(std::span<const uint8_t> data, size_t maxSize,
+                 std::vector<uint8_t>& out);
+
+ private:
+  std::vector<uint8_t> m_history;
+  bool m_keepHistory;
+};
+
+}  // namespace wpi::detail
@@ -10,6 +10,7 @@
 #include <span>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
 
 #include <wpi/Base64.h>
@@ -21,6 +22,7 @@
 #include <wpi/sha1.h>
 
 #include "WebSocketDebug.h"
+#include "WebSocketDeflate.h"
 #include "WebSocketSerializer.h"
 #include "wpinet/HttpParser.h"
 #include "wpinet/raw_uv_ostream.h"
@@ -141,6 +143,10 @@ class WebSocket::ClientHandshakeData {
   bool hasAccept = false;
   bool hasProtocol = false;
 
+  // compression offer and negotiated result
+  WebSocket::DeflateOptions deflateOptions;
+  std::optional<detail::DeflateParams> deflateParams;
+
   std::weak_ptr<uv::Timer> timer;
 };
 
@@ -187,7 +193,17 @@ std::shared_ptr<WebSocket> WebSocket::CreateServer(uv::Stream& stream,
                                                    std::string_view protocol) {
   auto ws = std::make_shared<WebSocket>(stream, true, private_init{});
   stream.SetData(ws);
-  ws->StartServer(key, version, protocol);
+  ws->StartServer(key, version, protocol, {}, {});
+  return ws;
+}
+
+std::shared_ptr<WebSocket> WebSocket::CreateServer(
+    uv::Stream& stream, std::string_view key, std::string_view version,
+    std::string_view protocol, std::string_view extensions,
+    const DeflateOptions& deflate) {
+  auto ws = std::make_shared<WebSocket>(stream, true, private_init{});
+  stream.SetData(ws);
+  ws->StartServer(key, version, protocol, extensions, deflate);
   return ws;
 }
 
@@ -249,6 +265,14 @@ void WebSocket::StartClient(std::string_view uri, std::string_view host,
     os << "\r\n";
   }
 
+  // compression (if requested)
+  if (options.deflate.enable) {
+    os << "Sec-WebSocket-Extensions: ";
+    detail::WriteDeflateOffer(os, options.deflate);
+    os << "\r\n";
+    m_clientHandshake->deflateOptions = options.deflate;
+  }
+
   // other headers
   for (auto&& header : options.extraHeaders) {
     os << header.first << ": " << header.second << "\r\n";
@@ -292,9 +316,22 @@ void WebSocket::StartClient(std::string_view uri, std::string_view host,
           }
           m_clientHandshake->hasAccept = true;
         } else if (equals_lower(name, "sec-websocket-extensions")) {
-          // No extensions are supported
-          if (!value.empty()) {
-            return Terminate(1010, "unsupported extension");
+          // Only permessage-deflate is supported, and only if we offered it
+          while (!value.empty()) {
+            std::string_view extension;
+            std::tie(extension, value) = split(value, ',');
+            if (trim(extension).empty()) {
+              continue;
+            }
+            if (!m_clientHandshake->deflateOptions.enable ||
+                m_clientHandshake->deflateParams) {
+              return Terminate(1010, "unsupported extension");
+            }
+            m_clientHandshake->deflateParams =
+                detail::ParseDeflateExtension(extension, true);
+            if (!m_clientHandshake->deflateParams) {
+              return Terminate(1010, "unsupported extension");
+            }
           }
         } else if (equals_lower(name, "sec-websocket-protocol")) {
           // Make sure it was one of the provided protocols
@@ -319,6 +356,11 @@ void WebSocket::StartClient(std::string_view uri, std::string_view host,
          !m_clientHandshake->protocols.empty())) {
       return Terminate(1002, "invalid response");
     }
+    if (auto& params = m_clientHandshake->deflateParams) {
+      params->clientNoContextTakeover |=
+          m_clientHandshake->deflateOptions.noContextTakeover;
+      m_deflate = std::make_unique<detail::PerMessageDeflate>(*params, false);
+    }
     if (m_state == CONNECTING) {
       m_state = OPEN;
       open(m_protocol);
@@ -337,7 +379,9 @@ void WebSocket::StartClient(std::string_view uri, std::string_view host,
 }
 
 void WebSocket::StartServer(std::string_view key, std::string_view version,
-                            std::string_view protocol) {
+                            std::string_view protocol,
+                            std::string_view extensions,
+                            const DeflateOptions& deflate) {
   m_protocol = protocol;
 
   // Build server response
@@ -372,6 +416,15 @@ void WebSocket::StartServer(std::string_view key, std::string_view version,
     os << "Sec-WebSocket-Protocol: " << protocol << "\r\n";
   }
 
+  if (deflate.enable && !extensions.empty()) {
+    SmallString<128> extBuf;
+    raw_svector_ostream extOs{extBuf};
+    if (auto params = detail::NegotiateDeflate(extensions, deflate, extOs)) {
+      os << "Sec-WebSocket-Extensions: " << extBuf.str() << "\r\n";
+      m_deflate = std::make_unique<detail::PerMessageDeflate>(*params, true);
+    }
+  }
+
   // end headers
   os << "\r\n";
 
@@ -415,17 +468,6 @@ void WebSocket::Shutdown() {
   m_stream.Shutdown([this] { m_stream.Close(); });
 }
 
-static inline void Unmask(std::span<uint8_t> data,
-                          std::span<const uint8_t, 4> key) {
-  int n = 0;
-  for (uint8_t& ch : data) {
-    ch ^= key[n++];
-    if (n >= 4) {
-      n = 0;
-    }
-  }
-}
-
 void WebSocket::HandleIncoming(uv::Buffer& buf, size_t size) {
   m_lastReceivedTime = m_stream.GetLoopRef().Now().count();
 
@@ -469,9 +511,15 @@ void WebSocket::HandleIncoming(uv::Buffer& buf, size_t size) {
           return;  // need more data
         }
 
-        // Validate RSV bits are zero
-        if ((m_header[0] & 0x70) != 0) {
-          return Fail(1002, "nonzero RSV");
+        // Validate RSV bits are zero, except RSV1 on the first frame of a
+        // compressed message
+        uint8_t rsv = m_header[0] & 0x70;
+        if (rsv != 0) {
+          uint8_t opcode = m_header[0] & kOpMask;
+          if (rsv != detail::kFlagRsv1 || !m_deflate ||
+              (opcode != kOpText && opcode != kOpBinary)) {
+            return Fail(1002, "nonzero RSV");
+          }
         }
       }
 
@@ -556,34 +604,57 @@ void WebSocket::HandleIncoming(uv::Buffer& buf, size_t size) {
         // We have a complete frame
         // If the message had masking, unmask it
         if ((m_header[1] & kFlagMasking) != 0) {
-          Unmask(control ? std::span{m_controlPayload}
-                         : std::span{m_payload}.subspan(m_frameStart),
-                 std::span<const uint8_t, 4>{&m_header[m_headerSize - 4], 4});
+          std::span<uint8_t> masked =
+              control ? std::span{m_controlPayload}
+                      : std::span{m_payload}.subspan(m_frameStart);
+          detail::MaskPayload(
+              masked.data(), masked.data(), masked.size(),
+              std::span<const uint8_t, 4>{&m_header[m_headerSize - 4], 4});
         }
 
         // Handle message
         bool fin = (m_header[0] & kFlagFin) != 0;
         uint8_t opcode = m_header[0] & kOpMask;
+        if (opcode == kOpText || opcode == kOpBinary) {
+          m_recvCompressed = (m_header[0] & detail::kFlagRsv1) != 0;
+        }
+
+        // Compressed messages are always combined and decompressed as a whole
+        bool compressed = !control && m_recvCompressed;
+        bool combine = m_combineFragments || compressed;
+        std::span<const uint8_t> payload = m_payload;
+        if (compressed && fin) {
+          switch (m_deflate->Decompress(m_payload, m_maxMessageSize)) {
+            case detail::Inflater::kOk:
+              break;
+            case detail::Inflater::kTooLarge:
+              return Fail(1009, "message too large");
+            default:
+              return Fail(1007, "invalid compressed data");
+          }
+          payload = m_deflate->GetDecompressed();
+        }
+
         switch (opcode) {
           case kOpCont:
-            WS_DEBUG(m_stream, "WS Fragment {} [{}]", m_payload.size(),
-                     DebugBinary(m_payload));
+            WS_DEBUG(m_stream, "WS Fragment {} [{}]", payload.size(),
+                     DebugBinary(payload));
             switch (m_fragmentOpcode) {
               case kOpText:
-                if (!m_combineFragments || fin) {
+                if (!combine || fin) {
                   std::string_view content{
-                      reinterpret_cast<char*>(m_payload.data()),
-                      m_payload.size()};
+                      reinterpret_cast<const char*>(payload.data()),
+                      payload.size()};
                   WS_DEBUG(m_stream, "WS RecvText(Defrag) {} ({})",
-                           m_payload.size(), DebugText(content));
+                           payload.size(), DebugText(content));
                   text(content, fin);
                 }
                 break;
               case kOpBinary:
-                if (!m_combineFragments || fin) {
+                if (!combine || fin) {
                   WS_DEBUG(m_stream, "WS RecvBinary(Defrag) {} ({})",
-                           m_payload.size(), DebugBinary(m_payload));
-                  binary(m_payload, fin);
+                           payload.size(), DebugBinary(payload));
+                  binary(payload, fin);
                 }
                 break;
               default:
@@ -595,20 +666,20 @@ void WebSocket::HandleIncoming(uv::Buffer& buf, size_t size) {
             }
             break;
           case kOpText: {
-            std::string_view content{reinterpret_cast<char*>(m_payload.data()),
-                                     m_payload.size()};
+            std::string_view content{
+                reinterpret_cast<const char*>(payload.data()), payload.size()};
             if (m_fragmentOpcode != 0) {
               WS_DEBUG(m_stream, "WS RecvText {} ({}) -> INCOMPLETE FRAGMENT",
-                       m_payload.size(), DebugText(content));
+                       payload.size(), DebugText(content));
               return Fail(1002, "incomplete fragment");
             }
-            if (!m_combineFragments || fin) {
-              WS_DEBUG(m_stream, "WS RecvText {} ({})", m_payload.size(),
+            if (!combine || fin) {
+              WS_DEBUG(m_stream, "WS RecvText {} ({})", payload.size(),
                        DebugText(content));
               text(content, fin);
             }
             if (!fin) {
-              WS_DEBUG(m_stream, "WS RecvText {} StartFrag", m_payload.size());
+              WS_DEBUG(m_stream, "WS RecvText {} StartFrag", payload.size());
               m_fragmentOpcode = opcode;
             }
             break;
@@ -616,17 +687,17 @@ void WebSocket::HandleIncoming(uv::Buffer& buf, size_t size) {
           case kOpBinary:
             if (m_fragmentOpcode != 0) {
               WS_DEBUG(m_stream, "WS RecvBinary {} ({}) -> INCOMPLETE FRAGMENT",
-                       m_payload.size(), DebugBinary(m_payload));
+                       payload.size(), DebugBinary(payload));
               return Fail(1002, "incomplete fragment");
             }
-            if (!m_combineFragments || fin) {
-              WS_DEBUG(m_stream, "WS RecvBinary {} ({})", m_payload.size(),
-                       DebugBinary(m_payload));
-              binary(m_payload, fin);
+            if (!combine || fin) {
+              WS_DEBUG(m_stream, "WS RecvBinary {} ({})", payload.size(),
+                       DebugBinary(payload));
+              binary(payload, fin);
             }
             if (!fin) {
               WS_DEBUG(m_stream, "WS RecvBinary {} StartFrag",
-                       m_payload.size());
+                       payload.size());
               m_fragmentOpcode = opcode;
             }
             break;
@@ -694,7 +765,10 @@ void WebSocket::HandleIncoming(uv::Buffer& buf, size_t size) {
         // Prepare for next message
         m_header.clear();
         m_headerSize = 0;
-        if (!m_combineFragments || fin) {
+        if (fin && !control) {
+          m_recvCompressed = false;
+        }
+        if (!combine || fin) {
           if (control) {
             m_controlPayload.clear();
           } else {
@@ -759,7 +833,7 @@ void WebSocket::SendFrames(
   int numBytes = 0;
   for (auto&& frame : frames) {
     VerboseDebug(frame);
-    numBytes += req->m_frames.AddFrame(frame, m_server);
+    numBytes += req->m_frames.AddFrame(frame, m_server, m_deflate.get());
     req->m_continueFrameOffs.emplace_back(numBytes);
     req->m_userBufs.append(frame.data.begin(), frame.data.end());
   }
@@ -797,6 +871,13 @@ std::span<const WebSocket::Frame> WebSocket::TrySendFrames(
     return frames;
   }
 
+  // The compressor state advances as frames are serialized, so every frame
+  // that is serialized must be sent; queue all of them
+  if (m_deflate) {
+    SendFrames(frames, std::move(callback));
+    return {};
+  }
+
   return detail::TrySendFrames(
       m_server, m_stream, frames,
       [this](std::function<void(std::span<uv::Buffer>, uv::Error)>&& cb) {
@@ -0,0 +1,178 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "WebSocketDeflate.h"
+
+#include <iterator>
+#include <tuple>
+
+#include <fmt/format.h>
+#include <wpi/StringExtras.h>
+#include <wpi/raw_ostream.h>
+
+using namespace wpi;
+using namespace wpi::detail;
+
+// unfragmented messages smaller than this are sent uncompressed
+static constexpr size_t kMinCompressSize = 64;
+
+std::optional<DeflateParams> detail::ParseDeflateExtension(
+    std::string_view extension, bool response) {
+  auto [name, rest] = split(extension, ';');
+  if (!equals_lower(trim(name), "permessage-deflate")) {
+    return std::nullopt;
+  }
+
+  DeflateParams params;
+  bool seenServerNoContext = false;
+  bool seenClientNoContext = false;
+  bool seenServerBits = false;
+  bool seenClientBits = false;
+  auto parseBits = [](std::string_view value) -> std::optional<int> {
+    if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+      value = value.substr(1, value.size() - 2);
+    }
+    auto bits = parse_integer<int>(value, 10);
+    if (!bits || *bits < 8 || *bits > 15) {
+      return std::nullopt;
+    }
+    return bits;
+  };
+
+  while (!rest.empty()) {
+    std::string_view param;
+    std::tie(param, rest) = split(rest, ';');
+    bool hasValue = param.find('=') != std::string_view::npos;
+    auto [key, value] = split(param, '=');
+    key = trim(key);
+    value = trim(value);
+    if (equals_lower(key, "server_no_context_takeover")) {
+      if (seenServerNoContext || hasValue) {
+        return std::nullopt;
+      }
+      seenServerNoContext = true;
+      params.serverNoContextTakeover = true;
+    } else if (equals_lower(key, "client_no_context_takeover")) {
+      if (seenClientNoContext || hasValue) {
+        return std::nullopt;
+      }
+      seenClientNoContext = true;
+      params.clientNoContextTakeover = true;
+    } else if (equals_lower(key, "server_max_window_bits")) {
+      auto bits = parseBits(value);
+      if (seenServerBits || !bits) {
+        return std::nullopt;
+      }
+      seenServerBits = true;
+      params.serverMaxWindowBits = *bits;
+    } else if (equals_lower(key, "client_max_window_bits")) {
+      if (seenClientBits) {
+        return std::nullopt;
+      }
+      seenClientBits = true;
+      // a value is optional in an offer, but required in a response
+      if (hasValue) {
+        auto bits = parseBits(value);
+        if (!bits) {
+          return std::nullopt;
+        }
+        params.clientMaxWindowBits = *bits;
+      } else if (response) {
+        return std::nullopt;
+      }
+    } else {
+      return std::nullopt;
+    }
+  }
+  return params;
+}
+
+void detail::WriteDeflateOffer(raw_ostream& os,
+                               const WebSocket::DeflateOptions& opts) {
+  os << "permessage-deflate; client_max_window_bits";
+  if (opts.noContextTakeover) {
+    os << "; client_no_context_takeover";
+  }
+  if (opts.peerNoContextTakeover) {
+    os << "; server_no_context_takeover";
+  }
+}
+
+std::optional<DeflateParams> detail::NegotiateDeflate(
+    std::string_view extensions, const WebSocket::DeflateOptions& opts,
+    raw_ostream& os) {
+  while (!extensions.empty()) {
+    std::string_view extension;
+    std::tie(extension, extensions) = split(extensions, ',');
+    auto params = ParseDeflateExtension(extension, false);
+    if (!params) {
+      continue;
+    }
+    params->serverNoContextTakeover |= opts.noContextTakeover;
+    params->clientNoContextTakeover |= opts.peerNoContextTakeover;
+
+    os << "permessage-deflate";
+    if (params->serverNoContextTakeover) {
+      os << "; server_no_context_takeover";
+    }
+    if (params->clientNoContextTakeover) {
+      os << "; client_no_context_takeover";
+    }
+    if (params->serverMaxWindowBits != 15) {
+      os << fmt::format("; server_max_window_bits={}",
+                        params->serverMaxWindowBits);
+    }
+    return params;
+  }
+  return std::nullopt;
+}
+
+PerMessageDeflate::PerMessageDeflate(const DeflateParams& params, bool server)
+    : m_deflater{server ? params.serverMaxWindowBits
+                        : params.clientMaxWindowBits},
+      m_inflater{!(server ? params.clientNoContextTakeover
+                          : params.serverNoContextTakeover)},
+      m_resetDeflater{server ? params.serverNoContextTakeover
+                             : params.clientNoContextTakeover} {}
+
+std::optional<std::span<const uint8_t>> PerMessageDeflate::Compress(
+    const WebSocket::Frame& frame, uint8_t* opcode) {
+  bool fin = (frame.opcode & WebSocket::kFlagFin) != 0;
+  if ((frame.opcode & WebSocket::kOpMask) != WebSocket::kOpCont) {
+    // first frame of a message
+    size_t size = 0;
+    for (auto&& buf : frame.data) {
+      size += buf.len;
+    }
+    m_compressing = !fin || size >= kMinCompressSize;
+    *opcode = frame.opcode | kFlagRsv1;
+  } else {
+    *opcode = frame.opcode;
+  }
+  if (!m_compressing) {
+    return std::nullopt;
+  }
+
+  m_out.clear();
+  for (auto&& buf : frame.data) {
+    m_deflater.Compress(buf.bytes(), m_out, false);
+  }
+  m_deflater.Compress({}, m_out, true);
+  if (fin) {
+    // the 00 00 FF FF sync flush trailer is implied at the end of a message
+    m_out.resize(m_out.size() - 4);
+    if (m_resetDeflater) {
+      m_deflater.Reset();
+    }
+  }
+  return m_out;
+}
+
+Inflater::Result PerMessageDeflate::Decompress(
+    SmallVectorImpl<uint8_t>& payload, size_t maxSize) {
+  static const uint8_t trailer[] = {0x00, 0x00, 0xff, 0xff};
+  payload.append(std::begin(trailer), std::end(trailer));
+  m_inflated.clear();
+  return m_inflater.Inflate(payload, maxSize, m_inflated);
+}
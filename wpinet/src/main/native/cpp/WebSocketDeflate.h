@@ -0,0 +1,112 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <wpi/SmallVector.h>
+
+#include "Deflate.h"
+#include "wpinet/WebSocket.h"
+
+namespace wpi {
+class raw_ostream;
+}  // namespace wpi
+
+namespace wpi::detail {
+
+// RSV1 marks the first frame of a compressed message
+inline constexpr uint8_t kFlagRsv1 = 0x40;
+
+/**
+ * Negotiated permessage-deflate (RFC 7692) parameters.
+ */
+struct DeflateParams {
+  bool serverNoContextTakeover = false;
+  bool clientNoContextTakeover = false;
+  int serverMaxWindowBits = 15;
+  int clientMaxWindowBits = 15;
+};
+
+/**
+ * Parses a single permessage-deflate extension offer (server) or response
+ * (client) from a Sec-WebSocket-Extensions header value, i.e. one
+ * comma-separated element. Returns nullopt if the element is not
+ * permessage-deflate or has invalid or unknown parameters.
+ *
+ * @param extension extension element
+ * @param response true if parsing the server response (client side)
+ */
+std::optional<DeflateParams> ParseDeflateExtension(std::string_view extension,
+                                                   bool response);
+
+/**
+ * Writes the Sec-WebSocket-Extensions header value for a client offer.
+ */
+void WriteDeflateOffer(raw_ostream& os, const WebSocket::DeflateOptions& opts);
+
+/**
+ * Selects the first acceptable permessage-deflate offer from a
+ * Sec-WebSocket-Extensions header value (server side), applying the server
+ * options. Writes the response header value to os.
+ *
+ * @return Negotiated parameters, or nullopt if no offer was acceptable
+ */
+std::optional<DeflateParams> NegotiateDeflate(
+    std::string_view extensions, const WebSocket::DeflateOptions& opts,
+    raw_ostream& os);
+
+/**
+ * Per-connection permessage-deflate state.
+ */
+class PerMessageDeflate {
+ public:
+  PerMessageDeflate(const DeflateParams& params, bool server);
+
+  /**
+   * Compresses an outgoing text, binary, or continuation frame. Messages
+   * smaller than a threshold are not compressed; the decision is made on the
+   * first frame of each message and applies to the whole message.
+   *
+   * @param frame frame to send
+   * @param opcode opcode to send (RSV1 set on the first frame of a compressed
+   *               message); only valid if the return value is not empty
+   * @return Compressed payload, or nullopt if the frame should be sent
+   *         uncompressed. Valid until the next call.
+   */
+  std::optional<std::span<const uint8_t>> Compress(
+      const WebSocket::Frame& frame, uint8_t* opcode);
+
+  /**
+   * Decompresses a complete incoming message. The payload buffer is modified
+   * (the sync flush trailer is appended). On success, the result is available
+   * from GetDecompressed().
+   *
+   * @param payload compressed message payload
+   * @param maxSize maximum decompressed message size
+   */
+  Inflater::Result Decompress(SmallVectorImpl<uint8_t>& payload,
+                              size_t maxSize);
+
+  /**
+   * Gets the most recently decompressed message.
+   */
+  std::span<const uint8_t> GetDecompressed() const { return m_inflated; }
+
+ private:
+  Deflater m_deflater;
+  Inflater m_inflater;
+  bool m_resetDeflater;
+  bool m_compressing = false;
+  std::vector<uint8_t> m_out;
+  std::vector<uint8_t> m_inflated;
+};
+
+}  // namespace wpi::detail
@@ -4,13 +4,59 @@
 
 #include "WebSocketSerializer.h"
 
+#include <cstring>
 #include <random>
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define WPINET_MASK_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define WPINET_MASK_NEON
+#endif
+
+#include "WebSocketDeflate.h"
+
 using namespace wpi::detail;
 
 static constexpr uint8_t kFlagMasking = 0x80;
 static constexpr size_t kWriteAllocSize = 4096;
 
+void wpi::detail::MaskPayload(uint8_t* dst, const uint8_t* src, size_t len,
+                              std::span<const uint8_t, 4> key, size_t offset) {
+  // rotate the key so k[0] applies to src[0]; since every stride below is a
+  // multiple of 4, the key then stays in phase
+  uint8_t k[16];
+  for (int i = 0; i < 16; ++i) {
+    k[i] = key[(offset + i) & 3];
+  }
+  size_t i = 0;
+#if defined(WPINET_MASK_SSE2)
+  __m128i k128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(k));
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_xor_si128(v, k128));
+  }
+#elif defined(WPINET_MASK_NEON)
+  uint8x16_t k128 = vld1q_u8(k);
+  for (; i + 16 <= len; i += 16) {
+    vst1q_u8(dst + i, veorq_u8(vld1q_u8(src + i), k128));
+  }
+#endif
+  uint64_t k64;
+  std::memcpy(&k64, k, 8);
+  for (; i + 8 <= len; i += 8) {
+    uint64_t v;
+    std::memcpy(&v, src + i, 8);
+    v ^= k64;
+    std::memcpy(dst + i, &v, 8);
+  }
+  for (; i < len; ++i) {
+    dst[i] = src[i] ^ k[i & 3];
+  }
+}
+
 static std::span<uint8_t> BuildHeader(std::span<uint8_t, 10> header,
                                       bool server,
                                       const wpi::WebSocket::Frame& frame) {
@@ -72,14 +118,12 @@ size_t SerializedFrames::AddClientFrame(const WebSocket::Frame& frame) {
   internalBuf += 4;
 
   // copy and mask data
-  int n = 0;
+  size_t offset = 0;
   for (auto&& buf : frame.data) {
-    for (auto&& ch : buf.data()) {
-      *internalBuf++ = static_cast<uint8_t>(ch) ^ key[n++];
-      if (n >= 4) {
-        n = 0;
-      }
-    }
+    MaskPayload(reinterpret_cast<uint8_t*>(internalBuf) + offset,
+                reinterpret_cast<const uint8_t*>(buf.base), buf.len, key,
+                offset);
+    offset += buf.len;
   }
   return size;
 }
@@ -106,3 +150,24 @@ size_t SerializedFrames::AddServerFrame(const WebSocket::Frame& frame) {
   }
   return sent;
 }
+
+size_t SerializedFrames::AddCompressedFrame(const WebSocket::Frame& frame,
+                                            bool server,
+                                            PerMessageDeflate& deflate) {
+  uint8_t opcode;
+  auto compressed = deflate.Compress(frame, &opcode);
+  if (!compressed) {
+    return server ? AddServerFrame(frame) : AddClientFrame(frame);
+  }
+  if (server) {
+    uv::Buffer buf = uv::Buffer::Dup(*compressed);
+    size_t size = AddServerFrame({opcode, {&buf, 1}});
+    // keep this out of the back slot, which AddServerFrame() uses for headers
+    m_allocBufs.insert(m_allocBufs.begin(), buf);
+    return size;
+  } else {
+    // AddClientFrame() copies the data while masking it
+    uv::Buffer buf{*compressed};
+    return AddClientFrame({opcode, {&buf, 1}});
+  }
+}
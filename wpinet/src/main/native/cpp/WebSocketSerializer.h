@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <stdint.h>
+
 #include <functional>
 #include <memory>
+#include <span>
 #include <utility>
 
 #include <wpi/SmallVector.h>
@@ -17,6 +20,22 @@
 
 namespace wpi::detail {
 
+class PerMessageDeflate;
+
+/**
+ * XORs data with a WebSocket masking key, a word or vector at a time.
+ * Masking and unmasking are the same operation. dst may equal src.
+ *
+ * @param dst destination
+ * @param src source
+ * @param len number of bytes
+ * @param key masking key
+ * @param offset offset of src[0] within the frame payload (selects the
+ *               starting key byte)
+ */
+void MaskPayload(uint8_t* dst, const uint8_t* src, size_t len,
+                 std::span<const uint8_t, 4> key, size_t offset = 0);
+
 class SerializedFrames {
  public:
   SerializedFrames() = default;
@@ -24,7 +43,11 @@ class SerializedFrames {
   SerializedFrames& operator=(const SerializedFrames&) = delete;
   ~SerializedFrames() { ReleaseBufs(); }
 
-  size_t AddFrame(const WebSocket::Frame& frame, bool server) {
+  size_t AddFrame(const WebSocket::Frame& frame, bool server,
+                  PerMessageDeflate* deflate = nullptr) {
+    if (deflate && (frame.opcode & WebSocket::kFlagControl) == 0) {
+      return AddCompressedFrame(frame, server, *deflate);
+    }
     if (server) {
       return AddServerFrame(frame);
     } else {
@@ -34,6 +57,8 @@ class SerializedFrames {
 
   size_t AddClientFrame(const WebSocket::Frame& frame);
   size_t AddServerFrame(const WebSocket::Frame& frame);
+  size_t AddCompressedFrame(const WebSocket::Frame& frame, bool server,
+                            PerMessageDeflate& deflate);
 
   void ReleaseBufs() {
     for (auto&& buf : m_allocBufs) {
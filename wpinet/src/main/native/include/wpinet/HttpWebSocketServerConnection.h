@@ -62,7 +62,7 @@ class HttpWebSocketServerConnection
       auto self = this->shared_from_this();
 
       // Accept the upgrade
-      auto ws = m_helper.Accept(m_stream, protocol);
+      auto ws = m_helper.Accept(m_stream, protocol, m_deflateOptions);
 
       // Set this as the websocket user data to keep it around
       ws->SetData(self);
@@ -117,6 +117,13 @@ class HttpWebSocketServerConnection
    */
   WebSocket* m_websocket = nullptr;
 
+  /**
+   * Compression options used when accepting the upgrade.  May be set by the
+   * derived class constructor or IsValidWsUpgrade().  By default compression
+   * is not used.
+   */
+  WebSocket::DeflateOptions m_deflateOptions;
+
  private:
   WebSocketServerHelper m_helper;
   SmallVector<std::string, 2> m_protocols;
@@ -28,6 +28,10 @@ namespace uv {
 class Stream;
 }  // namespace uv
 
+namespace detail {
+class PerMessageDeflate;
+}  // namespace detail
+
 /**
  * RFC 6455 compliant WebSocket client and server implementation.
  */
@@ -68,6 +72,23 @@ class WebSocket : public std::enable_shared_from_this<WebSocket> {
     CLOSED
   };
 
+  /**
+   * permessage-deflate (RFC 7692) compression options.
+   */
+  struct DeflateOptions {
+    /** Negotiate compression with the peer. */
+    bool enable = false;
+
+    /**
+     * Reset our compressor after every message.  Uses less CPU per message
+     * and lets the peer discard its history, at the cost of compression ratio.
+     */
+    bool noContextTakeover = false;
+
+    /** Require the peer to reset its compressor after every message. */
+    bool peerNoContextTakeover = false;
+  };
+
   /**
    * Client connection options.
    */
@@ -79,6 +100,9 @@ class WebSocket : public std::enable_shared_from_this<WebSocket> {
 
     /** Additional headers to include in handshake. */
     std::span<const std::pair<std::string_view, std::string_view>> extraHeaders;
+
+    /** Compression to offer to the server. */
+    DeflateOptions deflate;
   };
 
   /**
@@ -151,6 +175,28 @@ class WebSocket : public std::enable_shared_from_this<WebSocket> {
       uv::Stream& stream, std::string_view key, std::string_view version,
       std::string_view protocol = {});
 
+  /**
+   * Starts a server connection by performing the initial server side handshake.
+   * This should be called after the HTTP headers have been received.
+   * An open event is emitted when the handshake completes.
+   * This sets the stream user data to the websocket.
+   * @param stream Connection stream
+   * @param key The value of the Sec-WebSocket-Key header field in the client
+   *            request
+   * @param version The value of the Sec-WebSocket-Version header field in the
+   *                client request
+   * @param protocol The subprotocol to send to the client (in the
+   *                 Sec-WebSocket-Protocol header field).
+   * @param extensions The value of the Sec-WebSocket-Extensions header
+   *                   field(s) in the client request (comma-separated)
+   * @param deflate Compression options; compression is used if enabled here
+   *                and offered by the client
+   */
+  static std::shared_ptr<WebSocket> CreateServer(
+      uv::Stream& stream, std::string_view key, std::string_view version,
+      std::string_view protocol, std::string_view extensions,
+      const DeflateOptions& deflate);
+
   /**
    * Get connection state.
    */
@@ -172,6 +218,12 @@ class WebSocket : public std::enable_shared_from_this<WebSocket> {
    */
   std::string_view GetProtocol() const { return m_protocol; }
 
+  /**
+   * Returns true if permessage-deflate compression was negotiated.  Only valid
+   * in or after the open() event.
+   */
+  bool IsDeflateEnabled() const { return m_deflate != nullptr; }
+
   /**
    * Set the maximum message size.  Default is 128 KB.  If configured to combine
    * fragments this maximum applies to the entire message (all combined
@@ -408,7 +460,9 @@ class WebSocket : public std::enable_shared_from_this<WebSocket> {
    * will almost always fill partway through a frame). The frames following
    * the last frame will NOT be queued for transmission; the caller is
    * responsible for how to handle (e.g. re-send) those frames (e.g. when the
-   * callback is called).
+   * callback is called).  If compression is in use, frames are compressed as
+   * they are queued, so either all of the frames are queued or (if a previous
+   * write is still in progress) none are.
    *
    * @param frames Frame type/data pairs
    * @param callback Callback which is invoked when the write completes of the
@@ -535,6 +589,10 @@ class WebSocket : public std::enable_shared_from_this<WebSocket> {
   size_t m_frameStart = 0;
   uint64_t m_frameSize = UINT64_MAX;
   uint8_t m_fragmentOpcode = 0;
+  bool m_recvCompressed = false;
+
+  // negotiated compression (null if not in use)
+  std::unique_ptr<detail::PerMessageDeflate> m_deflate;
 
   // temporary data used only during client handshake
   class ClientHandshakeData;
@@ -544,7 +602,8 @@ class WebSocket : public std::enable_shared_from_this<WebSocket> {
                    std::span<const std::string_view> protocols,
                    const ClientOptions& options);
   void StartServer(std::string_view key, std::string_view version,
-                   std::string_view protocol);
+                   std::string_view protocol, std::string_view extensions,
+                   const DeflateOptions& deflate);
   void SendClose(uint16_t code, std::string_view reason);
   void SetClosed(uint16_t code, std::string_view reason, bool failed = false);
   void HandleIncoming(uv::Buffer& buf, size_t size);
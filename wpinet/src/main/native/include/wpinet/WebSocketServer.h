@@ -75,10 +75,14 @@ class WebSocketServerHelper {
    * reader) before calling this.  See also WebSocket::CreateServer().
    * @param stream Connection stream
    * @param protocol The subprotocol to send to the client
+   * @param deflate Compression options; compression is used if enabled here
+   *                and offered by the client
    */
-  std::shared_ptr<WebSocket> Accept(uv::Stream& stream,
-                                    std::string_view protocol = {}) {
-    return WebSocket::CreateServer(stream, m_key, m_version, protocol);
+  std::shared_ptr<WebSocket> Accept(
+      uv::Stream& stream, std::string_view protocol = {},
+      const WebSocket::DeflateOptions& deflate = {}) {
+    return WebSocket::CreateServer(stream, m_key, m_version, protocol,
+                                   m_extensions, deflate);
   }
 
   bool IsUpgrade() const { return m_gotHost && m_websocket; }
@@ -94,6 +98,7 @@ class WebSocketServerHelper {
   SmallVector<std::string, 2> m_protocols;
   SmallString<64> m_key;
   SmallString<16> m_version;
+  SmallString<64> m_extensions;
 };
 
 /**
@@ -118,6 +123,11 @@ class WebSocketServer : public std::enable_shared_from_this<WebSocketServer> {
      * default all hosts are accepted.
      */
     std::function<bool(std::string_view)> checkHost;
+
+    /**
+     * Compression options.  By default compression is not used.
+     */
+    WebSocket::DeflateOptions deflate;
   };
 
   /**
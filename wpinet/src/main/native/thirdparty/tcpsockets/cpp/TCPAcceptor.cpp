@@ -122,6 +122,19 @@ int TCPAcceptor::start() {
     return result;
   }
 
+  // get the port assigned by the OS when binding to port 0
+  if (m_port == 0) {
+#ifdef _WIN32
+    int len = sizeof(address);
+#else
+    socklen_t len = sizeof(address);
+#endif
+    if (getsockname(m_lsd, reinterpret_cast<struct sockaddr*>(&address),
+                    &len) == 0) {
+      m_port = ntohs(address.sin_port);
+    }
+  }
+
   result = listen(m_lsd, 5);
   if (result != 0) {
     WPI_ERROR(m_logger, "listen() on port {} failed: {}", m_port,
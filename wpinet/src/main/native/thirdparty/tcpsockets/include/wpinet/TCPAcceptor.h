@@ -51,6 +51,9 @@ class TCPAcceptor : public NetworkAcceptor {
   int start() override;
   void shutdown() final;
   std::unique_ptr<NetworkStream> accept() override;
+
+  // if constructed with port 0, the port assigned once start() succeeds
+  int getPort() const { return m_port; }
 };
 
 }  // namespace wpi
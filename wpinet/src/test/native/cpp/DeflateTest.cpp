@@ -0,0 +1,656 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "Deflate.h"  // NOLINT(build/include_order)
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <wpi/SmallString.h>
+#include <wpi/raw_ostream.h>
+
+#include "DeflateZlibVectors.h"
+#include "WebSocketDeflate.h"
+
+namespace wpi::detail {
+
+static std::span<const uint8_t> Bytes(std::string_view str) {
+  return {reinterpret_cast<const uint8_t*>(str.data()), str.size()};
+}
+
+static std::string TestText() {
+  std::string str;
+  for (int i = 0; i < 100; ++i) {
+    str += fmt::format("line {}: value={}\n", i, i * i);
+  }
+  return str;
+}
+
+// Text-like data with numbers, stray bytes and back-references of all
+// distances; must match the generator used for DeflateZlibVectors.h
+static std::vector<uint8_t> DeflateTestInput(uint32_t seed, size_t size) {
+  static constexpr std::string_view kWords[] = {
+      "robot", "drive", "pose", "vision", "value", "/SmartDashboard/", "true",
+      "false"};
+  std::vector<uint8_t> out;
+  uint32_t x = seed;
+  while (out.size() < size) {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    uint32_t kind = x % 8;
+    if (kind < 4) {
+      auto word = kWords[(x >> 8) % 8];
+      out.insert(out.end(), word.begin(), word.end());
+      out.push_back(' ');
+    } else if (kind < 6) {
+      auto num = fmt::format("{}\n", (x >> 8) % 100000);
+      out.insert(out.end(), num.begin(), num.end());
+    } else if (kind == 6 && !out.empty()) {
+      size_t dist = 1 + (x >> 8) % (std::min)(out.size(), size_t{32768});
+      size_t len = 3 + (x >> 24) % 100;
+      size_t start = out.size() - dist;
+      for (size_t k = 0; k < len; ++k) {
+        uint8_t v = out[start + k];
+        out.push_back(v);
+      }
+    } else {
+      out.push_back((x >> 8) & 0xff);
+    }
+  }
+  out.resize(size);
+  return out;
+}
+
+// Writes a raw deflate bit stream
+class BitWriter {
+ public:
+  // extra bits and header fields, least significant bit first
+  void Put(uint32_t value, int bits) {
+    for (int i = 0; i < bits; ++i) {
+      if (m_count == 0) {
+        data.push_back(0);
+      }
+      data.back() |= ((value >> i) & 1) << m_count;
+      m_count = (m_count + 1) % 8;
+    }
+  }
+
+  // Huffman codes, most significant bit first
+  void PutCode(uint32_t code, int bits) {
+    for (int i = bits - 1; i >= 0; --i) {
+      Put((code >> i) & 1, 1);
+    }
+  }
+
+  // symbol from the fixed literal/length code
+  void PutFixed(int sym) {
+    if (sym < 144) {
+      PutCode(0x30 + sym, 8);
+    } else if (sym < 256) {
+      PutCode(0x190 + sym - 144, 9);
+    } else if (sym < 280) {
+      PutCode(sym - 256, 7);
+    } else {
+      PutCode(0xc0 + sym - 280, 8);
+    }
+  }
+
+  std::vector<uint8_t> data;
+
+ private:
+  int m_count = 0;
+};
+
+static std::vector<uint8_t> RoundTrip(Deflater& deflater, Inflater& inflater,
+                                      std::span<const uint8_t> data,
+                                      size_t* compressedSize = nullptr) {
+  std::vector<uint8_t> compressed;
+  deflater.Compress(data, compressed, true);
+  if (compressedSize) {
+    *compressedSize = compressed.size();
+  }
+  std::vector<uint8_t> out;
+  EXPECT_EQ(inflater.Inflate(compressed, SIZE_MAX, out), Inflater::kOk);
+  return out;
+}
+
+TEST(DeflateTest, InflateZlibStream) {
+  // raw deflate stream with a dynamic Huffman block, ending in a sync flush
+  const uint8_t compressed[] = {
+    0x4c, 0x95, 0x4b, 0x8e, 0x5d, 0x21, 0x10, 0x43, 0xe7, 0x59, 0x45, 0x2f,
+    0x01, 0xa8, 0x7f, 0xa4, 0x2c, 0x26, 0x83, 0x1e, 0x44, 0x7a, 0xca, 0x2c,
+    0x59, 0x7f, 0x3a, 0xba, 0xd8, 0x7e, 0x43, 0x10, 0x2a, 0x7c, 0x0a, 0xbb,
+    0x78, 0xfd, 0xfa, 0xfd, 0xf9, 0xb1, 0xbe, 0x7f, 0xfc, 0xfd, 0xf9, 0xfa,
+    0xf3, 0xf9, 0x63, 0x7d, 0x7b, 0xfd, 0x5f, 0x6f, 0xac, 0xf7, 0xb3, 0x3e,
+    0x58, 0xfb, 0xb3, 0x36, 0xac, 0xe7, 0x59, 0x3b, 0xcf, 0xe7, 0xb3, 0x11,
+    0xd8, 0x38, 0xf1, 0x6c, 0x24, 0x36, 0xec, 0x9e, 0x28, 0x96, 0xbc, 0x35,
+    0x1a, 0x1b, 0x79, 0x2f, 0x19, 0x6c, 0xf4, 0x55, 0xb1, 0x29, 0x73, 0x2f,
+    0x08, 0x95, 0xd2, 0x83, 0x53, 0x14, 0xbb, 0xfd, 0x56, 0xda, 0x26, 0x7d,
+    0xf7, 0xb6, 0x2d, 0xc9, 0x73, 0x15, 0x6d, 0x89, 0x86, 0xea, 0x9d, 0xe2,
+    0xc0, 0x29, 0x0a, 0x3f, 0x8d, 0x5a, 0x94, 0x6e, 0x07, 0x37, 0x8e, 0x78,
+    0xd1, 0x43, 0xaa, 0x77, 0xa8, 0x3f, 0x54, 0xef, 0x8e, 0x53, 0x6a, 0x75,
+    0xdf, 0x5a, 0x87, 0xea, 0xe3, 0xdc, 0x1b, 0x0f, 0xd5, 0x47, 0x5d, 0x5d,
+    0x87, 0xea, 0x13, 0xea, 0x0f, 0xd5, 0x27, 0x4f, 0x51, 0x7d, 0xb1, 0x16,
+    0xd5, 0x17, 0x6f, 0x54, 0xeb, 0xa1, 0xcb, 0xa8, 0x7e, 0xa0, 0xde, 0xa8,
+    0x7e, 0xc0, 0x68, 0xea, 0xfd, 0x42, 0x2b, 0x4c, 0xcd, 0x5f, 0xe8, 0x98,
+    0xa9, 0xfb, 0x1b, 0x8d, 0xb5, 0xd0, 0x53, 0x82, 0xc0, 0x52, 0x7b, 0x78,
+    0x26, 0x23, 0xc2, 0x36, 0xbc, 0xa6, 0xf5, 0xdb, 0x9b, 0xe3, 0x5e, 0x42,
+    0xec, 0x80, 0x37, 0x5c, 0x0e, 0x4a, 0x60, 0xb8, 0x2c, 0x94, 0x70, 0x9a,
+    0x8b, 0xa3, 0x60, 0x47, 0x17, 0x47, 0xc3, 0xb3, 0xfe, 0xe6, 0x22, 0x18,
+    0xdb, 0x65, 0xa3, 0x05, 0x0e, 0x97, 0x8f, 0x36, 0x22, 0xe2, 0x32, 0xd2,
+    0x59, 0xa8, 0x47, 0x8e, 0x63, 0x0b, 0xf7, 0x92, 0xe3, 0xf8, 0xba, 0xfa,
+    0x62, 0xc9, 0x97, 0xe0, 0x08, 0x72, 0x9c, 0xe4, 0x39, 0x72, 0x9c, 0x42,
+    0xbd, 0x30, 0x19, 0x18, 0xf7, 0x06, 0x39, 0xce, 0x30, 0xc2, 0xe4, 0x30,
+    0x72, 0x84, 0x62, 0xbc, 0xc1, 0x1b, 0xf5, 0xe6, 0x7e, 0xd4, 0x53, 0x22,
+    0x0c, 0xfd, 0x0b, 0x45, 0xc2, 0xd1, 0xe7, 0x5c, 0x8a, 0x09, 0x38, 0x92,
+    0x1c, 0x56, 0x78, 0xb7, 0x24, 0x87, 0x35, 0xde, 0x37, 0xc9, 0x61, 0x03,
+    0x1f, 0xa4, 0x2b, 0x63, 0xf0, 0x4b, 0x92, 0xc3, 0xe9, 0xab, 0x24, 0x87,
+    0x1b, 0xfc, 0x97, 0x9a, 0x48, 0x0e, 0x9f, 0x26, 0x39, 0x3c, 0xe1, 0xe7,
+    0x24, 0x87, 0x17, 0x7c, 0x5f, 0xca, 0x36, 0xe3, 0x51, 0xe4, 0x88, 0x85,
+    0x14, 0x15, 0x39, 0x62, 0x23, 0x6c, 0xa5, 0x78, 0x1b, 0x32, 0x59, 0xca,
+    0xb7, 0x23, 0xba, 0x45, 0x8e, 0x60, 0xc2, 0x2b, 0x35, 0x07, 0x78, 0x8e,
+    0x1c, 0x31, 0xac, 0xa7, 0xe1, 0xba, 0x78, 0xef, 0x68, 0x60, 0x40, 0x5f,
+    0x2f, 0x0d, 0x61, 0x70, 0x34, 0x39, 0x32, 0xc0, 0xdb, 0x47, 0x93, 0x05,
+    0x7d, 0x69, 0x72, 0x64, 0xa3, 0x7f, 0x4d, 0x8e, 0x5a, 0xe8, 0x73, 0x87,
+    0x46, 0x10, 0x38, 0x9a, 0x1c, 0x65, 0x78, 0xb7, 0xd6, 0xa8, 0x0a, 0xbc,
+    0x6f, 0x6b, 0x56, 0x15, 0x7c, 0xd0, 0xe4, 0xa8, 0x81, 0x5f, 0x66, 0xe9,
+    0xef, 0x00, 0xc7, 0x90, 0xa3, 0x0f, 0xfc, 0x37, 0x47, 0x83, 0x8e, 0xdf,
+    0x0e, 0x39, 0x3a, 0xe1, 0xe7, 0x21, 0x47, 0x37, 0x7c, 0x3f, 0xa1, 0x89,
+    0x08, 0x8e, 0x21, 0xc7, 0x97, 0x14, 0x9c, 0x23, 0xc7, 0x38, 0xf2, 0x36,
+    0xad, 0xd1, 0x89, 0x5c, 0x0e, 0x39, 0xa6, 0xbf, 0xf2, 0xfb, 0x0f, 0x00,
+    0x00, 0xff, 0xff};
+  std::string expected = TestText();
+  Inflater inflater;
+  std::vector<uint8_t> out;
+  ASSERT_EQ(inflater.Inflate(compressed, SIZE_MAX, out), Inflater::kOk);
+  EXPECT_EQ(std::string_view(reinterpret_cast<const char*>(out.data()),
+                             out.size()),
+            expected);
+}
+
+TEST(DeflateTest, InflateZlibVectors) {
+  for (auto&& vector : kZlibVectors) {
+    SCOPED_TRACE(vector.name);
+    auto expected = DeflateTestInput(vector.seed, vector.size);
+    Inflater inflater;
+    size_t pos = 0;
+    size_t compressedPos = 0;
+    for (size_t i = 0; i < vector.chunkSizes.size(); ++i) {
+      std::vector<uint8_t> out;
+      ASSERT_EQ(inflater.Inflate(vector.compressed.subspan(
+                                     compressedPos, vector.compressedSizes[i]),
+                                 vector.chunkSizes[i], out),
+                Inflater::kOk);
+      EXPECT_EQ(out, std::vector<uint8_t>(
+                         expected.begin() + pos,
+                         expected.begin() + pos + vector.chunkSizes[i]));
+      pos += vector.chunkSizes[i];
+      compressedPos += vector.compressedSizes[i];
+    }
+    EXPECT_EQ(compressedPos, vector.compressed.size());
+  }
+}
+
+TEST(DeflateTest, RoundTripZlibVectorInputs) {
+  for (auto&& vector : kZlibVectors) {
+    SCOPED_TRACE(vector.name);
+    auto data = DeflateTestInput(vector.seed, vector.size);
+    Deflater deflater;
+    Inflater inflater;
+    size_t pos = 0;
+    for (size_t size : vector.chunkSizes) {
+      auto chunk = std::span{data}.subspan(pos, size);
+      EXPECT_EQ(RoundTrip(deflater, inflater, chunk),
+                std::vector<uint8_t>(chunk.begin(), chunk.end()));
+      pos += size;
+    }
+  }
+}
+
+TEST(DeflateTest, RandomizedRoundTrip) {
+  std::mt19937 gen{42};
+  for (int i = 0; i < 40; ++i) {
+    SCOPED_TRACE(i);
+    int windowBits = 9 + gen() % 7;
+    bool takeover = gen() % 2 == 0;
+    Deflater deflater{windowBits};
+    Inflater inflater{takeover};
+    for (int message = 0; message < 4; ++message) {
+      auto data = DeflateTestInput(gen() | 1, gen() % 30000);
+      // several Compress() calls, flushing only at the end of the message
+      std::vector<uint8_t> compressed;
+      for (size_t pos = 0; pos < data.size();) {
+        size_t size = (std::min)(data.size() - pos, size_t{1 + gen() % 8000});
+        deflater.Compress(std::span{data}.subspan(pos, size), compressed,
+                          false);
+        pos += size;
+      }
+      deflater.Compress({}, compressed, true);
+      std::vector<uint8_t> out;
+      ASSERT_EQ(inflater.Inflate(compressed, data.size(), out), Inflater::kOk);
+      EXPECT_EQ(out, data);
+      if (!takeover) {
+        deflater.Reset();
+      }
+    }
+  }
+}
+
+TEST(DeflateTest, TruncatedInput) {
+  for (auto&& vector : kZlibVectors) {
+    SCOPED_TRACE(vector.name);
+    auto expected = DeflateTestInput(vector.seed, vector.chunkSizes[0]);
+    auto compressed = vector.compressed.subspan(0, vector.compressedSizes[0]);
+    for (size_t size = 0; size < compressed.size(); ++size) {
+      Inflater inflater;
+      std::vector<uint8_t> out;
+      auto result = inflater.Inflate(compressed.subspan(0, size),
+                                     expected.size(), out);
+      ASSERT_NE(result, Inflater::kTooLarge) << size;
+      // bits past the end are never decoded, so whatever was output is right
+      ASSERT_LE(out.size(), expected.size()) << size;
+      ASSERT_TRUE(std::equal(out.begin(), out.end(), expected.begin()))
+          << size;
+    }
+  }
+}
+
+TEST(DeflateTest, CorruptedInput) {
+  std::mt19937 gen{99};
+  for (int i = 0; i < 3000; ++i) {
+    auto& vector = kZlibVectors[gen() % std::size(kZlibVectors)];
+    std::vector<uint8_t> data(
+        vector.compressed.begin(),
+        vector.compressed.begin() + vector.compressedSizes[0]);
+    for (int flips = 1 + gen() % 4; flips > 0; --flips) {
+      data[gen() % data.size()] ^= 1 << (gen() % 8);
+    }
+    Inflater inflater{gen() % 2 == 0};
+    size_t maxSize = 2 * vector.chunkSizes[0] + 1000;
+    std::vector<uint8_t> out;
+    inflater.Inflate(data, maxSize, out);
+    ASSERT_LE(out.size(), maxSize) << i;
+  }
+}
+
+TEST(DeflateTest, RandomInput) {
+  std::mt19937 gen{7};
+  for (int i = 0; i < 5000; ++i) {
+    std::vector<uint8_t> data(gen() % 300);
+    for (auto&& v : data) {
+      v = gen();
+    }
+    Inflater inflater;
+    std::vector<uint8_t> out;
+    inflater.Inflate(data, 100000, out);
+    ASSERT_LE(out.size(), 100000u) << i;
+  }
+}
+
+// A dynamic block whose literal/length code only has 'a' and end of block,
+// as a base for malformed variants.  clLens are the code length code lengths
+// in kCodeLenOrder order, and the sequence is (code, extra bits, extra value).
+struct DynamicBlock {
+  uint32_t hlit = 0;
+  uint32_t hdist = 0;
+  // 1 and 18 have 1-bit codes (0 and 1)
+  std::vector<uint32_t> clLens{0, 0, 1, 0, 0, 0, 0, 0, 0,
+                               0, 0, 0, 0, 0, 0, 0, 0, 1};
+  struct Code {
+    uint32_t code;
+    int bits;
+    int extraBits;
+    uint32_t extra;
+  };
+  // 97 zeros, 1 ('a'), 158 zeros, 1 (end of block), one distance code of 1
+  std::vector<Code> sequence{{1, 1, 7, 97 - 11}, {0, 1, 0, 0},
+                             {1, 1, 7, 138 - 11}, {1, 1, 7, 20 - 11},
+                             {0, 1, 0, 0},        {0, 1, 0, 0}};
+
+  std::vector<uint8_t> Encode() const {
+    BitWriter bw;
+    bw.Put(1, 1);  // BFINAL
+    bw.Put(2, 2);  // dynamic
+    bw.Put(hlit, 5);
+    bw.Put(hdist, 5);
+    bw.Put(clLens.size() - 4, 4);
+    for (uint32_t len : clLens) {
+      bw.Put(len, 3);
+    }
+    for (auto&& code : sequence) {
+      bw.PutCode(code.code, code.bits);
+      bw.Put(code.extra, code.extraBits);
+    }
+    // "aa", end of block
+    bw.PutCode(0, 1);
+    bw.PutCode(0, 1);
+    bw.PutCode(1, 1);
+    return bw.data;
+  }
+};
+
+static Inflater::Result InflateFresh(std::span<const uint8_t> data,
+                                     std::vector<uint8_t>* out = nullptr) {
+  Inflater inflater;
+  std::vector<uint8_t> buf;
+  return inflater.Inflate(data, 1 << 20, out ? *out : buf);
+}
+
+TEST(DeflateTest, HostileDynamicHeaders) {
+  std::vector<uint8_t> out;
+  ASSERT_EQ(InflateFresh(DynamicBlock{}.Encode(), &out), Inflater::kOk);
+  EXPECT_EQ(out, (std::vector<uint8_t>{'a', 'a'}));
+
+  // 287 literal/length codes
+  DynamicBlock block;
+  block.hlit = 30;
+  EXPECT_EQ(InflateFresh(block.Encode()), Inflater::kInvalid);
+
+  // 31 distance codes
+  block = {};
+  block.hdist = 30;
+  EXPECT_EQ(InflateFresh(block.Encode()), Inflater::kInvalid);
+
+  // oversubscribed code length code
+  block = {};
+  block.clLens[1] = 1;
+  EXPECT_EQ(InflateFresh(block.Encode()), Inflater::kInvalid);
+
+  // repeat of the previous length (16) as the first code; 18 has code 0,
+  // 1 and 16 have codes 10 and 11
+  block = {};
+  block.clLens = {2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2};
+  block.sequence = {{3, 2, 2, 0}};
+  EXPECT_EQ(InflateFresh(block.Encode()), Inflater::kInvalid);
+
+  // zeros past the end of the lengths
+  block = {};
+  block.sequence = {{1, 1, 7, 127}, {1, 1, 7, 127}};
+  EXPECT_EQ(InflateFresh(block.Encode()), Inflater::kInvalid);
+
+  // no end of block code
+  block = {};
+  block.sequence = {{1, 1, 7, 97 - 11}, {0, 1, 0, 0}, {1, 1, 7, 138 - 11},
+                    {1, 1, 7, 21 - 11}, {0, 1, 0, 0}};
+  EXPECT_EQ(InflateFresh(block.Encode()), Inflater::kInvalid);
+}
+
+TEST(DeflateTest, HostileStoredBlocks) {
+  // NLEN isn't the complement of LEN
+  const uint8_t badLen[] = {0x01, 0x05, 0x00, 0x00, 0x00, 'a', 'b', 'c', 'd',
+                            'e'};
+  EXPECT_EQ(InflateFresh(badLen), Inflater::kInvalid);
+
+  // LEN past the end of the data
+  const uint8_t shortData[] = {0x01, 0x0a, 0x00, 0xf5, 0xff, 'a', 'b'};
+  EXPECT_EQ(InflateFresh(shortData), Inflater::kInvalid);
+
+  const uint8_t ok[] = {0x01, 0x02, 0x00, 0xfd, 0xff, 'a', 'b'};
+  EXPECT_EQ(InflateFresh(ok), Inflater::kOk);
+}
+
+TEST(DeflateTest, HostileFixedBlocks) {
+  auto fixed = [](auto&& body) {
+    BitWriter bw;
+    bw.Put(1, 1);  // BFINAL
+    bw.Put(1, 2);  // fixed
+    body(bw);
+    return bw.data;
+  };
+
+  // literal/length symbols 286 and 287 don't exist
+  for (int sym : {286, 287}) {
+    EXPECT_EQ(InflateFresh(fixed([&](BitWriter& bw) { bw.PutFixed(sym); })),
+              Inflater::kInvalid);
+  }
+
+  // distance codes 30 and 31 don't exist
+  for (uint32_t dist : {30, 31}) {
+    EXPECT_EQ(InflateFresh(fixed([&](BitWriter& bw) {
+                bw.PutFixed('a');
+                bw.PutFixed(257);
+                bw.PutCode(dist, 5);
+                bw.PutFixed(256);
+              })),
+              Inflater::kInvalid);
+  }
+
+  // distance of 2 after one byte
+  EXPECT_EQ(InflateFresh(fixed([](BitWriter& bw) {
+              bw.PutFixed('a');
+              bw.PutFixed(257);
+              bw.PutCode(1, 5);
+              bw.PutFixed(256);
+            })),
+            Inflater::kInvalid);
+
+  // ends without an end of block code (5 bits of padding can't hold one)
+  EXPECT_EQ(InflateFresh(fixed([](BitWriter& bw) { bw.PutFixed('a'); })),
+            Inflater::kInvalid);
+}
+
+TEST(DeflateTest, DecompressionBomb) {
+  // 10000 matches of 258 bytes each: 2.5 MB from 16 KB
+  BitWriter bw;
+  bw.Put(1, 1);
+  bw.Put(1, 2);
+  bw.PutFixed('a');
+  for (int i = 0; i < 10000; ++i) {
+    bw.PutFixed(285);
+    bw.PutCode(0, 5);
+  }
+  bw.PutFixed(256);
+
+  Inflater inflater;
+  std::vector<uint8_t> out;
+  EXPECT_EQ(inflater.Inflate(bw.data, 1 << 20, out), Inflater::kTooLarge);
+  EXPECT_LE(out.size(), 1u << 20);
+
+  out.clear();
+  EXPECT_EQ(inflater.Inflate(bw.data, 3 << 20, out), Inflater::kOk);
+  EXPECT_EQ(out.size(), 1u + 10000 * 258);
+}
+
+TEST(DeflateTest, RoundTripEmpty) {
+  Deflater deflater;
+  Inflater inflater;
+  EXPECT_TRUE(RoundTrip(deflater, inflater, {}).empty());
+}
+
+TEST(DeflateTest, RoundTripText) {
+  Deflater deflater;
+  Inflater inflater;
+  std::string text = TestText();
+  size_t size;
+  auto out = RoundTrip(deflater, inflater, Bytes(text), &size);
+  EXPECT_EQ(out, std::vector<uint8_t>(text.begin(), text.end()));
+  EXPECT_LT(size, text.size() / 2);
+}
+
+TEST(DeflateTest, RoundTripFixedHuffman) {
+  // short inputs are encoded with the fixed code; use literals from every
+  // range of it, including the 9-bit codes for bytes 144-255
+  std::vector<uint8_t> data;
+  for (int i = 0; i < 64; ++i) {
+    data.push_back(static_cast<uint8_t>(i * 37 + 11));
+  }
+  Deflater deflater;
+  Inflater inflater;
+  EXPECT_EQ(RoundTrip(deflater, inflater, data), data);
+}
+
+TEST(DeflateTest, RoundTripLarge) {
+  // larger than the window and several blocks, with both matches and noise
+  std::mt19937 gen{1234};
+  std::vector<uint8_t> data;
+  for (int i = 0; i < 20000; ++i) {
+    uint32_t v = gen();
+    if (v % 4 == 0 && data.size() > 40000) {
+      // long-distance repeat
+      size_t start = data.size() - 40000 + v % 1000;
+      for (size_t j = 0; j < 20; ++j) {
+        data.push_back(data[start + j]);
+      }
+    } else {
+      data.push_back(v & 0x0f);
+      data.push_back('a' + (v >> 8) % 4);
+    }
+  }
+  Deflater deflater;
+  Inflater inflater;
+  EXPECT_EQ(RoundTrip(deflater, inflater, data), data);
+}
+
+TEST(DeflateTest, Incompressible) {
+  std::mt19937 gen{5678};
+  std::vector<uint8_t> data(100000);
+  for (auto&& v : data) {
+    v = gen();
+  }
+  Deflater deflater;
+  Inflater inflater;
+  size_t size;
+  EXPECT_EQ(RoundTrip(deflater, inflater, data, &size), data);
+  // falls back to stored blocks
+  EXPECT_LT(size, data.size() + 64);
+}
+
+TEST(DeflateTest, SmallWindow) {
+  std::string text = TestText();
+  Deflater deflater{9};
+  Inflater inflater;
+  EXPECT_EQ(RoundTrip(deflater, inflater, Bytes(text)),
+            std::vector<uint8_t>(text.begin(), text.end()));
+}
+
+TEST(DeflateTest, ContextTakeover) {
+  std::string text = TestText();
+  Deflater deflater;
+  Inflater inflater;
+  size_t first, second;
+  RoundTrip(deflater, inflater, Bytes(text), &first);
+  // the second copy refers back into the first message
+  EXPECT_EQ(RoundTrip(deflater, inflater, Bytes(text), &second),
+            std::vector<uint8_t>(text.begin(), text.end()));
+  EXPECT_LT(second, first / 4);
+}
+
+TEST(DeflateTest, Reset) {
+  std::string text = TestText();
+  Deflater deflater;
+  Inflater inflater{false};
+  size_t first, second;
+  RoundTrip(deflater, inflater, Bytes(text), &first);
+  deflater.Reset();
+  EXPECT_EQ(RoundTrip(deflater, inflater, Bytes(text), &second),
+            std::vector<uint8_t>(text.begin(), text.end()));
+  EXPECT_EQ(first, second);
+}
+
+TEST(DeflateTest, Partial) {
+  std::string text = TestText();
+  Deflater deflater;
+  std::vector<uint8_t> compressed;
+  deflater.Compress(Bytes(text).subspan(0, 1000), compressed, false);
+  deflater.Compress(Bytes(text).subspan(1000), compressed, true);
+  Inflater inflater;
+  std::vector<uint8_t> out;
+  ASSERT_EQ(inflater.Inflate(compressed, SIZE_MAX, out), Inflater::kOk);
+  EXPECT_EQ(out, std::vector<uint8_t>(text.begin(), text.end()));
+}
+
+TEST(DeflateTest, Invalid) {
+  const uint8_t data[] = {0xff, 0xff, 0xff, 0xff};  // BTYPE=11
+  Inflater inflater;
+  std::vector<uint8_t> out;
+  EXPECT_EQ(inflater.Inflate(data, SIZE_MAX, out), Inflater::kInvalid);
+
+  // distance beyond the start of the data
+  Deflater deflater;
+  std::vector<uint8_t> compressed;
+  std::string text = TestText();
+  deflater.Compress(Bytes(text), compressed, true);
+  compressed.clear();
+  deflater.Compress(Bytes(text), compressed, true);
+  Inflater fresh;
+  EXPECT_EQ(fresh.Inflate(compressed, SIZE_MAX, out), Inflater::kInvalid);
+}
+
+TEST(DeflateTest, TooLarge) {
+  std::string text = TestText();
+  Deflater deflater;
+  std::vector<uint8_t> compressed;
+  deflater.Compress(Bytes(text), compressed, true);
+  Inflater inflater;
+  std::vector<uint8_t> out;
+  EXPECT_EQ(inflater.Inflate(compressed, text.size() - 1, out),
+            Inflater::kTooLarge);
+}
+
+TEST(WebSocketDeflateTest, ParseOffer) {
+  auto params = ParseDeflateExtension(
+      "permessage-deflate; client_max_window_bits; "
+      "server_max_window_bits=10; client_no_context_takeover",
+      false);
+  ASSERT_TRUE(params);
+  EXPECT_FALSE(params->serverNoContextTakeover);
+  EXPECT_TRUE(params->clientNoContextTakeover);
+  EXPECT_EQ(params->serverMaxWindowBits, 10);
+  EXPECT_EQ(params->clientMaxWindowBits, 15);
+
+  EXPECT_TRUE(ParseDeflateExtension(" permessage-deflate ", false));
+  EXPECT_FALSE(ParseDeflateExtension("x-webkit-deflate-frame", false));
+  EXPECT_FALSE(ParseDeflateExtension("permessage-deflate; foo", false));
+  EXPECT_FALSE(ParseDeflateExtension(
+      "permessage-deflate; server_no_context_takeover; "
+      "server_no_context_takeover",
+      false));
+  EXPECT_FALSE(ParseDeflateExtension(
+      "permessage-deflate; server_max_window_bits=16", false));
+  EXPECT_FALSE(
+      ParseDeflateExtension("permessage-deflate; server_max_window_bits", false));
+}
+
+TEST(WebSocketDeflateTest, ParseResponse) {
+  auto params = ParseDeflateExtension(
+      "permessage-deflate; client_max_window_bits=\"9\"", true);
+  ASSERT_TRUE(params);
+  EXPECT_EQ(params->clientMaxWindowBits, 9);
+  // a value is required in a response
+  EXPECT_FALSE(ParseDeflateExtension(
+      "permessage-deflate; client_max_window_bits", true));
+}
+
+TEST(WebSocketDeflateTest, Negotiate) {
+  WebSocket::DeflateOptions opts;
+  opts.enable = true;
+  opts.peerNoContextTakeover = true;
+  SmallString<64> buf;
+  raw_svector_ostream os{buf};
+  auto params = NegotiateDeflate(
+      "permessage-deflate; foo, permessage-deflate; server_max_window_bits=12",
+      opts, os);
+  ASSERT_TRUE(params);
+  EXPECT_EQ(params->serverMaxWindowBits, 12);
+  EXPECT_TRUE(params->clientNoContextTakeover);
+  EXPECT_EQ(buf.str(),
+            "permessage-deflate; client_no_context_takeover; "
+            "server_max_window_bits=12");
+
+  SmallString<64> buf2;
+  raw_svector_ostream os2{buf2};
+  EXPECT_FALSE(NegotiateDeflate("x-foo", opts, os2));
+  EXPECT_TRUE(buf2.empty());
+}
+
+}  // namespace wpi::detail
@@ -0,0 +1,1294 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <span>
+
+// Raw deflate streams produced by zlib 1.2.13 from DeflateTestInput(), in
+// chunks.  Each chunk ends with a sync flush (or, if final is set, the last
+// chunk ends with a final block), so it can be inflated on its own, as
+// permessage-deflate does.
+//
+// Generated by wpinet/generate_deflate_test_vectors.py; do not edit.
+namespace wpi::detail {
+
+struct ZlibVector {
+  const char* name;
+  uint32_t seed;
+  size_t size;
+  std::span<const size_t> chunkSizes;       // uncompressed
+  std::span<const size_t> compressedSizes;  // per chunk
+  std::span<const uint8_t> compressed;
+  bool final;
+};
+
+inline constexpr size_t kStoredChunks[] = {600, 0, 900};
+inline constexpr size_t kStoredCompressed[] = {610, 5, 910};
+inline constexpr uint8_t kStoredData[] = {
+    0x00, 0x58, 0x02, 0xa7, 0xfd, 0x72, 0x6f, 0x62, 0x6f, 0x74, 0x20, 0x74,
+    0x72, 0x75, 0x65, 0x20, 0x34, 0x31, 0x35, 0x34, 0x34, 0x0a, 0x99, 0x66,
+    0x61, 0x6c, 0x73, 0x65, 0x20, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+    0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x20, 0x33, 0x33, 0x34, 0x35, 0x37, 0x0a, 0x39, 0x31, 0x30, 0x31, 0x31,
+    0x0a, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x97, 0x76, 0x69, 0x73, 0x69, 0x6f,
+    0x6e, 0x20, 0x72, 0x6f, 0x62, 0x6f, 0x74, 0x20, 0x74, 0x34, 0x31, 0x36,
+    0x37, 0x39, 0x0a, 0x2f, 0x53, 0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73,
+    0x68, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2f, 0x20, 0x64, 0x72, 0x69, 0x76,
+    0x65, 0x20, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x69, 0x73,
+    0x69, 0x6f, 0x6e, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x70, 0x6f, 0x73,
+    0x65, 0x20, 0x2f, 0x53, 0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68,
+    0x62, 0x6f, 0x61, 0x72, 0x64, 0x2f, 0x20, 0x76, 0x69, 0x73, 0x69, 0x6f,
+    0x6e, 0x20, 0x22, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x65,
+    0x20, 0x33, 0x33, 0x33, 0x33, 0x35, 0x0a, 0x33, 0x34, 0x39, 0x38, 0x0a,
+    0x72, 0x6f, 0x62, 0x6f, 0x74, 0x20, 0x68, 0x62, 0x6f, 0x61, 0x72, 0x64,
+    0x2f, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x76, 0x69, 0x73, 0x69,
+    0x6f, 0x6e, 0x20, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x2f, 0x53, 0x6d, 0x61,
+    0x72, 0x74, 0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2f,
+    0x20, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x22, 0x70, 0x6f, 0x73,
+    0x65, 0x20, 0xc7, 0x33, 0x30, 0x34, 0x37, 0x32, 0x0a, 0x76, 0x69, 0x73,
+    0x69, 0x6f, 0x6e, 0x20, 0x2f, 0x53, 0x6d, 0x61, 0x72, 0x74, 0x44, 0x61,
+    0x73, 0x68, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2f, 0x20, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x20, 0x31, 0x30, 0x31, 0x30, 0x31, 0x0a, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x20, 0x34, 0x31,
+    0x35, 0x34, 0x34, 0x0a, 0x99, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x76,
+    0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e,
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x33, 0x33, 0x34, 0x35, 0x37,
+    0x0a, 0x39, 0x31, 0x30, 0x31, 0x31, 0x0a, 0x70, 0x6f, 0x73, 0x65, 0x20,
+    0x97, 0xa6, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20,
+    0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0xb6, 0x10, 0x70, 0x6f, 0x73, 0x65,
+    0x20, 0x33, 0x37, 0x37, 0x32, 0x39, 0x0a, 0x36, 0x33, 0x34, 0x37, 0x31,
+    0x0a, 0x37, 0x37, 0x38, 0x32, 0x32, 0x0a, 0x33, 0x31, 0x39, 0x37, 0x32,
+    0x0a, 0x74, 0x72, 0x75, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20,
+    0x37, 0x35, 0x39, 0x31, 0x35, 0x0a, 0x31, 0x38, 0x35, 0x31, 0x39, 0x0a,
+    0x34, 0x31, 0x36, 0x39, 0x39, 0x0a, 0x39, 0x31, 0x37, 0x39, 0x39, 0x0a,
+    0x32, 0x34, 0x38, 0x35, 0x36, 0x0a, 0x36, 0x35, 0x35, 0x33, 0x34, 0x0a,
+    0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x39, 0x36, 0x38, 0x37, 0x30, 0x0a,
+    0x37, 0x38, 0x34, 0x37, 0x36, 0x0a, 0x38, 0x34, 0x37, 0x36, 0x0a, 0x38,
+    0x34, 0x37, 0x36, 0x0a, 0x38, 0x34, 0x37, 0x36, 0x0a, 0x38, 0x34, 0x37,
+    0x36, 0x0a, 0x38, 0x34, 0x37, 0x36, 0x0a, 0x38, 0x34, 0x37, 0x2f, 0x53,
+    0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61, 0x72,
+    0x64, 0x2f, 0x20, 0x86, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x76, 0x69,
+    0x73, 0x69, 0x6f, 0x6e, 0x20, 0x36, 0x38, 0x36, 0x39, 0x39, 0x0a, 0x64,
+    0x72, 0x69, 0x76, 0x65, 0x20, 0x32, 0x35, 0x39, 0x35, 0x37, 0x0a, 0x34,
+    0x33, 0x36, 0x39, 0x37, 0x0a, 0x39, 0x31, 0x35, 0x0a, 0x31, 0x38, 0x35,
+    0x31, 0x39, 0x0a, 0x34, 0x31, 0x36, 0x39, 0x39, 0x0a, 0x39, 0x31, 0x37,
+    0x39, 0x39, 0x0a, 0x32, 0x34, 0x38, 0x35, 0x36, 0x0a, 0x36, 0x35, 0x35,
+    0x33, 0x34, 0x0a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x2f, 0x53, 0x6d,
+    0x61, 0x72, 0x74, 0x44, 0x61, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0x00, 0x84, 0x03, 0x7b, 0xfc, 0x73, 0x68, 0x62, 0x6f,
+    0x61, 0x72, 0x64, 0x2f, 0x20, 0x2f, 0x53, 0x6d, 0x61, 0x72, 0x74, 0x44,
+    0x61, 0x73, 0x68, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2f, 0x20, 0x2f, 0x53,
+    0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61, 0x72,
+    0x64, 0x2f, 0x20, 0x33, 0x36, 0x32, 0x33, 0x36, 0x0a, 0x31, 0x35, 0x36,
+    0x33, 0x0a, 0x2f, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x76, 0x69,
+    0x73, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+    0x74, 0x72, 0x75, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x2f, 0x53,
+    0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68, 0x37, 0x39, 0x38, 0x39,
+    0x36, 0x0a, 0xea, 0x2f, 0x53, 0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73,
+    0x68, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2f, 0x20, 0x33, 0x34, 0x33, 0x34,
+    0x31, 0x0a, 0x38, 0x37, 0x35, 0x33, 0x39, 0x0a, 0x64, 0x2f, 0x20, 0x2f,
+    0x53, 0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61,
+    0x72, 0x64, 0x2f, 0x20, 0x33, 0x36, 0x32, 0x33, 0x36, 0x0a, 0x31, 0x35,
+    0x36, 0x33, 0x0a, 0x2f, 0x20, 0x64, 0x72, 0x69, 0x76, 0x64, 0x72, 0x69,
+    0x76, 0x65, 0x20, 0x38, 0x32, 0x34, 0x31, 0x0a, 0x38, 0x30, 0x38, 0x33,
+    0x39, 0x0a, 0x47, 0xff, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x70,
+    0x6f, 0x73, 0x65, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x32, 0x37,
+    0x30, 0x36, 0x33, 0x0a, 0x90, 0x72, 0x6f, 0x62, 0x6f, 0x74, 0x20, 0x66,
+    0x61, 0x6c, 0x73, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x2f, 0x53,
+    0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61, 0x72,
+    0x64, 0x2f, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x20, 0x3a, 0x31, 0x31, 0x37, 0x32, 0x32, 0x0a, 0x74, 0x72, 0x75,
+    0x65, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76,
+    0x65, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65,
+    0x20, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x76, 0x69, 0x73, 0x69,
+    0x6f, 0x6e, 0x20, 0x34, 0x30, 0x37, 0x31, 0x35, 0x0a, 0x32, 0x31, 0x34,
+    0x36, 0x35, 0x0a, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x64, 0x72, 0x69,
+    0x76, 0x65, 0x20, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x2f, 0x53,
+    0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61, 0x72,
+    0x64, 0x2f, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x76, 0x69, 0x73,
+    0x69, 0x6f, 0x6e, 0x20, 0x86, 0x0a, 0x99, 0x66, 0x61, 0x6c, 0x73, 0x65,
+    0x20, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x69, 0x73, 0x69,
+    0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x33, 0x33, 0x34,
+    0x35, 0x37, 0x0a, 0x39, 0x31, 0x30, 0x31, 0x31, 0x0a, 0x70, 0x6f, 0x73,
+    0x65, 0x20, 0x97, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x6f,
+    0x62, 0x6f, 0x74, 0x20, 0x74, 0x34, 0x31, 0x36, 0x37, 0x39, 0x0a, 0x2f,
+    0x53, 0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61,
+    0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x69, 0x73,
+    0x69, 0x6f, 0x6e, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x70, 0x6f, 0x73,
+    0x65, 0x20, 0x2f, 0x53, 0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68,
+    0x62, 0x6f, 0x61, 0x72, 0x64, 0x2f, 0x20, 0x76, 0x69, 0x73, 0x69, 0x6f,
+    0x6e, 0x20, 0x22, 0x70, 0x6f, 0x73, 0x65, 0x20, 0xc7, 0x33, 0x30, 0x34,
+    0x37, 0x32, 0x0a, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x2f, 0x53,
+    0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61, 0x72,
+    0x64, 0x2f, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x31, 0x30, 0x31,
+    0x35, 0x33, 0x37, 0x38, 0x31, 0x0a, 0x74, 0x72, 0x75, 0x65, 0x20, 0x37,
+    0x39, 0x39, 0x32, 0x34, 0x0a, 0x53, 0x6d, 0x61, 0x72, 0x74, 0x44, 0x61,
+    0x73, 0x68, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2f, 0x20, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x20, 0x31, 0x30, 0x31, 0x30, 0x31, 0x0a, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x20, 0x34, 0x31,
+    0x35, 0x34, 0x34, 0x0a, 0x99, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x37,
+    0x35, 0x32, 0x32, 0x31, 0x0a, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x20, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x38, 0x39,
+    0x38, 0x30, 0x30, 0x0a, 0x74, 0x72, 0x75, 0x65, 0x20, 0x32, 0x38, 0x35,
+    0x37, 0x37, 0x0a, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x70, 0x6f, 0x73,
+    0x65, 0x20, 0xe5, 0x73, 0x65, 0x20, 0x32, 0x37, 0x30, 0x36, 0x33, 0x0a,
+    0x90, 0x72, 0x6f, 0x62, 0x6f, 0x74, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65,
+    0x20, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x2f, 0x53, 0x6d, 0x61, 0x72, 0x74,
+    0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2f, 0x20, 0x74,
+    0x72, 0x75, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3a, 0x31,
+    0x31, 0x37, 0x32, 0x32, 0x0a, 0x74, 0x72, 0x75, 0x65, 0x20, 0x66, 0x61,
+    0x6c, 0x73, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x76, 0x69, 0x73,
+    0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e,
+    0x20, 0x35, 0x39, 0x36, 0x31, 0x35, 0x0a, 0x36, 0x34, 0x38, 0x32, 0x37,
+    0x0a, 0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61,
+    0x72, 0x64, 0x2f, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x64, 0x72,
+    0x69, 0x76, 0x65, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x37, 0x39, 0x39,
+    0x32, 0x34, 0x0a, 0x53, 0x6d, 0x61, 0x72, 0x74, 0x44, 0x61, 0x73, 0x68,
+    0x62, 0x6f, 0x61, 0x72, 0x64, 0x2f, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x20, 0x31, 0x30, 0x31, 0x30, 0x31, 0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x20, 0x34, 0x31, 0x35, 0x34,
+    0x34, 0x0a, 0x99, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20, 0x37, 0x35, 0x32,
+    0x32, 0x31, 0x0a, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x00, 0x00, 0x00, 0xff,
+    0xff};
+
+inline constexpr size_t kFixedChunks[] = {3000, 3000};
+inline constexpr size_t kFixedCompressed[] = {731, 735};
+inline constexpr uint8_t kFixedData[] = {
+    0x2a, 0xca, 0x4f, 0xca, 0x2f, 0x51, 0x28, 0x4b, 0xcc, 0x29, 0x4d, 0x55,
+    0x28, 0x02, 0xb3, 0xe9, 0x03, 0x21, 0x76, 0x95, 0x65, 0x16, 0x67, 0xe6,
+    0xe7, 0xc1, 0x28, 0xda, 0x98, 0x0e, 0x35, 0x3c, 0x2d, 0x31, 0xa7, 0x38,
+    0x15, 0xea, 0x51, 0x13, 0x03, 0x43, 0x53, 0x13, 0x2e, 0xa8, 0x84, 0xb1,
+    0xb1, 0xa1, 0xb1, 0x11, 0x17, 0x89, 0x36, 0x2c, 0x9e, 0x6b, 0x6c, 0x6a,
+    0x6c, 0x6e, 0xca, 0x95, 0x52, 0x94, 0x59, 0x96, 0xaa, 0x00, 0x21, 0xf5,
+    0x83, 0x73, 0x13, 0x8b, 0x4a, 0x5c, 0x12, 0x8b, 0x33, 0x92, 0xf2, 0x13,
+    0x8b, 0x52, 0xf4, 0xa1, 0x96, 0x61, 0x08, 0x6f, 0xb1, 0x30, 0x33, 0xb2,
+    0x30, 0xe4, 0x32, 0x34, 0x37, 0x30, 0x33, 0xe2, 0x32, 0x37, 0x37, 0x33,
+    0x34, 0xe4, 0x2a, 0x29, 0x82, 0x07, 0x3f, 0xc4, 0x9d, 0x2d, 0x10, 0x23,
+    0x21, 0x1c, 0x33, 0x03, 0x23, 0xa0, 0x55, 0x60, 0x35, 0x10, 0x81, 0x49,
+    0x86, 0x86, 0xe6, 0xe6, 0x16, 0x5c, 0xe6, 0xc6, 0x40, 0x47, 0x70, 0x19,
+    0x1a, 0x18, 0x19, 0x02, 0xcd, 0xb1, 0x34, 0x33, 0x30, 0xe3, 0xb2, 0xb4,
+    0xb0, 0x34, 0x33, 0xe5, 0x22, 0x51, 0x27, 0xc4, 0xaa, 0x82, 0x7c, 0xa0,
+    0xb4, 0xa5, 0xa9, 0xb9, 0x81, 0x05, 0x97, 0x89, 0x81, 0xa5, 0x39, 0x97,
+    0xb9, 0x85, 0x89, 0xa5, 0x05, 0xd4, 0x7f, 0x48, 0xce, 0x33, 0x36, 0x37,
+    0x33, 0x35, 0xe7, 0x82, 0xf8, 0x0c, 0x6a, 0x26, 0x58, 0x27, 0x72, 0x0a,
+    0x82, 0xb0, 0x81, 0xfe, 0xb2, 0x34, 0xe5, 0xb2, 0x30, 0x34, 0x33, 0x32,
+    0x32, 0xe2, 0x22, 0x94, 0xb4, 0xb0, 0x25, 0x07, 0xea, 0x85, 0x15, 0xd4,
+    0x40, 0x23, 0x43, 0x33, 0x4b, 0x4b, 0x2e, 0x27, 0x88, 0xf3, 0xcc, 0x4d,
+    0xcc, 0x81, 0x1e, 0x81, 0xd8, 0x62, 0x69, 0x60, 0x61, 0x66, 0x02, 0xd1,
+    0x64, 0x61, 0x60, 0x61, 0x6a, 0xc6, 0x85, 0x23, 0x42, 0xf1, 0x66, 0x15,
+    0x33, 0x63, 0x0b, 0x60, 0x0c, 0x40, 0xad, 0x82, 0x18, 0x00, 0x51, 0x6b,
+    0x68, 0x04, 0x0a, 0x6c, 0x0c, 0xc3, 0x90, 0x82, 0x3d, 0x98, 0xdc, 0x2c,
+    0x03, 0x11, 0x52, 0xed, 0xc2, 0x30, 0x1c, 0xec, 0x17, 0xa8, 0x52, 0x53,
+    0x43, 0x23, 0x53, 0x23, 0x2e, 0x48, 0x68, 0x98, 0x9b, 0x03, 0x23, 0xf5,
+    0xec, 0x35, 0x88, 0xdd, 0xc6, 0x16, 0x26, 0x16, 0x16, 0x5c, 0x96, 0x96,
+    0x16, 0xe6, 0xd0, 0x50, 0xbd, 0x0f, 0x76, 0x0d, 0x98, 0x29, 0x05, 0xd5,
+    0x6c, 0x66, 0x66, 0x6e, 0x6e, 0x80, 0xe9, 0x78, 0x4b, 0x03, 0x03, 0x4b,
+    0x63, 0xae, 0x24, 0x73, 0x23, 0x63, 0x13, 0x53, 0x4c, 0x59, 0x88, 0xb3,
+    0x70, 0x04, 0x22, 0x86, 0x80, 0x91, 0x89, 0xa1, 0x89, 0x31, 0x97, 0xb1,
+    0x91, 0xa1, 0xa9, 0x25, 0x17, 0x07, 0xd8, 0x05, 0x26, 0x96, 0x26, 0x46,
+    0x66, 0x5c, 0x16, 0x66, 0x16, 0xa6, 0xb0, 0x84, 0x83, 0xe4, 0x9d, 0x4b,
+    0xc0, 0xb8, 0xc2, 0x66, 0x29, 0x58, 0x27, 0x44, 0xb9, 0x29, 0x30, 0x16,
+    0x0d, 0x31, 0x55, 0x40, 0xa2, 0x03, 0x42, 0x4e, 0x24, 0xb2, 0x48, 0x40,
+    0x4f, 0xba, 0x24, 0x44, 0x02, 0x0d, 0x22, 0x1a, 0x47, 0x22, 0x42, 0xca,
+    0xa5, 0xc6, 0xa6, 0x96, 0x46, 0xa8, 0xc5, 0xd2, 0x39, 0xa8, 0x84, 0xb1,
+    0xb1, 0x11, 0x30, 0x26, 0xd1, 0x73, 0xb8, 0xb9, 0x85, 0xa5, 0xa1, 0x01,
+    0x97, 0xa9, 0x99, 0xb9, 0xa5, 0x21, 0x34, 0x57, 0x03, 0x63, 0xd4, 0x04,
+    0x96, 0x5c, 0x88, 0xc9, 0x5a, 0xc6, 0x20, 0x03, 0x80, 0x51, 0x65, 0x6a,
+    0x00, 0xd5, 0x74, 0x1a, 0x5a, 0x3a, 0xa0, 0xa5, 0x3b, 0x0c, 0xb7, 0xef,
+    0x80, 0x26, 0x13, 0x6a, 0x86, 0x10, 0x54, 0x88, 0x46, 0x09, 0x16, 0x3d,
+    0x14, 0x90, 0x13, 0x10, 0x52, 0x1c, 0x98, 0x19, 0x99, 0x9a, 0x18, 0x70,
+    0xd5, 0x81, 0xd9, 0x7f, 0xcd, 0x2c, 0x4d, 0x8d, 0x80, 0x65, 0x0b, 0x95,
+    0xab, 0x3a, 0x74, 0x01, 0x3f, 0x58, 0x76, 0x35, 0x34, 0x01, 0xa6, 0xfc,
+    0x83, 0x96, 0xc6, 0x86, 0x46, 0xe6, 0x5c, 0x90, 0xdc, 0x8c, 0x55, 0x37,
+    0x55, 0x32, 0x75, 0x11, 0xdc, 0xdb, 0xc8, 0x39, 0x0b, 0x2c, 0x0c, 0xa9,
+    0x13, 0xa0, 0x5e, 0x06, 0x0b, 0x5b, 0x9a, 0x99, 0x03, 0x8b, 0x70, 0x0b,
+    0x23, 0x33, 0x43, 0x63, 0x2e, 0x61, 0x6a, 0xe7, 0x29, 0x98, 0x2a, 0x73,
+    0x43, 0x60, 0x82, 0x86, 0xe5, 0x62, 0x2c, 0x19, 0x04, 0xdd, 0x0a, 0xa8,
+    0xbb, 0x69, 0x95, 0xc2, 0x21, 0xc5, 0x16, 0x52, 0xd8, 0x84, 0x81, 0x45,
+    0x4c, 0x0c, 0x0d, 0x80, 0x65, 0x0d, 0xc4, 0x8b, 0xe6, 0xa6, 0x16, 0x16,
+    0xe6, 0x5c, 0x26, 0x26, 0x66, 0x10, 0x6b, 0xed, 0x61, 0xa5, 0x91, 0x05,
+    0x30, 0x1a, 0x8d, 0x8d, 0x40, 0xd5, 0xd2, 0x5f, 0x88, 0xe3, 0xa9, 0x12,
+    0x69, 0x6d, 0xd8, 0x4b, 0x4d, 0x22, 0xd2, 0x08, 0x34, 0x4c, 0x97, 0x1a,
+    0x1a, 0xc0, 0x4b, 0x49, 0x73, 0x0b, 0x33, 0x63, 0x33, 0x48, 0x22, 0x83,
+    0x04, 0x81, 0xa9, 0x25, 0xb0, 0xe8, 0xe0, 0xa2, 0x42, 0x23, 0x0b, 0x5f,
+    0x40, 0x22, 0xaa, 0x28, 0xcc, 0xf2, 0x1d, 0xb9, 0xa5, 0x87, 0x3d, 0x5d,
+    0x11, 0xb6, 0x1c, 0x61, 0x3e, 0x2c, 0x82, 0x2c, 0x81, 0x59, 0x09, 0x39,
+    0x1c, 0x89, 0x29, 0xd3, 0xa8, 0x1d, 0xa1, 0x60, 0xb3, 0x20, 0x85, 0x8b,
+    0x85, 0x89, 0x89, 0x25, 0x57, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02,
+    0xb9, 0xb2, 0x0d, 0x57, 0x89, 0x0f, 0xa1, 0xcc, 0x80, 0xa5, 0x00, 0xb4,
+    0x55, 0x63, 0x64, 0x62, 0x61, 0x0c, 0xcf, 0x17, 0x10, 0xd7, 0x03, 0x5d,
+    0x68, 0x60, 0xca, 0xa5, 0x03, 0x6d, 0x0c, 0x99, 0x9a, 0x00, 0xab, 0x60,
+    0xd9, 0x4c, 0xe4, 0xc6, 0x0d, 0xb4, 0xbd, 0x67, 0x69, 0x0e, 0x6c, 0xc5,
+    0x99, 0x1a, 0x18, 0x03, 0x2d, 0x05, 0x1b, 0xd5, 0x4e, 0x59, 0x52, 0xc7,
+    0xd0, 0x88, 0xab, 0xe1, 0x85, 0x94, 0x0b, 0x31, 0xf4, 0xf4, 0x40, 0xdd,
+    0x06, 0x2c, 0xeb, 0x80, 0x81, 0x6a, 0x0e, 0x0c, 0x12, 0x98, 0xdf, 0x10,
+    0x85, 0x0f, 0x8e, 0xda, 0x1f, 0x62, 0x01, 0x44, 0xbf, 0x11, 0xb0, 0xc9,
+    0x66, 0xc1, 0xf5, 0x1c, 0x47, 0x28, 0x41, 0xd4, 0x38, 0x53, 0xb7, 0x69,
+    0x84, 0xa1, 0x98, 0x0e, 0xa5, 0x22, 0xb0, 0x4e, 0x30, 0x04, 0x36, 0xc4,
+    0x8d, 0x2c, 0x81, 0xad, 0x50, 0x33, 0x60, 0x44, 0x1a, 0x73, 0xb9, 0x61,
+    0xb8, 0xc3, 0xd0, 0x14, 0x08, 0xb9, 0x80, 0x2d, 0x58, 0x0b, 0xae, 0x20,
+    0xa4, 0x56, 0x3d, 0x72, 0x31, 0x4e, 0xcb, 0xe6, 0x1b, 0x44, 0x19, 0xc5,
+    0x66, 0x02, 0xcb, 0x69, 0x33, 0x73, 0x2e, 0x43, 0x53, 0x0b, 0x63, 0x73,
+    0xae, 0x16, 0x9c, 0xc1, 0x64, 0x6e, 0x08, 0x6c, 0xee, 0x70, 0x01, 0x7b,
+    0x14, 0x16, 0x06, 0x5c, 0x26, 0xe6, 0xc6, 0xd0, 0x02, 0xdf, 0xc4, 0x14,
+    0x9c, 0x98, 0x70, 0x17, 0x53, 0x60, 0x67, 0x40, 0x73, 0x16, 0xd0, 0x2d,
+    0x06, 0x40, 0xb5, 0xa6, 0x40, 0x27, 0x59, 0x5a, 0x02, 0x8d, 0xe3, 0x32,
+    0x33, 0x02, 0x26, 0x5f, 0x48, 0xae, 0x34, 0x83, 0xf5, 0x36, 0xcc, 0x8c,
+    0x8c, 0x2d, 0xa1, 0x09, 0xda, 0x10, 0x68, 0x3a, 0xb4, 0x3e, 0x46, 0x6a,
+    0x27, 0xe0, 0x2a, 0xc0, 0xcc, 0x4d, 0x8d, 0x0c, 0x61, 0x55, 0xcd, 0x37,
+    0xb0, 0x4a, 0x4b, 0x0b, 0x60, 0x24, 0x72, 0x21, 0x15, 0x80, 0x67, 0x72,
+    0x51, 0xba, 0x60, 0x78, 0xea, 0x29, 0x60, 0x07, 0xca, 0xdc, 0x12, 0x18,
+    0xb3, 0xc0, 0xa4, 0x6a, 0x68, 0x64, 0x62, 0x8a, 0x52, 0xbd, 0xad, 0xa5,
+    0xbc, 0xbd, 0x6d, 0x0e, 0x4c, 0x33, 0x26, 0x5c, 0x57, 0xbc, 0x91, 0x3a,
+    0x81, 0x26, 0x66, 0x16, 0xe6, 0xc6, 0x30, 0x8f, 0x13, 0xdd, 0xfb, 0x83,
+    0xaa, 0x37, 0x36, 0x05, 0xe6, 0x07, 0xb0, 0x61, 0x44, 0x74, 0x6f, 0x20,
+    0x7a, 0x40, 0xae, 0x37, 0xe1, 0x02, 0x66, 0x24, 0x0b, 0x58, 0x13, 0x16,
+    0xda, 0xe2, 0x00, 0x36, 0x75, 0x4d, 0xb8, 0x2c, 0xcc, 0x4d, 0x81, 0x41,
+    0x47, 0x92, 0x97, 0x89, 0xed, 0x68, 0x80, 0xdc, 0x6a, 0x88, 0x52, 0xf2,
+    0x62, 0x7a, 0x0b, 0x25, 0x07, 0x03, 0x83, 0xdf, 0x0c, 0xa6, 0x01, 0xd8,
+    0x42, 0x33, 0x30, 0xe7, 0x42, 0x2e, 0x8e, 0x70, 0xf5, 0x57, 0x50, 0xea,
+    0x2f, 0x58, 0xdf, 0x18, 0xa9, 0x88, 0xa6, 0x5e, 0x2b, 0xcc, 0xc4, 0xd0,
+    0xcc, 0xc0, 0x92, 0x0b, 0x5f, 0x0a, 0x45, 0xae, 0x07, 0x71, 0x76, 0xeb,
+    0xd2, 0xb1, 0x17, 0xc0, 0xd0, 0x36, 0x96, 0x29, 0x28, 0xf7, 0x19, 0x5b,
+    0x18, 0x1a, 0x1b, 0x43, 0x92, 0xe2, 0x7b, 0x1f, 0x13, 0x50, 0x2c, 0x98,
+    0x1a, 0x98, 0x19, 0x5a, 0x40, 0xcb, 0x61, 0x12, 0x3a, 0x0d, 0xe6, 0x66,
+    0xc0, 0xba, 0x89, 0x8b, 0x1a, 0xed, 0x21, 0x94, 0x70, 0x32, 0x32, 0x32,
+    0x35, 0xe7, 0xaa, 0xc7, 0xd0, 0x6e, 0x6a, 0x0c, 0xcc, 0x5b, 0xe4, 0x0e,
+    0xe3, 0x60, 0x98, 0x46, 0xf5, 0xca, 0xd5, 0x18, 0x68, 0x90, 0x19, 0xae,
+    0x7e, 0x2f, 0x34, 0x8d, 0x20, 0xfb, 0x12, 0x52, 0x5e, 0x99, 0x00, 0xbb,
+    0x7e, 0x73, 0x08, 0x77, 0xd3, 0x91, 0x92, 0x05, 0xb0, 0xcc, 0x33, 0xb3,
+    0xe0, 0xb2, 0x30, 0x34, 0xc5, 0x12, 0xc2, 0x50, 0x0b, 0xb0, 0x27, 0x01,
+    0x72, 0xab, 0x7b, 0x58, 0x8d, 0x6b, 0x6a, 0x6e, 0x64, 0xc1, 0x65, 0x64,
+    0x01, 0xca, 0xd1, 0xc0, 0x2a, 0x02, 0x58, 0xa4, 0x21, 0xb5, 0x3e, 0x97,
+    0x41, 0x02, 0x82, 0x1e, 0x63, 0x3b, 0x60, 0x5b, 0x81, 0xf1, 0x6e, 0x09,
+    0x2c, 0x6e, 0x8d, 0x81, 0x25, 0x3f, 0xae, 0xc1, 0x1d, 0x23, 0x53, 0x63,
+    0x73, 0x43, 0x60, 0x3f, 0xdb, 0x18, 0xd4, 0xe5, 0x46, 0x29, 0xa1, 0x8c,
+    0x2d, 0x8d, 0x0d, 0x80, 0xf9, 0xd0, 0xdc, 0xd8, 0xcc, 0x98, 0x0b, 0x25,
+    0x9b, 0x23, 0x1a, 0x7a, 0xc8, 0xe5, 0x8a, 0x89, 0x11, 0x68, 0xd4, 0x0e,
+    0x2c, 0x4c, 0xca, 0x48, 0x9c, 0x21, 0xb0, 0x85, 0x04, 0xcb, 0x4c, 0x28,
+    0x43, 0x73, 0x46, 0x86, 0x86, 0x66, 0x5c, 0x46, 0x96, 0x16, 0x96, 0x46,
+    0x5c, 0xc0, 0x12, 0xd7, 0xc8, 0x92, 0xcb, 0x14, 0x34, 0x0e, 0xc0, 0x65,
+    0x62, 0x60, 0x02, 0x0c, 0x5f, 0x42, 0x4d, 0x64, 0x94, 0xc1, 0x55, 0x44,
+    0x3a, 0x42, 0x29, 0x7a, 0x81, 0x05, 0x89, 0x01, 0x17, 0x8e, 0x24, 0x48,
+    0x7a, 0xe3, 0x0b, 0xe2, 0x03, 0xe4, 0x34, 0x88, 0x68, 0x9d, 0xfc, 0x05,
+    0x93, 0x37, 0x20, 0xc5, 0x15, 0x66, 0x86, 0x35, 0x32, 0x32, 0x33, 0x47,
+    0xae, 0x38, 0xcd, 0x0d, 0xcd, 0x81, 0xb1, 0x86, 0x2c, 0x60, 0x82, 0x18,
+    0xfa, 0x80, 0x90, 0xce, 0x96, 0x66, 0x96, 0xc0, 0xa4, 0x05, 0x36, 0xf1,
+    0x2c, 0xf6, 0xd2, 0xdf, 0xc8, 0xd2, 0xc0, 0x08, 0x4b, 0xda, 0xc7, 0x3d,
+    0x20, 0x0a, 0x2c, 0x77, 0x0d, 0x8d, 0x40, 0x49, 0x0f, 0x00, 0x00, 0x00,
+    0xff, 0xff};
+
+inline constexpr size_t kDynamicChunks[] = {8000, 8000};
+inline constexpr size_t kDynamicCompressed[] = {1516, 1575};
+inline constexpr uint8_t kDynamicData[] = {
+    0xb4, 0x59, 0x3b, 0x6f, 0x24, 0x45, 0x10, 0xce, 0x08, 0x4a, 0x44, 0xf0,
+    0x03, 0x70, 0x82, 0x44, 0x76, 0xfd, 0xa8, 0x7e, 0x81, 0x4e, 0xc0, 0xc9,
+    0x3a, 0x21, 0xd2, 0x0b, 0x2f, 0x40, 0x3e, 0xd9, 0x08, 0x23, 0x73, 0x3e,
+    0xd6, 0x3e, 0x27, 0xfc, 0x81, 0x93, 0x10, 0xe2, 0x12, 0x32, 0xd0, 0x11,
+    0x12, 0x10, 0x11, 0x91, 0x20, 0xf1, 0x07, 0x40, 0x20, 0x22, 0x10, 0x11,
+    0x11, 0x01, 0x20, 0x44, 0x86, 0x90, 0x80, 0x6f, 0xba, 0x7a, 0xbc, 0x3d,
+    0x3b, 0x33, 0xeb, 0x9d, 0xf5, 0x6c, 0x32, 0x3b, 0x8f, 0xea, 0xea, 0x7a,
+    0xd7, 0x57, 0xbd, 0x8b, 0xd3, 0x7b, 0xa7, 0xe7, 0x7b, 0x0f, 0x4e, 0xcf,
+    0x8e, 0xf6, 0x1e, 0x2c, 0xf2, 0xfd, 0x9b, 0x07, 0x27, 0x78, 0x90, 0x7b,
+    0xb9, 0x86, 0x94, 0x52, 0xa0, 0x5b, 0x1f, 0x9f, 0x2f, 0x1e, 0x1e, 0xed,
+    0xdd, 0xb8, 0xf3, 0xce, 0xc1, 0xe2, 0x7c, 0xff, 0xe0, 0xec, 0xad, 0x7b,
+    0xa7, 0x07, 0x8b, 0xc3, 0x1b, 0x85, 0xe6, 0xe2, 0xe0, 0x04, 0x1f, 0x33,
+    0xc5, 0xbf, 0x2f, 0xde, 0xd6, 0xc6, 0x2b, 0x26, 0xe1, 0x74, 0x71, 0x7c,
+    0x76, 0x7c, 0x7a, 0x7f, 0xaf, 0x66, 0x5e, 0x7f, 0x64, 0x6f, 0x6c, 0xa4,
+    0x64, 0x9d, 0xb1, 0x74, 0xb8, 0x38, 0xbe, 0x38, 0xda, 0x93, 0x6b, 0x66,
+    0x95, 0xb4, 0x67, 0xcf, 0x24, 0xcc, 0x45, 0xc8, 0xe6, 0xc2, 0x3a, 0x7a,
+    0x4b, 0xd3, 0x85, 0x2a, 0xa2, 0x78, 0x56, 0xca, 0x16, 0x01, 0xe4, 0x6a,
+    0x52, 0xd2, 0x91, 0x5e, 0x9b, 0x75, 0x9f, 0x76, 0xb3, 0x68, 0x8c, 0x23,
+    0xa1, 0xeb, 0x2d, 0xcf, 0x4b, 0x64, 0xf5, 0xbc, 0x8c, 0xe5, 0xb5, 0x58,
+    0x32, 0xab, 0x72, 0xb7, 0xac, 0xfa, 0xd3, 0x45, 0x9d, 0x98, 0x82, 0x65,
+    0x17, 0x8b, 0x09, 0x8c, 0x32, 0xe5, 0xae, 0xc7, 0xc6, 0x06, 0xed, 0x48,
+    0xc7, 0x04, 0x8a, 0xcd, 0x9e, 0x6b, 0xb1, 0xc7, 0xed, 0x68, 0xa2, 0x0e,
+    0x8e, 0x02, 0x14, 0xa0, 0xfc, 0x5d, 0xe8, 0x45, 0x5a, 0x97, 0x4c, 0xa4,
+    0x69, 0x0b, 0xe4, 0x69, 0x97, 0x9e, 0x95, 0x9f, 0xbf, 0x5b, 0x8d, 0x77,
+    0x6b, 0xb4, 0xe2, 0x29, 0xbc, 0xf2, 0xd1, 0xba, 0x40, 0x23, 0xa2, 0xfd,
+    0x95, 0x1a, 0x73, 0x4c, 0x8b, 0xf6, 0x99, 0x9d, 0x88, 0xa4, 0x35, 0xad,
+    0x19, 0x96, 0x84, 0x3d, 0x79, 0xeb, 0xb4, 0x1e, 0xb4, 0x78, 0x71, 0x24,
+    0x36, 0xf0, 0x6d, 0x5d, 0xc8, 0x9b, 0x97, 0x6a, 0xc1, 0x26, 0x24, 0xea,
+    0x28, 0x29, 0xf7, 0xd6, 0x39, 0xc4, 0x4a, 0x15, 0xe4, 0xcf, 0xd6, 0x61,
+    0xef, 0xbc, 0x8e, 0x91, 0x5c, 0xb0, 0x28, 0x20, 0x13, 0x3d, 0xe3, 0x9d,
+    0x81, 0x24, 0xbd, 0x1c, 0x72, 0x16, 0xb9, 0x43, 0xd1, 0x1b, 0x28, 0xf1,
+    0xe3, 0xb0, 0xaa, 0x95, 0x0f, 0xea, 0x18, 0x0d, 0xc6, 0x5e, 0x96, 0xb7,
+    0x55, 0x35, 0x19, 0xa1, 0x1d, 0xc1, 0x35, 0x05, 0x5b, 0x0a, 0xdd, 0xf7,
+    0xd6, 0x07, 0xd7, 0xda, 0x95, 0x5d, 0x8a, 0x8e, 0x7e, 0x8e, 0x08, 0x64,
+    0xa6, 0xcc, 0x58, 0xd8, 0x88, 0x74, 0xce, 0x72, 0x68, 0x94, 0xe4, 0x46,
+    0xd5, 0xe4, 0xbc, 0x19, 0x08, 0x97, 0xa5, 0x07, 0x65, 0xcd, 0x1f, 0x3d,
+    0x8a, 0xde, 0x8b, 0xa0, 0x4d, 0x8a, 0xf4, 0x0c, 0xaa, 0x32, 0xe2, 0x4f,
+    0x56, 0x5d, 0x15, 0xae, 0x3d, 0x1e, 0xd1, 0x47, 0xc4, 0x9d, 0x0e, 0xca,
+    0x9b, 0x8e, 0x53, 0xdf, 0xd6, 0x26, 0x5a, 0x53, 0x8c, 0x21, 0x1f, 0xe4,
+    0xbe, 0xc7, 0xe1, 0x85, 0x5b, 0xb2, 0xa2, 0xec, 0x90, 0x95, 0x77, 0xce,
+    0x6a, 0xdb, 0xd7, 0x11, 0x99, 0x62, 0x8a, 0x79, 0x0a, 0x75, 0xf9, 0xd9,
+    0xa4, 0x95, 0xc0, 0x6c, 0x2a, 0x92, 0x67, 0xe7, 0x29, 0x68, 0xaf, 0x9a,
+    0xab, 0xf2, 0x9a, 0xda, 0xfc, 0x81, 0x5f, 0x1e, 0x67, 0x16, 0xd1, 0x2a,
+    0x1f, 0x65, 0x13, 0xb1, 0xc1, 0xc4, 0xcf, 0x9a, 0x13, 0xe2, 0x87, 0x55,
+    0x13, 0xb5, 0x1a, 0xa9, 0x93, 0x8a, 0x34, 0xab, 0x32, 0xd5, 0x31, 0xbe,
+    0x61, 0x7d, 0x19, 0x29, 0x45, 0x2b, 0x29, 0x2b, 0x8c, 0x67, 0xcf, 0xa4,
+    0x35, 0x76, 0x67, 0x15, 0xa2, 0xa5, 0x59, 0xab, 0x5e, 0xef, 0xc3, 0xeb,
+    0xb5, 0x26, 0x95, 0x2d, 0xb7, 0xee, 0xfb, 0x09, 0x4e, 0x6b, 0xc3, 0xbe,
+    0xce, 0xe2, 0x14, 0x19, 0xe6, 0x7c, 0xd5, 0x5a, 0x0d, 0x55, 0x32, 0xf5,
+    0x62, 0x89, 0x9e, 0x7a, 0x62, 0x19, 0xed, 0xa9, 0x2a, 0x07, 0xbd, 0x8a,
+    0xda, 0x5b, 0xb0, 0xbd, 0x0f, 0xae, 0x83, 0xc7, 0xa0, 0xaa, 0x73, 0x7d,
+    0x6b, 0x23, 0x3c, 0xd9, 0x11, 0x03, 0xfa, 0x39, 0xda, 0x55, 0x8d, 0x88,
+    0x30, 0xa8, 0x1d, 0x88, 0xa8, 0xf7, 0x45, 0x50, 0x08, 0xad, 0x0d, 0x3d,
+    0x1e, 0x09, 0xed, 0xaf, 0x0d, 0x1b, 0x6c, 0xec, 0x82, 0x89, 0x86, 0x3e,
+    0xd5, 0xda, 0xb0, 0xa6, 0x55, 0xc3, 0xe5, 0xa7, 0xdf, 0xae, 0x5f, 0x28,
+    0x26, 0x37, 0x92, 0xdf, 0x4b, 0xc0, 0xe4, 0xf0, 0xca, 0x5c, 0xad, 0x0a,
+    0xf8, 0x38, 0xb6, 0x50, 0xd2, 0x5e, 0x04, 0xd9, 0x1a, 0xc1, 0x08, 0x85,
+    0x37, 0x31, 0x99, 0xbe, 0x3f, 0xeb, 0xa6, 0x71, 0x7d, 0x88, 0x5c, 0x67,
+    0x5c, 0x60, 0xcd, 0x1d, 0xe4, 0xfe, 0x48, 0xde, 0x6f, 0x19, 0x2e, 0x8f,
+    0x84, 0xf7, 0x8a, 0x02, 0x99, 0xb1, 0x7c, 0x79, 0x43, 0x1e, 0xe6, 0xae,
+    0xba, 0xf2, 0xf8, 0x92, 0x30, 0x8f, 0x0a, 0xd2, 0xd2, 0xd6, 0x8a, 0x4f,
+    0xd5, 0xab, 0xdf, 0x3b, 0xad, 0x41, 0xc8, 0xbd, 0x1c, 0x81, 0x43, 0x98,
+    0x16, 0x23, 0xce, 0xcc, 0xfa, 0xed, 0x06, 0x45, 0xcf, 0x9d, 0xad, 0x77,
+    0xf3, 0x7e, 0x09, 0x5a, 0x69, 0xda, 0xe5, 0xb8, 0x72, 0xe7, 0xe6, 0xa4,
+    0xac, 0xc8, 0x5b, 0x6d, 0x9a, 0x99, 0x51, 0x7b, 0x97, 0x4a, 0xe4, 0x72,
+    0x50, 0x8e, 0x09, 0x00, 0x98, 0x3d, 0x8d, 0x80, 0x97, 0xbc, 0xfb, 0xd8,
+    0x60, 0x51, 0x27, 0x56, 0x50, 0x9c, 0x6c, 0x0b, 0x36, 0x22, 0xd0, 0x61,
+    0x1a, 0x63, 0x59, 0x43, 0xa6, 0x27, 0x9d, 0x84, 0xde, 0x05, 0xce, 0xb0,
+    0x41, 0xc1, 0x16, 0xcf, 0x47, 0x05, 0x38, 0x4c, 0xbb, 0xac, 0x39, 0xf9,
+    0x46, 0x44, 0x57, 0x3e, 0xe8, 0x3e, 0x1f, 0xd9, 0x1b, 0xf2, 0x38, 0x5a,
+    0x97, 0xef, 0xad, 0x2c, 0x3b, 0x45, 0x9b, 0xf9, 0x75, 0xe1, 0x33, 0xf3,
+    0xfc, 0x5e, 0xe5, 0xc0, 0xfa, 0x71, 0x62, 0x24, 0x7d, 0x30, 0x97, 0xb4,
+    0xdd, 0xa6, 0xed, 0xf1, 0xab, 0xad, 0xb8, 0xcd, 0x20, 0xc7, 0x4c, 0xbf,
+    0x14, 0x22, 0xe1, 0xb2, 0x29, 0x82, 0xac, 0x6d, 0xab, 0x5d, 0x93, 0x05,
+    0x83, 0x75, 0xad, 0x75, 0xbe, 0x7c, 0x4c, 0x16, 0xae, 0x2b, 0xdb, 0xdd,
+    0x2e, 0xc5, 0xd3, 0x62, 0xc8, 0xa2, 0x09, 0xd0, 0xbc, 0xff, 0x35, 0xff,
+    0x8c, 0x88, 0x2d, 0xd4, 0xe3, 0xbd, 0x32, 0x2a, 0x66, 0xd3, 0x99, 0xf0,
+    0x9e, 0xd6, 0x5e, 0xa3, 0xe5, 0x39, 0x65, 0xc2, 0x28, 0xf8, 0x14, 0xca,
+    0x2b, 0x30, 0x4e, 0x17, 0x56, 0x14, 0x03, 0x6c, 0x8e, 0xa2, 0xb4, 0x83,
+    0xd2, 0x94, 0x02, 0x6c, 0x2b, 0xbe, 0xfc, 0x64, 0x56, 0x5c, 0x67, 0x52,
+    0xa3, 0x5f, 0xa1, 0x1d, 0xc9, 0x84, 0x36, 0x40, 0xc1, 0x3b, 0xd1, 0x87,
+    0x18, 0xbf, 0xb5, 0xa6, 0xe4, 0x12, 0xea, 0xe1, 0x5a, 0xc0, 0x65, 0x13,
+    0x07, 0x5f, 0xd0, 0x8e, 0x73, 0xa0, 0xfe, 0xfc, 0x3d, 0xd9, 0xe0, 0xb3,
+    0x3a, 0x26, 0x77, 0x02, 0xa0, 0xfa, 0x66, 0xb5, 0xc9, 0x5d, 0x86, 0xdc,
+    0xfa, 0x51, 0xf9, 0xbe, 0x67, 0x8c, 0xf4, 0x34, 0xf9, 0x1c, 0x69, 0xb4,
+    0x1b, 0xd6, 0x05, 0x44, 0xd4, 0x78, 0x92, 0xef, 0x77, 0x75, 0x6c, 0x8a,
+    0x09, 0x0b, 0x1e, 0x61, 0xa5, 0x59, 0x11, 0x9c, 0x1b, 0xc8, 0x07, 0x17,
+    0xda, 0x6e, 0x99, 0x59, 0x67, 0x79, 0x8d, 0x62, 0x34, 0xfe, 0x9e, 0x2e,
+    0x51, 0x73, 0xb8, 0x9c, 0x75, 0x97, 0xe9, 0xb5, 0x9c, 0xa0, 0xa0, 0x1b,
+    0x7a, 0x6f, 0x35, 0xee, 0x44, 0x18, 0x27, 0xd0, 0x92, 0xca, 0x26, 0xa5,
+    0xb0, 0x73, 0xf4, 0x3a, 0xd0, 0x61, 0x7b, 0xca, 0x13, 0x15, 0x4d, 0x9a,
+    0x4c, 0x47, 0x9b, 0x7f, 0x75, 0xba, 0x64, 0x3c, 0x1a, 0x04, 0xbd, 0xb2,
+    0x71, 0x47, 0x2c, 0x6c, 0x20, 0x3e, 0x34, 0x94, 0x20, 0xf2, 0xcd, 0x39,
+    0x4c, 0x79, 0x5f, 0xbb, 0xb7, 0x0d, 0xce, 0xaa, 0x58, 0xe4, 0x05, 0x5f,
+    0x38, 0xb4, 0x00, 0x43, 0xdd, 0x9c, 0xae, 0xc3, 0xb9, 0xae, 0x87, 0x63,
+    0xe5, 0x3d, 0x34, 0xe7, 0x09, 0xa4, 0x0d, 0x22, 0x32, 0x05, 0x8f, 0xee,
+    0x05, 0xf3, 0xc4, 0x81, 0x22, 0xb3, 0x5d, 0xbf, 0xf8, 0x69, 0xdd, 0xf9,
+    0x65, 0xff, 0xa8, 0x67, 0xb7, 0xe0, 0x31, 0xe8, 0x70, 0x59, 0xc9, 0x67,
+    0x18, 0x62, 0xaa, 0xf9, 0xfa, 0x83, 0xda, 0xd7, 0xf9, 0xcd, 0x68, 0xb9,
+    0x8b, 0x28, 0xa9, 0x25, 0x40, 0x83, 0x8d, 0x48, 0x4a, 0x44, 0xa3, 0xd2,
+    0xf4, 0x70, 0xd6, 0x88, 0x84, 0x37, 0x81, 0x77, 0x97, 0xd8, 0x45, 0xa8,
+    0x51, 0xbb, 0x91, 0x80, 0xd0, 0x15, 0x05, 0xa1, 0xf7, 0x4a, 0x64, 0xcd,
+    0xd4, 0xff, 0x34, 0x5b, 0x1b, 0x0e, 0xb0, 0xa6, 0x71, 0xd6, 0xf7, 0x63,
+    0x61, 0xa8, 0x8b, 0xc8, 0xf5, 0xb9, 0xef, 0x86, 0xa2, 0x56, 0xbe, 0x85,
+    0xe6, 0x20, 0xa7, 0x3e, 0x43, 0x58, 0xd5, 0xd0, 0x3b, 0x98, 0xa2, 0x85,
+    0x83, 0xb2, 0xfa, 0x9b, 0x77, 0xd9, 0x37, 0xd0, 0x5d, 0x56, 0x5d, 0xe7,
+    0xe0, 0x3e, 0xbf, 0xea, 0x9d, 0x60, 0x94, 0x6d, 0xf6, 0xb1, 0xb1, 0xb5,
+    0x04, 0x8c, 0xc2, 0xa5, 0xa2, 0xff, 0x97, 0x69, 0x3e, 0x4a, 0x8e, 0xad,
+    0xa2, 0x93, 0x9b, 0x52, 0x54, 0x03, 0xa3, 0x2e, 0x4f, 0x9e, 0x0b, 0xea,
+    0x29, 0x4c, 0xae, 0xeb, 0x44, 0xad, 0x6a, 0x99, 0xbc, 0xfd, 0xf2, 0x87,
+    0x11, 0x10, 0xb3, 0xac, 0x9e, 0x22, 0xdd, 0x46, 0xf3, 0x53, 0xa7, 0x72,
+    0xb3, 0xe3, 0x80, 0xba, 0xac, 0xad, 0x45, 0x10, 0x68, 0x03, 0xe3, 0x57,
+    0x31, 0x5d, 0x17, 0x12, 0x58, 0x5a, 0x2b, 0xea, 0xf8, 0x7b, 0xbb, 0xa6,
+    0x20, 0x0f, 0x8c, 0x31, 0x29, 0x0c, 0x88, 0x09, 0xeb, 0x5b, 0x5e, 0xfb,
+    0x77, 0x54, 0xd3, 0xfa, 0xc2, 0x18, 0x05, 0x2c, 0x80, 0x11, 0x0e, 0x1d,
+    0xc1, 0x34, 0x50, 0x49, 0x23, 0xb7, 0x66, 0x83, 0xd9, 0x1c, 0xd2, 0xe5,
+    0xf9, 0x17, 0x27, 0x46, 0x44, 0x8e, 0x0e, 0x2f, 0xbf, 0xd6, 0x8b, 0xeb,
+    0xb3, 0x93, 0x7c, 0x5f, 0x85, 0x0b, 0x4c, 0x8f, 0xf8, 0xa8, 0xa9, 0x75,
+    0x48, 0x7e, 0xe0, 0xfc, 0xb8, 0x90, 0x3c, 0xb5, 0xe5, 0xfc, 0xd9, 0xc1,
+    0x53, 0x57, 0x9d, 0x50, 0x8d, 0x03, 0x97, 0x11, 0x18, 0x5b, 0xb8, 0x27,
+    0xdb, 0x34, 0x70, 0x36, 0x1e, 0xa8, 0xac, 0xf1, 0x74, 0x7b, 0xbc, 0xa8,
+    0x2d, 0x5a, 0x7b, 0xc7, 0x4a, 0x59, 0xd3, 0xeb, 0xdc, 0x6f, 0xaf, 0xc1,
+    0xb6, 0x27, 0x39, 0xd9, 0xea, 0xdf, 0x6a, 0x0c, 0x9b, 0x03, 0x8d, 0x71,
+    0x7f, 0xb3, 0xbf, 0xdc, 0x70, 0x09, 0x28, 0xf6, 0x0c, 0x40, 0x42, 0x5e,
+    0x59, 0xdf, 0xc6, 0x23, 0xe6, 0x14, 0x18, 0xcb, 0x00, 0xf8, 0xf9, 0xce,
+    0xa9, 0xee, 0x86, 0x63, 0x88, 0x30, 0xf9, 0x6a, 0x18, 0xb7, 0xfd, 0x0f,
+    0x00, 0x00, 0xff, 0xff, 0xbc, 0x5b, 0x3d, 0xab, 0x25, 0x45, 0x10, 0x05,
+    0x13, 0xa1, 0x35, 0xf6, 0xfd, 0x07, 0x51, 0x98, 0xfe, 0xee, 0xd6, 0x3f,
+    0xa0, 0x26, 0x82, 0xc9, 0x66, 0x8b, 0x20, 0x88, 0x8a, 0xa9, 0x81, 0x88,
+    0xf2, 0xc4, 0x3f, 0x60, 0x24, 0x62, 0xb8, 0x1b, 0x08, 0x8a, 0x18, 0xbc,
+    0xc8, 0x4c, 0x7f, 0x85, 0x6c, 0x24, 0xb2, 0x99, 0xa1, 0xd1, 0x82, 0x1b,
+    0x78, 0x6a, 0xba, 0x66, 0x6e, 0xf5, 0xed, 0x9e, 0xf7, 0x66, 0x66, 0xef,
+    0x6c, 0x72, 0xdf, 0x7b, 0xf3, 0x7a, 0x66, 0xba, 0xab, 0xab, 0x4f, 0x9d,
+    0x53, 0x55, 0xb7, 0x0d, 0xd4, 0xd9, 0xc6, 0x9c, 0xea, 0xf3, 0x6a, 0x81,
+    0x7c, 0x53, 0xf9, 0xe7, 0x22, 0x54, 0x4c, 0xbc, 0xde, 0xa5, 0x08, 0x7d,
+    0x6e, 0x73, 0x84, 0x57, 0x1c, 0x5e, 0x9c, 0xb1, 0x2e, 0xb9, 0x50, 0x49,
+    0xcc, 0xf5, 0x27, 0x06, 0x57, 0x61, 0x84, 0x22, 0xdc, 0x47, 0x28, 0x9a,
+    0x12, 0xaf, 0x75, 0xf6, 0x62, 0x9e, 0xe9, 0x67, 0x42, 0xe3, 0x8b, 0x23,
+    0x1d, 0xb2, 0x45, 0xb8, 0x00, 0x11, 0xd4, 0x41, 0x4d, 0x63, 0xb1, 0x16,
+    0xe3, 0xd4, 0xbd, 0xbb, 0xe2, 0x94, 0x4e, 0x71, 0xc8, 0xad, 0x77, 0x7d,
+    0xd2, 0x78, 0x6b, 0xd9, 0x77, 0xf8, 0xcb, 0xa0, 0x1a, 0xd4, 0x5a, 0xf0,
+    0xc0, 0xb5, 0x3c, 0x67, 0x9b, 0xe2, 0xd2, 0x50, 0xce, 0xed, 0x84, 0x6d,
+    0x24, 0x3f, 0x29, 0x94, 0xd8, 0x92, 0xb4, 0x7e, 0xd8, 0xea, 0x1f, 0xe7,
+    0xb1, 0x54, 0xef, 0x06, 0x88, 0x84, 0x62, 0xc2, 0x3f, 0x4b, 0x15, 0x62,
+    0x43, 0x9e, 0x8c, 0x2e, 0x1f, 0xaa, 0x04, 0x9f, 0x9c, 0x0c, 0xb4, 0x4f,
+    0x1c, 0xcb, 0xc8, 0xf6, 0x74, 0xc9, 0xd5, 0x3d, 0x5c, 0x16, 0xec, 0x7b,
+    0x45, 0xf1, 0xfa, 0x74, 0xd0, 0x2e, 0x51, 0xbb, 0x92, 0x72, 0xe4, 0xe7,
+    0x14, 0x33, 0xec, 0x7a, 0x3f, 0x23, 0xcc, 0xd5, 0x39, 0x63, 0xce, 0x01,
+    0xc2, 0xb0, 0x90, 0x50, 0xc6, 0x63, 0x82, 0x62, 0x46, 0x94, 0xf3, 0xaa,
+    0x21, 0xeb, 0x9b, 0x5b, 0x93, 0x82, 0xf2, 0xb3, 0xe5, 0xb7, 0x91, 0x8c,
+    0xd9, 0x17, 0x0b, 0x08, 0xbf, 0x83, 0x59, 0x8a, 0xf9, 0x0b, 0xd2, 0x62,
+    0x53, 0x46, 0x8f, 0x2d, 0xf4, 0x39, 0x93, 0x22, 0x63, 0xe1, 0x4f, 0xd9,
+    0x50, 0x21, 0xbd, 0xdc, 0xfa, 0x25, 0xd7, 0x21, 0x37, 0x95, 0xdd, 0x44,
+    0x5e, 0x2c, 0x1b, 0x3b, 0x24, 0xa0, 0xc2, 0x00, 0x89, 0x94, 0x74, 0x4a,
+    0x67, 0x00, 0xcc, 0xf8, 0x0a, 0xfb, 0x32, 0x65, 0xe7, 0x00, 0xf0, 0x5c,
+    0x7c, 0xd5, 0x84, 0x90, 0x6b, 0xcd, 0xc9, 0x73, 0x06, 0x39, 0xf1, 0xaa,
+    0x4e, 0x49, 0x3d, 0x97, 0x5a, 0x83, 0x07, 0x38, 0x24, 0xe5, 0xcd, 0x60,
+    0x27, 0x36, 0x1a, 0xac, 0xb7, 0x53, 0xf7, 0x81, 0x4d, 0x36, 0x21, 0xa0,
+    0xc0, 0xf5, 0x9c, 0xb2, 0x1a, 0x67, 0xa0, 0x05, 0xa0, 0xe6, 0xc2, 0x0f,
+    0xe3, 0x12, 0xb0, 0x50, 0x6c, 0x36, 0xc7, 0x5c, 0x07, 0xa0, 0x56, 0x53,
+    0x35, 0x65, 0xd2, 0xdf, 0xcf, 0x7c, 0x0a, 0xde, 0xa3, 0x2c, 0xdd, 0x44,
+    0x7c, 0x16, 0xfc, 0xd5, 0x87, 0x00, 0xd4, 0x13, 0x2e, 0x99, 0x6c, 0x07,
+    0xf5, 0xb3, 0x35, 0xa7, 0xb4, 0xfb, 0xd5, 0xc4, 0xa4, 0x34, 0x3c, 0x0d,
+    0xde, 0xc9, 0xa9, 0xb7, 0xcb, 0xe4, 0x4d, 0x9a, 0x57, 0xff, 0x97, 0xb4,
+    0xc1, 0x76, 0x96, 0xa7, 0x9b, 0x6c, 0xd8, 0xfd, 0x40, 0xcc, 0xb1, 0x34,
+    0xa9, 0x67, 0x8b, 0x11, 0x12, 0xc8, 0xb6, 0x55, 0x9b, 0xc4, 0x6a, 0x72,
+    0xc4, 0xfe, 0xc7, 0xa7, 0x5e, 0xa6, 0x02, 0xb8, 0x3e, 0x17, 0x53, 0xc6,
+    0x6c, 0x6f, 0x0e, 0xf8, 0xf6, 0x77, 0x39, 0x9d, 0x03, 0xe2, 0x8a, 0x38,
+    0xf7, 0xcd, 0xae, 0xf1, 0x96, 0x3a, 0x42, 0xc1, 0x00, 0x46, 0xa5, 0x56,
+    0xb7, 0x1d, 0x4a, 0xf5, 0xc1, 0xe0, 0x56, 0x68, 0x0a, 0x26, 0xaf, 0xa5,
+    0xd6, 0x8b, 0x38, 0xc2, 0x96, 0x2f, 0xfc, 0x1b, 0x13, 0x14, 0x8e, 0xc2,
+    0xdb, 0xe6, 0x8a, 0x92, 0xc8, 0xd6, 0xf9, 0xa8, 0x7b, 0xd9, 0xa1, 0x90,
+    0x3d, 0x16, 0xef, 0x80, 0x85, 0xd5, 0xcc, 0xd8, 0x6a, 0x0b, 0xc1, 0x6f,
+    0x63, 0xa2, 0xb8, 0xe5, 0x89, 0x9e, 0x48, 0x90, 0x3c, 0x6e, 0xdf, 0xf5,
+    0xcb, 0x33, 0xc2, 0x4a, 0x54, 0xa1, 0x51, 0xa2, 0x4e, 0x92, 0x2d, 0x74,
+    0xaf, 0xd2, 0x83, 0xc5, 0x62, 0x97, 0xf9, 0x2c, 0xd8, 0x21, 0xa8, 0x3f,
+    0x2b, 0x02, 0x78, 0xbc, 0xe6, 0xd9, 0xfe, 0xe5, 0x00, 0xda, 0x53, 0x49,
+    0x6c, 0x91, 0xce, 0x46, 0x08, 0x15, 0xe5, 0xb5, 0x46, 0x58, 0x49, 0x2e,
+    0x46, 0x50, 0x1f, 0x70, 0x84, 0x59, 0x4e, 0x37, 0xe3, 0x85, 0x23, 0x4b,
+    0x82, 0xd9, 0x13, 0xf5, 0x60, 0x3b, 0x70, 0xc3, 0xa7, 0x0c, 0xc3, 0xf0,
+    0x58, 0x9c, 0xab, 0xad, 0xe1, 0xc9, 0x0d, 0xc4, 0xe3, 0xe0, 0xb1, 0xa4,
+    0xd3, 0x64, 0x44, 0xba, 0x16, 0x66, 0xba, 0x69, 0xb3, 0x66, 0x13, 0x45,
+    0x86, 0xeb, 0xe8, 0x0e, 0x84, 0x15, 0x6f, 0xc9, 0x1e, 0xdb, 0xb7, 0xab,
+    0x07, 0x86, 0x33, 0x64, 0x6d, 0xcc, 0xad, 0x82, 0xd5, 0xce, 0x9e, 0x4a,
+    0x7e, 0xc6, 0x11, 0xed, 0xb4, 0x72, 0xcb, 0x46, 0xd6, 0x90, 0x28, 0xb5,
+    0x4a, 0x65, 0x4f, 0x03, 0x95, 0x17, 0x47, 0xd6, 0x5e, 0xc7, 0x05, 0xa8,
+    0x01, 0x9c, 0x1d, 0xf8, 0x05, 0x4e, 0xdd, 0xf5, 0xc1, 0xfc, 0xa8, 0x93,
+    0xd0, 0xaf, 0x50, 0x47, 0xca, 0x32, 0x1f, 0x92, 0xd7, 0xca, 0x25, 0x92,
+    0xf4, 0x4b, 0xbe, 0xba, 0xa5, 0x42, 0x24, 0x15, 0x9b, 0x0e, 0x29, 0x74,
+    0x84, 0xdc, 0xc6, 0x7c, 0x69, 0x97, 0xf1, 0x8e, 0x43, 0x35, 0xce, 0x5c,
+    0x47, 0x9c, 0x1c, 0xdd, 0xd3, 0x56, 0xf3, 0x3a, 0x3e, 0x1f, 0xc3, 0x30,
+    0x57, 0xf3, 0x42, 0xa0, 0x24, 0xc0, 0x85, 0x5a, 0xf9, 0x3c, 0xc0, 0xac,
+    0x8c, 0x7a, 0x8b, 0x8b, 0x48, 0x79, 0x00, 0x75, 0x82, 0xb0, 0x9c, 0xc3,
+    0xc3, 0xae, 0x32, 0x72, 0x02, 0xfe, 0x83, 0xe9, 0x0c, 0xd9, 0x79, 0x7e,
+    0x4c, 0x88, 0x44, 0x5d, 0xb9, 0x48, 0x11, 0x72, 0x56, 0xbf, 0x56, 0x40,
+    0xf1, 0x82, 0x4d, 0x94, 0x45, 0xfe, 0x70, 0x47, 0xa5, 0x83, 0xa9, 0x4d,
+    0x20, 0xb6, 0x07, 0xe6, 0x05, 0xa1, 0xfc, 0x4e, 0xb9, 0xff, 0xfe, 0x92,
+    0xc7, 0x1d, 0x9c, 0x66, 0x2e, 0x97, 0x9f, 0x94, 0x1f, 0x2b, 0x49, 0xc8,
+    0xd5, 0xc2, 0xd9, 0x2b, 0xf7, 0xfd, 0x91, 0x28, 0x48, 0x14, 0x0f, 0xbe,
+    0x41, 0x9c, 0xec, 0xf4, 0x22, 0xb0, 0x77, 0x03, 0x82, 0xd4, 0xf7, 0x8e,
+    0x4a, 0x81, 0xec, 0x2e, 0xb7, 0x47, 0x03, 0x87, 0x00, 0x65, 0xe1, 0x43,
+    0x20, 0xcc, 0x90, 0x2b, 0x1e, 0x16, 0x2c, 0xce, 0x70, 0x74, 0xbe, 0xe6,
+    0x8e, 0x5e, 0xb4, 0x17, 0xb9, 0xab, 0x18, 0x4e, 0x51, 0xf3, 0x07, 0x29,
+    0x2f, 0x00, 0xb1, 0xf2, 0xcf, 0x32, 0xec, 0x97, 0xc9, 0x84, 0x39, 0x52,
+    0x3b, 0x05, 0x67, 0x54, 0x80, 0x2f, 0x29, 0x45, 0x9c, 0x66, 0x61, 0x83,
+    0x16, 0x87, 0x10, 0xa1, 0x59, 0x3d, 0x11, 0xb7, 0x9f, 0x0c, 0x78, 0x68,
+    0x27, 0xfb, 0x9b, 0xe3, 0x84, 0x36, 0x97, 0x15, 0x4e, 0x3b, 0x20, 0x4a,
+    0x33, 0xf4, 0xee, 0x73, 0x0e, 0x9b, 0xb5, 0xb6, 0x6c, 0x05, 0x81, 0xce,
+    0xfd, 0x78, 0x56, 0xc4, 0x91, 0xf5, 0x43, 0x54, 0x5f, 0x67, 0x48, 0x8a,
+    0xd0, 0xab, 0x23, 0x8e, 0x37, 0xae, 0x55, 0xd0, 0xab, 0x98, 0x37, 0x3e,
+    0xcb, 0xaf, 0xf0, 0xb5, 0x09, 0xb2, 0xce, 0x7c, 0xed, 0xa7, 0x85, 0x88,
+    0xb6, 0x74, 0xbe, 0x6f, 0x6d, 0x2f, 0x7a, 0x1d, 0x48, 0x61, 0xac, 0xec,
+    0x34, 0x2f, 0x9f, 0xef, 0xfe, 0xd8, 0xdc, 0x70, 0x53, 0xfe, 0xf3, 0x8f,
+    0x83, 0x74, 0x9d, 0x04, 0xf7, 0x91, 0xb5, 0x8e, 0x29, 0x9b, 0x1a, 0xb4,
+    0xad, 0x0a, 0xd2, 0x21, 0x8f, 0x59, 0x6a, 0x90, 0x2c, 0xf3, 0x0c, 0xad,
+    0xc6, 0xd8, 0xe8, 0xdc, 0x89, 0x67, 0x77, 0xf4, 0x48, 0xd8, 0x8c, 0x95,
+    0x70, 0xa1, 0x4f, 0x4c, 0x89, 0x1b, 0x1c, 0x1d, 0x75, 0x21, 0xa4, 0x1c,
+    0x4c, 0x52, 0x5f, 0x80, 0x25, 0x66, 0x0f, 0x2c, 0x49, 0x29, 0xab, 0x0a,
+    0x98, 0xa1, 0x7a, 0x4d, 0x98, 0x1b, 0xcb, 0xa8, 0xf0, 0xd1, 0x8a, 0x55,
+    0x4d, 0xca, 0x3a, 0x8e, 0x9a, 0xfc, 0x41, 0x45, 0x85, 0x77, 0xa9, 0x02,
+    0x43, 0x13, 0x53, 0x06, 0xf0, 0xa1, 0x41, 0x94, 0xb3, 0x9b, 0x59, 0x69,
+    0x02, 0x1d, 0x59, 0x6a, 0xc0, 0x5a, 0x43, 0x85, 0x6c, 0x24, 0x61, 0xfb,
+    0x01, 0x25, 0x7c, 0x04, 0x43, 0x16, 0x15, 0xe7, 0x33, 0xf7, 0x8d, 0x60,
+    0x6b, 0x88, 0xd1, 0x10, 0xfc, 0xb9, 0x6c, 0xe8, 0x75, 0x15, 0x33, 0xba,
+    0x54, 0xa2, 0xfc, 0xd9, 0x6d, 0xd4, 0xbc, 0xad, 0x69, 0xea, 0xec, 0x3b,
+    0x18, 0xe3, 0xe3, 0xde, 0xde, 0x9f, 0x0e, 0xb7, 0x63, 0x89, 0x57, 0x82,
+    0x09, 0x34, 0x88, 0xad, 0x98, 0x74, 0x63, 0x9d, 0x8f, 0x8f, 0x6a, 0x90,
+    0xac, 0x8c, 0x46, 0xfe, 0xc4, 0x30, 0xed, 0x06, 0x37, 0xad, 0x38, 0x6b,
+    0x0a, 0x38, 0x6c, 0x34, 0x60, 0x7f, 0x52, 0x06, 0x57, 0x9c, 0x32, 0x31,
+    0x50, 0x72, 0x61, 0x6d, 0x1a, 0x4b, 0x30, 0xa6, 0xe8, 0x35, 0x98, 0xf6,
+    0xc3, 0xc7, 0xcd, 0x5c, 0x1d, 0x58, 0x08, 0xa8, 0x07, 0xe9, 0x7b, 0xfc,
+    0x06, 0xbe, 0x71, 0x88, 0x63, 0xf1, 0x6a, 0x5f, 0xee, 0x3f, 0xb3, 0x72,
+    0xa0, 0xf1, 0x0a, 0x6b, 0x51, 0x04, 0xbb, 0xd0, 0xd6, 0xca, 0x26, 0xf7,
+    0x1f, 0xe8, 0x88, 0x76, 0xd8, 0xbf, 0xce, 0x1c, 0x25, 0x3e, 0x6d, 0x65,
+    0xb9, 0xa7, 0xb6, 0x50, 0x6c, 0xbe, 0x9f, 0xdb, 0x81, 0x68, 0x0d, 0x17,
+    0x20, 0x0b, 0xfb, 0xda, 0xd9, 0x05, 0xe4, 0x6a, 0x4f, 0xfb, 0x7c, 0x7a,
+    0x83, 0x19, 0xc0, 0x3b, 0x01, 0xcf, 0xe4, 0xeb, 0x73, 0xac, 0xa1, 0x42,
+    0x49, 0x19, 0x22, 0x53, 0x68, 0xab, 0xbf, 0x8a, 0xf0, 0xe0, 0xb2, 0xf5,
+    0xac, 0x2b, 0x3b, 0x2e, 0xa8, 0xa6, 0xf7, 0xa0, 0x8d, 0xa0, 0x4c, 0x5b,
+    0xbf, 0x27, 0xc5, 0xfc, 0x52, 0xbc, 0x57, 0xe0, 0x90, 0x3c, 0xe4, 0x11,
+    0x41, 0x60, 0x00, 0xa7, 0xa7, 0xce, 0x83, 0x47, 0x65, 0xcc, 0x6f, 0x90,
+    0xea, 0x51, 0xcf, 0xb8, 0x62, 0xa8, 0x9b, 0x63, 0x63, 0x21, 0x75, 0x5b,
+    0x6f, 0x51, 0x07, 0xf0, 0x24, 0xdc, 0x64, 0xca, 0x2e, 0x28, 0x20, 0x18,
+    0xf6, 0xef, 0x7d, 0x69, 0x50, 0x79, 0x43, 0x24, 0x6d, 0x2c, 0xd3, 0xdb,
+    0xf5, 0x43, 0x59, 0x22, 0xb8, 0x84, 0x83, 0x4d, 0x65, 0x3c, 0x0d, 0xce,
+    0x97, 0x87, 0x74, 0x66, 0x6b, 0xea, 0x1b, 0x3e, 0xf0, 0xcb, 0x52, 0xf7,
+    0xaa, 0xf4, 0x46, 0x18, 0xa3, 0x56, 0xb9, 0x13, 0xf0, 0x12, 0x54, 0xd0,
+    0xce, 0x56, 0xb9, 0xa3, 0x37, 0x5e, 0x21, 0x8e, 0xe6, 0x45, 0x9f, 0x0d,
+    0x0f, 0xff, 0x0a, 0xae, 0x1c, 0xd8, 0xf3, 0xbd, 0xa1, 0x3e, 0x1a, 0x46,
+    0xa5, 0x40, 0x5d, 0x04, 0xfc, 0xfc, 0x0b, 0xf4, 0x3f, 0x73, 0x38, 0xef,
+    0xc1, 0x39, 0xcf, 0xe4, 0x91, 0x47, 0x38, 0x9d, 0x62, 0x44, 0x19, 0xfe,
+    0x91, 0x5c, 0xa5, 0xfc, 0x47, 0xf1, 0x7a, 0x93, 0x41, 0xbd, 0x5f, 0xcd,
+    0x31, 0x41, 0xe6, 0x79, 0x4c, 0xb0, 0x03, 0x8c, 0xf5, 0xa6, 0x18, 0x6b,
+    0xed, 0x4c, 0x37, 0xad, 0x77, 0xba, 0x8a, 0x48, 0xe7, 0xc1, 0xef, 0x34,
+    0x0e, 0xd6, 0xf5, 0x20, 0x28, 0x7a, 0x21, 0xab, 0x21, 0xce, 0x03, 0xd8,
+    0x1a, 0x54, 0xf3, 0xde, 0xb6, 0x1a, 0x87, 0x1d, 0x98, 0xc8, 0x9e, 0xd8,
+    0xbc, 0xbf, 0xb1, 0x15, 0x60, 0x36, 0xaf, 0x35, 0x2f, 0x7e, 0xe9, 0xe4,
+    0x99, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff};
+
+inline constexpr size_t kDynamicFastChunks[] = {8000};
+inline constexpr size_t kDynamicFastCompressed[] = {2114};
+inline constexpr uint8_t kDynamicFastData[] = {
+    0xb5, 0x59, 0x3b, 0x88, 0x9d, 0x45, 0x14, 0xc6, 0x57, 0x33, 0x95, 0x95,
+    0x60, 0xa3, 0x17, 0x51, 0x10, 0x2c, 0x32, 0xef, 0x07, 0x88, 0x8d, 0x01,
+    0xb1, 0xb1, 0xb1, 0x11, 0x24, 0xc5, 0x06, 0xb3, 0x18, 0x5f, 0x2b, 0x9b,
+    0x78, 0x05, 0x2b, 0x21, 0x68, 0x23, 0x88, 0x12, 0xb0, 0xb1, 0x15, 0x8c,
+    0x75, 0xec, 0xa2, 0x18, 0x14, 0xac, 0x05, 0x51, 0x7c, 0x55, 0x2a, 0x82,
+    0x41, 0x08, 0x62, 0x63, 0x13, 0xf1, 0xfb, 0xcf, 0x77, 0xfe, 0xfb, 0xd8,
+    0xb9, 0x77, 0x77, 0x6f, 0x76, 0xd3, 0xfc, 0xf7, 0xbf, 0xf3, 0xcf, 0x9c,
+    0xf9, 0xce, 0xfb, 0xcc, 0x99, 0xe8, 0x7d, 0x34, 0xb1, 0xd6, 0x94, 0x4d,
+    0xf2, 0xde, 0x36, 0x93, 0x62, 0xf0, 0xde, 0xe4, 0x1c, 0xbc, 0x35, 0xdb,
+    0xd3, 0xb3, 0xe7, 0xce, 0xee, 0xbc, 0x32, 0x39, 0xbf, 0xfb, 0xda, 0x99,
+    0xc9, 0x74, 0xeb, 0x25, 0x3c, 0x53, 0x6e, 0xa9, 0x98, 0xe6, 0x72, 0xf3,
+    0xe6, 0xe0, 0xa5, 0x27, 0x9e, 0x7e, 0x79, 0x6b, 0xf7, 0xfc, 0xc9, 0xad,
+    0x73, 0xcf, 0x9f, 0xde, 0xd9, 0xda, 0x7d, 0xee, 0xc4, 0x24, 0x36, 0xb3,
+    0x33, 0x0c, 0x92, 0x98, 0x92, 0xcf, 0x35, 0xd9, 0x68, 0x76, 0x77, 0x4e,
+    0xef, 0x9c, 0xe7, 0x56, 0x7c, 0xe5, 0x93, 0x33, 0x67, 0xd0, 0x3a, 0x8a,
+    0xaf, 0xee, 0x9c, 0x3b, 0x33, 0xf1, 0xb1, 0xb5, 0x6c, 0x84, 0xc0, 0xde,
+    0xf9, 0xfc, 0x3f, 0xf0, 0xd1, 0x2d, 0xdd, 0x0f, 0xcc, 0xf6, 0xd6, 0x4b,
+    0xa0, 0x9b, 0xa3, 0xb3, 0x59, 0x91, 0x71, 0x64, 0x51, 0x22, 0x1d, 0xc1,
+    0x54, 0x2a, 0xa4, 0x26, 0x72, 0x9a, 0x9e, 0x8d, 0x15, 0x52, 0x32, 0x3a,
+    0x3f, 0x86, 0x66, 0xbd, 0x21, 0x89, 0x90, 0x21, 0x60, 0x1d, 0xff, 0x4e,
+    0x44, 0x7b, 0xfc, 0x42, 0x52, 0xf2, 0x14, 0x61, 0x87, 0xb3, 0xfa, 0xec,
+    0xdd, 0xa2, 0xc0, 0x2f, 0x52, 0x8a, 0xaa, 0xfe, 0x6e, 0xfe, 0x5c, 0xc6,
+    0xdd, 0xa7, 0x66, 0x63, 0x72, 0xe6, 0xb9, 0xdd, 0xb3, 0xd3, 0x33, 0x93,
+    0x35, 0xbb, 0xf1, 0x63, 0xb7, 0x72, 0x09, 0x22, 0x6c, 0x0d, 0xca, 0x3f,
+    0xa2, 0x88, 0x05, 0x26, 0x77, 0x93, 0x57, 0x05, 0x74, 0x13, 0xb4, 0x45,
+    0x2b, 0x42, 0x43, 0x51, 0xca, 0xbb, 0xab, 0x01, 0x76, 0x2a, 0xaf, 0x32,
+    0x81, 0x70, 0x9f, 0xdd, 0xd4, 0x37, 0x3a, 0x49, 0x1c, 0xd2, 0x0e, 0x63,
+    0xb4, 0xa1, 0xa9, 0x0d, 0x51, 0xd4, 0x04, 0x90, 0x62, 0x6e, 0xd5, 0xbc,
+    0xf1, 0xe1, 0x1a, 0x27, 0x13, 0xbc, 0x19, 0x6b, 0xbd, 0xb9, 0xd5, 0x9e,
+    0x22, 0x5b, 0xc9, 0xc3, 0x57, 0x1f, 0x8a, 0x62, 0x4d, 0x36, 0xc1, 0x89,
+    0x54, 0x90, 0x22, 0xc2, 0xdb, 0xe9, 0x58, 0xfb, 0x4d, 0xa7, 0x1a, 0x45,
+    0xcc, 0xe4, 0x55, 0x26, 0x73, 0x34, 0x54, 0x17, 0x47, 0xf3, 0x0d, 0xd6,
+    0x43, 0x27, 0x25, 0x59, 0x88, 0xe0, 0xc2, 0x9c, 0x60, 0x88, 0xcd, 0x56,
+    0xe3, 0x62, 0x0e, 0xd5, 0x08, 0x11, 0x17, 0x4a, 0x4b, 0x23, 0x88, 0x1f,
+    0x64, 0xe8, 0x93, 0xe4, 0x5c, 0x6a, 0x66, 0x4a, 0x7f, 0x95, 0x27, 0xc3,
+    0xdd, 0x2d, 0xc4, 0x78, 0x99, 0x2a, 0x8b, 0xd9, 0xc5, 0x68, 0xde, 0x14,
+    0x18, 0xdc, 0x9f, 0x12, 0x39, 0xac, 0x8a, 0x6b, 0x8b, 0x21, 0x0f, 0xea,
+    0xdc, 0xab, 0x57, 0xca, 0x4a, 0x62, 0xed, 0xda, 0x39, 0xdc, 0xb0, 0xb3,
+    0x42, 0x0e, 0xbf, 0xd2, 0x7b, 0x71, 0xf6, 0xb5, 0x35, 0xf3, 0x7d, 0xf3,
+    0x35, 0x41, 0xd2, 0x39, 0x43, 0xb0, 0xdd, 0x62, 0xb2, 0xd5, 0x82, 0x4b,
+    0xd5, 0x2c, 0xe5, 0x90, 0xf9, 0xcc, 0x6c, 0x63, 0xf6, 0xa6, 0xd4, 0x14,
+    0x82, 0x81, 0x5e, 0xb2, 0xf9, 0x76, 0x21, 0x15, 0xc4, 0x9c, 0xb3, 0x33,
+    0xb1, 0xd4, 0xd2, 0x4c, 0x0c, 0xc1, 0x37, 0x0d, 0x29, 0x8f, 0xa7, 0x9a,
+    0x1c, 0xe6, 0xc7, 0xe6, 0xbc, 0x19, 0x12, 0xc8, 0x06, 0x1b, 0x9d, 0xa2,
+    0x30, 0xf8, 0x4c, 0xa1, 0xc6, 0xa0, 0x44, 0x7f, 0x24, 0x91, 0x77, 0xc8,
+    0xf1, 0x03, 0xfc, 0x37, 0x07, 0xaa, 0xa9, 0x8a, 0xc3, 0x3e, 0xd5, 0x1c,
+    0xd5, 0x46, 0xc4, 0xbc, 0xb8, 0xe8, 0x8a, 0x9a, 0xf3, 0xb5, 0xc5, 0x44,
+    0xd9, 0x91, 0xd8, 0xcf, 0xb1, 0x37, 0xc9, 0x76, 0x2d, 0xb6, 0x52, 0x47,
+    0xe3, 0x5d, 0x93, 0x3d, 0x09, 0x57, 0x12, 0x56, 0x6f, 0x45, 0xc5, 0x21,
+    0xff, 0xf4, 0x5a, 0x0b, 0x29, 0x95, 0xa0, 0x79, 0x80, 0xae, 0x55, 0x43,
+    0xb4, 0xc9, 0xec, 0xcd, 0xda, 0x47, 0xcd, 0x17, 0x52, 0x3e, 0xd0, 0xb7,
+    0x08, 0xf3, 0x19, 0x84, 0xd2, 0x68, 0xcd, 0xe4, 0xb8, 0xbc, 0x57, 0x34,
+    0x53, 0x10, 0x74, 0x8a, 0x71, 0x16, 0x26, 0xa3, 0x0a, 0xeb, 0x14, 0x42,
+    0x26, 0xef, 0xe8, 0xc6, 0x55, 0x9b, 0x43, 0xca, 0x3f, 0xc8, 0x86, 0x93,
+    0x2b, 0x49, 0xed, 0xa8, 0x79, 0x97, 0x83, 0xf1, 0x25, 0xf9, 0x6a, 0x42,
+    0xc8, 0xc8, 0xf6, 0x97, 0x68, 0x6c, 0xd1, 0x7a, 0x18, 0x39, 0x37, 0xbb,
+    0xa8, 0x82, 0x6d, 0x01, 0x41, 0xb0, 0x36, 0xc4, 0x2e, 0x83, 0x8a, 0x2a,
+    0x13, 0x31, 0xca, 0x16, 0x6b, 0x16, 0xdc, 0x60, 0xa2, 0x40, 0x6e, 0xa2,
+    0x22, 0x2a, 0x36, 0x46, 0xb8, 0x88, 0x98, 0x55, 0xcf, 0xdf, 0x42, 0x8c,
+    0xdb, 0xd8, 0xc3, 0x05, 0x6a, 0x4f, 0x92, 0xfa, 0xa4, 0x3b, 0x68, 0x01,
+    0xb3, 0x6e, 0x92, 0xc4, 0xb9, 0x62, 0x7d, 0xb5, 0xe6, 0x73, 0xd6, 0x81,
+    0x34, 0x03, 0x9f, 0x2e, 0x2b, 0xc3, 0x14, 0x52, 0xb7, 0x5e, 0x16, 0xca,
+    0xfe, 0xf2, 0x76, 0x2b, 0x6a, 0x49, 0x32, 0x70, 0x4c, 0x29, 0x84, 0x6c,
+    0xa0, 0x22, 0x2a, 0x9e, 0x69, 0xe7, 0x17, 0xb8, 0x13, 0x0a, 0x6c, 0xd8,
+    0xd5, 0xc6, 0x19, 0x09, 0x6c, 0xaf, 0xd1, 0x26, 0x87, 0x09, 0xbc, 0x13,
+    0x59, 0x37, 0x40, 0x4c, 0x14, 0x78, 0x0c, 0x05, 0x09, 0x51, 0x04, 0x3a,
+    0x97, 0x2a, 0xb3, 0x10, 0xd5, 0x29, 0xef, 0x43, 0x2d, 0x77, 0x98, 0xc0,
+    0x4b, 0x9a, 0xa4, 0x3f, 0x4b, 0xb4, 0x84, 0xf5, 0x31, 0x31, 0xd6, 0x5a,
+    0x42, 0x32, 0xff, 0x96, 0x80, 0xdc, 0xb1, 0x94, 0x68, 0x5d, 0xb5, 0xd6,
+    0xf8, 0x1a, 0x73, 0x31, 0x5b, 0xb7, 0x38, 0xa8, 0xff, 0x73, 0x15, 0x49,
+    0x25, 0xcd, 0x2a, 0xee, 0x18, 0x90, 0x4f, 0xde, 0xbf, 0x9d, 0xa8, 0x6b,
+    0xcb, 0xb9, 0xaa, 0xa3, 0xae, 0xa9, 0x2a, 0x0e, 0xce, 0xd8, 0x6a, 0xc2,
+    0xca, 0x71, 0x88, 0x69, 0x0c, 0xa9, 0xbe, 0xc1, 0xd9, 0x45, 0xce, 0xdc,
+    0x6d, 0xcd, 0x0e, 0x5a, 0xb7, 0xfc, 0xf6, 0x88, 0xf7, 0x3e, 0xcf, 0xc4,
+    0x44, 0x7d, 0x70, 0xa1, 0x2a, 0xbc, 0x1f, 0xea, 0x94, 0x3d, 0x0c, 0x50,
+    0x03, 0xb2, 0xef, 0xde, 0xf2, 0x60, 0x38, 0x61, 0xf1, 0xf3, 0xfc, 0x40,
+    0xc5, 0xff, 0x03, 0xed, 0x91, 0xda, 0x75, 0xe5, 0x08, 0x67, 0x3e, 0x6e,
+    0x29, 0xb4, 0x56, 0x54, 0xbf, 0xbb, 0x8b, 0xa6, 0xb3, 0x2d, 0x27, 0xa6,
+    0xa3, 0x46, 0xf6, 0xd3, 0x37, 0x5b, 0x6d, 0x08, 0x14, 0x8a, 0x8b, 0x4f,
+    0xf2, 0xc5, 0x27, 0x19, 0x88, 0x31, 0x56, 0xe3, 0x13, 0x0a, 0x19, 0x3a,
+    0xe7, 0x8d, 0x18, 0x86, 0xd0, 0xcd, 0x29, 0xad, 0xc6, 0xa4, 0x05, 0x6b,
+    0x0d, 0x15, 0x05, 0xc8, 0x81, 0xc1, 0xe6, 0x09, 0xaa, 0xa5, 0x64, 0x87,
+    0xa3, 0xdd, 0x28, 0xbb, 0x59, 0x11, 0xee, 0x5b, 0x2c, 0x59, 0x4d, 0x8b,
+    0x3b, 0xfc, 0xb7, 0x2d, 0x12, 0xfa, 0xeb, 0xf2, 0x63, 0x5c, 0xe8, 0x73,
+    0xcb, 0x8d, 0x48, 0x60, 0x19, 0x28, 0x7c, 0x88, 0xbb, 0xa3, 0x34, 0x28,
+    0x8d, 0x4b, 0x55, 0x1d, 0xc2, 0xea, 0x7c, 0x5a, 0xa9, 0xd6, 0x59, 0x8d,
+    0xfc, 0xdc, 0x89, 0x5a, 0x3b, 0xd6, 0x32, 0x96, 0xd8, 0xfe, 0xe1, 0x0f,
+    0x8e, 0xb6, 0x2d, 0x8c, 0xf5, 0x08, 0x2a, 0x2b, 0x14, 0x7d, 0x04, 0x78,
+    0x7f, 0x49, 0x01, 0x87, 0xc8, 0x25, 0x7b, 0x15, 0xd9, 0x07, 0x3f, 0xc3,
+    0x4b, 0x12, 0x9c, 0x42, 0x23, 0xcd, 0xcd, 0x15, 0x83, 0x2a, 0x7e, 0xdd,
+    0xb1, 0x40, 0xf8, 0xf5, 0x2e, 0xa0, 0x80, 0xe3, 0x36, 0x7c, 0x7e, 0xd6,
+    0x8a, 0x45, 0xce, 0x2d, 0x35, 0xa0, 0xf6, 0x5f, 0x8e, 0xb0, 0x7f, 0x94,
+    0xe2, 0x31, 0x7b, 0xf4, 0x4c, 0xd4, 0x8d, 0x14, 0xcc, 0x86, 0xb9, 0xcf,
+    0x71, 0x15, 0x9f, 0xbe, 0x44, 0x04, 0x31, 0xa2, 0x27, 0x80, 0xe4, 0x9d,
+    0xab, 0xa6, 0x40, 0x8f, 0x89, 0x6a, 0xac, 0x70, 0xf8, 0xf1, 0x60, 0x42,
+    0x06, 0x3f, 0x7d, 0x57, 0xc0, 0x3b, 0x9f, 0x8b, 0x33, 0x3f, 0xa1, 0xe6,
+    0x41, 0xf8, 0x4d, 0x01, 0x5e, 0xde, 0xdc, 0xd0, 0x10, 0x58, 0xa4, 0xc6,
+    0x05, 0xa7, 0x14, 0x73, 0x8b, 0x0e, 0x75, 0xe7, 0xef, 0xdc, 0xba, 0x35,
+    0x84, 0x06, 0xb5, 0x53, 0x6e, 0x4d, 0xa1, 0x36, 0x0f, 0x72, 0xbe, 0x95,
+    0x34, 0x3b, 0xd9, 0xa8, 0x7e, 0x12, 0xea, 0xc0, 0xa5, 0xba, 0x6e, 0x26,
+    0xfd, 0xb1, 0x11, 0x63, 0xf3, 0xaa, 0x2a, 0x51, 0xc8, 0x12, 0x48, 0x71,
+    0x2d, 0x59, 0x83, 0xc0, 0x89, 0x0a, 0x65, 0x4c, 0x08, 0x1d, 0x15, 0x61,
+    0x4e, 0x11, 0x1f, 0xdc, 0xc1, 0xd1, 0x89, 0xe4, 0x89, 0xbb, 0x90, 0x1b,
+    0xa2, 0x46, 0x48, 0x2a, 0x45, 0xb9, 0x2c, 0xa5, 0xc1, 0x8e, 0x04, 0x0e,
+    0xa7, 0xe8, 0xda, 0x31, 0xba, 0xe9, 0x5f, 0xad, 0x93, 0x38, 0x65, 0x4d,
+    0xed, 0xcb, 0x8f, 0x7a, 0x48, 0xd6, 0x75, 0x0b, 0x1d, 0xa9, 0xa9, 0x94,
+    0x46, 0x87, 0x36, 0x0c, 0x52, 0xfb, 0xb2, 0x93, 0x44, 0x29, 0x6e, 0xd5,
+    0xb9, 0xe8, 0xe1, 0x17, 0x45, 0x44, 0xd9, 0x79, 0x1c, 0x78, 0xc8, 0xe6,
+    0x64, 0x55, 0x8d, 0x8d, 0x06, 0x9c, 0x2d, 0x3a, 0xe1, 0xad, 0x2b, 0xfb,
+    0x9e, 0x5c, 0xfb, 0x08, 0x79, 0x92, 0xb2, 0x24, 0xf9, 0x27, 0xef, 0x25,
+    0x44, 0x8f, 0x73, 0x93, 0x47, 0x4f, 0xcf, 0x21, 0xac, 0x45, 0x07, 0xc3,
+    0x1b, 0xce, 0x55, 0x68, 0xdd, 0x75, 0xc8, 0x69, 0x4a, 0xc9, 0xa1, 0x8d,
+    0x53, 0xda, 0x4a, 0x26, 0x48, 0x18, 0xf4, 0x6a, 0x33, 0xd7, 0x3e, 0xf2,
+    0x35, 0x23, 0x3a, 0xfa, 0x32, 0x10, 0xf6, 0x58, 0x65, 0x15, 0xb6, 0xd0,
+    0x89, 0x30, 0x74, 0xec, 0x87, 0x46, 0x05, 0x6c, 0x27, 0x04, 0x38, 0x06,
+    0xb1, 0x65, 0xd4, 0x44, 0xcd, 0xbc, 0xb0, 0xbf, 0x3d, 0x13, 0x78, 0x07,
+    0x90, 0xc3, 0x22, 0x47, 0xd9, 0xa3, 0xc0, 0x4a, 0x40, 0x0e, 0xe7, 0x94,
+    0xd2, 0x86, 0x8e, 0xa5, 0x7c, 0xe1, 0x24, 0x74, 0x02, 0xb5, 0x87, 0xe9,
+    0x1a, 0x6a, 0x6d, 0xb4, 0x31, 0x11, 0x07, 0x38, 0x41, 0x35, 0x9f, 0x0a,
+    0x20, 0x9a, 0xcd, 0xda, 0x25, 0x08, 0x6a, 0xf0, 0x7c, 0x54, 0xed, 0xdc,
+    0x64, 0x4d, 0x8a, 0xdb, 0xb0, 0xdd, 0xd1, 0xb1, 0xd9, 0x0d, 0x70, 0x37,
+    0x0a, 0xbf, 0xfb, 0x48, 0xb1, 0xf2, 0x89, 0xa2, 0x0e, 0x3c, 0x29, 0x83,
+    0xfa, 0x23, 0x92, 0xd2, 0x77, 0x88, 0xc4, 0xcf, 0x22, 0x44, 0x47, 0x69,
+    0x68, 0xca, 0x22, 0x30, 0x65, 0xe8, 0x2b, 0xaf, 0xb2, 0x8f, 0x5c, 0x2c,
+    0x6a, 0xb8, 0xa9, 0xb8, 0xc9, 0x9f, 0xfc, 0xb9, 0x8b, 0xd0, 0x10, 0xb7,
+    0x11, 0xf9, 0x39, 0xd4, 0x91, 0x15, 0x00, 0x29, 0xf9, 0x9c, 0xcd, 0x15,
+    0xc2, 0x94, 0x91, 0x9f, 0x97, 0xd3, 0xaa, 0x8c, 0xcd, 0xbb, 0xb7, 0x9c,
+    0x38, 0xc2, 0x0e, 0x05, 0x78, 0x6a, 0x45, 0x95, 0xa8, 0x9b, 0xac, 0x91,
+    0x45, 0x2c, 0x2d, 0xaf, 0x38, 0xdd, 0x66, 0x74, 0x19, 0xb4, 0x0c, 0x97,
+    0x6d, 0xd6, 0xac, 0xbe, 0x81, 0x7e, 0x37, 0x12, 0x88, 0x58, 0xd1, 0xdc,
+    0xc8, 0x3a, 0x7e, 0xc8, 0x32, 0xfa, 0xb8, 0xc1, 0xf5, 0x3e, 0x84, 0x2a,
+    0xbf, 0x66, 0x38, 0xd8, 0xd0, 0x11, 0x27, 0x0f, 0x57, 0x75, 0xbe, 0xab,
+    0x70, 0x90, 0x1a, 0x0b, 0x1a, 0x4d, 0x1f, 0x28, 0x5f, 0xfc, 0x82, 0xc3,
+    0x63, 0x73, 0x26, 0xa0, 0x0c, 0x5e, 0xea, 0x8f, 0x2b, 0x2b, 0x39, 0xc1,
+    0x65, 0x47, 0x95, 0x1e, 0xd4, 0x38, 0x27, 0xc1, 0xb5, 0xbd, 0xea, 0xa1,
+    0x6d, 0x2f, 0x02, 0x40, 0xcf, 0x09, 0x29, 0x2c, 0xf8, 0x40, 0x66, 0x65,
+    0x6c, 0x2a, 0x7a, 0xc5, 0x17, 0x94, 0x22, 0x14, 0x50, 0x6b, 0x05, 0xc9,
+    0x26, 0x45, 0x87, 0x56, 0x36, 0xe4, 0x5a, 0xc6, 0xee, 0x47, 0x27, 0x91,
+    0xe3, 0x39, 0xb7, 0xee, 0xdf, 0xdb, 0x18, 0x6f, 0x24, 0xba, 0xcd, 0xe7,
+    0x86, 0x23, 0x9f, 0xde, 0xa6, 0xd4, 0x3d, 0xee, 0x30, 0xb4, 0x43, 0x5b,
+    0x02, 0xce, 0x18, 0x63, 0x25, 0x22, 0x4c, 0xe2, 0x54, 0x06, 0x5d, 0xdc,
+    0x6d, 0x79, 0xf6, 0x26, 0x01, 0xb6, 0x29, 0x45, 0xed, 0x87, 0x2f, 0x30,
+    0x6e, 0xa3, 0xa0, 0x8a, 0x1b, 0x1a, 0xf9, 0xb7, 0x7d, 0x05, 0x0d, 0x23,
+    0xd4, 0x34, 0x6b, 0x91, 0x73, 0x2f, 0xfc, 0xad, 0x4a, 0xde, 0xec, 0x4a,
+    0xe2, 0xfa, 0x34, 0x57, 0x8b, 0xe2, 0xb4, 0x63, 0x53, 0x90, 0x71, 0xbb,
+    0x34, 0x94, 0x3b, 0xd4, 0x5c, 0x12, 0x75, 0xe1, 0x3f, 0xa2, 0x9f, 0x2a,
+    0x4d, 0xe2, 0xf7, 0xdc, 0x86, 0xf7, 0x34, 0x3e, 0x85, 0x59, 0x9a, 0xc9,
+    0x88, 0xdd, 0x82, 0x18, 0x47, 0x3c, 0x4e, 0x2c, 0xa1, 0xdf, 0xba, 0xc3,
+    0xa2, 0x9c, 0xc5, 0x8c, 0x53, 0x9d, 0x2e, 0xa5, 0xf5, 0xc8, 0x87, 0xa3,
+    0x55, 0xc3, 0x24, 0xd4, 0x6d, 0xd9, 0xc2, 0xe0, 0xd9, 0x84, 0xfc, 0x4e,
+    0x46, 0x55, 0x83, 0xc8, 0xbf, 0xf2, 0xae, 0xaa, 0x5b, 0xa9, 0x60, 0x49,
+    0x57, 0x2e, 0xb5, 0xba, 0x29, 0x7b, 0x4c, 0x68, 0xd1, 0x0d, 0xf7, 0xbf,
+    0xd5, 0xe8, 0x28, 0x75, 0x03, 0x42, 0xfa, 0xa1, 0x95, 0xc7, 0x23, 0xca,
+    0x9c, 0xe6, 0xda, 0x90, 0xf5, 0x97, 0x1b, 0xd0, 0x7b, 0xec, 0x47, 0x14,
+    0x7a, 0x9f, 0x50, 0x43, 0x87, 0x14, 0x15, 0xad, 0xbc, 0x92, 0x29, 0x16,
+    0xf9, 0x0b, 0xf9, 0x6c, 0x7e, 0xcb, 0xa6, 0x61, 0x54, 0xac, 0xbe, 0xc3,
+    0xd6, 0x0d, 0x50, 0xbc, 0xc4, 0x85, 0x06, 0xc1, 0xaf, 0xb2, 0xc7, 0x6f,
+    0x2a, 0x40, 0x6d, 0xfb, 0xae, 0x2a, 0x17, 0xb9, 0x62, 0xf9, 0xf6, 0x81,
+    0xd0, 0xf8, 0x8c, 0x75, 0x48, 0x1c, 0x4f, 0x6c, 0xe2, 0x21, 0x24, 0x89,
+    0xf8, 0x83, 0x4e, 0x71, 0x45, 0xcd, 0x8b, 0x26, 0x9a, 0xe2, 0x68, 0x43,
+    0x3d, 0x8f, 0x44, 0x87, 0x48, 0xad, 0x23, 0x77, 0x3a, 0xf4, 0xf8, 0xc7,
+    0x2a, 0x97, 0x0b, 0x79, 0x01, 0xd8, 0x09, 0x66, 0xac, 0x79, 0x97, 0xdb,
+    0xb1, 0xc2, 0xe6, 0xf2, 0x01, 0x79, 0x39, 0xd1, 0x93, 0x0b, 0x51, 0x01,
+    0x5f, 0xbf, 0xd6, 0x9d, 0xcf, 0x4c, 0x86, 0x2d, 0x46, 0x39, 0xae, 0xf2,
+    0xdd, 0xa7, 0x16, 0xf4, 0x84, 0xec, 0x82, 0xf6, 0xb9, 0x2e, 0xe5, 0x38,
+    0x11, 0x92, 0xa8, 0x8c, 0xac, 0xba, 0x7e, 0x1d, 0xe9, 0xcf, 0x4e, 0x94,
+    0x4a, 0x82, 0xcb, 0xd4, 0xa4, 0x5b, 0x43, 0x0b, 0xd7, 0xe0, 0x52, 0x16,
+    0x92, 0xd8, 0xe7, 0x96, 0x05, 0x67, 0x54, 0x24, 0x9b, 0xc5, 0xcd, 0x63,
+    0x42, 0x5e, 0xd7, 0xb4, 0x2a, 0x2c, 0x5e, 0x5a, 0x80, 0x33, 0x8f, 0x23,
+    0xb4, 0xa4, 0x0e, 0x8a, 0x4c, 0x98, 0xdd, 0x5a, 0xca, 0xbf, 0xea, 0x12,
+    0x8a, 0x01, 0xce, 0x97, 0x81, 0x9c, 0x86, 0x22, 0x70, 0xb1, 0x8f, 0xf4,
+    0x7a, 0x4b, 0xe8, 0x07, 0xad, 0xb9, 0x1f, 0x15, 0x70, 0x30, 0x45, 0xf9,
+    0xdd, 0x96, 0x93, 0xf2, 0x83, 0xfc, 0xb9, 0xf8, 0x5e, 0x2e, 0xb8, 0xf1,
+    0x31, 0xdf, 0x90, 0xf8, 0x3d, 0x1c, 0x45, 0x3f, 0x1f, 0xe6, 0xc1, 0x77,
+    0x7e, 0xa8, 0x38, 0x0d, 0x54, 0xf3, 0xc5, 0x54, 0xcc, 0xfe, 0x28, 0xa5,
+    0x2f, 0x1d, 0x42, 0x98, 0x20, 0x7d, 0xc1, 0xd4, 0x09, 0xe1, 0xd1, 0xe1,
+    0xe3, 0xff};
+
+inline constexpr size_t kHuffmanOnlyChunks[] = {3000};
+inline constexpr size_t kHuffmanOnlyCompressed[] = {1872};
+inline constexpr uint8_t kHuffmanOnlyData[] = {
+    0x04, 0xc1, 0xb1, 0xcd, 0x24, 0xb9, 0x11, 0x06, 0x50, 0x9f, 0x31, 0xc8,
+    0xf8, 0x22, 0xf8, 0x7b, 0x9a, 0x6c, 0x0e, 0xd9, 0xc6, 0x79, 0xe3, 0xaf,
+    0x31, 0x11, 0x14, 0xc1, 0x1a, 0x0c, 0x85, 0x9e, 0xae, 0x46, 0x15, 0xc9,
+    0x93, 0x77, 0x19, 0xc8, 0x15, 0x94, 0x87, 0x62, 0x38, 0xc8, 0xb8, 0x20,
+    0x16, 0x38, 0x4f, 0xc2, 0xba, 0xc2, 0xc9, 0x11, 0xf4, 0x5e, 0xf4, 0xf9,
+    0xe6, 0xd6, 0x70, 0x8b, 0x9b, 0xab, 0xda, 0x26, 0x63, 0x36, 0x6b, 0x72,
+    0xc2, 0x87, 0x70, 0x4f, 0xee, 0x27, 0x95, 0x22, 0x1d, 0x97, 0x18, 0x23,
+    0xaf, 0x6b, 0x08, 0xae, 0xeb, 0x60, 0x7c, 0x2d, 0xcf, 0x0f, 0x69, 0x7f,
+    0x90, 0xbd, 0x8b, 0x90, 0xd6, 0x05, 0x5d, 0x07, 0xa3, 0x6a, 0x9b, 0x8c,
+    0xd9, 0xac, 0xc9, 0x89, 0xaa, 0x6d, 0x32, 0x2e, 0x31, 0x46, 0xdc, 0xa3,
+    0x0f, 0x6e, 0x36, 0x6b, 0x72, 0x42, 0xa5, 0x48, 0xc7, 0x25, 0xc6, 0x58,
+    0x9e, 0x1f, 0xd2, 0xfe, 0x20, 0x7b, 0x17, 0x21, 0xad, 0x0b, 0x5e, 0x74,
+    0x18, 0xe3, 0x45, 0x87, 0x31, 0x5e, 0x74, 0x18, 0x43, 0xa5, 0x48, 0xc7,
+    0x6c, 0xd6, 0xe4, 0x44, 0xd5, 0x36, 0x19, 0x93, 0x8e, 0xc1, 0xb8, 0xc4,
+    0x18, 0x87, 0x31, 0x5e, 0x74, 0x18, 0xe3, 0x45, 0x87, 0x31, 0x54, 0x8a,
+    0x74, 0x5c, 0x62, 0x8c, 0xd9, 0xac, 0xc9, 0x89, 0x4b, 0x8c, 0xf1, 0xa2,
+    0xc3, 0x18, 0x5b, 0xda, 0x63, 0x74, 0x55, 0xdb, 0x64, 0xfc, 0xb8, 0xc4,
+    0x18, 0x97, 0x18, 0xa3, 0x6a, 0x9b, 0x8c, 0xef, 0x5d, 0x07, 0x43, 0xa5,
+    0x48, 0x87, 0xf7, 0x71, 0x77, 0x8c, 0x2d, 0xed, 0x31, 0xba, 0xaa, 0x6d,
+    0x32, 0x7e, 0x5c, 0x62, 0x8c, 0x4b, 0x8c, 0x51, 0xb5, 0x4d, 0xc6, 0xf7,
+    0xae, 0x83, 0xa1, 0x52, 0xa4, 0xc3, 0xfb, 0xb8, 0x3b, 0xc6, 0x96, 0xf6,
+    0x18, 0x5d, 0xd5, 0x36, 0x19, 0x3f, 0x2e, 0x31, 0xc6, 0x25, 0xc6, 0xa8,
+    0xda, 0x26, 0xe3, 0x7b, 0xd7, 0x5f, 0x96, 0xe7, 0x87, 0xb4, 0x3f, 0xc8,
+    0xde, 0x45, 0x48, 0xeb, 0x82, 0x74, 0xbb, 0xaf, 0xc1, 0xed, 0xb7, 0xdb,
+    0xb6, 0xb9, 0xd9, 0xac, 0xc9, 0x89, 0xdf, 0x9a, 0x9c, 0xf0, 0x21, 0xdc,
+    0x93, 0xfb, 0x49, 0xa5, 0x48, 0xc7, 0x25, 0xc6, 0xc8, 0xeb, 0x1a, 0x82,
+    0xeb, 0x3a, 0x18, 0x5f, 0xcb, 0xf3, 0x43, 0xda, 0x1f, 0x64, 0xef, 0x22,
+    0xa4, 0x75, 0x41, 0xd7, 0xc1, 0xa8, 0xda, 0x26, 0x63, 0x36, 0x6b, 0x72,
+    0xa2, 0x6a, 0x9b, 0x8c, 0x4b, 0x8c, 0x11, 0xf7, 0xe8, 0x83, 0x9b, 0xcd,
+    0x9a, 0x9c, 0x50, 0x29, 0xd2, 0x91, 0xb2, 0xf7, 0xd1, 0xa9, 0x14, 0xe9,
+    0x10, 0x63, 0xe4, 0x75, 0x0d, 0xc1, 0x75, 0x1d, 0x8c, 0xaf, 0xe5, 0xf9,
+    0x21, 0xed, 0x0f, 0xb2, 0x77, 0x11, 0xd2, 0xba, 0xa0, 0xeb, 0x60, 0x54,
+    0x6d, 0x93, 0x31, 0x9b, 0x35, 0x39, 0x5f, 0x74, 0x18, 0x23, 0x6f, 0x71,
+    0x4b, 0x0e, 0x71, 0x8f, 0x3e, 0xb8, 0xd9, 0xac, 0xc9, 0x09, 0x95, 0x22,
+    0x1d, 0x29, 0x7f, 0x4b, 0xd9, 0xfb, 0xe8, 0x54, 0x8a, 0x74, 0x88, 0x31,
+    0xf2, 0xba, 0x86, 0xe0, 0xba, 0x0e, 0xc6, 0xd7, 0xf2, 0xfc, 0x90, 0xf6,
+    0x07, 0xd9, 0xbb, 0x08, 0x69, 0x5d, 0xd0, 0x73, 0x8c, 0xf7, 0x9b, 0x9b,
+    0x74, 0x0c, 0xc6, 0xbf, 0x2f, 0x31, 0xc6, 0x6c, 0xd6, 0xe4, 0xc4, 0xa4,
+    0x63, 0x30, 0xb6, 0x2d, 0xa7, 0xd5, 0x41, 0x8c, 0x91, 0xd7, 0x35, 0x04,
+    0xd7, 0x75, 0x30, 0xbe, 0x96, 0xe7, 0x87, 0xb4, 0x3f, 0xc8, 0xde, 0xc5,
+    0x55, 0x6d, 0x93, 0xf1, 0xe3, 0x12, 0x63, 0x5c, 0x62, 0x8c, 0xaa, 0x6d,
+    0xf2, 0x1a, 0x52, 0xce, 0xee, 0x5f, 0xb3, 0x59, 0x93, 0x13, 0x2f, 0x3a,
+    0x8c, 0x11, 0xd3, 0xea, 0x93, 0x93, 0x22, 0x1d, 0x97, 0x18, 0x63, 0x36,
+    0x6b, 0x72, 0xe2, 0x12, 0x63, 0xbc, 0xe8, 0x30, 0xc6, 0x96, 0x26, 0x1d,
+    0x83, 0xb1, 0x05, 0x9f, 0xbd, 0x8b, 0x31, 0x26, 0xef, 0x2e, 0x31, 0x46,
+    0xd7, 0xc1, 0x98, 0x74, 0x0c, 0xc6, 0xa4, 0x63, 0x30, 0xf2, 0xdd, 0xbb,
+    0xc3, 0x18, 0x21, 0x6f, 0x5b, 0x72, 0xc6, 0xc8, 0xeb, 0x1a, 0x82, 0xeb,
+    0x3a, 0x18, 0x5f, 0xcb, 0xf3, 0x43, 0xda, 0x1f, 0x64, 0xef, 0x22, 0xa4,
+    0x75, 0x41, 0xd7, 0xc1, 0x58, 0x9e, 0x1f, 0xd2, 0xfe, 0x20, 0x7b, 0x17,
+    0x21, 0xad, 0x0b, 0xac, 0xc9, 0x09, 0x95, 0x22, 0x1d, 0x29, 0x7f, 0x4b,
+    0xd9, 0xfb, 0xe8, 0x54, 0x8a, 0x74, 0x88, 0x31, 0xf2, 0xba, 0x86, 0xe0,
+    0xba, 0x0e, 0xc6, 0xd7, 0xf2, 0xfc, 0x90, 0xf6, 0x07, 0xe5, 0x7d, 0x5d,
+    0x83, 0xa3, 0xc3, 0x18, 0x5b, 0x9a, 0x74, 0x0c, 0xc6, 0x16, 0x7c, 0xf6,
+    0x2e, 0xc6, 0x98, 0xbc, 0xbb, 0xc4, 0x18, 0xdd, 0xfb, 0xb8, 0x3b, 0x86,
+    0x4a, 0x91, 0x8e, 0xbf, 0x2e, 0xcf, 0x0f, 0x69, 0x7f, 0x90, 0xbd, 0x8b,
+    0x90, 0xd6, 0x05, 0x2a, 0x45, 0x3a, 0xd2, 0xa4, 0x63, 0x30, 0xb6, 0xe0,
+    0xb3, 0x77, 0x31, 0xc6, 0xe4, 0xdd, 0x25, 0x55, 0xdb, 0x64, 0xec, 0x21,
+    0x64, 0xef, 0xfe, 0x7e, 0x89, 0x31, 0xfe, 0x01, 0x95, 0x22, 0x1d, 0xb3,
+    0x59, 0x93, 0x13, 0x55, 0xdb, 0x64, 0x4c, 0x3a, 0x06, 0xe3, 0x52, 0x29,
+    0xd2, 0xa1, 0x52, 0xa4, 0xe3, 0x45, 0x87, 0x31, 0xaa, 0xb6, 0xc9, 0x58,
+    0x9e, 0x1f, 0xd2, 0xfe, 0x20, 0x7b, 0x17, 0x21, 0xad, 0x0b, 0xee, 0x39,
+    0xde, 0x37, 0x37, 0x9b, 0x35, 0x39, 0xf1, 0xa2, 0xc3, 0x18, 0xb3, 0x59,
+    0x93, 0x13, 0x45, 0x3a, 0x52, 0xfe, 0x96, 0xb2, 0xf7, 0xd1, 0xa9, 0x14,
+    0xe9, 0x10, 0x63, 0xe4, 0x75, 0x0d, 0xc1, 0x75, 0x1d, 0x8c, 0xaf, 0xe5,
+    0xf9, 0x21, 0xed, 0x0f, 0xca, 0xfb, 0xba, 0xce, 0x66, 0x4d, 0x4e, 0x54,
+    0x6d, 0x93, 0x91, 0xc2, 0xee, 0x77, 0x17, 0x6e, 0xf9, 0x96, 0xdc, 0xf2,
+    0xfc, 0x90, 0xf6, 0x07, 0xd9, 0xbb, 0x08, 0x69, 0x5d, 0xb0, 0x3c, 0x3f,
+    0xa4, 0xfd, 0x41, 0xf6, 0x2e, 0x42, 0x5a, 0x17, 0xc4, 0xb4, 0xdd, 0x83,
+    0xdb, 0xf7, 0x5b, 0xdc, 0x5c, 0x5c, 0xf7, 0xb4, 0xbb, 0x49, 0xc7, 0x60,
+    0x84, 0x1c, 0xee, 0xbb, 0xfb, 0xcb, 0x9e, 0xd2, 0x6d, 0x75, 0x71, 0xdd,
+    0x43, 0x76, 0x5d, 0x07, 0x63, 0x79, 0x7e, 0x48, 0xfb, 0x83, 0xec, 0x5d,
+    0x84, 0xb4, 0x2e, 0x58, 0xb7, 0x1c, 0x37, 0x77, 0x89, 0x31, 0x2e, 0x31,
+    0x46, 0xd5, 0x36, 0x19, 0xdf, 0xbb, 0x0e, 0x86, 0x4a, 0x91, 0x0e, 0xef,
+    0xe3, 0xee, 0x18, 0x5b, 0xda, 0x63, 0x74, 0x55, 0xdb, 0x64, 0xfc, 0xb8,
+    0xc4, 0x18, 0x97, 0x18, 0xa3, 0x6a, 0x9b, 0x8c, 0xef, 0x5d, 0x7f, 0x59,
+    0x9e, 0x1f, 0xd2, 0xfe, 0x20, 0x7b, 0x17, 0x21, 0xad, 0x0b, 0xd2, 0xed,
+    0xd7, 0x4b, 0x8c, 0x31, 0x9b, 0x35, 0x39, 0x11, 0x42, 0x88, 0xc9, 0xe5,
+    0x6d, 0xbb, 0xad, 0x6e, 0xdf, 0xb6, 0x90, 0x5c, 0xd7, 0xc1, 0x78, 0xd1,
+    0x61, 0x0c, 0xdd, 0xe3, 0x1a, 0x57, 0x77, 0x89, 0x31, 0xbc, 0x8f, 0x4e,
+    0xa5, 0x48, 0x87, 0x18, 0x23, 0xaf, 0xb3, 0x59, 0x93, 0x13, 0x97, 0x18,
+    0xe3, 0x12, 0x63, 0x74, 0x1d, 0x8c, 0x17, 0x1d, 0xc6, 0xf0, 0x39, 0xee,
+    0xbb, 0xbb, 0xc4, 0x18, 0xcb, 0xf3, 0x43, 0xda, 0x1f, 0x64, 0xef, 0x22,
+    0xa4, 0x75, 0x81, 0x4a, 0x91, 0x8e, 0xb0, 0x6f, 0xfb, 0xdd, 0xc5, 0xe4,
+    0xdd, 0x25, 0x55, 0xdb, 0x64, 0xec, 0x21, 0xac, 0x6b, 0x08, 0xae, 0xeb,
+    0x60, 0x7c, 0x2d, 0xcf, 0x0f, 0x69, 0x7f, 0x90, 0xbd, 0x8b, 0x90, 0xd6,
+    0x05, 0x5d, 0x07, 0xa3, 0x6a, 0x9b, 0x8c, 0xd9, 0xac, 0xc9, 0x89, 0xaa,
+    0x6d, 0x32, 0x2e, 0x31, 0x46, 0xdc, 0xa3, 0x0f, 0x6e, 0x36, 0x6b, 0x97,
+    0x18, 0xa3, 0xeb, 0x60, 0x4c, 0x3a, 0x06, 0xa3, 0xc9, 0x89, 0x10, 0x42,
+    0x4c, 0x2e, 0x6f, 0xdb, 0x6d, 0x75, 0xfb, 0xb6, 0x85, 0xe4, 0xba, 0x0e,
+    0xc6, 0x8b, 0x0e, 0x63, 0xe8, 0x1e, 0xd7, 0xb8, 0xba, 0x4b, 0x8c, 0xe1,
+    0x7d, 0x74, 0x2a, 0x45, 0x3a, 0xc4, 0x18, 0x79, 0x9d, 0xcd, 0x9a, 0x9c,
+    0xb8, 0xc4, 0x18, 0x97, 0x18, 0xa3, 0xeb, 0x60, 0xbc, 0xe8, 0x70, 0x97,
+    0x18, 0xa3, 0xeb, 0x60, 0x4c, 0x3a, 0x06, 0x63, 0xd2, 0x31, 0x18, 0xf9,
+    0xee, 0xdd, 0x61, 0x8c, 0x90, 0xb7, 0x2d, 0x39, 0x63, 0xe4, 0x75, 0x0d,
+    0xc1, 0x75, 0x1d, 0x8c, 0xaf, 0xe5, 0xf9, 0x21, 0xed, 0x0f, 0xb2, 0x77,
+    0x11, 0xd2, 0xba, 0xa0, 0xdf, 0xf7, 0xe0, 0x77, 0x97, 0x67, 0xb3, 0x26,
+    0x27, 0x66, 0xb3, 0x26, 0x27, 0xaa, 0xb6, 0xc9, 0x98, 0x74, 0x0c, 0xc6,
+    0xa4, 0x63, 0x30, 0x54, 0x8a, 0x74, 0x5c, 0x62, 0x0c, 0xb7, 0x86, 0x5b,
+    0xdc, 0x5c, 0xd5, 0x36, 0x19, 0xf3, 0x12, 0x63, 0xfc, 0xa7, 0xeb, 0x60,
+    0x74, 0x1d, 0x8c, 0x3d, 0xa7, 0xdd, 0xbb, 0xd9, 0xac, 0xc9, 0x89, 0x4b,
+    0x8c, 0xe1, 0x53, 0x8a, 0x37, 0x27, 0xc6, 0xa8, 0xda, 0x26, 0xe3, 0x30,
+    0x46, 0x7d, 0xd1, 0x61, 0x8c, 0x94, 0x62, 0x0c, 0x2e, 0xae, 0x7e, 0xf3,
+    0xee, 0xbf, 0xb3, 0x59, 0x93, 0x13, 0x7f, 0x84, 0xbc, 0xad, 0xd1, 0xe5,
+    0x3d, 0xdf, 0xb3, 0x9b, 0xcd, 0x9a, 0x9c, 0xc8, 0xb7, 0x3d, 0x6c, 0xee,
+    0x9f, 0x97, 0x18, 0xe3, 0x45, 0x87, 0x31, 0xd6, 0xbc, 0xc7, 0xcd, 0x25,
+    0x9f, 0xb6, 0xbb, 0x5b, 0x9e, 0x1f, 0xd2, 0xfe, 0x20, 0x7b, 0x17, 0x21,
+    0xad, 0x0b, 0x7e, 0xf5, 0x29, 0xc5, 0x9b, 0x13, 0x63, 0x54, 0x6d, 0x93,
+    0x71, 0x18, 0xa3, 0xbe, 0xe8, 0x30, 0x46, 0x4a, 0x31, 0x06, 0x17, 0x57,
+    0xbf, 0x79, 0xf7, 0xdf, 0xd9, 0xac, 0xc9, 0x89, 0x3f, 0x42, 0xde, 0xd6,
+    0xe8, 0xf2, 0x9e, 0xef, 0xd9, 0xcd, 0x66, 0x4d, 0x4e, 0xe4, 0xdb, 0x1e,
+    0xb6, 0x7b, 0xf2, 0xf7, 0xe4, 0x52, 0xdc, 0x56, 0xef, 0xba, 0x0e, 0xc6,
+    0x16, 0xd3, 0xb6, 0x3b, 0x7f, 0x4b, 0xdb, 0xcd, 0x85, 0xe0, 0xba, 0x0e,
+    0xc6, 0xd7, 0x32, 0xe9, 0x18, 0x8c, 0xb0, 0xe7, 0xe8, 0x9d, 0x4a, 0x91,
+    0x8e, 0x4b, 0x8c, 0xa1, 0x52, 0xa4, 0x63, 0xbd, 0xad, 0x31, 0xba, 0x4b,
+    0x8c, 0xb1, 0x3c, 0x3f, 0xa4, 0xfd, 0x41, 0xf6, 0x2e, 0x42, 0x5a, 0x17,
+    0x30, 0x26, 0x1d, 0x83, 0x91, 0xef, 0xde, 0x1d, 0xc6, 0x08, 0x79, 0xdb,
+    0x92, 0x33, 0x46, 0x5e, 0xd7, 0x10, 0x5c, 0xd7, 0xc1, 0xf8, 0x5a, 0x9e,
+    0x1f, 0xd2, 0xfe, 0x20, 0x7b, 0x17, 0x21, 0xad, 0x0b, 0xba, 0x0e, 0xc6,
+    0xf2, 0xfc, 0x90, 0xf6, 0x07, 0xd9, 0xbb, 0x08, 0x69, 0x5d, 0x60, 0x4d,
+    0x4e, 0xa8, 0x14, 0xe9, 0x48, 0xf9, 0x5b, 0xca, 0xde, 0x47, 0xa7, 0x52,
+    0xa4, 0xeb, 0x60, 0xfc, 0x39, 0xdf, 0xee, 0xab, 0x77, 0x5d, 0x07, 0xe3,
+    0x45, 0x87, 0x31, 0x96, 0xe7, 0x87, 0xb4, 0x3f, 0xc8, 0xde, 0x45, 0x48,
+    0xeb, 0x82, 0xd9, 0xac, 0xc9, 0x89, 0x49, 0xc7, 0x60, 0x74, 0x1d, 0x8c,
+    0xb0, 0xfa, 0xdd, 0xbb, 0xaa, 0x6d, 0x32, 0xaa, 0xb6, 0xc9, 0x48, 0xb7,
+    0x7b, 0xdc, 0xdd, 0x6c, 0xd6, 0xe4, 0x44, 0xf4, 0x7b, 0x8c, 0xee, 0x12,
+    0x63, 0x5c, 0x62, 0x8c, 0xaa, 0x6d, 0x32, 0xbe, 0x77, 0xfd, 0x65, 0x79,
+    0x7e, 0x48, 0xfb, 0x83, 0xec, 0x5d, 0x84, 0xb4, 0x2e, 0x48, 0xb7, 0xfb,
+    0x1a, 0xdc, 0x7e, 0xbb, 0x6d, 0x9b, 0x9b, 0xcd, 0x9a, 0x9c, 0xf8, 0xad,
+    0xc9, 0x09, 0x1f, 0xc2, 0x3d, 0xb9, 0x9f, 0x54, 0x8a, 0x74, 0x5c, 0x62,
+    0x8c, 0xbc, 0xae, 0x21, 0xb8, 0xae, 0x83, 0xf1, 0xb5, 0x3c, 0x3f, 0xa4,
+    0xfd, 0xf1, 0x7b, 0x93, 0x13, 0x55, 0xdb, 0x64, 0x4c, 0x3a, 0x06, 0x63,
+    0xd2, 0x31, 0x18, 0x2a, 0x45, 0x3a, 0xae, 0x9f, 0x37, 0x7f, 0xf3, 0x9b,
+    0xdb, 0xb6, 0x3d, 0x44, 0x37, 0xe9, 0x18, 0x8c, 0xae, 0x83, 0xf1, 0xa2,
+    0xc3, 0x18, 0x2a, 0x45, 0x3a, 0x96, 0xe7, 0x87, 0xb4, 0x3f, 0xc8, 0xde,
+    0x45, 0x48, 0xeb, 0x82, 0x4b, 0x8c, 0xa1, 0x52, 0xa4, 0xa3, 0x6a, 0x9b,
+    0x8c, 0x4b, 0x8c, 0x71, 0x89, 0x31, 0x06, 0xe3, 0x6b, 0x79, 0x7e, 0x48,
+    0xfb, 0xe3, 0xf7, 0x26, 0x27, 0xaa, 0xb6, 0xc9, 0x98, 0x74, 0x0c, 0xc6,
+    0xa4, 0x63, 0x30, 0x54, 0x8a, 0x74, 0x5c, 0x3f, 0x6f, 0xfe, 0xe6, 0x83,
+    0xf7, 0xdb, 0xdd, 0x75, 0x1d, 0x0c, 0x54, 0x6d, 0x93, 0x71, 0xc9, 0x9f,
+    0x2e, 0x31, 0xc6, 0xff, 0x52, 0x8a, 0x69, 0x75, 0x6d, 0x32, 0xbe, 0x77,
+    0x1d, 0x0c, 0x95, 0x22, 0x1d, 0xde, 0xc7, 0xdd, 0x31, 0xb6, 0xb4, 0xc7,
+    0xe8, 0xaa, 0xb6, 0xc9, 0xf8, 0x71, 0x89, 0x31, 0x2e, 0x31, 0x46, 0xd5,
+    0x36, 0x59, 0xa5, 0x48, 0xc7, 0xdf, 0xc4, 0x18, 0x5d, 0x07, 0x63, 0xd2,
+    0x31, 0x18, 0x93, 0x8e, 0xc1, 0xc8, 0x77, 0xef, 0x0e, 0x63, 0x84, 0xbc,
+    0x6d, 0xc9, 0x19, 0x23, 0xaf, 0x6b, 0x08, 0xae, 0xeb, 0x60, 0x7c, 0x2d,
+    0xcf, 0x0f, 0x69, 0x7f, 0x90, 0xbd, 0x8b, 0x90, 0xd6, 0x05, 0xfd, 0xbe,
+    0x07, 0xbf, 0xbb, 0x3c, 0x9b, 0x35, 0x39, 0x31, 0x9b, 0x35, 0x39, 0x51,
+    0xb5, 0x4d, 0xc6, 0xec, 0x3a, 0x18, 0x97, 0x18, 0x63, 0xd2, 0x31, 0x18,
+    0x5d, 0x07, 0x43, 0xa5, 0x48, 0xc7, 0x60, 0x54, 0x6d, 0x93, 0x31, 0x9b,
+    0x35, 0x39, 0x51, 0xb5, 0x4d, 0xc6, 0x25, 0xc6, 0x88, 0x7b, 0xf4, 0xc1,
+    0xcd, 0x66, 0x4d, 0x4e, 0xa8, 0x14, 0xe9, 0xb8, 0xc4, 0x18, 0xcb, 0xf3,
+    0x43, 0xda, 0x1f, 0x64, 0xef, 0x22, 0xa4, 0x75, 0xc1, 0x8b, 0x0e, 0x63,
+    0xbc, 0xe8, 0x30, 0xc6, 0x8b, 0x0e, 0x63, 0xa8, 0x14, 0xe9, 0x98, 0x4d,
+    0x27, 0x1d, 0x83, 0xe1, 0xe3, 0xee, 0x93, 0x83, 0x4a, 0x91, 0x8e, 0xd9,
+    0xac, 0xc9, 0x89, 0xaa, 0x6d, 0x32, 0x26, 0x1d, 0x83, 0x71, 0xa9, 0x14,
+    0xe9, 0x50, 0x29, 0xd2, 0xf1, 0xa2, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff};
+
+inline constexpr size_t kRleChunks[] = {3000};
+inline constexpr size_t kRleCompressed[] = {1862};
+inline constexpr uint8_t kRleData[] = {
+    0x9c, 0xc1, 0x21, 0x0e, 0xf6, 0xba, 0xb1, 0x06, 0x60, 0x54, 0xe2, 0x15,
+    0xdc, 0xb2, 0x57, 0xfa, 0x17, 0xe0, 0xc4, 0x89, 0x13, 0x87, 0x56, 0xa1,
+    0x45, 0x01, 0x65, 0x47, 0x1a, 0xcb, 0x13, 0xc5, 0x52, 0xf2, 0xcd, 0xa7,
+    0x19, 0xc7, 0xec, 0xd0, 0xb3, 0x83, 0x6e, 0xa1, 0xb4, 0xb0, 0xb4, 0xb4,
+    0x2a, 0x6a, 0x49, 0xd7, 0x70, 0xca, 0xca, 0x0a, 0x2e, 0xb8, 0x7b, 0xb8,
+    0xcf, 0xf3, 0xd7, 0xff, 0x8f, 0x5e, 0xad, 0xca, 0x07, 0x56, 0xe5, 0x03,
+    0xab, 0xf2, 0x81, 0x55, 0xf9, 0xc0, 0xaa, 0x7c, 0x60, 0x55, 0x3e, 0xb0,
+    0x2a, 0x1f, 0x58, 0x95, 0x0f, 0xac, 0xca, 0x67, 0x9a, 0x86, 0x71, 0x72,
+    0x2a, 0x59, 0x1a, 0xd2, 0x10, 0xd3, 0xe4, 0x4e, 0xba, 0x8d, 0xe1, 0x54,
+    0xb2, 0x34, 0xa4, 0x21, 0xa6, 0xc9, 0x9d, 0x74, 0x1b, 0xc3, 0xa9, 0x64,
+    0x69, 0x48, 0x43, 0x4c, 0x93, 0x3b, 0xe9, 0x36, 0x86, 0x53, 0xc9, 0xd2,
+    0x90, 0x86, 0x98, 0x26, 0x77, 0xd2, 0x6d, 0x0c, 0xa7, 0x92, 0xa5, 0x21,
+    0x0d, 0x31, 0x4d, 0xee, 0xa4, 0xdb, 0x18, 0x4e, 0x25, 0x4b, 0x43, 0x1a,
+    0x62, 0x9a, 0x26, 0x77, 0xd2, 0x6d, 0x0c, 0xa7, 0x92, 0xa5, 0x21, 0x0d,
+    0x31, 0x4d, 0xee, 0xa4, 0xdb, 0x58, 0x25, 0x4b, 0x43, 0xd3, 0x97, 0xe1,
+    0x8f, 0x87, 0xb4, 0xed, 0x64, 0x57, 0x16, 0xd2, 0xe2, 0xe1, 0x8f, 0x87,
+    0xb4, 0xed, 0x64, 0x57, 0x16, 0xd2, 0xe2, 0x11, 0xa6, 0x65, 0x75, 0xd3,
+    0xb4, 0x6d, 0xc1, 0xf9, 0xe3, 0x21, 0x6d, 0x3b, 0xd9, 0x95, 0x85, 0xb4,
+    0x78, 0x8c, 0x43, 0x1c, 0x47, 0x77, 0xd2, 0x6d, 0x8c, 0xa2, 0xb5, 0x33,
+    0xfc, 0xf1, 0x90, 0xb6, 0x9d, 0xec, 0xca, 0x42, 0x5a, 0x3c, 0x54, 0xb2,
+    0x34, 0x0c, 0xc5, 0x43, 0x25, 0x4b, 0xc3, 0x50, 0x3c, 0x54, 0xb2, 0x34,
+    0x0c, 0xc5, 0x43, 0x25, 0x4e, 0xc3, 0x30, 0xb9, 0xaf, 0x18, 0x43, 0x25,
+    0x4b, 0xc3, 0x57, 0x8c, 0xf1, 0x43, 0x25, 0x4b, 0x43, 0xd3, 0x97, 0x51,
+    0xb4, 0x76, 0x86, 0x4a, 0x96, 0x86, 0xff, 0xaa, 0x64, 0x69, 0xf8, 0x8a,
+    0x31, 0x9a, 0xbe, 0x0c, 0x7f, 0x3c, 0xa4, 0x6d, 0x27, 0xbb, 0xb2, 0x90,
+    0x16, 0x0f, 0x7f, 0x3c, 0xa4, 0x6d, 0x27, 0xbb, 0xb2, 0x90, 0x16, 0x8f,
+    0xbf, 0xa8, 0x64, 0x69, 0xf8, 0x5d, 0xaf, 0x56, 0xe5, 0x83, 0xaf, 0x18,
+    0x23, 0xc4, 0x94, 0x56, 0x37, 0xb9, 0xaf, 0x18, 0x43, 0x25, 0x4b, 0xc3,
+    0x57, 0x8c, 0xf1, 0x43, 0x25, 0x4b, 0x43, 0xd3, 0x97, 0x51, 0xb4, 0x76,
+    0x86, 0x4a, 0xaf, 0x56, 0xe5, 0x83, 0x10, 0xe3, 0x1c, 0x5d, 0xd1, 0xda,
+    0x19, 0xbd, 0x5a, 0x95, 0x0f, 0xb6, 0x35, 0xce, 0x9b, 0x93, 0x2c, 0x0d,
+    0x4d, 0x5f, 0x86, 0x3f, 0x1e, 0xd2, 0xb6, 0x93, 0x5d, 0x59, 0x48, 0x8b,
+    0x87, 0x3f, 0x1e, 0xd2, 0xb6, 0x93, 0x5d, 0x59, 0x48, 0x8b, 0x47, 0x98,
+    0x96, 0xd5, 0x7d, 0xc5, 0x18, 0xbd, 0x5a, 0x95, 0x0f, 0xfc, 0xf1, 0x90,
+    0xb6, 0x9d, 0xec, 0xca, 0x42, 0x5a, 0x3c, 0xc4, 0x18, 0x3f, 0x54, 0xb2,
+    0x34, 0x34, 0x7d, 0x19, 0x45, 0x6b, 0x67, 0xa8, 0xf4, 0x6a, 0x55, 0x3e,
+    0x08, 0x31, 0xce, 0xd1, 0x15, 0xad, 0x9d, 0xd1, 0xab, 0x55, 0xf9, 0x60,
+    0x5b, 0xe3, 0xbc, 0x39, 0xc9, 0xd2, 0xd0, 0xf4, 0x65, 0xf8, 0xe3, 0x21,
+    0x6d, 0x3b, 0xd9, 0x95, 0x85, 0xb4, 0x78, 0xf8, 0xe3, 0x21, 0x6d, 0x3b,
+    0xd9, 0x95, 0x8b, 0xd6, 0xce, 0x08, 0xeb, 0xb0, 0xac, 0xce, 0x1f, 0x0f,
+    0x69, 0xdb, 0xc9, 0xae, 0x2c, 0xa4, 0xc5, 0x83, 0xb4, 0x78, 0x84, 0x69,
+    0x59, 0xdd, 0x57, 0x8c, 0xd1, 0xab, 0x55, 0xf9, 0xc0, 0x1f, 0x0f, 0x69,
+    0xdb, 0xc9, 0xae, 0x2c, 0xa4, 0xc5, 0x43, 0xc2, 0xbc, 0x0d, 0x9b, 0xfb,
+    0xb3, 0x3f, 0x1e, 0xd2, 0xb6, 0x93, 0x5d, 0x59, 0x48, 0x8b, 0x47, 0x58,
+    0xd6, 0x6d, 0x72, 0xbd, 0x5a, 0x95, 0x0f, 0xc6, 0x71, 0x19, 0x66, 0xa7,
+    0x92, 0xa5, 0xa1, 0x68, 0xed, 0x8c, 0x7f, 0x2f, 0xe3, 0x32, 0x05, 0x37,
+    0xad, 0xeb, 0xb0, 0x3a, 0xd2, 0xe2, 0xe1, 0x8f, 0x87, 0xb4, 0xed, 0x64,
+    0x57, 0x16, 0xd2, 0xe2, 0xf1, 0x17, 0x95, 0x2c, 0x0d, 0x31, 0x86, 0x2d,
+    0xba, 0x35, 0xcc, 0x6b, 0x74, 0x9d, 0xee, 0x97, 0xa1, 0x92, 0xa5, 0xa1,
+    0x57, 0xab, 0xf2, 0x41, 0xaf, 0x56, 0xe5, 0x83, 0x6d, 0xd9, 0xe2, 0xe4,
+    0xfc, 0xf1, 0x90, 0xb6, 0x9d, 0xec, 0xca, 0x42, 0x5a, 0x3c, 0xb6, 0x35,
+    0xcc, 0x2e, 0x2e, 0x69, 0xde, 0x1c, 0xab, 0x64, 0x69, 0x68, 0xfa, 0x32,
+    0xfc, 0xf1, 0x90, 0xb6, 0x9d, 0xec, 0xca, 0x42, 0x5a, 0x3c, 0xfc, 0xf1,
+    0x90, 0xb6, 0x9d, 0xec, 0xca, 0x42, 0xfa, 0x8b, 0x3f, 0x1e, 0xd2, 0xb6,
+    0x93, 0x5d, 0x59, 0x48, 0x8b, 0x47, 0xd3, 0x97, 0x31, 0xc7, 0x79, 0x99,
+    0x5d, 0xd1, 0xda, 0x19, 0x27, 0xdd, 0xc6, 0xd0, 0xb6, 0x93, 0x5d, 0x59,
+    0x48, 0x8b, 0x87, 0x3f, 0x1e, 0xd2, 0xb6, 0x93, 0x5d, 0x59, 0x48, 0x7f,
+    0xf1, 0xc7, 0x43, 0xda, 0x76, 0xb2, 0x2b, 0x0b, 0x69, 0xf1, 0x68, 0xfa,
+    0x32, 0xe6, 0x38, 0x8f, 0x5b, 0x48, 0xab, 0xfb, 0x8a, 0x31, 0xe2, 0x38,
+    0xad, 0x9b, 0xeb, 0x74, 0xbf, 0x8c, 0xa2, 0xb5, 0x33, 0x8a, 0xd6, 0xce,
+    0x50, 0xc9, 0xd2, 0xd0, 0xe9, 0x7e, 0x19, 0x9f, 0xa6, 0x2f, 0x63, 0x19,
+    0xc3, 0xb8, 0x39, 0x95, 0x2c, 0x0d, 0xcb, 0x9c, 0xb6, 0xd9, 0xa9, 0x64,
+    0x69, 0xf8, 0x97, 0x4a, 0x96, 0x86, 0x93, 0x6e, 0x63, 0x9c, 0x74, 0x1b,
+    0xa3, 0x57, 0xab, 0xf2, 0x41, 0xd3, 0x97, 0x31, 0x86, 0xb4, 0x45, 0xd7,
+    0xf4, 0x65, 0xcc, 0xc3, 0xba, 0x24, 0xf7, 0x43, 0xdb, 0x4e, 0x76, 0x65,
+    0x21, 0x2d, 0x1e, 0x61, 0x59, 0xb7, 0xc9, 0xf5, 0x3a, 0xa5, 0x61, 0x5e,
+    0xdc, 0x49, 0xb7, 0x31, 0x7e, 0x6a, 0xfa, 0x32, 0x4e, 0xba, 0x8d, 0xf1,
+    0x6b, 0xd1, 0xda, 0x19, 0x3f, 0xbb, 0x35, 0xcc, 0x6b, 0x74, 0x9d, 0xee,
+    0x97, 0xa1, 0x92, 0xa5, 0xa1, 0x57, 0xab, 0xf2, 0x41, 0xaf, 0x56, 0xe5,
+    0x83, 0x6d, 0xd9, 0xe2, 0xe4, 0xfc, 0xf1, 0x90, 0xb6, 0x9d, 0xec, 0xca,
+    0x42, 0xfa, 0x8f, 0xbf, 0x6f, 0xd1, 0x35, 0x7d, 0x19, 0xf3, 0xb0, 0x2e,
+    0xc9, 0xfd, 0xd0, 0xb6, 0x93, 0x5d, 0x59, 0x48, 0x8b, 0x47, 0x58, 0xd6,
+    0x6d, 0x72, 0xbd, 0x4e, 0x69, 0x98, 0x17, 0x77, 0xd2, 0x6d, 0x8c, 0x9f,
+    0x9a, 0xbe, 0x8c, 0x93, 0x6e, 0x63, 0xfc, 0xda, 0xe9, 0x7e, 0x19, 0x5f,
+    0x31, 0x86, 0x3f, 0x1e, 0xd2, 0xb6, 0x93, 0x5d, 0x59, 0x48, 0x8b, 0x47,
+    0xaf, 0x56, 0xe5, 0x83, 0xa6, 0x2f, 0x23, 0xcd, 0x29, 0x05, 0xe7, 0x8f,
+    0x87, 0xb4, 0xed, 0x64, 0x57, 0x16, 0xd2, 0xe2, 0xb1, 0x86, 0x69, 0x4c,
+    0xae, 0xd3, 0xfd, 0x32, 0xdc, 0x6f, 0xd6, 0x10, 0xa6, 0xc5, 0x89, 0x31,
+    0xe2, 0x38, 0xad, 0x9b, 0xeb, 0x74, 0xbf, 0x8c, 0xa2, 0xb5, 0x33, 0x8a,
+    0xd6, 0xfe, 0x15, 0x63, 0x74, 0xba, 0x5f, 0xc6, 0x32, 0x0c, 0xcb, 0xea,
+    0x52, 0x18, 0xe3, 0xe6, 0xd2, 0x3a, 0xa7, 0xd1, 0xf5, 0x6a, 0x55, 0x3e,
+    0x40, 0x1a, 0x62, 0x9a, 0xdc, 0x49, 0xb7, 0x31, 0x9c, 0x4a, 0x96, 0x86,
+    0x34, 0x0d, 0x71, 0x59, 0x5d, 0x0c, 0x71, 0x0a, 0x4e, 0x25, 0x4b, 0x83,
+    0x3f, 0x1e, 0xd2, 0xb6, 0x93, 0x5d, 0x59, 0x48, 0x8b, 0xc7, 0x57, 0x8c,
+    0xf1, 0x15, 0x63, 0x9c, 0x74, 0x1b, 0xe3, 0x2b, 0xc6, 0x08, 0xcb, 0x12,
+    0x56, 0x77, 0xd2, 0x6d, 0x0c, 0x7f, 0x3c, 0xa4, 0x6d, 0x27, 0xbb, 0xb2,
+    0x90, 0x16, 0x0f, 0x7f, 0x3c, 0xa4, 0x6d, 0x27, 0xbb, 0xb2, 0x90, 0xfe,
+    0xe2, 0x8f, 0x87, 0xb4, 0xed, 0x64, 0x57, 0x16, 0xd2, 0xe2, 0xd1, 0xf4,
+    0x65, 0xcc, 0x71, 0x5e, 0x66, 0x57, 0xb4, 0x76, 0xc6, 0x49, 0xb7, 0x31,
+    0xb4, 0xed, 0x64, 0x57, 0x16, 0xd2, 0xe2, 0x8f, 0x87, 0xb4, 0xed, 0x64,
+    0x57, 0x16, 0xd2, 0xe2, 0x71, 0xd2, 0x6d, 0x8c, 0x71, 0x89, 0x61, 0x75,
+    0x27, 0xdd, 0xc6, 0xf8, 0xed, 0x9a, 0xa6, 0xb0, 0x39, 0x7f, 0x3c, 0xa4,
+    0x6d, 0x27, 0xbb, 0xb2, 0x90, 0x16, 0x8f, 0x5e, 0xad, 0xca, 0x07, 0x45,
+    0x6b, 0x67, 0x9c, 0x74, 0x1b, 0xe3, 0xa4, 0xdb, 0x18, 0xd3, 0x34, 0x4c,
+    0xc1, 0x05, 0x7f, 0x3c, 0xa4, 0x6d, 0x27, 0xbb, 0xb2, 0x90, 0x16, 0x0f,
+    0x95, 0x2c, 0x0d, 0x45, 0x6b, 0x67, 0x34, 0x7d, 0x19, 0x2a, 0x59, 0x1a,
+    0x7a, 0xb5, 0x2a, 0x1f, 0xf4, 0x6a, 0x55, 0x3e, 0xd8, 0x96, 0x2d, 0x4e,
+    0xce, 0x1f, 0x0f, 0x69, 0xdb, 0xc9, 0xae, 0x2c, 0xa4, 0xff, 0xf8, 0xfb,
+    0x16, 0x5d, 0xd3, 0x97, 0x31, 0x0f, 0x6b, 0x4a, 0xcb, 0xb6, 0xb8, 0xff,
+    0xfd, 0x8a, 0x31, 0x9a, 0xbe, 0x0c, 0x5f, 0xb4, 0x76, 0x46, 0xa7, 0xfb,
+    0x65, 0x74, 0xba, 0x5f, 0x86, 0x4a, 0x96, 0x86, 0xa2, 0xb5, 0x33, 0x4e,
+    0xba, 0x8d, 0x81, 0x39, 0xce, 0xe3, 0x16, 0xd2, 0xea, 0xbe, 0x62, 0x8c,
+    0x38, 0x4e, 0xeb, 0xe6, 0x3a, 0xdd, 0x2f, 0xa3, 0x68, 0xed, 0x8c, 0xa2,
+    0xb5, 0x33, 0x54, 0xb2, 0x34, 0x74, 0xba, 0x5f, 0xc6, 0xa7, 0xe9, 0xcb,
+    0x58, 0xc6, 0x30, 0x6e, 0x4e, 0x25, 0xcb, 0x1f, 0x62, 0x8a, 0xeb, 0xe2,
+    0x54, 0x7a, 0xb5, 0x2a, 0x1f, 0x84, 0x18, 0xe7, 0xe8, 0x8a, 0xd6, 0xce,
+    0xe8, 0xd5, 0xaa, 0x7c, 0xb0, 0xad, 0x71, 0xde, 0x9c, 0x64, 0x69, 0x68,
+    0xfa, 0x32, 0xfc, 0xf1, 0x90, 0xb6, 0x9d, 0xec, 0xca, 0x42, 0x5a, 0x3c,
+    0xfc, 0xf1, 0x90, 0xb6, 0x9d, 0xec, 0xca, 0x25, 0x8c, 0xf3, 0x3c, 0xb9,
+    0x2d, 0x86, 0x71, 0x71, 0x5f, 0x31, 0xc6, 0x49, 0xb7, 0x31, 0x8a, 0xd6,
+    0xce, 0xf8, 0xdd, 0x49, 0xb7, 0x31, 0x7e, 0x6a, 0xfa, 0x32, 0x4e, 0xba,
+    0x8d, 0xf1, 0x6b, 0xd1, 0xda, 0x19, 0x3f, 0xbb, 0x35, 0xcc, 0x6b, 0x74,
+    0x9d, 0xee, 0x97, 0xa1, 0x92, 0xa5, 0xa1, 0x57, 0xab, 0xf2, 0x41, 0xaf,
+    0x56, 0xe5, 0x83, 0x6d, 0xd9, 0xe2, 0xe4, 0x96, 0x98, 0x86, 0xcd, 0xcd,
+    0x43, 0x1a, 0x17, 0xd7, 0xf4, 0x65, 0x7c, 0xc5, 0x18, 0xc5, 0x23, 0x4c,
+    0xcb, 0xea, 0xbe, 0x62, 0x8c, 0x5e, 0x6d, 0x4c, 0x21, 0x0c, 0x2e, 0x84,
+    0x6d, 0x1c, 0x1d, 0xd9, 0x95, 0x85, 0xb4, 0x78, 0x34, 0x7d, 0x19, 0x73,
+    0x9c, 0x97, 0xd9, 0x15, 0xad, 0x9d, 0x71, 0xd2, 0x6d, 0x0c, 0x6d, 0xfb,
+    0x1f, 0xff, 0xb3, 0xce, 0x71, 0xdc, 0x5c, 0xd3, 0x97, 0x71, 0xd2, 0x6d,
+    0x8c, 0x75, 0x88, 0x69, 0x72, 0xdb, 0x9a, 0x42, 0x72, 0x4d, 0x5f, 0x46,
+    0x9a, 0x86, 0xb8, 0xac, 0x2e, 0x86, 0x38, 0x05, 0xa7, 0x92, 0xa5, 0xc1,
+    0x1f, 0x0f, 0x69, 0xdb, 0xc9, 0xae, 0x2c, 0xa4, 0xc5, 0xe3, 0x2b, 0xc6,
+    0xf8, 0x8a, 0x31, 0x4e, 0xba, 0x8d, 0xf1, 0x15, 0x63, 0x84, 0x65, 0x09,
+    0xab, 0x3b, 0xe9, 0x36, 0x86, 0x3f, 0x1e, 0xd2, 0xb6, 0x93, 0x5d, 0x59,
+    0x68, 0x19, 0xd3, 0x34, 0xb8, 0x18, 0xe2, 0xea, 0xd2, 0x36, 0x8d, 0x83,
+    0xf3, 0xc7, 0x43, 0xda, 0x76, 0xb2, 0x2b, 0x0b, 0x69, 0xf1, 0x38, 0xe9,
+    0x36, 0x86, 0x3f, 0x1e, 0xd2, 0xb6, 0x93, 0x5d, 0x59, 0x48, 0x8b, 0xc7,
+    0x57, 0x8c, 0x71, 0xd2, 0x6d, 0x8c, 0xaf, 0x18, 0x23, 0x2c, 0x4b, 0x58,
+    0xdd, 0x49, 0xb7, 0x31, 0xfc, 0xf1, 0x90, 0xb6, 0x9d, 0xec, 0xca, 0x42,
+    0xcb, 0x98, 0xa6, 0xc1, 0xc5, 0x10, 0x57, 0x97, 0xb6, 0x69, 0x1c, 0x9c,
+    0x3f, 0x1e, 0xd2, 0xe6, 0x8f, 0x87, 0xb4, 0xed, 0x64, 0x57, 0x16, 0xd2,
+    0xe2, 0x91, 0xd2, 0xb2, 0x0d, 0xae, 0x57, 0xab, 0xf2, 0x41, 0x58, 0xd3,
+    0x36, 0xba, 0xa2, 0xb5, 0x33, 0xa6, 0xb8, 0x8e, 0xc9, 0xa9, 0x64, 0x69,
+    0x18, 0xc7, 0x65, 0xda, 0x5c, 0x9c, 0xc2, 0x3a, 0xb8, 0x93, 0x6e, 0x63,
+    0x30, 0xfc, 0xf1, 0x90, 0xb6, 0x9d, 0xec, 0xca, 0x42, 0x5a, 0xbc, 0x4a,
+    0x96, 0x86, 0xff, 0x59, 0xc6, 0x38, 0x6f, 0xee, 0x2b, 0xc6, 0xf8, 0xfd,
+    0x9f, 0x18, 0x61, 0x4a, 0x69, 0x1b, 0xdd, 0x3f, 0xed, 0xca, 0x42, 0x5a,
+    0x3c, 0xfc, 0xf1, 0xf8, 0xe3, 0x21, 0x6d, 0x3b, 0xd9, 0x95, 0x85, 0xb4,
+    0x78, 0x74, 0xba, 0x5f, 0x46, 0xd3, 0x97, 0x51, 0xb4, 0x76, 0x06, 0xd9,
+    0x95, 0x85, 0xb4, 0x78, 0xf4, 0x6a, 0x55, 0x3e, 0x28, 0xda, 0xe9, 0x7e,
+    0x19, 0x92, 0xa5, 0xc1, 0x1f, 0x0f, 0x69, 0xdb, 0xc9, 0xae, 0x2c, 0xa4,
+    0xc5, 0xe3, 0x2b, 0xc6, 0xf8, 0x8a, 0x75, 0xba, 0x5f, 0x46, 0xaf, 0x56,
+    0xe5, 0x83, 0xa2, 0xb5, 0x33, 0xac, 0xca, 0x07, 0x4d, 0x5f, 0x46, 0x9a,
+    0x53, 0x0a, 0xce, 0x1f, 0x0f, 0x69, 0xdb, 0xc9, 0xae, 0x2c, 0xa4, 0xc5,
+    0x63, 0x0d, 0xd3, 0x98, 0x5c, 0xa7, 0xfb, 0x65, 0xb8, 0xdf, 0xac, 0x21,
+    0x4c, 0x4b, 0x8a, 0x69, 0x74, 0x5f, 0x31, 0x46, 0x48, 0x71, 0x5e, 0xdc,
+    0xcb, 0x18, 0x43, 0xda, 0xa2, 0x6b, 0xfa, 0x32, 0xe6, 0x61, 0x5d, 0x92,
+    0xfb, 0xa1, 0x6d, 0x27, 0xbb, 0xb2, 0x90, 0x16, 0x8f, 0xb0, 0xac, 0xdb,
+    0xe4, 0x7a, 0x9d, 0xd2, 0x30, 0x2f, 0xee, 0xa4, 0xdb, 0x18, 0x3f, 0x35,
+    0x7d, 0x19, 0x27, 0xdd, 0xc6, 0xf8, 0xb5, 0x68, 0xed, 0x8c, 0x9f, 0xc7,
+    0x61, 0x19, 0x36, 0x77, 0xd2, 0x6d, 0x0c, 0xe9, 0xd5, 0xaa, 0x40, 0xdb,
+    0x4e, 0x76, 0x65, 0xa1, 0x4e, 0xf7, 0xcb, 0x08, 0x5b, 0x18, 0xa3, 0x3b,
+    0xe9, 0x36, 0xc6, 0x32, 0x86, 0xd1, 0xfd, 0xcd, 0x1f, 0x0f, 0x69, 0xdb,
+    0xc9, 0xae, 0x2c, 0xa4, 0xc5, 0x23, 0xcd, 0x31, 0xba, 0x75, 0x9d, 0xb7,
+    0xc1, 0x7d, 0xc5, 0x18, 0x69, 0x0a, 0x9b, 0xfb, 0x3f, 0x00, 0x00, 0x00,
+    0xff, 0xff};
+
+inline constexpr size_t kSmallWindowChunks[] = {4000, 4000};
+inline constexpr size_t kSmallWindowCompressed[] = {1225, 1462};
+inline constexpr uint8_t kSmallWindowData[] = {
+    0xac, 0x4f, 0x3b, 0x8f, 0x1c, 0x45, 0x10, 0x4e, 0x2e, 0xaa, 0xd0, 0x31,
+    0x48, 0x13, 0x10, 0x39, 0xb9, 0xae, 0xae, 0x47, 0x77, 0x85, 0x08, 0x87,
+    0x04, 0x20, 0x4b, 0x24, 0x27, 0x21, 0xed, 0xe9, 0x76, 0xf1, 0x4a, 0x77,
+    0xac, 0x35, 0xbb, 0x5e, 0xf1, 0x3b, 0xc8, 0xb1, 0xf8, 0x11, 0x20, 0x21,
+    0x39, 0x23, 0x76, 0x64, 0x52, 0x02, 0x72, 0xf8, 0x05, 0x8e, 0xe8, 0xab,
+    0xea, 0xf1, 0xcd, 0xdd, 0x9c, 0x8d, 0x8d, 0x9c, 0xf4, 0xa3, 0xea, 0x7b,
+    0xfe, 0xf5, 0xe3, 0xc5, 0xb8, 0x3d, 0xae, 0x07, 0xcb, 0xc8, 0x0a, 0x3b,
+    0x13, 0xc3, 0x0a, 0xc7, 0xed, 0x7e, 0xbb, 0xfb, 0x7e, 0x78, 0xf1, 0x3c,
+    0x76, 0x24, 0x6a, 0x15, 0x24, 0xa9, 0x08, 0x9c, 0x3e, 0xbe, 0x5a, 0x8d,
+    0x87, 0x47, 0xab, 0xfd, 0x93, 0xf3, 0xdd, 0x6a, 0xbc, 0x38, 0x1d, 0xde,
+    0xfb, 0x92, 0x54, 0x2d, 0x01, 0x73, 0xe2, 0x0c, 0x4c, 0x5c, 0x08, 0x0e,
+    0xe3, 0xb3, 0xf5, 0xa0, 0xd4, 0xe4, 0x21, 0x8c, 0xba, 0xef, 0xb8, 0x3b,
+    0xdf, 0x1d, 0xa6, 0xcf, 0xd3, 0xdd, 0x7e, 0x3d, 0x30, 0x49, 0xf3, 0x16,
+    0xc1, 0x8c, 0x90, 0xad, 0x60, 0x81, 0x87, 0x3e, 0xf7, 0x43, 0x8b, 0xa1,
+    0xc1, 0xc6, 0xdf, 0x8b, 0x78, 0x2f, 0x3f, 0x50, 0xdc, 0x33, 0x6d, 0x56,
+    0x97, 0x6d, 0x4e, 0xa4, 0xb5, 0xc2, 0xd9, 0x07, 0xa4, 0x70, 0x32, 0x62,
+    0xd2, 0x02, 0x66, 0x98, 0x10, 0x7e, 0xaf, 0xa6, 0x02, 0xdd, 0xec, 0xfe,
+    0xa0, 0xe1, 0xf5, 0x3f, 0x9d, 0x17, 0x75, 0x3f, 0xf1, 0xf1, 0xa7, 0x59,
+    0x49, 0x32, 0x08, 0x25, 0xac, 0xb0, 0xc0, 0xe4, 0x92, 0x08, 0x3e, 0x6b,
+    0xd2, 0xe3, 0xee, 0x7c, 0x77, 0x18, 0x7a, 0xba, 0xa5, 0xcf, 0x07, 0x05,
+    0x0a, 0x5c, 0x28, 0x3e, 0xc0, 0x5a, 0x09, 0x50, 0x8a, 0x65, 0x88, 0x49,
+    0x6c, 0x2f, 0xc6, 0xed, 0xb1, 0x51, 0xbb, 0xa1, 0xcb, 0xa3, 0x65, 0x56,
+    0x78, 0x7b, 0xec, 0xf6, 0xb7, 0x04, 0x41, 0x67, 0xd1, 0x4c, 0xf0, 0xcb,
+    0x5e, 0x05, 0x59, 0x80, 0x94, 0xaa, 0x6f, 0x62, 0xb9, 0x68, 0x39, 0xdd,
+    0xef, 0xbe, 0x82, 0xfc, 0x5a, 0x4b, 0x62, 0xec, 0x36, 0x1e, 0x65, 0x21,
+    0xe7, 0xc7, 0x4b, 0x51, 0x88, 0x12, 0xbd, 0x43, 0xb4, 0xeb, 0x1f, 0x27,
+    0x32, 0x89, 0x08, 0x88, 0x60, 0x46, 0xc8, 0x5e, 0x31, 0x54, 0x89, 0xb4,
+    0x56, 0x38, 0x5b, 0x02, 0x43, 0xc2, 0xc8, 0x58, 0xc1, 0x32, 0x22, 0x74,
+    0xb5, 0xe9, 0x5a, 0x5d, 0x36, 0x0d, 0x17, 0xea, 0x66, 0x3e, 0x58, 0x0f,
+    0x0d, 0xdb, 0x18, 0x3b, 0x13, 0xc3, 0x3a, 0x71, 0x5e, 0x3c, 0x8f, 0x74,
+    0x24, 0x6a, 0x15, 0x24, 0x69, 0x73, 0x58, 0x34, 0x99, 0x5d, 0x58, 0xd8,
+    0xa8, 0xd7, 0x7e, 0x4f, 0x94, 0x27, 0x29, 0x26, 0x95, 0xef, 0x04, 0x9d,
+    0x45, 0xd4, 0x56, 0x55, 0xc0, 0x07, 0xc1, 0x42, 0xb5, 0x52, 0xe0, 0xbd,
+    0xf5, 0xef, 0xec, 0xef, 0x5e, 0x92, 0xaa, 0x25, 0x60, 0x4e, 0x9c, 0x81,
+    0x89, 0x0b, 0x85, 0x15, 0x56, 0xab, 0x04, 0xc7, 0xd5, 0xe5, 0x9b, 0x1c,
+    0xaf, 0x2f, 0xc6, 0xed, 0x71, 0x3d, 0xc4, 0xc8, 0xac, 0xa4, 0x04, 0x7f,
+    0x3f, 0xdd, 0xed, 0xa7, 0xb5, 0x24, 0xae, 0x19, 0xe2, 0xed, 0x0a, 0x01,
+    0xf4, 0xe7, 0x3e, 0xc6, 0x53, 0x45, 0x5f, 0x9c, 0xdc, 0x24, 0x1c, 0x8a,
+    0xb9, 0x50, 0x31, 0x6c, 0x21, 0x3a, 0xea, 0xf4, 0xf1, 0xd5, 0xea, 0x56,
+    0xc7, 0xff, 0xe6, 0x2f, 0x29, 0x9e, 0xa3, 0xb3, 0xe2, 0x8a, 0x24, 0x5a,
+    0xb2, 0x54, 0x68, 0x15, 0x92, 0x4e, 0x7e, 0xb5, 0x70, 0x81, 0xaf, 0x9c,
+    0x31, 0x2f, 0x4a, 0x35, 0x09, 0xb8, 0x7a, 0xf6, 0xdd, 0xc6, 0x6d, 0x89,
+    0xb4, 0x56, 0x38, 0x73, 0xa2, 0x2f, 0x99, 0x44, 0x04, 0x44, 0x30, 0x23,
+    0x64, 0x2b, 0x58, 0xe0, 0xe1, 0xf5, 0x3c, 0x34, 0xc2, 0x33, 0x98, 0xdf,
+    0x21, 0x73, 0xc9, 0x10, 0x9f, 0x48, 0x79, 0xfe, 0xce, 0x2b, 0x90, 0xaf,
+    0xb5, 0x24, 0xc6, 0x4e, 0xbb, 0xbf, 0xac, 0x1f, 0x2f, 0x45, 0xa1, 0xc7,
+    0x9f, 0xfa, 0xc6, 0x17, 0x0d, 0x53, 0x85, 0x48, 0x02, 0xcc, 0x89, 0x33,
+    0x30, 0x71, 0x21, 0xf0, 0x56, 0x4a, 0xb4, 0x24, 0x5e, 0x43, 0xaf, 0x3f,
+    0x6a, 0x49, 0xa9, 0x2f, 0x63, 0xaa, 0xda, 0x3a, 0xf6, 0xc9, 0x3f, 0x9e,
+    0x26, 0x8a, 0xfa, 0x33, 0xc6, 0x91, 0x34, 0xde, 0x4d, 0xdb, 0x2a, 0x48,
+    0x52, 0x11, 0xb8, 0x89, 0x1d, 0xbc, 0x30, 0x0b, 0x74, 0x88, 0x07, 0xc7,
+    0x63, 0xf5, 0xed, 0x6c, 0xd2, 0x23, 0xba, 0x5b, 0x24, 0xff, 0xb6, 0x83,
+    0xfe, 0x54, 0x12, 0x62, 0x48, 0x5c, 0x73, 0xaf, 0x19, 0x12, 0x37, 0xd0,
+    0xfd, 0x4d, 0xa5, 0x86, 0x8f, 0xc5, 0x89, 0x1b, 0x5f, 0x1d, 0x1c, 0x90,
+    0xa9, 0x05, 0x9c, 0x1b, 0x77, 0x9d, 0xd6, 0xb7, 0x56, 0x65, 0x55, 0x82,
+    0x1f, 0x7e, 0x9e, 0x35, 0x8d, 0x67, 0x44, 0x7a, 0x37, 0xdc, 0x44, 0x45,
+    0x61, 0xb8, 0x15, 0xc0, 0x25, 0xb8, 0x59, 0x0a, 0x88, 0x60, 0x46, 0xc8,
+    0x56, 0x7c, 0x16, 0xbd, 0xb4, 0x64, 0x20, 0x6a, 0xac, 0x5e, 0x79, 0x9e,
+    0xe8, 0x3e, 0x85, 0xd3, 0xc7, 0x57, 0xab, 0xf1, 0xf0, 0x68, 0xb5, 0x7f,
+    0x72, 0xbe, 0x5b, 0x8d, 0x17, 0xa7, 0x43, 0x2e, 0x46, 0x08, 0x8e, 0x59,
+    0xec, 0x0a, 0x73, 0x21, 0x28, 0x8c, 0xa9, 0xc2, 0xc7, 0xab, 0x9b, 0xc5,
+    0x98, 0x61, 0x61, 0x36, 0x25, 0x0c, 0xbc, 0x91, 0xb1, 0x82, 0x65, 0x44,
+    0xe8, 0xb6, 0xd3, 0xe5, 0xf2, 0x87, 0xb1, 0x1d, 0x81, 0x8c, 0xb3, 0x56,
+    0xc6, 0x5e, 0x23, 0x06, 0x68, 0x94, 0x19, 0x88, 0x8b, 0x26, 0x08, 0x4e,
+    0xcc, 0x37, 0x95, 0x09, 0x0b, 0x6c, 0x56, 0x97, 0xfb, 0x2e, 0xb3, 0x48,
+    0x12, 0xc0, 0x20, 0xfd, 0x6a, 0x39, 0xb3, 0x40, 0xd4, 0x09, 0x92, 0xc8,
+    0x82, 0x91, 0x8b, 0x51, 0x77, 0x5f, 0xec, 0x0a, 0x73, 0x21, 0x28, 0x8c,
+    0xa9, 0x42, 0x13, 0xec, 0x35, 0xc2, 0xe3, 0x10, 0x26, 0x39, 0x09, 0x71,
+    0x4f, 0x29, 0xc6, 0xdc, 0xed, 0xe6, 0xb1, 0xe7, 0x99, 0x7e, 0x8a, 0x8b,
+    0x45, 0x52, 0x0e, 0xd3, 0x49, 0x35, 0x02, 0x06, 0x36, 0x34, 0xbc, 0x61,
+    0xdf, 0xce, 0x26, 0x73, 0x83, 0xc3, 0xf8, 0xcd, 0xe7, 0x8b, 0xd4, 0xdb,
+    0x2f, 0x1c, 0x37, 0x76, 0xaa, 0xbb, 0xf8, 0xc4, 0x5f, 0xb7, 0x04, 0xc3,
+    0x2e, 0xac, 0x17, 0x3a, 0xf3, 0x44, 0x9d, 0x15, 0x1f, 0x4e, 0xa5, 0x14,
+    0xa8, 0xda, 0x8a, 0x2f, 0x48, 0x25, 0x25, 0xf8, 0xdb, 0x8d, 0x02, 0x2b,
+    0x89, 0x6b, 0x86, 0x78, 0x47, 0xa1, 0x1e, 0xbc, 0x1d, 0xfb, 0x5b, 0xda,
+    0xb1, 0x38, 0x71, 0xd3, 0x2b, 0xdf, 0x17, 0x73, 0xa1, 0x62, 0xc8, 0x19,
+    0x3a, 0xea, 0x34, 0x60, 0xbf, 0x45, 0x38, 0x4e, 0x86, 0x36, 0xad, 0x34,
+    0xa3, 0x1a, 0xbc, 0x5a, 0x44, 0x0a, 0x97, 0xf6, 0xc8, 0xc5, 0x08, 0xc1,
+    0x35, 0x3f, 0x3e, 0x68, 0xca, 0x77, 0x97, 0xe3, 0xa7, 0xa4, 0x6a, 0x09,
+    0x98, 0x53, 0x2b, 0xc2, 0xc4, 0x85, 0xc0, 0x0b, 0x2e, 0xc1, 0xd7, 0xfa,
+    0x5d, 0xc9, 0xd5, 0x99, 0x44, 0x04, 0x44, 0x30, 0x23, 0x64, 0xe7, 0x44,
+    0x71, 0x22, 0xad, 0x15, 0xce, 0x96, 0xc0, 0x88, 0x68, 0x64, 0xac, 0xe1,
+    0x31, 0xce, 0x35, 0xe3, 0x83, 0x35, 0x33, 0x42, 0xbc, 0xc7, 0xed, 0x71,
+    0x7d, 0x7b, 0x7b, 0xfd, 0x51, 0x13, 0xcd, 0xcd, 0xa0, 0x10, 0xa5, 0x04,
+    0x96, 0x72, 0xb3, 0xbf, 0x70, 0x68, 0x2e, 0x59, 0x18, 0xe0, 0xd5, 0x22,
+    0x7a, 0x90, 0xdb, 0x23, 0x17, 0x23, 0x04, 0x0f, 0xf5, 0x76, 0xd0, 0x62,
+    0xe3, 0x59, 0x17, 0x53, 0x57, 0xf9, 0xf2, 0x8f, 0x9e, 0x2f, 0x12, 0x38,
+    0x52, 0x48, 0x13, 0xc3, 0x66, 0x75, 0xd9, 0xf6, 0xf7, 0x34, 0xb7, 0x8c,
+    0x08, 0x9d, 0x35, 0x5d, 0xab, 0xcb, 0x67, 0x9d, 0xdc, 0x7b, 0xfa, 0x60,
+    0x3d, 0x34, 0x6c, 0x63, 0xec, 0x4c, 0x0c, 0xeb, 0xc4, 0x79, 0xf1, 0x3c,
+    0xbc, 0xfa, 0xf7, 0x86, 0xba, 0xef, 0xdc, 0xb9, 0xe6, 0x89, 0xa7, 0xb8,
+    0xf2, 0x7d, 0x31, 0x8f, 0x5c, 0x0c, 0x39, 0x4f, 0x62, 0xcb, 0xae, 0xc3,
+    0x91, 0xb9, 0xd9, 0x42, 0x98, 0x38, 0xa3, 0x85, 0xa8, 0x2d, 0xb2, 0x0b,
+    0x76, 0xde, 0xb5, 0x6a, 0xd8, 0x3d, 0xc0, 0x5a, 0x09, 0x50, 0x8a, 0x65,
+    0x88, 0xc9, 0xc6, 0x3d, 0x83, 0xcf, 0x1d, 0x7f, 0x18, 0xe7, 0xc5, 0x5c,
+    0xd5, 0x33, 0x51, 0x66, 0x53, 0x28, 0x52, 0x31, 0xc1, 0xd7, 0x1d, 0x5b,
+    0x8c, 0x10, 0x1c, 0xb2, 0x48, 0x17, 0x22, 0xed, 0x91, 0x97, 0xa0, 0x6e,
+    0x10, 0x1a, 0xe1, 0x2e, 0x02, 0x22, 0x31, 0x37, 0x2d, 0x59, 0x2a, 0x94,
+    0x94, 0x92, 0xc2, 0x31, 0xa7, 0x8a, 0x04, 0x94, 0x44, 0x0d, 0x22, 0x6e,
+    0xe7, 0x45, 0xbe, 0xb7, 0xf8, 0x4a, 0xc2, 0xcc, 0xf0, 0xa6, 0xd1, 0xb3,
+    0xde, 0x61, 0x8a, 0x9d, 0xb0, 0x18, 0xe4, 0xa4, 0x56, 0xe1, 0x61, 0x9f,
+    0x05, 0xef, 0x30, 0xa8, 0xd6, 0xaa, 0xfc, 0x2f, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0x8c, 0x8f, 0xbd, 0x8e, 0x5c, 0x59, 0x15, 0x85, 0x13, 0x47, 0x3b,
+    0x64, 0x52, 0x90, 0x6a, 0x10, 0x22, 0x30, 0x41, 0x9f, 0xfd, 0x7f, 0x36,
+    0x83, 0x84, 0x90, 0x1d, 0x21, 0x4d, 0x64, 0x09, 0x21, 0x99, 0x80, 0xdb,
+    0xaa, 0x6e, 0x5c, 0xa8, 0x9a, 0xb2, 0xaa, 0x5b, 0x25, 0xde, 0x00, 0x07,
+    0xbc, 0x02, 0x96, 0xb3, 0x11, 0x0f, 0x40, 0x80, 0xfc, 0x0a, 0x13, 0x39,
+    0x04, 0x91, 0x4c, 0x36, 0x12, 0x0f, 0x00, 0x13, 0x71, 0xea, 0xec, 0x73,
+    0xdb, 0x55, 0xbe, 0xdd, 0x12, 0xc9, 0xfd, 0xd9, 0x7b, 0xed, 0xb5, 0xbe,
+    0x65, 0xc6, 0xf0, 0xc7, 0x77, 0x19, 0x11, 0x6a, 0x6a, 0xb0, 0x3a, 0x83,
+    0xee, 0x75, 0x84, 0xb5, 0x63, 0x23, 0x21, 0x50, 0x78, 0x9f, 0xf5, 0x18,
+    0x6b, 0x0d, 0x80, 0xb9, 0x5d, 0x65, 0xb9, 0x8f, 0x11, 0x67, 0xec, 0xa7,
+    0x48, 0xaa, 0xa1, 0x01, 0xef, 0x66, 0x40, 0x23, 0x37, 0x18, 0x8d, 0xee,
+    0x3e, 0x36, 0x5e, 0xb4, 0xd5, 0x4a, 0x54, 0x40, 0x58, 0x02, 0x41, 0x82,
+    0x58, 0x61, 0x21, 0xf9, 0xe4, 0x37, 0x6b, 0x68, 0x41, 0x12, 0x18, 0xbe,
+    0x9d, 0xe3, 0x14, 0xc6, 0x0b, 0x7a, 0x00, 0x15, 0x8b, 0x0a, 0x4f, 0x3f,
+    0xc2, 0xcf, 0xeb, 0x5e, 0x54, 0x58, 0x55, 0x41, 0x15, 0x09, 0x81, 0xfa,
+    0xf1, 0xf5, 0xb4, 0x6d, 0x73, 0x66, 0xab, 0x15, 0x5e, 0x3e, 0x22, 0x0c,
+    0x47, 0x87, 0xa7, 0x7d, 0xfe, 0x9a, 0x2a, 0x1a, 0x41, 0x5e, 0x1d, 0xa6,
+    0x6d, 0x73, 0x78, 0x80, 0xfe, 0xff, 0x7e, 0x69, 0xa9, 0x51, 0x40, 0xa4,
+    0x08, 0x81, 0xb0, 0xf4, 0x88, 0xf5, 0x7e, 0x73, 0x18, 0xcd, 0xfe, 0x9e,
+    0xdf, 0x12, 0x54, 0x15, 0x5a, 0x97, 0xdd, 0xdd, 0xea, 0x31, 0x56, 0x26,
+    0x85, 0x4a, 0x1e, 0x06, 0x7d, 0x96, 0x62, 0xa4, 0xd2, 0xa4, 0x6a, 0x6a,
+    0xb0, 0xda, 0x7f, 0x73, 0xd8, 0xf4, 0x9b, 0xca, 0xa8, 0x29, 0xca, 0x76,
+    0x54, 0x18, 0xe1, 0x4d, 0x70, 0x09, 0x06, 0xab, 0x41, 0x05, 0xde, 0x98,
+    0x98, 0x30, 0x74, 0x84, 0x6f, 0xd3, 0x49, 0xc3, 0xcc, 0x80, 0xc5, 0x1c,
+    0xf3, 0xf6, 0x77, 0x7d, 0xbb, 0x0a, 0x42, 0x31, 0xd8, 0x85, 0x06, 0x56,
+    0x18, 0x01, 0xef, 0xdf, 0x1e, 0xb1, 0xd9, 0x34, 0x08, 0xaa, 0x9a, 0x13,
+    0xcc, 0x9b, 0xf1, 0xea, 0xa7, 0xe9, 0x6b, 0xad, 0x8b, 0x66, 0xd2, 0xf5,
+    0xb4, 0x6d, 0xbe, 0x68, 0xe1, 0x0e, 0xfb, 0xbb, 0xe7, 0xd3, 0xed, 0xab,
+    0xcb, 0xdd, 0xb4, 0x5f, 0x5f, 0xac, 0xda, 0xeb, 0x30, 0x6d, 0x9b, 0xa2,
+    0x07, 0x0f, 0x8f, 0xa6, 0x0a, 0x04, 0x73, 0xab, 0x3c, 0xbb, 0xff, 0x13,
+    0xc9, 0x30, 0xe0, 0x4b, 0x33, 0x2f, 0xb5, 0x25, 0x6b, 0xab, 0xf2, 0x8f,
+    0x81, 0xcf, 0xd2, 0x4a, 0x8e, 0x04, 0x0a, 0x73, 0x38, 0xfa, 0x89, 0x6a,
+    0xa1, 0xac, 0x33, 0xdb, 0xa6, 0x24, 0x8f, 0x8e, 0x2d, 0xae, 0x12, 0x76,
+    0x6c, 0x4f, 0x26, 0xf9, 0x99, 0x5c, 0x77, 0xfb, 0x5f, 0xfd, 0xe2, 0xe2,
+    0xc5, 0xcd, 0x74, 0x46, 0xbd, 0x79, 0x66, 0x52, 0xb1, 0x40, 0x7a, 0xa5,
+    0xef, 0x57, 0x55, 0x90, 0x6b, 0xd6, 0xfd, 0x5b, 0xde, 0xa6, 0xcf, 0xbb,
+    0x7c, 0xfd, 0x47, 0xb9, 0x60, 0x85, 0x85, 0x17, 0x79, 0x61, 0xf8, 0x51,
+    0x03, 0x48, 0xb3, 0x41, 0xd3, 0xc1, 0x85, 0x55, 0x15, 0x54, 0x91, 0x10,
+    0xa8, 0x1b, 0x67, 0x14, 0xb3, 0xd5, 0x0a, 0x2f, 0x6f, 0x7f, 0xbb, 0x30,
+    0x3b, 0x6b, 0x3a, 0x77, 0x1d, 0xc6, 0x1d, 0xe9, 0x2f, 0xf9, 0x12, 0xd5,
+    0x42, 0xd0, 0x43, 0xc6, 0x49, 0xc8, 0x91, 0xe3, 0xf4, 0x20, 0xb1, 0xbb,
+    0xa6, 0x56, 0xf4, 0x0a, 0xbf, 0x3f, 0x09, 0xda, 0x3c, 0x33, 0xa9, 0x58,
+    0xc6, 0x41, 0xe6, 0x7d, 0x35, 0xac, 0x46, 0x84, 0xb9, 0x94, 0x8c, 0xe8,
+    0xe8, 0x14, 0xe6, 0x80, 0x8e, 0x8d, 0xdc, 0x48, 0x85, 0xa1, 0x11, 0x18,
+    0xc1, 0x2c, 0x7f, 0xd2, 0x2d, 0x6e, 0xba, 0xd4, 0xa3, 0x9f, 0x79, 0xa0,
+    0x10, 0x0c, 0xd3, 0x45, 0xd5, 0xd6, 0x48, 0x24, 0x08, 0xe1, 0x84, 0x93,
+    0xb0, 0x41, 0x41, 0x1a, 0x8e, 0xbb, 0xa3, 0xeb, 0xbe, 0x9a, 0x34, 0xfe,
+    0xae, 0x23, 0x6f, 0xe1, 0x00, 0x1f, 0x16, 0x7e, 0xa3, 0xf4, 0x45, 0x53,
+    0x04, 0x63, 0x82, 0x3f, 0x2e, 0x3a, 0xdd, 0x64, 0xde, 0x23, 0xda, 0x5e,
+    0xa8, 0x9b, 0xb1, 0xa9, 0x23, 0x7c, 0x4a, 0x60, 0x55, 0x89, 0x41, 0x14,
+    0x5b, 0x93, 0xeb, 0xe9, 0x48, 0x9b, 0x76, 0x86, 0xa5, 0x21, 0x23, 0xb2,
+    0xd9, 0x28, 0xf4, 0x2c, 0x5f, 0xa8, 0x8c, 0x02, 0x11, 0x46, 0x0a, 0x3f,
+    0x27, 0x67, 0xf3, 0x64, 0x8d, 0xbb, 0xb9, 0x72, 0xea, 0x9e, 0x74, 0xb3,
+    0x9b, 0x9e, 0xef, 0x71, 0x94, 0x74, 0x19, 0x29, 0xa1, 0x01, 0xb9, 0xb2,
+    0xc3, 0x67, 0xa9, 0xcc, 0xd8, 0xc4, 0xbd, 0x1c, 0x1e, 0xa7, 0x28, 0xae,
+    0xaa, 0x0c, 0xb3, 0x79, 0xbe, 0x52, 0x3d, 0xf6, 0x1c, 0x95, 0xe0, 0x2c,
+    0x9c, 0xad, 0x16, 0x02, 0x0b, 0xd4, 0x02, 0x86, 0x90, 0xea, 0x8e, 0x92,
+    0xad, 0x9f, 0x4f, 0xb7, 0xaf, 0x2e, 0x77, 0xd3, 0x7e, 0x7d, 0xb1, 0xfa,
+    0x99, 0x9a, 0x36, 0xc9, 0x62, 0x7e, 0x06, 0xd2, 0xf1, 0xfa, 0x3d, 0x15,
+    0x2a, 0x36, 0x0c, 0xd7, 0xfb, 0xcd, 0xe1, 0xb8, 0xeb, 0xc5, 0x32, 0x38,
+    0x47, 0x9b, 0x7c, 0x8d, 0x9f, 0xe6, 0xd2, 0x77, 0xfd, 0xfe, 0x76, 0x90,
+    0x9f, 0xd2, 0x3e, 0xe9, 0x19, 0x37, 0x7d, 0xef, 0xd1, 0xdd, 0x3c, 0x50,
+    0xee, 0x3b, 0x5d, 0xbc, 0x70, 0x0d, 0x84, 0x28, 0xa2, 0xad, 0x14, 0x90,
+    0x2b, 0x3b, 0x7c, 0x96, 0xb7, 0xc9, 0x97, 0xa6, 0x97, 0x67, 0xcc, 0xb9,
+    0x77, 0x55, 0xe5, 0xd9, 0x68, 0xbc, 0x06, 0x42, 0xee, 0x39, 0x6a, 0x0f,
+    0xea, 0xe9, 0x49, 0x2c, 0xc5, 0x8c, 0xe1, 0x87, 0x69, 0xf3, 0x6b, 0xe1,
+    0x8a, 0x08, 0x7d, 0xad, 0xa2, 0x2a, 0x20, 0x42, 0xb5, 0x42, 0x9a, 0xe4,
+    0xf3, 0xcf, 0xc8, 0x4e, 0x02, 0xdf, 0xe5, 0x79, 0x23, 0x57, 0x03, 0xd5,
+    0x2a, 0xf7, 0xc1, 0xb5, 0x9f, 0x4b, 0x95, 0x8a, 0x70, 0xf1, 0xe2, 0x66,
+    0xda, 0xdf, 0x3d, 0x9f, 0x6e, 0x5f, 0x5d, 0xee, 0xa6, 0xfd, 0xfa, 0x62,
+    0x80, 0x50, 0x84, 0x21, 0xb8, 0x22, 0x19, 0xe4, 0x04, 0xeb, 0x7c, 0xfe,
+    0xfe, 0x6d, 0x3a, 0xb3, 0x5a, 0x54, 0xd0, 0x62, 0xaa, 0x27, 0x36, 0x5f,
+    0x7c, 0x9e, 0xfa, 0xd7, 0xbb, 0xdb, 0xb9, 0x81, 0x21, 0x06, 0x0e, 0xc4,
+    0x9c, 0xfc, 0x89, 0xac, 0x88, 0x41, 0xd7, 0x60, 0x48, 0x14, 0xb8, 0xcf,
+    0xd7, 0x4a, 0x54, 0x40, 0x58, 0xda, 0x89, 0x04, 0xb1, 0x2e, 0x11, 0xef,
+    0x7f, 0xff, 0xea, 0x52, 0x43, 0xd3, 0x26, 0x57, 0x23, 0xe4, 0x62, 0x45,
+    0x1e, 0x8c, 0xb9, 0x99, 0xef, 0x0f, 0x9b, 0x50, 0x6f, 0xc4, 0xd7, 0xd3,
+    0xb6, 0x4d, 0xdd, 0xb1, 0x56, 0xf8, 0x69, 0x72, 0x0a, 0x6b, 0x2b, 0xa1,
+    0xad, 0x2e, 0x02, 0xdd, 0xed, 0x1b, 0x7e, 0x8a, 0x98, 0xad, 0xa6, 0xe5,
+    0x02, 0xe2, 0xf8, 0x91, 0x4d, 0x17, 0xab, 0xbc, 0xe8, 0x36, 0xdd, 0x9d,
+    0x4d, 0x1d, 0xe1, 0xaa, 0x31, 0x91, 0x0a, 0xc0, 0x87, 0x3c, 0xb0, 0x6a,
+    0x6e, 0x1c, 0xb0, 0x5a, 0x46, 0x56, 0x78, 0x79, 0xbb, 0xd9, 0xfd, 0xe1,
+    0x01, 0xb6, 0x70, 0x74, 0x78, 0x7a, 0x56, 0xeb, 0x3e, 0xf6, 0xfb, 0x7d,
+    0xfc, 0x03, 0x32, 0x56, 0x82, 0xc5, 0x56, 0x8a, 0xb2, 0xc2, 0x61, 0xd3,
+    0x8d, 0x7f, 0xf2, 0xcb, 0x60, 0x0f, 0x87, 0x7f, 0x13, 0x4b, 0x89, 0xa5,
+    0x98, 0x29, 0x8c, 0x20, 0x7b, 0x2c, 0x97, 0xee, 0x75, 0x5e, 0x22, 0x95,
+    0x46, 0xab, 0xa6, 0x06, 0xab, 0xfd, 0x37, 0xc3, 0xbd, 0x32, 0x2a, 0x74,
+    0x98, 0x84, 0xa6, 0xc2, 0x08, 0x6f, 0x82, 0x4b, 0x30, 0x58, 0x0d, 0x2a,
+    0xf0, 0xc6, 0xc4, 0x84, 0xa1, 0xd7, 0xfe, 0x36, 0x9d, 0x34, 0xcc, 0xbe,
+    0x7c, 0xf2, 0x20, 0x78, 0x97, 0x3d, 0xfb, 0x5a, 0x1b, 0x15, 0xa6, 0xaf,
+    0x29, 0x89, 0x00, 0x87, 0xbb, 0xc1, 0x7f, 0xaf, 0xa7, 0x6d, 0x1b, 0xed,
+    0xff, 0xd5, 0x37, 0x5d, 0x4b, 0x78, 0xc4, 0xef, 0x9f, 0xe9, 0x71, 0xf9,
+    0xf0, 0x2b, 0x2f, 0xbf, 0x33, 0x2f, 0x82, 0x90, 0x3f, 0xdd, 0x64, 0xc1,
+    0xd0, 0x1f, 0x5f, 0xb7, 0x92, 0xeb, 0xc5, 0x2a, 0xe9, 0xe7, 0xe6, 0x66,
+    0x45, 0xa1, 0x7f, 0x8e, 0xc9, 0x58, 0x4f, 0xdb, 0xc6, 0xe2, 0x1c, 0x95,
+    0x60, 0x2c, 0x72, 0xc4, 0x56, 0x0b, 0x81, 0x05, 0x6a, 0x01, 0x43, 0x48,
+    0x75, 0x07, 0x3f, 0x0d, 0x72, 0x26, 0xcd, 0xe2, 0xeb, 0xfd, 0xe6, 0x70,
+    0xb5, 0xd2, 0x08, 0x61, 0x90, 0x22, 0x2c, 0x60, 0x15, 0x1d, 0x46, 0x8c,
+    0x16, 0x24, 0xb9, 0x0f, 0xc8, 0xd7, 0x02, 0xd8, 0x59, 0x8a, 0x83, 0x29,
+    0xa2, 0x41, 0x4f, 0x72, 0x42, 0x13, 0xb8, 0x9e, 0xb6, 0xcd, 0x5f, 0x85,
+    0x66, 0x8a, 0x9e, 0x97, 0xd3, 0x60, 0xad, 0x2d, 0x29, 0x4a, 0x78, 0x9e,
+    0xf4, 0xdd, 0xc2, 0x39, 0xef, 0xda, 0x07, 0x79, 0x30, 0xc2, 0x99, 0x28,
+    0x77, 0x83, 0x69, 0xbd, 0x77, 0x46, 0xb1, 0x99, 0x74, 0xd1, 0xb7, 0xbb,
+    0x65, 0xb4, 0x73, 0x10, 0x81, 0x31, 0x21, 0x03, 0xac, 0xf7, 0x9b, 0x43,
+    0x44, 0x71, 0x85, 0xdf, 0x04, 0x86, 0x11, 0xb8, 0xb4, 0x24, 0x90, 0x4a,
+    0x7d, 0x75, 0xb5, 0xca, 0xe7, 0x09, 0xff, 0x61, 0xda, 0x36, 0x6f, 0x71,
+    0x22, 0x1f, 0x12, 0x13, 0xaa, 0x20, 0x4c, 0xec, 0xf0, 0x31, 0x74, 0x80,
+    0x2c, 0x18, 0xfa, 0x53, 0x4b, 0x8d, 0x02, 0x22, 0x45, 0xa8, 0x1d, 0x8a,
+    0x33, 0xcc, 0xc0, 0xbd, 0x52, 0x4f, 0xb8, 0x5a, 0x05, 0x1d, 0x1b, 0xed,
+    0x42, 0x03, 0xeb, 0x5c, 0xec, 0xfd, 0xdb, 0xcc, 0x64, 0xb5, 0xa8, 0xa0,
+    0xc5, 0x54, 0x61, 0x91, 0x71, 0xa9, 0x6a, 0xa4, 0x90, 0x75, 0x6b, 0x78,
+    0x2b, 0xba, 0x9a, 0x57, 0xe7, 0xaf, 0x34, 0xab, 0x55, 0xb5, 0xc0, 0xe3,
+    0xb6, 0x5f, 0x7c, 0x9e, 0x48, 0xaf, 0x17, 0x5c, 0x8b, 0xe8, 0xde, 0x23,
+    0x5d, 0x33, 0xbe, 0x0f, 0xf0, 0x88, 0x9f, 0xd3, 0xd1, 0x23, 0x7f, 0x4e,
+    0xd4, 0xa7, 0xcf, 0x4c, 0xdb, 0xef, 0x2e, 0x77, 0x77, 0xc3, 0xe5, 0xf5,
+    0xae, 0x3d, 0x16, 0x61, 0xa9, 0xfb, 0xf1, 0xb0, 0xac, 0xc4, 0x1c, 0xa0,
+    0x5c, 0xdd, 0x20, 0x6f, 0xbf, 0x87, 0xb5, 0x32, 0xa0, 0x7a, 0xd0, 0x71,
+    0x92, 0xc3, 0xf9, 0xf8, 0x13, 0xaf, 0x5c, 0x6a, 0x41, 0x12, 0x18, 0x86,
+    0x9d, 0xae, 0x3f, 0xc6, 0xc0, 0x0b, 0x7a, 0x00, 0x15, 0x8b, 0x0a, 0x4f,
+    0xc7, 0xac, 0xdd, 0xe5, 0x5a, 0xd8, 0x5a, 0xbc, 0x79, 0x08, 0x90, 0x93,
+    0x0a, 0xc0, 0x87, 0x05, 0x70, 0x86, 0xb4, 0x0f, 0xf2, 0x60, 0x84, 0x87,
+    0x5b, 0xdd, 0x8b, 0xce, 0x36, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff};
+
+inline const ZlibVector kZlibVectors[] = {
+    {"Stored", 1, 1500, kStoredChunks, kStoredCompressed, kStoredData, false},
+    {"Fixed", 2, 6000, kFixedChunks, kFixedCompressed, kFixedData, false},
+    {"Dynamic", 3, 16000, kDynamicChunks, kDynamicCompressed, kDynamicData,
+     false},
+    {"DynamicFast", 4, 8000, kDynamicFastChunks, kDynamicFastCompressed,
+     kDynamicFastData, true},
+    {"HuffmanOnly", 5, 3000, kHuffmanOnlyChunks, kHuffmanOnlyCompressed,
+     kHuffmanOnlyData, false},
+    {"Rle", 6, 3000, kRleChunks, kRleCompressed, kRleData, false},
+    {"SmallWindow", 7, 8000, kSmallWindowChunks, kSmallWindowCompressed,
+     kSmallWindowData, false},
+};
+
+}  // namespace wpi::detail
@@ -4,6 +4,7 @@
 
 #include "wpinet/WebSocketServer.h"  // NOLINT(build/include_order)
 
+#include <string>
 #include <vector>
 
 #include <wpi/SmallString.h>
@@ -200,4 +201,105 @@ TEST_F(WebSocketIntegrationTest, ServerSendPing) {
   ASSERT_EQ(gotData, 2);
 }
 
+TEST_F(WebSocketIntegrationTest, Deflate) {
+  std::string big;
+  for (int i = 0; i < 200; ++i) {
+    big += "{\"topic\":\"/SmartDashboard/value\",\"value\":";
+    big += std::to_string(i);
+    big += "}";
+  }
+  std::vector<std::string> expected{big, big, "short", "hello world"};
+  std::vector<std::string> serverGot;
+  std::vector<std::string> clientGot;
+
+  serverPipe->Listen([&]() {
+    auto conn = serverPipe->Accept();
+    WebSocketServer::ServerOptions options;
+    options.deflate.enable = true;
+    auto server = WebSocketServer::Create(*conn, {}, options);
+    server->connected.connect([&](std::string_view, WebSocket& ws) {
+      ASSERT_TRUE(ws.IsDeflateEnabled());
+      ws.text.connect([&](std::string_view data, bool) {
+        serverGot.emplace_back(data);
+        // echo back
+        ws.SendText({uv::Buffer::Dup(data)}, [](auto bufs, uv::Error) {
+          for (auto&& buf : bufs) {
+            buf.Deallocate();
+          }
+        });
+      });
+    });
+  });
+
+  clientPipe->Connect(pipeName, [&] {
+    WebSocket::ClientOptions options;
+    options.deflate.enable = true;
+    auto ws =
+        WebSocket::CreateClient(*clientPipe, "/test", pipeName, {}, options);
+    ws->closed.connect([&](uint16_t code, std::string_view reason) {
+      Finish();
+      if (code != 1005 && code != 1006) {
+        FAIL() << "Code: " << code << " Reason: " << reason;
+      }
+    });
+    ws->open.connect([&, s = ws.get()](std::string_view) {
+      ASSERT_TRUE(s->IsDeflateEnabled());
+      s->SendText({{big}}, [&](auto, uv::Error) {});
+      s->SendText({{big}}, [&](auto, uv::Error) {});
+      s->SendText({{"short"}}, [&](auto, uv::Error) {});
+      s->SendTextFragment({{"hello "}}, [&](auto, uv::Error) {});
+      s->SendFragment({{"world"}}, true, [&](auto, uv::Error) {});
+    });
+    ws->text.connect([&, s = ws.get()](std::string_view data, bool) {
+      clientGot.emplace_back(data);
+      if (clientGot.size() == expected.size()) {
+        s->Close();
+      }
+    });
+  });
+
+  loop->Run();
+
+  ASSERT_EQ(serverGot, expected);
+  ASSERT_EQ(clientGot, expected);
+}
+
+TEST_F(WebSocketIntegrationTest, DeflateNotEnabledOnServer) {
+  int gotData = 0;
+
+  serverPipe->Listen([&]() {
+    auto conn = serverPipe->Accept();
+    auto server = WebSocketServer::Create(*conn);
+    server->connected.connect([&](std::string_view, WebSocket& ws) {
+      ASSERT_FALSE(ws.IsDeflateEnabled());
+      ws.text.connect([&](std::string_view data, bool) {
+        ++gotData;
+        ASSERT_EQ(data, "hello");
+      });
+    });
+  });
+
+  clientPipe->Connect(pipeName, [&] {
+    WebSocket::ClientOptions options;
+    options.deflate.enable = true;
+    auto ws =
+        WebSocket::CreateClient(*clientPipe, "/test", pipeName, {}, options);
+    ws->closed.connect([&](uint16_t code, std::string_view reason) {
+      Finish();
+      if (code != 1005 && code != 1006) {
+        FAIL() << "Code: " << code << " Reason: " << reason;
+      }
+    });
+    ws->open.connect([&, s = ws.get()](std::string_view) {
+      ASSERT_FALSE(s->IsDeflateEnabled());
+      s->SendText({{"hello"}}, [&](auto, uv::Error) {});
+      s->Close();
+    });
+  });
+
+  loop->Run();
+
+  ASSERT_EQ(gotData, 1);
+}
+
 }  // namespace wpi
@@ -420,4 +420,28 @@ TEST_F(WebSocketTrySendTest, Big) {
   ASSERT_EQ(callbackCalled, 0);
 }
 
+TEST(WebSocketMaskTest, MatchesBytewise) {
+  const uint8_t key[4] = {0x12, 0x34, 0x56, 0x78};
+  std::vector<uint8_t> src(100);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = i * 7;
+  }
+  // cover every vector/word/tail split and key phase
+  for (size_t len = 0; len <= 40; ++len) {
+    for (size_t offset = 0; offset < 4; ++offset) {
+      std::vector<uint8_t> expected(len);
+      for (size_t i = 0; i < len; ++i) {
+        expected[i] = src[i + 1] ^ key[(offset + i) & 3];
+      }
+      std::vector<uint8_t> out(len);
+      MaskPayload(out.data(), src.data() + 1, len, key, offset);
+      ASSERT_EQ(out, expected) << "len " << len << " offset " << offset;
+      // in place
+      std::vector<uint8_t> inplace(src.begin() + 1, src.begin() + 1 + len);
+      MaskPayload(inplace.data(), inplace.data(), len, key, offset);
+      ASSERT_EQ(inplace, expected) << "len " << len << " offset " << offset;
+    }
+  }
+}
+
 }  // namespace wpi::detail
@@ -341,6 +341,20 @@ void DataLog::AppendRaw2(int entry,
   }
 }
 
+void DataLog::AppendRawBatch(std::span<const RawRecord> records) {
+  std::scoped_lock lock{m_mutex};
+  if (m_paused) {
+    [[unlikely]] return;
+  }
+  for (auto&& record : records) {
+    if (record.entry <= 0) {
+      continue;
+    }
+    StartRecord(record.entry, record.timestamp, record.data.size(), 0);
+    AppendImpl(record.data);
+  }
+}
+
 void DataLog::AppendBoolean(int entry, bool value, int64_t timestamp) {
   if (entry <= 0) {
     return;
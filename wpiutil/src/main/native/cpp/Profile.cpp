@@ -0,0 +1,270 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/Profile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "wpi/DataLog.h"
+#include "wpi/Endian.h"
+#include "wpi/json.h"
+#include "wpi/mutex.h"
+#include "wpi/raw_ostream.h"
+#include "wpi/timestamp.h"
+
+using namespace wpi::profile;
+
+// number of events per thread; must be a power of 2
+static constexpr uint64_t kBufferSize = 8192;
+
+namespace {
+
+// Single-producer ring buffer of events.  The owning thread writes slots
+// without locking; the collector validates what it read against the head
+// afterwards (like a seqlock), so events overwritten while being read are
+// discarded.  Slot fields are atomics only so these racing reads are not
+// undefined behavior; all accesses are relaxed.
+struct ThreadBuffer {
+  explicit ThreadBuffer(int index) : index{index} {}
+
+  struct Slot {
+    std::atomic<const Zone*> zone;
+    std::atomic<int64_t> start;
+    std::atomic<int64_t> end;
+  };
+
+  int index;
+  std::unique_ptr<Slot[]> slots{new Slot[kBufferSize]};
+  std::atomic<uint64_t> head{0};
+  std::atomic<bool> exited{false};
+  // only accessed by the collector
+  uint64_t tail = 0;
+};
+
+struct ThreadBufferHolder {
+  ~ThreadBufferHolder() {
+    if (buf) {
+      buf->exited = true;
+    }
+  }
+
+  std::shared_ptr<ThreadBuffer> buf;
+  // set before the buffer is created
+  std::string name;
+};
+
+struct Registry {
+  wpi::mutex mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  // indexed by thread index; kept after threads exit
+  std::vector<std::string> names;
+};
+
+}  // namespace
+
+static std::atomic<bool> gEnabled{false};
+static thread_local ThreadBufferHolder gThreadBuffer;
+
+static Registry& GetRegistry() {
+  // intentionally leaked, as threads may record while exiting
+  static Registry* inst = new Registry;
+  return *inst;
+}
+
+static ThreadBuffer& GetThreadBuffer() {
+  if (!gThreadBuffer.buf) [[unlikely]] {
+    auto& registry = GetRegistry();
+    std::scoped_lock lock{registry.mutex};
+    gThreadBuffer.buf =
+        std::make_shared<ThreadBuffer>(static_cast<int>(registry.names.size()));
+    registry.buffers.emplace_back(gThreadBuffer.buf);
+    if (gThreadBuffer.name.empty()) {
+      registry.names.emplace_back(
+          fmt::format("Thread {}", gThreadBuffer.buf->index));
+    } else {
+      registry.names.emplace_back(std::move(gThreadBuffer.name));
+    }
+  }
+  return *gThreadBuffer.buf;
+}
+
+void wpi::profile::SetEnabled(bool enabled) {
+  gEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool wpi::profile::IsEnabled() {
+  return gEnabled.load(std::memory_order_relaxed);
+}
+
+int64_t wpi::profile::Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void wpi::profile::Record(const Zone* zone, int64_t start, int64_t end) {
+  auto& buf = GetThreadBuffer();
+  uint64_t pos = buf.head.load(std::memory_order_relaxed);
+  // order the previous head update before the slot writes, so a collector
+  // that reads any of them also sees that the slot is being reused
+  std::atomic_thread_fence(std::memory_order_release);
+  auto& slot = buf.slots[pos & (kBufferSize - 1)];
+  slot.zone.store(zone, std::memory_order_relaxed);
+  slot.start.store(start, std::memory_order_relaxed);
+  slot.end.store(end, std::memory_order_relaxed);
+  buf.head.store(pos + 1, std::memory_order_release);
+}
+
+void wpi::profile::SetThreadName(std::string_view name) {
+  // the buffer is only created once the thread records something
+  if (!gThreadBuffer.buf) {
+    gThreadBuffer.name = name;
+    return;
+  }
+  auto& registry = GetRegistry();
+  std::scoped_lock lock{registry.mutex};
+  registry.names[gThreadBuffer.buf->index] = name;
+}
+
+std::string wpi::profile::GetThreadName(int thread) {
+  auto& registry = GetRegistry();
+  std::scoped_lock lock{registry.mutex};
+  if (thread < 0 || static_cast<size_t>(thread) >= registry.names.size()) {
+    return {};
+  }
+  return registry.names[thread];
+}
+
+size_t wpi::profile::Collect(std::vector<Event>* events) {
+  auto& registry = GetRegistry();
+  std::scoped_lock lock{registry.mutex};
+  size_t lost = 0;
+  for (auto&& buf : registry.buffers) {
+    uint64_t head = buf->head.load(std::memory_order_acquire);
+    uint64_t begin = buf->tail;
+    if (head - begin > kBufferSize) {
+      lost += head - kBufferSize - begin;
+      begin = head - kBufferSize;
+    }
+    size_t first = events->size();
+    for (uint64_t pos = begin; pos != head; ++pos) {
+      auto& slot = buf->slots[pos & (kBufferSize - 1)];
+      events->push_back({slot.zone.load(std::memory_order_relaxed), buf->index,
+                         slot.start.load(std::memory_order_relaxed),
+                         slot.end.load(std::memory_order_relaxed)});
+    }
+    buf->tail = head;
+
+    // discard slots the owner may have started reusing while they were read
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t newHead = buf->head.load(std::memory_order_relaxed);
+    if (newHead + 1 > begin + kBufferSize) {
+      uint64_t overwritten =
+          std::min(newHead + 1 - kBufferSize - begin, head - begin);
+      events->erase(events->begin() + first,
+                    events->begin() + first + overwritten);
+      lost += overwritten;
+    }
+  }
+
+  // buffers of exited threads are no longer needed once emptied
+  std::erase_if(registry.buffers, [](auto&& buf) {
+    return buf->exited && buf->tail == buf->head.load();
+  });
+  return lost;
+}
+
+DataLogger::DataLogger(wpi::log::DataLog& log, std::string_view prefix)
+    : m_log{log}, m_prefix{prefix} {}
+
+void DataLogger::Append(std::span<const Event> events) {
+  if (events.empty()) {
+    return;
+  }
+  // data log timestamps use wpi::Now() (microseconds)
+  int64_t offset = static_cast<int64_t>(wpi::Now()) - Now() / 1000;
+
+  m_buf.resize(events.size() * 8);
+  std::vector<wpi::log::DataLog::RawRecord> records;
+  records.reserve(events.size());
+  uint8_t* data = m_buf.data();
+  for (auto&& event : events) {
+    auto [it, isNew] = m_entries.try_emplace(event.zone, 0);
+    if (isNew) {
+      it->second = m_log.Start(
+          fmt::format("{}{}", m_prefix, event.zone->name), "int64",
+          "{\"unit\":\"ns\"}");
+    }
+    wpi::support::endian::write64le(data, event.end - event.start);
+    records.push_back({it->second,
+                       {data, 8},
+                       std::max<int64_t>(event.start / 1000 + offset, 1)});
+    data += 8;
+  }
+  m_log.AppendRawBatch(records);
+}
+
+TraceWriter::TraceWriter(wpi::raw_ostream& os) : m_os{os} {}
+
+TraceWriter::TraceWriter(std::string_view filename, std::error_code& ec)
+    : m_ownedOs{std::make_unique<wpi::raw_fd_ostream>(filename, ec)},
+      m_os{*m_ownedOs} {}
+
+TraceWriter::~TraceWriter() {
+  if (m_first) {
+    m_os << "{\"traceEvents\":[";
+  }
+  m_os << "\n]}\n";
+  m_os.flush();
+}
+
+void TraceWriter::Append(std::span<const Event> events) {
+  wpi::json::serializer s{m_os, ' ', 0};
+  auto next = [&] {
+    if (m_first) {
+      m_os << "{\"traceEvents\":[\n";
+      m_first = false;
+    } else {
+      m_os << ",\n";
+    }
+  };
+  for (auto&& event : events) {
+    if (static_cast<size_t>(event.thread) >= m_namedThreads.size()) {
+      m_namedThreads.resize(event.thread + 1);
+    }
+    if (!m_namedThreads[event.thread]) {
+      m_namedThreads[event.thread] = true;
+      next();
+      m_os << fmt::format(
+          "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+          "\"args\":{{\"name\":\"",
+          event.thread);
+      s.dump_escaped(GetThreadName(event.thread), false);
+      m_os << "\"}}";
+    }
+    next();
+    m_os << "{\"name\":\"";
+    s.dump_escaped(event.zone->name, false);
+    // timestamps are in microseconds; keep nanosecond resolution
+    int64_t dur = event.end - event.start;
+    m_os << fmt::format(
+        "\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{}.{:03},"
+        "\"dur\":{}.{:03}}}",
+        event.thread, event.start / 1000, event.start % 1000, dur / 1000,
+        dur % 1000);
+  }
+}
+
+void TraceWriter::Flush() {
+  m_os.flush();
+}
@@ -4,30 +4,55 @@
 
 #include "wpi/sendable/SendableRegistry.h"
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "wpi/DenseMap.h"
-#include "wpi/SmallVector.h"
+#include "wpi/Profile.h"
 #include "wpi/UidVector.h"
 #include "wpi/mutex.h"
 #include "wpi/sendable/Sendable.h"
 #include "wpi/sendable/SendableBuilder.h"
+#include "wpi/spinlock.h"
 
 using namespace wpi;
 
 namespace {
 struct Component {
   Sendable* sendable = nullptr;
-  std::unique_ptr<SendableBuilder> builder;
+  std::shared_ptr<SendableBuilder> builder;
   std::string name;
   std::string subsystem = "Ungrouped";
   Sendable* parent = nullptr;
   bool liveWindow = false;
-  wpi::SmallVector<std::shared_ptr<void>, 2> data;
+  // a deque, so references passed to ForeachLiveWindow() callbacks stay valid
+  // when data for other handles is added; the deque itself is protected by
+  // the registry mutex, and the elements by visitMutex
+  std::deque<std::shared_ptr<void>> data;
+
+  // Calls to the builder and sendable outside of the registry mutex are done
+  // through Visit() with visitMutex held, so only one thread at a time uses
+  // the builder and the data elements, and Remove() and Move() wait for a
+  // visit in progress on another thread.  Recursive so a callback can visit,
+  // remove or move its own component.
+  wpi::recursive_mutex visitMutex;
+  std::atomic<bool> removed{false};
+  std::atomic<bool> moving{false};
+  std::atomic<unsigned int> moveCount{0};
+
+  // must be called with the registry mutex held
+  std::shared_ptr<void>& GetData(int handle) {
+    if (static_cast<size_t>(handle) >= data.size()) {
+      data.resize(handle + 1);
+    }
+    return data[handle];
+  }
 
   void SetName(std::string_view moduleType, int channel) {
     name = fmt::format("{}[{}]", moduleType, channel);
@@ -38,31 +63,132 @@ struct Component {
   }
 };
 
+// Copy of the LiveWindow-enabled components, so ForeachLiveWindow() can
+// iterate without holding the registry mutex.  Rebuilt when the registry
+// version changes.
+struct LiveWindowSnapshot {
+  struct Entry {
+    std::shared_ptr<Component> comp;
+    unsigned int moveCount;
+    Sendable* sendable;
+    std::string name;
+    std::string subsystem;
+    Sendable* parent;
+    std::shared_ptr<SendableBuilder> builder;
+    std::shared_ptr<void>* data;
+  };
+
+  uint64_t version;
+  int dataHandle;
+  std::vector<Entry> entries;
+};
+
 struct SendableRegistryInst {
-  wpi::recursive_mutex mutex;
+  wpi::mutex mutex;
 
   std::function<std::unique_ptr<SendableBuilder>()> liveWindowFactory;
-  wpi::UidVector<std::unique_ptr<Component>, 32> components;
+  wpi::UidVector<std::shared_ptr<Component>, 32> components;
   wpi::DenseMap<void*, SendableRegistry::UID> componentMap;
   int nextDataHandle = 0;
 
+  // incremented (with mutex held) on changes that may affect the snapshot
+  std::atomic<uint64_t> version{0};
+  wpi::spinlock snapshotMutex;
+  std::shared_ptr<const LiveWindowSnapshot> snapshot;
+
   Component& GetOrAdd(void* sendable, SendableRegistry::UID* uid = nullptr);
+  Component* Find(const void* sendable);
+  std::shared_ptr<Component> FindShared(const void* sendable);
+  std::shared_ptr<Component> Get(SendableRegistry::UID uid);
+  void Changed() { version.fetch_add(1, std::memory_order_release); }
+  std::shared_ptr<const LiveWindowSnapshot> GetLiveWindowSnapshot(
+      int dataHandle);
 };
 }  // namespace
 
+// Calls func with the component's visit mutex held, unless the component has
+// been removed or moved since moveCount was read.
+template <typename F>
+static void Visit(Component& comp, unsigned int moveCount, F&& func) {
+  std::scoped_lock lock(comp.visitMutex);
+  if (comp.removed.load(std::memory_order_relaxed) ||
+      comp.moving.load(std::memory_order_relaxed) ||
+      comp.moveCount.load(std::memory_order_relaxed) != moveCount) {
+    return;
+  }
+  func();
+}
+
 Component& SendableRegistryInst::GetOrAdd(void* sendable,
                                           SendableRegistry::UID* uid) {
   SendableRegistry::UID& compUid = componentMap[sendable];
   if (compUid == 0) {
-    compUid = components.emplace_back(std::make_unique<Component>()) + 1;
+    compUid = components.emplace_back(std::make_shared<Component>()) + 1;
   }
   if (uid) {
     *uid = compUid;
   }
+  Changed();
 
   return *components[compUid - 1];
 }
 
+Component* SendableRegistryInst::Find(const void* sendable) {
+  auto it = componentMap.find(sendable);
+  if (it == componentMap.end()) {
+    return nullptr;
+  }
+  return components[it->getSecond() - 1].get();
+}
+
+std::shared_ptr<Component> SendableRegistryInst::FindShared(
+    const void* sendable) {
+  auto it = componentMap.find(sendable);
+  if (it == componentMap.end()) {
+    return nullptr;
+  }
+  return components[it->getSecond() - 1];
+}
+
+std::shared_ptr<Component> SendableRegistryInst::Get(
+    SendableRegistry::UID uid) {
+  if (uid == 0 || (uid - 1) >= components.size()) {
+    return nullptr;
+  }
+  return components[uid - 1];
+}
+
+std::shared_ptr<const LiveWindowSnapshot>
+SendableRegistryInst::GetLiveWindowSnapshot(int dataHandle) {
+  std::shared_ptr<const LiveWindowSnapshot> current;
+  {
+    std::scoped_lock lock(snapshotMutex);
+    current = snapshot;
+  }
+  if (current && current->dataHandle == dataHandle &&
+      current->version == version.load(std::memory_order_acquire)) {
+    return current;
+  }
+
+  std::scoped_lock lock(mutex);
+  auto newSnapshot = std::make_shared<LiveWindowSnapshot>();
+  newSnapshot->version = version.load(std::memory_order_relaxed);
+  newSnapshot->dataHandle = dataHandle;
+  for (auto&& comp : components) {
+    if (comp && comp->builder && comp->sendable && comp->liveWindow) {
+      newSnapshot->entries.push_back(
+          {comp, comp->moveCount.load(), comp->sendable, comp->name,
+           comp->subsystem, comp->parent, comp->builder,
+           &comp->GetData(dataHandle)});
+    }
+  }
+  {
+    std::scoped_lock snapshotLock(snapshotMutex);
+    snapshot = newSnapshot;
+  }
+  return newSnapshot;
+}
+
 static std::unique_ptr<SendableRegistryInst>& GetInstanceHolder() {
   static std::unique_ptr<SendableRegistryInst> instance =
       std::make_unique<SendableRegistryInst>();
@@ -90,6 +216,15 @@ void SendableRegistry::SetLiveWindowBuilderFactory(
   GetInstance().liveWindowFactory = std::move(factory);
 }
 
+// the builder is created before locking, as the factory is user code
+static std::unique_ptr<SendableBuilder> MakeLiveWindowBuilder(
+    SendableRegistryInst& inst) {
+  if (inst.liveWindowFactory) {
+    return inst.liveWindowFactory();
+  }
+  return nullptr;
+}
+
 void SendableRegistry::Add(Sendable* sendable, std::string_view name) {
   auto& inst = GetInstance();
   std::scoped_lock lock(inst.mutex);
@@ -128,11 +263,12 @@ void SendableRegistry::Add(Sendable* sendable, std::string_view subsystem,
 
 void SendableRegistry::AddLW(Sendable* sendable, std::string_view name) {
   auto& inst = GetInstance();
+  auto builder = MakeLiveWindowBuilder(inst);
   std::scoped_lock lock(inst.mutex);
   auto& comp = inst.GetOrAdd(sendable);
   comp.sendable = sendable;
-  if (inst.liveWindowFactory) {
-    comp.builder = inst.liveWindowFactory();
+  if (builder) {
+    comp.builder = std::move(builder);
   }
   comp.liveWindow = true;
   comp.name = name;
@@ -141,11 +277,12 @@ void SendableRegistry::AddLW(Sendable* sendable, std::string_view name) {
 void SendableRegistry::AddLW(Sendable* sendable, std::string_view moduleType,
                              int channel) {
   auto& inst = GetInstance();
+  auto builder = MakeLiveWindowBuilder(inst);
   std::scoped_lock lock(inst.mutex);
   auto& comp = inst.GetOrAdd(sendable);
   comp.sendable = sendable;
-  if (inst.liveWindowFactory) {
-    comp.builder = inst.liveWindowFactory();
+  if (builder) {
+    comp.builder = std::move(builder);
   }
   comp.liveWindow = true;
   comp.SetName(moduleType, channel);
@@ -154,11 +291,12 @@ void SendableRegistry::AddLW(Sendable* sendable, std::string_view moduleType,
 void SendableRegistry::AddLW(Sendable* sendable, std::string_view moduleType,
                              int moduleNumber, int channel) {
   auto& inst = GetInstance();
+  auto builder = MakeLiveWindowBuilder(inst);
   std::scoped_lock lock(inst.mutex);
   auto& comp = inst.GetOrAdd(sendable);
   comp.sendable = sendable;
-  if (inst.liveWindowFactory) {
-    comp.builder = inst.liveWindowFactory();
+  if (builder) {
+    comp.builder = std::move(builder);
   }
   comp.liveWindow = true;
   comp.SetName(moduleType, moduleNumber, channel);
@@ -167,11 +305,12 @@ void SendableRegistry::AddLW(Sendable* sendable, std::string_view moduleType,
 void SendableRegistry::AddLW(Sendable* sendable, std::string_view subsystem,
                              std::string_view name) {
   auto& inst = GetInstance();
+  auto builder = MakeLiveWindowBuilder(inst);
   std::scoped_lock lock(inst.mutex);
   auto& comp = inst.GetOrAdd(sendable);
   comp.sendable = sendable;
-  if (inst.liveWindowFactory) {
-    comp.builder = inst.liveWindowFactory();
+  if (builder) {
+    comp.builder = std::move(builder);
   }
   comp.liveWindow = true;
   comp.name = name;
@@ -194,46 +333,69 @@ void SendableRegistry::AddChild(Sendable* parent, void* child) {
 
 bool SendableRegistry::Remove(Sendable* sendable) {
   auto& inst = GetInstance();
-  std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end()) {
-    return false;
-  }
-  UID compUid = it->getSecond();
-  inst.components.erase(compUid - 1);
-  inst.componentMap.erase(it);
-  // update any parent pointers
-  for (auto&& comp : inst.components) {
-    if (comp->parent == sendable) {
-      comp->parent = nullptr;
+  std::shared_ptr<Component> comp;
+  {
+    std::scoped_lock lock(inst.mutex);
+    auto it = inst.componentMap.find(sendable);
+    if (it == inst.componentMap.end()) {
+      return false;
+    }
+    UID compUid = it->getSecond();
+    comp = inst.components.erase(compUid - 1);
+    inst.componentMap.erase(it);
+    // update any parent pointers
+    for (auto&& other : inst.components) {
+      if (other->parent == sendable) {
+        other->parent = nullptr;
+      }
     }
+    inst.Changed();
+  }
+  // the sendable is likely about to be destroyed, so wait for any update of
+  // it that is still running on another thread
+  if (comp) {
+    std::scoped_lock lock(comp->visitMutex);
+    comp->removed = true;
   }
   return true;
 }
 
 void SendableRegistry::Move(Sendable* to, Sendable* from) {
   auto& inst = GetInstance();
-  std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(from);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
-    return;
+  std::shared_ptr<Component> comp;
+  std::shared_ptr<SendableBuilder> builder;
+  {
+    std::scoped_lock lock(inst.mutex);
+    auto it = inst.componentMap.find(from);
+    if (it == inst.componentMap.end() ||
+        !inst.components[it->getSecond() - 1]) {
+      return;
+    }
+    UID compUid = it->getSecond();
+    inst.componentMap.erase(it);
+    inst.componentMap[to] = compUid;
+    comp = inst.components[compUid - 1];
+    comp->sendable = to;
+    comp->moving = true;
+    ++comp->moveCount;
+    // update any parent pointers
+    for (auto&& other : inst.components) {
+      if (other->parent == from) {
+        other->parent = to;
+      }
+    }
+    if (comp->builder && comp->builder->IsPublished()) {
+      builder = comp->builder;
+    }
+    inst.Changed();
   }
-  UID compUid = it->getSecond();
-  inst.componentMap.erase(it);
-  inst.componentMap[to] = compUid;
-  auto& comp = *inst.components[compUid - 1];
-  comp.sendable = to;
-  if (comp.builder && comp.builder->IsPublished()) {
+  std::scoped_lock lock(comp->visitMutex);
+  if (builder) {
     // rebuild builder, as lambda captures can point to "from"
-    comp.builder->ClearProperties();
-    to->InitSendable(*comp.builder);
-  }
-  // update any parent pointers
-  for (auto&& comp : inst.components) {
-    if (comp->parent == from) {
-      comp->parent = to;
-    }
+    builder->ClearProperties();
+    to->InitSendable(*builder);
   }
+  comp->moving = false;
 }
 
 bool SendableRegistry::Contains(const Sendable* sendable) {
@@ -245,78 +407,91 @@ bool SendableRegistry::Contains(const Sendable* sendable) {
 std::string SendableRegistry::GetName(const Sendable* sendable) {
   auto& inst = GetInstance();
   std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
+  auto comp = inst.Find(sendable);
+  if (!comp) {
     return {};
   }
-  return inst.components[it->getSecond() - 1]->name;
+  return comp->name;
 }
 
 void SendableRegistry::SetName(Sendable* sendable, std::string_view name) {
   auto& inst = GetInstance();
   std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
+  auto comp = inst.Find(sendable);
+  if (!comp) {
     return;
   }
-  inst.components[it->getSecond() - 1]->name = name;
+  comp->name = name;
+  if (comp->liveWindow) {
+    inst.Changed();
+  }
 }
 
 void SendableRegistry::SetName(Sendable* sendable, std::string_view moduleType,
                                int channel) {
   auto& inst = GetInstance();
   std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
+  auto comp = inst.Find(sendable);
+  if (!comp) {
     return;
   }
-  inst.components[it->getSecond() - 1]->SetName(moduleType, channel);
+  comp->SetName(moduleType, channel);
+  if (comp->liveWindow) {
+    inst.Changed();
+  }
 }
 
 void SendableRegistry::SetName(Sendable* sendable, std::string_view moduleType,
                                int moduleNumber, int channel) {
   auto& inst = GetInstance();
   std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
+  auto comp = inst.Find(sendable);
+  if (!comp) {
     return;
   }
-  inst.components[it->getSecond() - 1]->SetName(moduleType, moduleNumber,
-                                                channel);
+  comp->SetName(moduleType, moduleNumber, channel);
+  if (comp->liveWindow) {
+    inst.Changed();
+  }
 }
 
 void SendableRegistry::SetName(Sendable* sendable, std::string_view subsystem,
                                std::string_view name) {
   auto& inst = GetInstance();
   std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
+  auto comp = inst.Find(sendable);
+  if (!comp) {
     return;
   }
-  auto& comp = *inst.components[it->getSecond() - 1];
-  comp.name = name;
-  comp.subsystem = subsystem;
+  comp->name = name;
+  comp->subsystem = subsystem;
+  if (comp->liveWindow) {
+    inst.Changed();
+  }
 }
 
 std::string SendableRegistry::GetSubsystem(const Sendable* sendable) {
   auto& inst = GetInstance();
   std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
+  auto comp = inst.Find(sendable);
+  if (!comp) {
     return {};
   }
-  return inst.components[it->getSecond() - 1]->subsystem;
+  return comp->subsystem;
 }
 
 void SendableRegistry::SetSubsystem(Sendable* sendable,
                                     std::string_view subsystem) {
   auto& inst = GetInstance();
   std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
+  auto comp = inst.Find(sendable);
+  if (!comp) {
     return;
   }
-  inst.components[it->getSecond() - 1]->subsystem = subsystem;
+  comp->subsystem = subsystem;
+  if (comp->liveWindow) {
+    inst.Changed();
+  }
 }
 
 int SendableRegistry::GetDataHandle() {
@@ -329,56 +504,59 @@ std::shared_ptr<void> SendableRegistry::SetData(Sendable* sendable, int handle,
                                                 std::shared_ptr<void> data) {
   auto& inst = GetInstance();
   assert(handle >= 0);
-  std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
-    return nullptr;
-  }
-  auto& comp = *inst.components[it->getSecond() - 1];
-  std::shared_ptr<void> rv;
-  if (static_cast<size_t>(handle) < comp.data.size()) {
-    rv = std::move(comp.data[handle]);
-  } else {
-    comp.data.resize(handle + 1);
+  std::shared_ptr<Component> comp;
+  std::shared_ptr<void>* element;
+  {
+    std::scoped_lock lock(inst.mutex);
+    comp = inst.FindShared(sendable);
+    if (!comp) {
+      return nullptr;
+    }
+    element = &comp->GetData(handle);
   }
-  comp.data[handle] = std::move(data);
-  return rv;
+  // a ForeachLiveWindow() callback may be using the data
+  std::scoped_lock lock(comp->visitMutex);
+  return std::exchange(*element, std::move(data));
 }
 
 std::shared_ptr<void> SendableRegistry::GetData(Sendable* sendable,
                                                 int handle) {
   auto& inst = GetInstance();
   assert(handle >= 0);
-  std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
-    return nullptr;
-  }
-  auto& comp = *inst.components[it->getSecond() - 1];
-  if (static_cast<size_t>(handle) >= comp.data.size()) {
-    return nullptr;
+  std::shared_ptr<Component> comp;
+  std::shared_ptr<void>* element;
+  {
+    std::scoped_lock lock(inst.mutex);
+    comp = inst.FindShared(sendable);
+    if (!comp) {
+      return nullptr;
+    }
+    element = &comp->GetData(handle);
   }
-  return comp.data[handle];
+  std::scoped_lock lock(comp->visitMutex);
+  return *element;
 }
 
 void SendableRegistry::EnableLiveWindow(Sendable* sendable) {
   auto& inst = GetInstance();
   std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
+  auto comp = inst.Find(sendable);
+  if (!comp) {
     return;
   }
-  inst.components[it->getSecond() - 1]->liveWindow = true;
+  comp->liveWindow = true;
+  inst.Changed();
 }
 
 void SendableRegistry::DisableLiveWindow(Sendable* sendable) {
   auto& inst = GetInstance();
   std::scoped_lock lock(inst.mutex);
-  auto it = inst.componentMap.find(sendable);
-  if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
+  auto comp = inst.Find(sendable);
+  if (!comp) {
     return;
   }
-  inst.components[it->getSecond() - 1]->liveWindow = false;
+  comp->liveWindow = false;
+  inst.Changed();
 }
 
 SendableRegistry::UID SendableRegistry::GetUniqueId(Sendable* sendable) {
@@ -392,63 +570,67 @@ SendableRegistry::UID SendableRegistry::GetUniqueId(Sendable* sendable) {
 
 Sendable* SendableRegistry::GetSendable(UID uid) {
   auto& inst = GetInstance();
-  if (uid == 0) {
-    return nullptr;
-  }
   std::scoped_lock lock(inst.mutex);
-  if ((uid - 1) >= inst.components.size() || !inst.components[uid - 1]) {
+  auto comp = inst.Get(uid);
+  if (!comp) {
     return nullptr;
   }
-  return inst.components[uid - 1]->sendable;
+  return comp->sendable;
 }
 
 void SendableRegistry::Publish(UID sendableUid,
                                std::unique_ptr<SendableBuilder> builder) {
   auto& inst = GetInstance();
-  std::scoped_lock lock(inst.mutex);
-  if (sendableUid == 0 || (sendableUid - 1) >= inst.components.size() ||
-      !inst.components[sendableUid - 1]) {
-    return;
+  std::shared_ptr<Component> comp;
+  std::shared_ptr<SendableBuilder> newBuilder = std::move(builder);
+  Sendable* sendable;
+  unsigned int moveCount;
+  {
+    std::scoped_lock lock(inst.mutex);
+    comp = inst.Get(sendableUid);
+    if (!comp) {
+      return;
+    }
+    comp->builder = newBuilder;  // clear any current builder
+    sendable = comp->sendable;
+    moveCount = comp->moveCount;
+    inst.Changed();
   }
-  auto& comp = *inst.components[sendableUid - 1];
-  comp.builder = std::move(builder);  // clear any current builder
-  comp.sendable->InitSendable(*comp.builder);
-  comp.builder->Update();
+  Visit(*comp, moveCount, [&] {
+    sendable->InitSendable(*newBuilder);
+    newBuilder->Update();
+  });
 }
 
 void SendableRegistry::Update(UID sendableUid) {
+  WPI_PROFILE_SCOPE("SendableRegistry::Update()");
   auto& inst = GetInstance();
-  if (sendableUid == 0) {
-    return;
-  }
-  std::scoped_lock lock(inst.mutex);
-  if ((sendableUid - 1) >= inst.components.size() ||
-      !inst.components[sendableUid - 1]) {
-    return;
-  }
-  if (inst.components[sendableUid - 1]->builder) {
-    inst.components[sendableUid - 1]->builder->Update();
+  std::shared_ptr<Component> comp;
+  std::shared_ptr<SendableBuilder> builder;
+  unsigned int moveCount;
+  {
+    std::scoped_lock lock(inst.mutex);
+    comp = inst.Get(sendableUid);
+    if (!comp || !comp->builder) {
+      return;
+    }
+    builder = comp->builder;
+    moveCount = comp->moveCount;
   }
+  Visit(*comp, moveCount, [&] { builder->Update(); });
 }
 
 void SendableRegistry::ForeachLiveWindow(
     int dataHandle, wpi::function_ref<void(CallbackData& data)> callback) {
+  WPI_PROFILE_SCOPE("SendableRegistry::ForeachLiveWindow()");
   auto& inst = GetInstance();
   assert(dataHandle >= 0);
-  std::scoped_lock lock(inst.mutex);
-  wpi::SmallVector<Component*, 128> components;
-  for (auto&& comp : inst.components) {
-    components.emplace_back(comp.get());
-  }
-  for (auto comp : components) {
-    if (comp && comp->builder && comp->sendable && comp->liveWindow) {
-      if (static_cast<size_t>(dataHandle) >= comp->data.size()) {
-        comp->data.resize(dataHandle + 1);
-      }
-      CallbackData cbdata{comp->sendable,         comp->name,
-                          comp->subsystem,        comp->parent,
-                          comp->data[dataHandle], *comp->builder};
+  auto snapshot = inst.GetLiveWindowSnapshot(dataHandle);
+  for (auto&& entry : snapshot->entries) {
+    Visit(*entry.comp, entry.moveCount, [&] {
+      CallbackData cbdata{entry.sendable, entry.name,  entry.subsystem,
+                          entry.parent,   *entry.data, *entry.builder};
       callback(cbdata);
-    }
+    });
   }
 }
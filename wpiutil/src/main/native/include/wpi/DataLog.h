@@ -244,6 +244,27 @@ class DataLog {
   void AppendRaw2(int entry, std::span<const std::span<const uint8_t>> data,
                   int64_t timestamp);
 
+  /**
+   * A raw record, for use with AppendRawBatch().
+   */
+  struct RawRecord {
+    /// Entry index, as returned by Start()
+    int entry;
+    /// Byte array to record
+    std::span<const uint8_t> data;
+    /// Time stamp (may be 0 to indicate now)
+    int64_t timestamp;
+  };
+
+  /**
+   * Appends multiple raw records to the log.  This is equivalent to calling
+   * AppendRaw() for each record, but only acquires the internal lock once.
+   * Records with invalid entry indices are skipped.
+   *
+   * @param records Records to append, in order
+   */
+  void AppendRawBatch(std::span<const RawRecord> records);
+
   /**
    * Appends a boolean record to the log.
    *
@@ -0,0 +1,240 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "wpi/DenseMap.h"
+
+namespace wpi {
+class raw_ostream;
+namespace log {
+class DataLog;
+}  // namespace log
+}  // namespace wpi
+
+/**
+ * Low-overhead scoped profiling of hot code paths.
+ *
+ * Zones are declared with WPI_PROFILE_SCOPE() and are recorded from the point
+ * of declaration to the end of the enclosing scope.  Each thread records into
+ * its own fixed-size ring buffer without locking; a single consumer
+ * periodically calls Collect() and passes the events to DataLogger and/or
+ * TraceWriter.  If a thread records faster than events are collected, the
+ * oldest events are overwritten.
+ *
+ * Recording is disabled by default; while disabled, a zone costs a single
+ * check of the enabled flag.
+ */
+namespace wpi::profile {
+
+/**
+ * A profiling zone.  Instances are static and are normally created by
+ * WPI_PROFILE_SCOPE(), so recording a zone only stores a pointer to it.
+ */
+struct Zone {
+  /// Zone name; must be a string literal (or otherwise never freed)
+  const char* name;
+  /// Source file
+  const char* file;
+  /// Source line
+  int line;
+};
+
+/**
+ * A recorded zone.
+ */
+struct Event {
+  /// Zone
+  const Zone* zone;
+  /// Thread index, as used by GetThreadName()
+  int thread;
+  /// Start time, in nanoseconds (see Now())
+  int64_t start;
+  /// End time, in nanoseconds (see Now())
+  int64_t end;
+};
+
+/**
+ * Enables or disables recording.
+ *
+ * @param enabled true to enable
+ */
+void SetEnabled(bool enabled);
+
+/**
+ * Returns true if recording is enabled.
+ *
+ * @return True if enabled
+ */
+bool IsEnabled();
+
+/**
+ * Gets the profiling time, in nanoseconds.  This is a monotonic clock with an
+ * arbitrary epoch; it is not the same as wpi::Now().
+ *
+ * @return Time in nanoseconds
+ */
+int64_t Now();
+
+/**
+ * Records a zone on the current thread.
+ *
+ * @param zone zone
+ * @param start start time (from Now())
+ * @param end end time (from Now())
+ */
+void Record(const Zone* zone, int64_t start, int64_t end);
+
+/**
+ * Sets the name of the current thread, as shown in traces.  Threads that are
+ * not named are shown as "Thread N".
+ *
+ * @param name thread name
+ */
+void SetThreadName(std::string_view name);
+
+/**
+ * Gets the name of a thread.
+ *
+ * @param thread thread index (from Event)
+ * @return Thread name
+ */
+std::string GetThreadName(int thread);
+
+/**
+ * Appends the events recorded on all threads since the last call.  Events of
+ * each thread are in the order in which the zones ended, so nested zones come
+ * before the zones that contain them.  Only one thread should collect events.
+ *
+ * @param events vector to append events to
+ * @return Number of events that were lost because they were overwritten
+ *         before being collected
+ */
+size_t Collect(std::vector<Event>* events);
+
+/**
+ * Records a zone from construction to destruction.  Normally used via
+ * WPI_PROFILE_SCOPE().
+ */
+class Scope {
+ public:
+  explicit Scope(const Zone* zone)
+      : m_zone{IsEnabled() ? zone : nullptr}, m_start{m_zone ? Now() : 0} {}
+
+  ~Scope() {
+    if (m_zone) {
+      Record(m_zone, m_start, Now());
+    }
+  }
+
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+ private:
+  const Zone* m_zone;
+  int64_t m_start;
+};
+
+/**
+ * Writes events to a data log.  Each zone is logged as an "int64" entry
+ * (named prefix + zone name) containing the duration in nanoseconds, with the
+ * record timestamp set to the start of the zone.
+ */
+class DataLogger {
+ public:
+  /**
+   * Constructs.
+   *
+   * @param log data log
+   * @param prefix prefix for entry names
+   */
+  explicit DataLogger(wpi::log::DataLog& log,
+                      std::string_view prefix = "profile/");
+
+  /**
+   * Appends events to the data log.
+   *
+   * @param events events (from Collect())
+   */
+  void Append(std::span<const Event> events);
+
+ private:
+  wpi::log::DataLog& m_log;
+  std::string m_prefix;
+  wpi::DenseMap<const Zone*, int> m_entries;
+  std::vector<uint8_t> m_buf;
+};
+
+/**
+ * Writes events to a file in the Chrome trace event JSON format, which can
+ * be viewed with Perfetto (https://ui.perfetto.dev) or chrome://tracing.
+ * The file is completed when the writer is destroyed; viewers also accept
+ * files that were not completed.
+ */
+class TraceWriter {
+ public:
+  /**
+   * Constructs from an output stream.
+   *
+   * @param os output stream
+   */
+  explicit TraceWriter(wpi::raw_ostream& os);
+
+  /**
+   * Constructs from a filename.
+   *
+   * @param filename filename
+   * @param ec error code (set on error opening the file)
+   */
+  TraceWriter(std::string_view filename, std::error_code& ec);
+
+  ~TraceWriter();
+
+  TraceWriter(const TraceWriter&) = delete;
+  TraceWriter& operator=(const TraceWriter&) = delete;
+
+  /**
+   * Appends events to the trace.
+   *
+   * @param events events (from Collect())
+   */
+  void Append(std::span<const Event> events);
+
+  /**
+   * Flushes the output stream.
+   */
+  void Flush();
+
+ private:
+  std::unique_ptr<wpi::raw_ostream> m_ownedOs;
+  wpi::raw_ostream& m_os;
+  std::vector<bool> m_namedThreads;
+  bool m_first = true;
+};
+
+}  // namespace wpi::profile
+
+#define WPI_PROFILE_CONCAT_IMPL(a, b) a##b
+#define WPI_PROFILE_CONCAT(a, b) WPI_PROFILE_CONCAT_IMPL(a, b)
+
+/**
+ * Records the rest of the enclosing scope as a profiling zone.
+ *
+ * @param name zone name (string literal)
+ */
+#define WPI_PROFILE_SCOPE(name)                                              \
+  static constexpr ::wpi::profile::Zone WPI_PROFILE_CONCAT(                  \
+      wpi_profile_zone_, __LINE__){name, __FILE__, __LINE__};                \
+  ::wpi::profile::Scope WPI_PROFILE_CONCAT(wpi_profile_scope_, __LINE__) {   \
+    &WPI_PROFILE_CONCAT(wpi_profile_zone_, __LINE__)                         \
+  }
@@ -0,0 +1,565 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "wpi/xxhash.h"
+
+namespace wpi {
+
+/**
+ * StringHashMap is an unordered associative container that contains key-value
+ * pairs with unique string keys.  Search, insertion, and removal have average
+ * constant complexity.
+ *
+ * The map uses open addressing with linear probing.  Keys are copied into
+ * blocks of memory owned by the map rather than allocated individually, and
+ * every slot records the full hash of its key, so a probe only compares
+ * strings when hashes match and growing the table doesn't rehash keys.
+ * Lookups take std::string_view and never allocate.  Callers that look up the
+ * same key repeatedly can compute Hash() once and pass it to find().
+ *
+ * Unlike StringMap, iteration order is unspecified, and inserting or erasing
+ * an element invalidates all iterators and references into the map.
+ */
+template <typename T>
+class StringHashMap {
+ public:
+  using key_type = std::string_view;
+  using mapped_type = T;
+  using value_type = std::pair<const std::string_view, T>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+  /** Forward iterator over the elements of a StringHashMap. */
+  template <bool IsConst>
+  class Iterator {
+    using Map = std::conditional_t<IsConst, const StringHashMap, StringHashMap>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = StringHashMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference =
+        std::conditional_t<IsConst, const value_type&, value_type&>;
+    using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+    Iterator() = default;
+
+    operator Iterator<true>() const {  // NOLINT
+      return Iterator<true>{m_map, m_index};
+    }
+
+    reference operator*() const { return *m_map->m_values[m_index]; }
+    pointer operator->() const { return &*m_map->m_values[m_index]; }
+
+    Iterator& operator++() {
+      ++m_index;
+      SkipEmpty();
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) {
+      return lhs.m_index == rhs.m_index;
+    }
+
+   private:
+    friend class StringHashMap;
+    friend class Iterator<!IsConst>;
+
+    Iterator(Map* map, size_t index) : m_map{map}, m_index{index} {}
+
+    void SkipEmpty() {
+      while (m_index < m_map->m_hashes.size() &&
+             m_map->m_hashes[m_index] == 0) {
+        ++m_index;
+      }
+    }
+
+    Map* m_map = nullptr;
+    size_t m_index = 0;
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  /** Constructs an empty container. */
+  StringHashMap() = default;
+
+  /** Copy constructor. */
+  StringHashMap(const StringHashMap& other) {
+    reserve(other.size());
+    for (auto&& [key, value] : other) {
+      try_emplace(key, value);
+    }
+  }
+
+  /** Move constructor. */
+  StringHashMap(StringHashMap&& other) noexcept
+      : m_hashes{std::move(other.m_hashes)},
+        m_values{std::move(other.m_values)},
+        m_size{std::exchange(other.m_size, 0)},
+        m_keys{std::move(other.m_keys)} {
+    other.m_hashes.clear();
+    other.m_values.clear();
+  }
+
+  /** Copy assignment operator. */
+  StringHashMap& operator=(const StringHashMap& other) {
+    if (this != &other) {
+      StringHashMap tmp{other};
+      *this = std::move(tmp);
+    }
+    return *this;
+  }
+
+  /** Move assignment operator. */
+  StringHashMap& operator=(StringHashMap&& other) noexcept {
+    m_hashes = std::move(other.m_hashes);
+    m_values = std::move(other.m_values);
+    m_size = std::exchange(other.m_size, 0);
+    m_keys = std::move(other.m_keys);
+    other.m_hashes.clear();
+    other.m_values.clear();
+    return *this;
+  }
+
+  /**
+   * Computes the hash of a key, for use with find().
+   *
+   * @param key the key
+   * @return The hash of the key.
+   */
+  static uint64_t Hash(std::string_view key) { return xxh3_64bits(key); }
+
+  /**
+   * Returns an iterator to the first element of the map.
+   *
+   * @return Iterator to the first element.
+   */
+  iterator begin() {
+    iterator it{this, 0};
+    it.SkipEmpty();
+    return it;
+  }
+
+  /**
+   * Returns an iterator to the first element of the map.
+   *
+   * @return Iterator to the first element.
+   */
+  const_iterator begin() const {
+    const_iterator it{this, 0};
+    it.SkipEmpty();
+    return it;
+  }
+
+  /**
+   * Returns an iterator to the element following the last element of the map.
+   *
+   * @return Iterator to the element following the last element.
+   */
+  iterator end() { return {this, m_hashes.size()}; }
+
+  /**
+   * Returns an iterator to the element following the last element of the map.
+   *
+   * @return Iterator to the element following the last element.
+   */
+  const_iterator end() const { return {this, m_hashes.size()}; }
+
+  /**
+   * Checks if the container has no elements.
+   *
+   * @return true if the container is empty, false otherwise
+   */
+  bool empty() const { return m_size == 0; }
+
+  /**
+   * Returns the number of elements in the container.
+   *
+   * @return The number of elements in the container.
+   */
+  size_type size() const { return m_size; }
+
+  /**
+   * Erases all elements from the container.  The slot table keeps its
+   * capacity; the memory holding the keys is released.
+   */
+  void clear() {
+    std::fill(m_hashes.begin(), m_hashes.end(), 0);
+    for (auto&& value : m_values) {
+      value.reset();
+    }
+    m_size = 0;
+    m_keys.Clear();
+  }
+
+  /**
+   * Sets the capacity of the container to at least the number of elements
+   * needed to hold count elements without growing.
+   *
+   * @param count new capacity of the container
+   */
+  void reserve(size_type count) {
+    size_type capacity = kMinCapacity;
+    while (capacity * kMaxLoadNum < count * kMaxLoadDen) {
+      capacity *= 2;
+    }
+    if (capacity > m_hashes.size()) {
+      Rehash(capacity);
+    }
+  }
+
+  /**
+   * Finds an element with key equivalent to key.
+   *
+   * @param key key value of the element to search for
+   * @return Iterator to the requested element, or end() if not found.
+   */
+  iterator find(std::string_view key) { return find(key, Hash(key)); }
+
+  /**
+   * Finds an element with key equivalent to key.
+   *
+   * @param key key value of the element to search for
+   * @return Iterator to the requested element, or end() if not found.
+   */
+  const_iterator find(std::string_view key) const {
+    return find(key, Hash(key));
+  }
+
+  /**
+   * Finds an element with key equivalent to key, using a hash computed
+   * earlier.
+   *
+   * @param key key value of the element to search for
+   * @param hash Hash(key)
+   * @return Iterator to the requested element, or end() if not found.
+   */
+  iterator find(std::string_view key, uint64_t hash) {
+    return {this, FindIndex(key, hash)};
+  }
+
+  /**
+   * Finds an element with key equivalent to key, using a hash computed
+   * earlier.
+   *
+   * @param key key value of the element to search for
+   * @param hash Hash(key)
+   * @return Iterator to the requested element, or end() if not found.
+   */
+  const_iterator find(std::string_view key, uint64_t hash) const {
+    return {this, FindIndex(key, hash)};
+  }
+
+  /**
+   * Checks if there is an element with key equivalent to key in the container.
+   *
+   * @param key key value of the element to search for
+   * @return true if there is such an element, otherwise false
+   */
+  bool contains(std::string_view key) const { return find(key) != end(); }
+
+  /**
+   * Returns the number of elements with key that compares equal to the
+   * specified argument key, which is either 1 or 0.
+   *
+   * @param key key value of the elements to count
+   * @return Number of elements with key that compares equal to key.
+   */
+  size_type count(std::string_view key) const { return contains(key) ? 1 : 0; }
+
+  /**
+   * Returns a reference to the mapped value of the element with the specified
+   * key.  If no such element exists, an exception of type std::out_of_range is
+   * thrown.
+   *
+   * @param key the key of the element to find
+   * @return A reference to the mapped value of the requested element.
+   */
+  T& at(std::string_view key) {
+    auto it = find(key);
+    if (it == end()) {
+      throw std::out_of_range{"StringHashMap::at"};
+    }
+    return it->second;
+  }
+
+  /**
+   * Returns a reference to the mapped value of the element with the specified
+   * key.  If no such element exists, an exception of type std::out_of_range is
+   * thrown.
+   *
+   * @param key the key of the element to find
+   * @return A reference to the mapped value of the requested element.
+   */
+  const T& at(std::string_view key) const {
+    auto it = find(key);
+    if (it == end()) {
+      throw std::out_of_range{"StringHashMap::at"};
+    }
+    return it->second;
+  }
+
+  /**
+   * Returns a reference to the value that is mapped to a key, performing an
+   * insertion of a value-initialized value if such key does not already exist.
+   *
+   * @param key the key of the element to find
+   * @return A reference to the mapped value of the new element if no element
+   *         with key key existed.  Otherwise, a reference to the mapped value
+   *         of the existing element whose key is equivalent to key.
+   */
+  T& operator[](std::string_view key) { return try_emplace(key).first->second; }
+
+  /**
+   * Inserts a new element into the container constructed in-place with the
+   * given args if there is no element with the key in the container.
+   *
+   * @param key the key used both to look up and to insert if not found
+   * @param args arguments to forward to the constructor of the element
+   * @return A pair consisting of an iterator to the inserted element (or to
+   *         the element that prevented the insertion) and a bool denoting
+   *         whether the insertion took place.
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(std::string_view key, Args&&... args) {
+    uint64_t hash = Hash(key);
+    size_t index = FindIndex(key, hash);
+    if (index != m_hashes.size()) {
+      return {iterator{this, index}, false};
+    }
+    if ((m_size + 1) * kMaxLoadDen > m_hashes.size() * kMaxLoadNum) {
+      Rehash(std::max(m_hashes.size() * 2, kMinCapacity));
+    }
+    index = Place(StoredHash(hash), m_keys.Store(key),
+                  std::forward<Args>(args)...);
+    ++m_size;
+    return {iterator{this, index}, true};
+  }
+
+  /**
+   * If a key equivalent to key already exists in the container, assigns obj
+   * to the mapped type corresponding to the key.  If the key does not exist,
+   * inserts the new value as if by try_emplace.
+   *
+   * @param key the key used both to look up and to insert if not found
+   * @param obj the value to insert or assign
+   * @return A pair consisting of an iterator to the inserted or updated
+   *         element and a bool denoting whether the insertion took place.
+   */
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(std::string_view key, M&& obj) {
+    auto result = try_emplace(key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+
+  /**
+   * Removes the element at pos.  Invalidates all iterators.
+   *
+   * @param pos iterator to the element to remove
+   */
+  void erase(const_iterator pos) { EraseIndex(pos.m_index); }
+
+  /**
+   * Removes the element (if one exists) with the key equivalent to key.
+   *
+   * @param key key value of the elements to remove
+   * @return Number of elements removed (0 or 1).
+   */
+  size_type erase(std::string_view key) {
+    size_t index = FindIndex(key, Hash(key));
+    if (index == m_hashes.size()) {
+      return 0;
+    }
+    EraseIndex(index);
+    return 1;
+  }
+
+ private:
+  // Bump allocator holding the key strings
+  class KeyArena {
+   public:
+    KeyArena() = default;
+    KeyArena(KeyArena&& other) noexcept { *this = std::move(other); }
+    KeyArena& operator=(KeyArena&& other) noexcept {
+      m_blocks = std::move(other.m_blocks);
+      other.m_blocks.clear();
+      m_cur = std::exchange(other.m_cur, nullptr);
+      m_remaining = std::exchange(other.m_remaining, 0);
+      m_liveBytes = std::exchange(other.m_liveBytes, 0);
+      m_deadBytes = std::exchange(other.m_deadBytes, 0);
+      return *this;
+    }
+
+    std::string_view Store(std::string_view key) {
+      if (key.empty()) {
+        return {};
+      }
+      m_liveBytes += key.size();
+      char* data;
+      if (key.size() > kBlockSize / 4) {
+        data = m_blocks.emplace_back(new char[key.size()]).get();
+      } else {
+        if (key.size() > m_remaining) {
+          m_cur = m_blocks.emplace_back(new char[kBlockSize]).get();
+          m_remaining = kBlockSize;
+        }
+        data = m_cur;
+        m_cur += key.size();
+        m_remaining -= key.size();
+      }
+      std::copy(key.begin(), key.end(), data);
+      return {data, key.size()};
+    }
+
+    void Release(std::string_view key) {
+      m_liveBytes -= key.size();
+      m_deadBytes += key.size();
+    }
+
+    // true if erased keys take up enough space to be worth compacting
+    bool ShouldCompact() const {
+      return m_deadBytes > kBlockSize && m_deadBytes > m_liveBytes;
+    }
+
+    void Clear() { *this = KeyArena{}; }
+
+   private:
+    static constexpr size_t kBlockSize = 4096;
+
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    char* m_cur = nullptr;
+    size_t m_remaining = 0;
+    size_t m_liveBytes = 0;
+    size_t m_deadBytes = 0;
+  };
+
+  static constexpr size_t kMinCapacity = 16;
+  // maximum load factor before growing is kMaxLoadNum / kMaxLoadDen
+  static constexpr size_t kMaxLoadNum = 3;
+  static constexpr size_t kMaxLoadDen = 4;
+
+  // A stored hash of 0 marks an empty slot
+  static uint64_t StoredHash(uint64_t hash) { return hash == 0 ? 1 : hash; }
+
+  size_t Mask() const { return m_hashes.size() - 1; }
+
+  size_t FindIndex(std::string_view key, uint64_t hash) const {
+    if (m_size == 0) {
+      return m_hashes.size();
+    }
+    hash = StoredHash(hash);
+    size_t mask = Mask();
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+      uint64_t slotHash = m_hashes[i];
+      if (slotHash == 0) {
+        return m_hashes.size();
+      }
+      if (slotHash == hash && m_values[i]->first == key) {
+        return i;
+      }
+    }
+  }
+
+  // Constructs an element in the first free slot of its probe sequence
+  template <typename... Args>
+  size_t Place(uint64_t hash, std::string_view key, Args&&... args) {
+    size_t mask = Mask();
+    size_t i = hash & mask;
+    while (m_hashes[i] != 0) {
+      i = (i + 1) & mask;
+    }
+    m_hashes[i] = hash;
+    m_values[i].emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                        std::forward_as_tuple(std::forward<Args>(args)...));
+    return i;
+  }
+
+  void EraseIndex(size_t index) {
+    m_keys.Release(m_values[index]->first);
+    m_hashes[index] = 0;
+    m_values[index].reset();
+    --m_size;
+
+    // Shift later elements of the probe run back so lookups never need
+    // tombstones: an element can fill the hole if the hole lies between its
+    // home slot and its current slot.
+    size_t mask = Mask();
+    size_t hole = index;
+    for (size_t i = (index + 1) & mask; m_hashes[i] != 0; i = (i + 1) & mask) {
+      size_t home = m_hashes[i] & mask;
+      if (((i - home) & mask) >= ((i - hole) & mask)) {
+        m_hashes[hole] = m_hashes[i];
+        m_values[hole].emplace(m_values[i]->first,
+                               std::move(m_values[i]->second));
+        m_hashes[i] = 0;
+        m_values[i].reset();
+        hole = i;
+      }
+    }
+
+    if (m_keys.ShouldCompact()) {
+      Rehash(m_hashes.size());
+    }
+  }
+
+  // Moves every element into a table of the given capacity, compacting the
+  // key storage if enough keys have been erased
+  void Rehash(size_t capacity) {
+    std::vector<uint64_t> oldHashes(capacity, 0);
+    std::vector<std::optional<value_type>> oldValues(capacity);
+    oldHashes.swap(m_hashes);
+    oldValues.swap(m_values);
+
+    KeyArena oldKeys;
+    bool compact = m_keys.ShouldCompact();
+    if (compact) {
+      std::swap(oldKeys, m_keys);
+    }
+
+    for (size_t i = 0; i < oldHashes.size(); ++i) {
+      if (oldHashes[i] != 0) {
+        std::string_view key = oldValues[i]->first;
+        Place(oldHashes[i], compact ? m_keys.Store(key) : key,
+              std::move(oldValues[i]->second));
+      }
+    }
+  }
+
+  std::vector<uint64_t> m_hashes;
+  std::vector<std::optional<value_type>> m_values;
+  size_t m_size = 0;
+  KeyArena m_keys;
+};
+
+}  // namespace wpi
@@ -369,6 +369,33 @@ class SendableBuilder {
           getter,
       std::function<void(std::span<const uint8_t>)> setter) = 0;
 
+  /**
+   * Limit how often a property is updated.  The getter of the property is
+   * called at most once per period; in between, the last value is kept.
+   * Must be called after the property has been added.  Builders that do not
+   * support this ignore it.
+   *
+   * @param key     property name
+   * @param period  minimum time between updates, in seconds (0 to update on
+   *                every call to Update())
+   */
+  virtual void SetUpdatePeriod(std::string_view key, double period) {}
+
+  /**
+   * Only update properties after the sendable signals that its state has
+   * changed, instead of on every call to Update().  The returned function
+   * signals a change; it is thread-safe and may be called (and kept) after
+   * the builder has been destroyed.  Changes made through property setters
+   * are not detected automatically, so setters should also signal.
+   * Builders that do not support this always update, and return a function
+   * that does nothing.
+   *
+   * @return Function to call when the state of the sendable has changed
+   */
+  virtual std::function<void()> EnableChangeTracking() {
+    return [] {};
+  }
+
   /**
    * Gets the kind of backend being used.
    *
@@ -296,7 +296,8 @@ class SendableRegistry final {
                       std::unique_ptr<SendableBuilder> builder);
 
   /**
-   * Updates published information from an object.
+   * Updates published information from an object.  Not run concurrently with
+   * other updates of the same object (including ForeachLiveWindow()).
    *
    * @param sendableUid sendable unique id
    */
@@ -326,8 +327,14 @@ class SendableRegistry final {
 
   /**
    * Iterates over LiveWindow-enabled objects in the registry.
-   * It is *not* safe to call other SendableRegistry functions from the
-   * callback (this will likely deadlock).
+   * Iteration is over a snapshot of the registry that is only rebuilt when it
+   * has changed, and is done without holding the registry lock, so other
+   * threads (and the callback) may call other SendableRegistry functions.
+   * Changes made during iteration are seen by the next call.  Objects removed
+   * during iteration are skipped; Remove() waits for the callback to return
+   * if it is running for the removed object on another thread.  Callbacks for
+   * an object are serialized with Update(), Publish() and other iterations
+   * for the same object.
    *
    * @param dataHandle data handle to get data pointer passed to callback
    * @param callback function to call for each object
@@ -289,6 +289,28 @@ TEST_F(DataLogTest, RawAppend) {
   ASSERT_EQ(data.size(), 42u);
 }
 
+TEST_F(DataLogTest, RawAppendBatch) {
+  int a = log.Start("a", "raw", "", 5);
+  int b = log.Start("b", "raw", "", 5);
+  uint8_t one[] = {1};
+  uint8_t two[] = {2, 3};
+  wpi::log::DataLog::RawRecord records[] = {
+      {a, one, 7}, {0, one, 7}, {b, two, 8}, {a, two, 9}};
+  log.AppendRawBatch(records);
+  log.Flush();
+
+  std::vector<uint8_t> expected;
+  wpi::log::DataLogWriter expectedLog{
+      msglog, std::make_unique<wpi::raw_uvector_ostream>(expected)};
+  a = expectedLog.Start("a", "raw", "", 5);
+  b = expectedLog.Start("b", "raw", "", 5);
+  expectedLog.AppendRaw(a, one, 7);
+  expectedLog.AppendRaw(b, two, 8);
+  expectedLog.AppendRaw(a, two, 9);
+  expectedLog.Flush();
+  ASSERT_EQ(data, expected);
+}
+
 TEST_F(DataLogTest, RawUpdate) {
   wpi::log::RawLogEntry entry{log, "a", 5};
   ASSERT_FALSE(entry.HasLastValue());
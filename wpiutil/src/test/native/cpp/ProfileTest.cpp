@@ -0,0 +1,162 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/Profile.h"
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "wpi/DataLogReader.h"
+#include "wpi/DataLogWriter.h"
+#include "wpi/Logger.h"
+#include "wpi/MemoryBuffer.h"
+#include "wpi/json.h"
+#include "wpi/raw_ostream.h"
+
+class ProfileTest : public ::testing::Test {
+ protected:
+  ProfileTest() {
+    // discard events from earlier tests
+    std::vector<wpi::profile::Event> events;
+    wpi::profile::Collect(&events);
+    wpi::profile::SetEnabled(true);
+  }
+
+  ~ProfileTest() override { wpi::profile::SetEnabled(false); }
+};
+
+static void Inner() {
+  WPI_PROFILE_SCOPE("Inner");
+}
+
+static void Outer() {
+  WPI_PROFILE_SCOPE("Outer");
+  Inner();
+  Inner();
+}
+
+TEST_F(ProfileTest, Nested) {
+  Outer();
+  std::vector<wpi::profile::Event> events;
+  EXPECT_EQ(wpi::profile::Collect(&events), 0u);
+  ASSERT_EQ(events.size(), 3u);
+  EXPECT_EQ(std::string_view{events[0].zone->name}, "Inner");
+  EXPECT_EQ(events[0].zone, events[1].zone);
+  EXPECT_EQ(std::string_view{events[2].zone->name}, "Outer");
+  EXPECT_LE(events[2].start, events[0].start);
+  EXPECT_LE(events[0].end, events[1].start);
+  EXPECT_LE(events[1].end, events[2].end);
+
+  // already collected
+  events.clear();
+  wpi::profile::Collect(&events);
+  EXPECT_TRUE(events.empty());
+}
+
+TEST_F(ProfileTest, Disabled) {
+  wpi::profile::SetEnabled(false);
+  Outer();
+  std::vector<wpi::profile::Event> events;
+  wpi::profile::Collect(&events);
+  EXPECT_TRUE(events.empty());
+}
+
+TEST_F(ProfileTest, Overflow) {
+  for (int i = 0; i < 10000; ++i) {
+    Inner();
+  }
+  std::vector<wpi::profile::Event> events;
+  size_t lost = wpi::profile::Collect(&events);
+  EXPECT_GT(lost, 0u);
+  EXPECT_EQ(events.size() + lost, 10000u);
+}
+
+TEST_F(ProfileTest, Threads) {
+  std::thread thr{[] {
+    wpi::profile::SetThreadName("worker");
+    Inner();
+  }};
+  thr.join();
+  Inner();
+
+  std::vector<wpi::profile::Event> events;
+  wpi::profile::Collect(&events);
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_NE(events[0].thread, events[1].thread);
+  int worker = events[0].thread;
+  if (wpi::profile::GetThreadName(worker) != "worker") {
+    worker = events[1].thread;
+  }
+  EXPECT_EQ(wpi::profile::GetThreadName(worker), "worker");
+}
+
+TEST_F(ProfileTest, TraceWriter) {
+  Outer();
+  std::vector<wpi::profile::Event> events;
+  wpi::profile::Collect(&events);
+
+  std::string out;
+  {
+    wpi::raw_string_ostream os{out};
+    wpi::profile::TraceWriter writer{os};
+    writer.Append(events);
+  }
+  auto j = wpi::json::parse(out);
+  auto& traceEvents = j.at("traceEvents");
+  // thread name metadata, then the three zones
+  ASSERT_EQ(traceEvents.size(), 4u);
+  EXPECT_EQ(traceEvents[0].at("ph").get<std::string>(), "M");
+  EXPECT_EQ(traceEvents[1].at("name").get<std::string>(), "Inner");
+  EXPECT_EQ(traceEvents[1].at("ph").get<std::string>(), "X");
+  EXPECT_EQ(traceEvents[3].at("name").get<std::string>(), "Outer");
+  EXPECT_DOUBLE_EQ(traceEvents[3].at("dur").get<double>(),
+                   (events[2].end - events[2].start) / 1000.0);
+}
+
+TEST_F(ProfileTest, TraceWriterEmpty) {
+  std::string out;
+  {
+    wpi::raw_string_ostream os{out};
+    wpi::profile::TraceWriter writer{os};
+  }
+  EXPECT_TRUE(wpi::json::parse(out).at("traceEvents").empty());
+}
+
+TEST_F(ProfileTest, DataLogger) {
+  Outer();
+  std::vector<wpi::profile::Event> events;
+  wpi::profile::Collect(&events);
+
+  wpi::Logger msglog;
+  std::vector<uint8_t> data;
+  {
+    wpi::log::DataLogWriter log{
+        msglog, std::make_unique<wpi::raw_uvector_ostream>(data)};
+    wpi::profile::DataLogger logger{log};
+    logger.Append(events);
+    log.Flush();
+  }
+
+  wpi::log::DataLogReader reader{wpi::MemoryBuffer::GetMemBuffer(data)};
+  ASSERT_TRUE(reader.IsValid());
+  std::vector<std::string> names;
+  std::vector<int64_t> durations;
+  for (auto&& record : reader) {
+    wpi::log::StartRecordData start;
+    int64_t value;
+    if (record.GetStartData(&start)) {
+      EXPECT_EQ(start.type, "int64");
+      names.emplace_back(start.name);
+    } else if (!record.IsControl() && record.GetInteger(&value)) {
+      durations.push_back(value);
+    }
+  }
+  EXPECT_EQ(names, (std::vector<std::string>{"profile/Inner", "profile/Outer"}));
+  ASSERT_EQ(durations.size(), 3u);
+  EXPECT_EQ(durations[2], events[2].end - events[2].start);
+}
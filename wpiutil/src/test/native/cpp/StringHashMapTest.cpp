@@ -0,0 +1,200 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/StringHashMap.h"  // NOLINT(build/include_order)
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "wpi/StringMap.h"
+
+using namespace wpi;
+
+namespace {
+
+std::string Key(int i) {
+  return "/SmartDashboard/table" + std::to_string(i % 97) + "/entry" +
+         std::to_string(i);
+}
+
+TEST(StringHashMapTest, Empty) {
+  StringHashMap<int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(0u, map.size());
+  EXPECT_TRUE(map.begin() == map.end());
+  EXPECT_FALSE(map.contains("key"));
+  EXPECT_TRUE(map.find("key") == map.end());
+  EXPECT_EQ(0u, map.erase("key"));
+  EXPECT_THROW(map.at("key"), std::out_of_range);
+}
+
+TEST(StringHashMapTest, InsertAndFind) {
+  StringHashMap<int> map;
+  auto [it, inserted] = map.try_emplace("a", 1);
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ("a", it->first);
+  EXPECT_EQ(1, it->second);
+
+  std::tie(it, inserted) = map.try_emplace(std::string{"a"}, 2);
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(1, it->second);
+
+  map["b"] = 2;
+  map.insert_or_assign("a", 3);
+  EXPECT_EQ(2u, map.size());
+  EXPECT_EQ(3, map.at("a"));
+  EXPECT_EQ(2, map.at(std::string_view{"b"}));
+  EXPECT_EQ(1u, map.count("b"));
+  EXPECT_EQ(0, map[""]);
+  EXPECT_TRUE(map.contains(""));
+}
+
+TEST(StringHashMapTest, KeyIsCopied) {
+  StringHashMap<int> map;
+  {
+    std::string key = "temporary";
+    map[key] = 5;
+  }
+  EXPECT_EQ(5, map.at("temporary"));
+  EXPECT_EQ("temporary", map.begin()->first);
+}
+
+TEST(StringHashMapTest, PrecomputedHash) {
+  StringHashMap<int> map;
+  map["/topic"] = 7;
+  uint64_t hash = StringHashMap<int>::Hash("/topic");
+  auto it = map.find("/topic", hash);
+  ASSERT_TRUE(it != map.end());
+  EXPECT_EQ(7, it->second);
+}
+
+TEST(StringHashMapTest, ManyKeys) {
+  StringHashMap<int> map;
+  for (int i = 0; i < 10000; ++i) {
+    map[Key(i)] = i;
+  }
+  EXPECT_EQ(10000u, map.size());
+  for (int i = 0; i < 10000; ++i) {
+    auto it = map.find(Key(i));
+    ASSERT_TRUE(it != map.end()) << Key(i);
+    EXPECT_EQ(i, it->second);
+  }
+
+  size_t count = 0;
+  for (auto&& [key, value] : map) {
+    EXPECT_EQ(Key(value), key);
+    ++count;
+  }
+  EXPECT_EQ(10000u, count);
+}
+
+TEST(StringHashMapTest, EraseKeepsOtherKeysReachable) {
+  StringHashMap<int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map[Key(i)] = i;
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    EXPECT_EQ(1u, map.erase(Key(i)));
+  }
+  EXPECT_EQ(500u, map.size());
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(i % 2 == 1, map.contains(Key(i))) << Key(i);
+  }
+
+  map.erase(map.find(Key(1)));
+  EXPECT_FALSE(map.contains(Key(1)));
+  EXPECT_EQ(499u, map.size());
+}
+
+TEST(StringHashMapTest, ChurnMatchesStringMap) {
+  StringHashMap<int> map;
+  StringMap<int> reference;
+  std::mt19937 gen{42};
+  std::uniform_int_distribution<int> keyDist{0, 300};
+  std::uniform_int_distribution<int> opDist{0, 2};
+
+  for (int i = 0; i < 100000; ++i) {
+    auto key = Key(keyDist(gen));
+    switch (opDist(gen)) {
+      case 0:
+        map[key] = i;
+        reference[key] = i;
+        break;
+      case 1:
+        EXPECT_EQ(reference.erase(key), map.erase(key));
+        break;
+      default: {
+        auto it = map.find(key);
+        auto refIt = reference.find(key);
+        ASSERT_EQ(refIt == reference.end(), it == map.end());
+        if (it != map.end()) {
+          EXPECT_EQ(refIt->second, it->second);
+        }
+        break;
+      }
+    }
+  }
+  ASSERT_EQ(reference.size(), map.size());
+  for (auto&& [key, value] : reference) {
+    EXPECT_EQ(value, map.at(key));
+  }
+}
+
+TEST(StringHashMapTest, MoveOnlyValue) {
+  StringHashMap<std::unique_ptr<int>> map;
+  for (int i = 0; i < 100; ++i) {
+    map.try_emplace(Key(i), std::make_unique<int>(i));
+  }
+  for (int i = 0; i < 100; i += 3) {
+    map.erase(Key(i));
+  }
+  for (int i = 1; i < 100; i += 3) {
+    EXPECT_EQ(i, *map.at(Key(i)));
+  }
+}
+
+TEST(StringHashMapTest, CopyAndMove) {
+  StringHashMap<int> map;
+  for (int i = 0; i < 100; ++i) {
+    map[Key(i)] = i;
+  }
+
+  StringHashMap<int> copy{map};
+  map["/extra"] = -1;
+  EXPECT_EQ(100u, copy.size());
+  EXPECT_FALSE(copy.contains("/extra"));
+  EXPECT_EQ(42, copy.at(Key(42)));
+
+  StringHashMap<int> moved{std::move(map)};
+  EXPECT_EQ(101u, moved.size());
+  EXPECT_EQ(-1, moved.at("/extra"));
+  EXPECT_TRUE(map.empty());  // NOLINT(bugprone-use-after-move)
+  map["/reused"] = 1;
+  EXPECT_EQ(1, map.at("/reused"));
+  EXPECT_EQ(-1, moved.at("/extra"));
+
+  copy = moved;
+  EXPECT_EQ(101u, copy.size());
+}
+
+TEST(StringHashMapTest, Clear) {
+  StringHashMap<int> map;
+  for (int i = 0; i < 100; ++i) {
+    map[Key(i)] = i;
+  }
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+  EXPECT_FALSE(map.contains(Key(5)));
+  map[Key(5)] = 5;
+  EXPECT_EQ(5, map.at(Key(5)));
+}
+
+}  // namespace
@@ -0,0 +1,318 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/sendable/SendableRegistry.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "wpi/sendable/Sendable.h"
+#include "wpi/sendable/SendableBuilder.h"
+
+namespace wpi::impl {
+void ResetSendableRegistry();
+}  // namespace wpi::impl
+
+namespace {
+class TestSendable : public wpi::Sendable {
+ public:
+  void InitSendable(wpi::SendableBuilder& builder) override {}
+};
+
+class TestBuilder : public wpi::SendableBuilder {
+ public:
+  void SetSmartDashboardType(std::string_view type) override {}
+  void SetActuator(bool value) override {}
+  void SetSafeState(std::function<void()> func) override {}
+  void AddBooleanProperty(std::string_view key, std::function<bool()> getter,
+                          std::function<void(bool)> setter) override {}
+  void PublishConstBoolean(std::string_view key, bool value) override {}
+  void AddIntegerProperty(std::string_view key,
+                          std::function<int64_t()> getter,
+                          std::function<void(int64_t)> setter) override {}
+  void PublishConstInteger(std::string_view key, int64_t value) override {}
+  void AddFloatProperty(std::string_view key, std::function<float()> getter,
+                        std::function<void(float)> setter) override {}
+  void PublishConstFloat(std::string_view key, float value) override {}
+  void AddDoubleProperty(std::string_view key, std::function<double()> getter,
+                         std::function<void(double)> setter) override {}
+  void PublishConstDouble(std::string_view key, double value) override {}
+  void AddStringProperty(
+      std::string_view key, std::function<std::string()> getter,
+      std::function<void(std::string_view)> setter) override {}
+  void PublishConstString(std::string_view key,
+                          std::string_view value) override {}
+  void AddBooleanArrayProperty(
+      std::string_view key, std::function<std::vector<int>()> getter,
+      std::function<void(std::span<const int>)> setter) override {}
+  void PublishConstBooleanArray(std::string_view key,
+                                std::span<const int> value) override {}
+  void AddIntegerArrayProperty(
+      std::string_view key, std::function<std::vector<int64_t>()> getter,
+      std::function<void(std::span<const int64_t>)> setter) override {}
+  void PublishConstIntegerArray(std::string_view key,
+                                std::span<const int64_t> value) override {}
+  void AddFloatArrayProperty(
+      std::string_view key, std::function<std::vector<float>()> getter,
+      std::function<void(std::span<const float>)> setter) override {}
+  void PublishConstFloatArray(std::string_view key,
+                              std::span<const float> value) override {}
+  void AddDoubleArrayProperty(
+      std::string_view key, std::function<std::vector<double>()> getter,
+      std::function<void(std::span<const double>)> setter) override {}
+  void PublishConstDoubleArray(std::string_view key,
+                               std::span<const double> value) override {}
+  void AddStringArrayProperty(
+      std::string_view key, std::function<std::vector<std::string>()> getter,
+      std::function<void(std::span<const std::string>)> setter) override {}
+  void PublishConstStringArray(std::string_view key,
+                               std::span<const std::string> value) override {}
+  void AddRawProperty(
+      std::string_view key, std::string_view typeString,
+      std::function<std::vector<uint8_t>()> getter,
+      std::function<void(std::span<const uint8_t>)> setter) override {}
+  void PublishConstRaw(std::string_view key, std::string_view typeString,
+                       std::span<const uint8_t> value) override {}
+  void AddSmallStringProperty(
+      std::string_view key,
+      std::function<std::string_view(wpi::SmallVectorImpl<char>& buf)> getter,
+      std::function<void(std::string_view)> setter) override {}
+  void AddSmallBooleanArrayProperty(
+      std::string_view key,
+      std::function<std::span<const int>(wpi::SmallVectorImpl<int>& buf)>
+          getter,
+      std::function<void(std::span<const int>)> setter) override {}
+  void AddSmallIntegerArrayProperty(
+      std::string_view key,
+      std::function<
+          std::span<const int64_t>(wpi::SmallVectorImpl<int64_t>& buf)>
+          getter,
+      std::function<void(std::span<const int64_t>)> setter) override {}
+  void AddSmallFloatArrayProperty(
+      std::string_view key,
+      std::function<std::span<const float>(wpi::SmallVectorImpl<float>& buf)>
+          getter,
+      std::function<void(std::span<const float>)> setter) override {}
+  void AddSmallDoubleArrayProperty(
+      std::string_view key,
+      std::function<std::span<const double>(wpi::SmallVectorImpl<double>& buf)>
+          getter,
+      std::function<void(std::span<const double>)> setter) override {}
+  void AddSmallStringArrayProperty(
+      std::string_view key,
+      std::function<
+          std::span<const std::string>(wpi::SmallVectorImpl<std::string>& buf)>
+          getter,
+      std::function<void(std::span<const std::string>)> setter) override {}
+  void AddSmallRawProperty(
+      std::string_view key, std::string_view typeString,
+      std::function<std::span<uint8_t>(wpi::SmallVectorImpl<uint8_t>& buf)>
+          getter,
+      std::function<void(std::span<const uint8_t>)> setter) override {}
+  BackendKind GetBackendKind() const override { return kUnknown; }
+  bool IsPublished() const override { return false; }
+  void Update() override {}
+  void ClearProperties() override {}
+};
+}  // namespace
+
+class SendableRegistryTest : public ::testing::Test {
+ protected:
+  SendableRegistryTest() {
+    wpi::impl::ResetSendableRegistry();
+    wpi::SendableRegistry::SetLiveWindowBuilderFactory(
+        [] { return std::make_unique<TestBuilder>(); });
+    m_dataHandle = wpi::SendableRegistry::GetDataHandle();
+  }
+
+  ~SendableRegistryTest() override { wpi::impl::ResetSendableRegistry(); }
+
+  std::vector<std::string> GetLiveWindowNames() {
+    std::vector<std::string> names;
+    wpi::SendableRegistry::ForeachLiveWindow(
+        m_dataHandle,
+        [&](auto& cbdata) { names.emplace_back(cbdata.name); });
+    return names;
+  }
+
+  int m_dataHandle;
+};
+
+TEST_F(SendableRegistryTest, ForeachLiveWindow) {
+  TestSendable a, b, c;
+  wpi::SendableRegistry::AddLW(&a, "a");
+  wpi::SendableRegistry::Add(&b, "b");
+  wpi::SendableRegistry::AddLW(&c, "Sub", "c");
+
+  int count = 0;
+  wpi::SendableRegistry::ForeachLiveWindow(m_dataHandle, [&](auto& cbdata) {
+    if (cbdata.sendable == &a) {
+      EXPECT_EQ(cbdata.name, "a");
+      EXPECT_EQ(cbdata.subsystem, "Ungrouped");
+    } else {
+      EXPECT_EQ(cbdata.sendable, &c);
+      EXPECT_EQ(cbdata.name, "c");
+      EXPECT_EQ(cbdata.subsystem, "Sub");
+    }
+    ++count;
+  });
+  EXPECT_EQ(count, 2);
+}
+
+TEST_F(SendableRegistryTest, ForeachLiveWindowData) {
+  TestSendable a;
+  wpi::SendableRegistry::AddLW(&a, "a");
+  auto data = std::make_shared<int>(5);
+  wpi::SendableRegistry::ForeachLiveWindow(
+      m_dataHandle, [&](auto& cbdata) { cbdata.data = data; });
+  EXPECT_EQ(wpi::SendableRegistry::GetData(&a, m_dataHandle), data);
+
+  // data for other handles doesn't affect it
+  int otherHandle = wpi::SendableRegistry::GetDataHandle();
+  wpi::SendableRegistry::SetData(&a, otherHandle, std::make_shared<int>(6));
+  wpi::SendableRegistry::ForeachLiveWindow(m_dataHandle, [&](auto& cbdata) {
+    EXPECT_EQ(cbdata.data, data);
+  });
+}
+
+TEST_F(SendableRegistryTest, ChangesSeenByNextCall) {
+  TestSendable a, b;
+  wpi::SendableRegistry::AddLW(&a, "a");
+  EXPECT_EQ(GetLiveWindowNames(), std::vector<std::string>{"a"});
+
+  wpi::SendableRegistry::SetName(&a, "a2");
+  EXPECT_EQ(GetLiveWindowNames(), std::vector<std::string>{"a2"});
+
+  wpi::SendableRegistry::AddLW(&b, "b");
+  wpi::SendableRegistry::DisableLiveWindow(&a);
+  EXPECT_EQ(GetLiveWindowNames(), std::vector<std::string>{"b"});
+
+  wpi::SendableRegistry::Remove(&b);
+  EXPECT_TRUE(GetLiveWindowNames().empty());
+}
+
+TEST_F(SendableRegistryTest, RegistryCallsFromCallback) {
+  TestSendable a, b;
+  wpi::SendableRegistry::AddLW(&a, "a");
+  wpi::SendableRegistry::AddLW(&b, "b");
+  int count = 0;
+  wpi::SendableRegistry::ForeachLiveWindow(m_dataHandle, [&](auto& cbdata) {
+    ++count;
+    wpi::SendableRegistry::SetName(cbdata.sendable, "renamed");
+    // removing the object being visited must not wait for itself
+    wpi::SendableRegistry::Remove(&a);
+  });
+  // b is visited even though the registry changed; a may be skipped if
+  // visited second, as it has been removed
+  EXPECT_GE(count, 1);
+  EXPECT_EQ(wpi::SendableRegistry::GetName(&b), "renamed");
+  EXPECT_FALSE(wpi::SendableRegistry::Contains(&a));
+}
+
+TEST_F(SendableRegistryTest, OtherThreadsDuringCallback) {
+  TestSendable a, b;
+  wpi::SendableRegistry::AddLW(&a, "a");
+  wpi::SendableRegistry::AddLW(&b, "b");
+
+  std::atomic<bool> inCallback{false};
+  std::atomic<bool> finishCallback{false};
+  std::thread loop{[&] {
+    wpi::SendableRegistry::ForeachLiveWindow(m_dataHandle, [&](auto& cbdata) {
+      if (cbdata.sendable != &a) {
+        return;
+      }
+      inCallback = true;
+      while (!finishCallback) {
+        std::this_thread::yield();
+      }
+    });
+  }};
+  while (!inCallback) {
+    std::this_thread::yield();
+  }
+
+  // registry changes don't wait for the iteration
+  wpi::SendableRegistry::SetName(&b, "b2");
+  TestSendable c;
+  wpi::SendableRegistry::AddLW(&c, "c");
+  wpi::SendableRegistry::Remove(&b);
+
+  // but removing the object being visited does
+  std::atomic<bool> removed{false};
+  std::thread remover{[&] {
+    wpi::SendableRegistry::Remove(&a);
+    removed = true;
+  }};
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(removed);
+  finishCallback = true;
+  remover.join();
+  loop.join();
+  EXPECT_TRUE(removed);
+
+  EXPECT_EQ(GetLiveWindowNames(), std::vector<std::string>{"c"});
+}
+
+namespace {
+// detects concurrent use of the builder
+class ConcurrencyBuilder : public TestBuilder {
+ public:
+  void Update() override {
+    if (m_active.fetch_add(1) != 0) {
+      m_overlapped = true;
+    }
+    std::this_thread::yield();
+    ++m_count;
+    m_active.fetch_sub(1);
+  }
+
+  std::atomic<int> m_active{0};
+  std::atomic<bool> m_overlapped{false};
+  int m_count = 0;
+};
+}  // namespace
+
+TEST_F(SendableRegistryTest, UpdateConcurrentWithForeachLiveWindow) {
+  ConcurrencyBuilder* builder = nullptr;
+  wpi::SendableRegistry::SetLiveWindowBuilderFactory([&] {
+    auto b = std::make_unique<ConcurrencyBuilder>();
+    builder = b.get();
+    return b;
+  });
+  TestSendable a;
+  wpi::SendableRegistry::AddLW(&a, "a");
+  auto uid = wpi::SendableRegistry::GetUniqueId(&a);
+  ASSERT_TRUE(builder);
+
+  constexpr int kIterations = 2000;
+  std::thread updater{[&] {
+    for (int i = 0; i < kIterations; ++i) {
+      wpi::SendableRegistry::Update(uid);
+    }
+  }};
+  std::thread dataUser{[&] {
+    for (int i = 0; i < kIterations; ++i) {
+      wpi::SendableRegistry::SetData(&a, m_dataHandle,
+                                     std::make_shared<int>(i));
+      wpi::SendableRegistry::GetData(&a, m_dataHandle);
+    }
+  }};
+  for (int i = 0; i < kIterations; ++i) {
+    wpi::SendableRegistry::ForeachLiveWindow(m_dataHandle, [&](auto& cbdata) {
+      cbdata.builder.Update();
+      cbdata.data = std::make_shared<int>(-i);
+    });
+  }
+  updater.join();
+  dataUser.join();
+
+  EXPECT_FALSE(builder->m_overlapped);
+  EXPECT_EQ(builder->m_count, 2 * kIterations);
+}